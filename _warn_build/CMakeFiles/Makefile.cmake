@@ -0,0 +1,241 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeASMCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/dynamic-od/CMakeLists.txt"
+  "/root/repo/examples/quickstart/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/integration/CMakeLists.txt"
+  "/root/repo/tests/unit/CMakeLists.txt"
+  "/root/repo/tests/unit/core/CMakeLists.txt"
+  "/root/repo/tests/unit/core/crc/CMakeLists.txt"
+  "/root/repo/tests/unit/core/crc/calc/CMakeLists.txt"
+  "/root/repo/tests/unit/core/dict/CMakeLists.txt"
+  "/root/repo/tests/unit/core/dict/find/CMakeLists.txt"
+  "/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt"
+  "/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt"
+  "/root/repo/tests/unit/core/dict/range/CMakeLists.txt"
+  "/root/repo/tests/unit/core/dict/ref/CMakeLists.txt"
+  "/root/repo/tests/unit/core/disp/CMakeLists.txt"
+  "/root/repo/tests/unit/core/disp/find/CMakeLists.txt"
+  "/root/repo/tests/unit/core/tmr/CMakeLists.txt"
+  "/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt"
+  "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt"
+  "/root/repo/tests/unit/core/tmr/min_time/CMakeLists.txt"
+  "/root/repo/tests/unit/hal/CMakeLists.txt"
+  "/root/repo/tests/unit/hal/can/CMakeLists.txt"
+  "/root/repo/tests/unit/hal/can/ctx/CMakeLists.txt"
+  "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt"
+  "/root/repo/tests/unit/hal/can/ring/CMakeLists.txt"
+  "/root/repo/tests/unit/hal/can/stamp/CMakeLists.txt"
+  "/root/repo/tests/unit/hal/can/txq/CMakeLists.txt"
+  "/root/repo/tests/unit/object/CMakeLists.txt"
+  "/root/repo/tests/unit/object/basic/CMakeLists.txt"
+  "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt"
+  "/root/repo/tests/unit/object/basic/co_signed16/CMakeLists.txt"
+  "/root/repo/tests/unit/object/basic/co_signed32/CMakeLists.txt"
+  "/root/repo/tests/unit/object/basic/co_signed8/CMakeLists.txt"
+  "/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt"
+  "/root/repo/tests/unit/object/basic/co_unsigned16/CMakeLists.txt"
+  "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt"
+  "/root/repo/tests/unit/object/basic/co_unsigned8/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_emcy_id/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_sdo_id/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt"
+  "/root/repo/tests/unit/object/cia301/co_sync_id/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeASMInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-ASM.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/quickstart/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/dynamic-od/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/crc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/crc/calc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/dict/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/dict/find/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/dict/lookup/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/dict/overlay/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/dict/range/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/dict/ref/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/disp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/disp/find/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/tmr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/tmr/get_ticks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/tmr/min_time/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/core/tmr/backend/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/hal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/hal/can/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/hal/can/fd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/hal/can/txq/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/hal/can/stamp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/hal/can/ctx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/hal/can/ring/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/basic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/basic/co_domain/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/basic/co_signed8/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/basic/co_signed16/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/basic/co_signed32/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/basic/co_string/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/basic/co_unsigned8/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/basic/co_unsigned16/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/basic/co_unsigned32/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_emcy_hist/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_emcy_id/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_hb_cons/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_hb_cons_engine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_hb_prod/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_para_async/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_para_log/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_para_store/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_para_restore/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_pdo_event/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_pdo_id/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_pdo_map/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_pdo_num/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_pdo_type/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_sdo_id/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_sync_cycle/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/object/cia301/co_sync_id/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/integration/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/canopen-stack_package.dir/DependInfo.cmake"
+  "src/CMakeFiles/canopen-stack.dir/DependInfo.cmake"
+  "examples/quickstart/CMakeFiles/demo-quickstart.dir/DependInfo.cmake"
+  "examples/dynamic-od/CMakeFiles/demo-dynamic-od.dir/DependInfo.cmake"
+  "tests/CMakeFiles/bench.dir/DependInfo.cmake"
+  "tests/unit/core/crc/calc/CMakeFiles/ut-crc-calc.dir/DependInfo.cmake"
+  "tests/unit/core/crc/calc/CMakeFiles/bench-crc-calc.dir/DependInfo.cmake"
+  "tests/unit/core/dict/find/CMakeFiles/ut-dict-find.dir/DependInfo.cmake"
+  "tests/unit/core/dict/lookup/CMakeFiles/ut-canopen-stack-dict-index.dir/DependInfo.cmake"
+  "tests/unit/core/dict/lookup/CMakeFiles/ut-dict-lookup.dir/DependInfo.cmake"
+  "tests/unit/core/dict/lookup/CMakeFiles/ut-dict-lookup-index.dir/DependInfo.cmake"
+  "tests/unit/core/dict/lookup/CMakeFiles/bench-dict-lookup.dir/DependInfo.cmake"
+  "tests/unit/core/dict/overlay/CMakeFiles/ut-canopen-stack-dict-overlay.dir/DependInfo.cmake"
+  "tests/unit/core/dict/overlay/CMakeFiles/ut-dict-overlay.dir/DependInfo.cmake"
+  "tests/unit/core/dict/range/CMakeFiles/ut-canopen-stack-obj-range.dir/DependInfo.cmake"
+  "tests/unit/core/dict/range/CMakeFiles/ut-dict-range.dir/DependInfo.cmake"
+  "tests/unit/core/dict/ref/CMakeFiles/ut-dict-ref.dir/DependInfo.cmake"
+  "tests/unit/core/disp/find/CMakeFiles/ut-canopen-stack-disp.dir/DependInfo.cmake"
+  "tests/unit/core/disp/find/CMakeFiles/ut-disp-find.dir/DependInfo.cmake"
+  "tests/unit/core/disp/find/CMakeFiles/bench-disp-find.dir/DependInfo.cmake"
+  "tests/unit/core/tmr/get_ticks/CMakeFiles/ut-tmr-get-ticks.dir/DependInfo.cmake"
+  "tests/unit/core/tmr/min_time/CMakeFiles/ut-tmr-min-time.dir/DependInfo.cmake"
+  "tests/unit/core/tmr/backend/CMakeFiles/ut-canopen-stack-wheel.dir/DependInfo.cmake"
+  "tests/unit/core/tmr/backend/CMakeFiles/ut-tmr-backend.dir/DependInfo.cmake"
+  "tests/unit/core/tmr/backend/CMakeFiles/ut-tmr-backend-wheel.dir/DependInfo.cmake"
+  "tests/unit/core/tmr/backend/CMakeFiles/bench-tmr-backend.dir/DependInfo.cmake"
+  "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/DependInfo.cmake"
+  "tests/unit/hal/can/fd/CMakeFiles/ut-can-fd.dir/DependInfo.cmake"
+  "tests/unit/hal/can/fd/CMakeFiles/ut-can-fd-fd.dir/DependInfo.cmake"
+  "tests/unit/hal/can/fd/CMakeFiles/bench-can-fd.dir/DependInfo.cmake"
+  "tests/unit/hal/can/txq/CMakeFiles/ut-canopen-stack-txq.dir/DependInfo.cmake"
+  "tests/unit/hal/can/txq/CMakeFiles/ut-can-txq.dir/DependInfo.cmake"
+  "tests/unit/hal/can/stamp/CMakeFiles/ut-canopen-stack-stamp.dir/DependInfo.cmake"
+  "tests/unit/hal/can/stamp/CMakeFiles/ut-can-stamp.dir/DependInfo.cmake"
+  "tests/unit/hal/can/ctx/CMakeFiles/ut-canopen-stack-ctx.dir/DependInfo.cmake"
+  "tests/unit/hal/can/ctx/CMakeFiles/ut-can-ctx.dir/DependInfo.cmake"
+  "tests/unit/hal/can/ring/CMakeFiles/ut-can-ring.dir/DependInfo.cmake"
+  "tests/unit/hal/can/ring/CMakeFiles/bench-can-ring.dir/DependInfo.cmake"
+  "tests/unit/object/basic/co_domain/CMakeFiles/ut-domain.dir/DependInfo.cmake"
+  "tests/unit/object/basic/co_domain/CMakeFiles/bench-domain.dir/DependInfo.cmake"
+  "tests/unit/object/basic/co_signed8/CMakeFiles/ut-signed8.dir/DependInfo.cmake"
+  "tests/unit/object/basic/co_signed16/CMakeFiles/ut-signed16.dir/DependInfo.cmake"
+  "tests/unit/object/basic/co_signed32/CMakeFiles/ut-signed32.dir/DependInfo.cmake"
+  "tests/unit/object/basic/co_string/CMakeFiles/ut-string.dir/DependInfo.cmake"
+  "tests/unit/object/basic/co_unsigned8/CMakeFiles/ut-unsigned8.dir/DependInfo.cmake"
+  "tests/unit/object/basic/co_unsigned16/CMakeFiles/ut-unsigned16.dir/DependInfo.cmake"
+  "tests/unit/object/basic/co_unsigned32/CMakeFiles/ut-unsigned32.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_emcy_hist/CMakeFiles/ut-emcy-hist.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_emcy_id/CMakeFiles/ut-emcy-id.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_hb_cons/CMakeFiles/ut-hb-cons.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_hb_cons_engine/CMakeFiles/ut-canopen-stack-hbc.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_hb_cons_engine/CMakeFiles/ut-hb-cons-engine.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_hb_cons_engine/CMakeFiles/ut-hb-cons-engine-table.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_hb_cons_engine/CMakeFiles/bench-hb-cons-engine.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_hb_prod/CMakeFiles/ut-hb-prod.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_para_async/CMakeFiles/ut-canopen-stack-para-async.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_para_async/CMakeFiles/ut-para-async.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_para_log/CMakeFiles/ut-canopen-stack-para-log.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_para_log/CMakeFiles/ut-para-log.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_para_store/CMakeFiles/ut-para-store.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_para_restore/CMakeFiles/ut-para-restore.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_pdo_event/CMakeFiles/ut-pdo-event.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_pdo_id/CMakeFiles/ut-pdo-id.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_pdo_map/CMakeFiles/ut-pdo-map.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_pdo_num/CMakeFiles/ut-pdo-num.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_pdo_type/CMakeFiles/ut-pdo-type.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_sdo_id/CMakeFiles/ut-sdo-id.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_sync_cycle/CMakeFiles/ut-sync-cycle.dir/DependInfo.cmake"
+  "tests/unit/object/cia301/co_sync_id/CMakeFiles/ut-sync-id.dir/DependInfo.cmake"
+  "tests/integration/CMakeFiles/it-canopen-stack.dir/DependInfo.cmake"
+  "tests/integration/CMakeFiles/it-canopen-stack-opt.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/canopen-stack_package"
+  "canopen-stack-src.zip"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/canopen-stack_package.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/dynamic-od/app/clock_app.c" "examples/dynamic-od/CMakeFiles/demo-dynamic-od.dir/app/clock_app.c.o" "gcc" "examples/dynamic-od/CMakeFiles/demo-dynamic-od.dir/app/clock_app.c.o.d"
+  "/root/repo/examples/dynamic-od/app/clock_dict.c" "examples/dynamic-od/CMakeFiles/demo-dynamic-od.dir/app/clock_dict.c.o" "gcc" "examples/dynamic-od/CMakeFiles/demo-dynamic-od.dir/app/clock_dict.c.o.d"
+  "/root/repo/examples/dynamic-od/app/clock_spec.c" "examples/dynamic-od/CMakeFiles/demo-dynamic-od.dir/app/clock_spec.c.o" "gcc" "examples/dynamic-od/CMakeFiles/demo-dynamic-od.dir/app/clock_spec.c.o.d"
+  "/root/repo/examples/dynamic-od/driver/drv_can_sim.c" "examples/dynamic-od/CMakeFiles/demo-dynamic-od.dir/driver/drv_can_sim.c.o" "gcc" "examples/dynamic-od/CMakeFiles/demo-dynamic-od.dir/driver/drv_can_sim.c.o.d"
+  "/root/repo/examples/dynamic-od/driver/drv_nvm_sim.c" "examples/dynamic-od/CMakeFiles/demo-dynamic-od.dir/driver/drv_nvm_sim.c.o" "gcc" "examples/dynamic-od/CMakeFiles/demo-dynamic-od.dir/driver/drv_nvm_sim.c.o.d"
+  "/root/repo/examples/dynamic-od/driver/drv_timer_swcycle.c" "examples/dynamic-od/CMakeFiles/demo-dynamic-od.dir/driver/drv_timer_swcycle.c.o" "gcc" "examples/dynamic-od/CMakeFiles/demo-dynamic-od.dir/driver/drv_timer_swcycle.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/src/CMakeFiles/canopen-stack.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
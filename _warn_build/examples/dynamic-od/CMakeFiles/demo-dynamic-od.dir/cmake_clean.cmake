@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/demo-dynamic-od.dir/app/clock_app.c.o"
+  "CMakeFiles/demo-dynamic-od.dir/app/clock_app.c.o.d"
+  "CMakeFiles/demo-dynamic-od.dir/app/clock_dict.c.o"
+  "CMakeFiles/demo-dynamic-od.dir/app/clock_dict.c.o.d"
+  "CMakeFiles/demo-dynamic-od.dir/app/clock_spec.c.o"
+  "CMakeFiles/demo-dynamic-od.dir/app/clock_spec.c.o.d"
+  "CMakeFiles/demo-dynamic-od.dir/driver/drv_can_sim.c.o"
+  "CMakeFiles/demo-dynamic-od.dir/driver/drv_can_sim.c.o.d"
+  "CMakeFiles/demo-dynamic-od.dir/driver/drv_nvm_sim.c.o"
+  "CMakeFiles/demo-dynamic-od.dir/driver/drv_nvm_sim.c.o.d"
+  "CMakeFiles/demo-dynamic-od.dir/driver/drv_timer_swcycle.c.o"
+  "CMakeFiles/demo-dynamic-od.dir/driver/drv_timer_swcycle.c.o.d"
+  "demo-dynamic-od"
+  "demo-dynamic-od.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/demo-dynamic-od.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
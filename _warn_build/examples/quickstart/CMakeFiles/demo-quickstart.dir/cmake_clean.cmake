@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/demo-quickstart.dir/app/clock_app.c.o"
+  "CMakeFiles/demo-quickstart.dir/app/clock_app.c.o.d"
+  "CMakeFiles/demo-quickstart.dir/app/clock_spec.c.o"
+  "CMakeFiles/demo-quickstart.dir/app/clock_spec.c.o.d"
+  "CMakeFiles/demo-quickstart.dir/driver/drv_can_sim.c.o"
+  "CMakeFiles/demo-quickstart.dir/driver/drv_can_sim.c.o.d"
+  "CMakeFiles/demo-quickstart.dir/driver/drv_nvm_sim.c.o"
+  "CMakeFiles/demo-quickstart.dir/driver/drv_nvm_sim.c.o.d"
+  "CMakeFiles/demo-quickstart.dir/driver/drv_timer_swcycle.c.o"
+  "CMakeFiles/demo-quickstart.dir/driver/drv_timer_swcycle.c.o.d"
+  "demo-quickstart"
+  "demo-quickstart.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/demo-quickstart.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
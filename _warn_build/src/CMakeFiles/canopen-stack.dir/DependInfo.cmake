@@ -0,0 +1,61 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/config/callbacks.c" "src/CMakeFiles/canopen-stack.dir/config/callbacks.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/config/callbacks.c.o.d"
+  "/root/repo/src/core/co_core.c" "src/CMakeFiles/canopen-stack.dir/core/co_core.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/core/co_core.c.o.d"
+  "/root/repo/src/core/co_crc.c" "src/CMakeFiles/canopen-stack.dir/core/co_crc.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/core/co_crc.c.o.d"
+  "/root/repo/src/core/co_dict.c" "src/CMakeFiles/canopen-stack.dir/core/co_dict.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/core/co_dict.c.o.d"
+  "/root/repo/src/core/co_disp.c" "src/CMakeFiles/canopen-stack.dir/core/co_disp.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/core/co_disp.c.o.d"
+  "/root/repo/src/core/co_filter.c" "src/CMakeFiles/canopen-stack.dir/core/co_filter.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/core/co_filter.c.o.d"
+  "/root/repo/src/core/co_nmt.c" "src/CMakeFiles/canopen-stack.dir/core/co_nmt.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/core/co_nmt.c.o.d"
+  "/root/repo/src/core/co_obj.c" "src/CMakeFiles/canopen-stack.dir/core/co_obj.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/core/co_obj.c.o.d"
+  "/root/repo/src/core/co_tmr.c" "src/CMakeFiles/canopen-stack.dir/core/co_tmr.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/core/co_tmr.c.o.d"
+  "/root/repo/src/core/co_ver.c" "src/CMakeFiles/canopen-stack.dir/core/co_ver.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/core/co_ver.c.o.d"
+  "/root/repo/src/hal/co_if.c" "src/CMakeFiles/canopen-stack.dir/hal/co_if.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/hal/co_if.c.o.d"
+  "/root/repo/src/hal/co_if_can.c" "src/CMakeFiles/canopen-stack.dir/hal/co_if_can.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/hal/co_if_can.c.o.d"
+  "/root/repo/src/hal/co_if_can_ring.c" "src/CMakeFiles/canopen-stack.dir/hal/co_if_can_ring.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/hal/co_if_can_ring.c.o.d"
+  "/root/repo/src/hal/co_if_nvm.c" "src/CMakeFiles/canopen-stack.dir/hal/co_if_nvm.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/hal/co_if_nvm.c.o.d"
+  "/root/repo/src/hal/co_if_ring.c" "src/CMakeFiles/canopen-stack.dir/hal/co_if_ring.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/hal/co_if_ring.c.o.d"
+  "/root/repo/src/hal/co_if_timer.c" "src/CMakeFiles/canopen-stack.dir/hal/co_if_timer.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/hal/co_if_timer.c.o.d"
+  "/root/repo/src/object/basic/co_domain.c" "src/CMakeFiles/canopen-stack.dir/object/basic/co_domain.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/basic/co_domain.c.o.d"
+  "/root/repo/src/object/basic/co_integer16.c" "src/CMakeFiles/canopen-stack.dir/object/basic/co_integer16.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/basic/co_integer16.c.o.d"
+  "/root/repo/src/object/basic/co_integer32.c" "src/CMakeFiles/canopen-stack.dir/object/basic/co_integer32.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/basic/co_integer32.c.o.d"
+  "/root/repo/src/object/basic/co_integer8.c" "src/CMakeFiles/canopen-stack.dir/object/basic/co_integer8.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/basic/co_integer8.c.o.d"
+  "/root/repo/src/object/basic/co_range.c" "src/CMakeFiles/canopen-stack.dir/object/basic/co_range.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/basic/co_range.c.o.d"
+  "/root/repo/src/object/basic/co_string.c" "src/CMakeFiles/canopen-stack.dir/object/basic/co_string.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/basic/co_string.c.o.d"
+  "/root/repo/src/object/cia301/co_emcy_hist.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_emcy_hist.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_emcy_hist.c.o.d"
+  "/root/repo/src/object/cia301/co_emcy_id.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_emcy_id.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_emcy_id.c.o.d"
+  "/root/repo/src/object/cia301/co_hb_cons.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_hb_cons.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_hb_cons.c.o.d"
+  "/root/repo/src/object/cia301/co_hb_prod.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_hb_prod.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_hb_prod.c.o.d"
+  "/root/repo/src/object/cia301/co_para_log.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_para_log.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_para_log.c.o.d"
+  "/root/repo/src/object/cia301/co_para_restore.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_para_restore.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_para_restore.c.o.d"
+  "/root/repo/src/object/cia301/co_para_store.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_para_store.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_para_store.c.o.d"
+  "/root/repo/src/object/cia301/co_pdo_event.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_event.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_event.c.o.d"
+  "/root/repo/src/object/cia301/co_pdo_id.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_id.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_id.c.o.d"
+  "/root/repo/src/object/cia301/co_pdo_map.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_map.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_map.c.o.d"
+  "/root/repo/src/object/cia301/co_pdo_num.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_num.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_num.c.o.d"
+  "/root/repo/src/object/cia301/co_pdo_type.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_type.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_type.c.o.d"
+  "/root/repo/src/object/cia301/co_sdo_id.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_sdo_id.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_sdo_id.c.o.d"
+  "/root/repo/src/object/cia301/co_sync_cycle.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_sync_cycle.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_sync_cycle.c.o.d"
+  "/root/repo/src/object/cia301/co_sync_id.c" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_sync_id.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/object/cia301/co_sync_id.c.o.d"
+  "/root/repo/src/service/cia301/co_csdo.c" "src/CMakeFiles/canopen-stack.dir/service/cia301/co_csdo.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/service/cia301/co_csdo.c.o.d"
+  "/root/repo/src/service/cia301/co_emcy.c" "src/CMakeFiles/canopen-stack.dir/service/cia301/co_emcy.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/service/cia301/co_emcy.c.o.d"
+  "/root/repo/src/service/cia301/co_pdo.c" "src/CMakeFiles/canopen-stack.dir/service/cia301/co_pdo.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/service/cia301/co_pdo.c.o.d"
+  "/root/repo/src/service/cia301/co_ssdo.c" "src/CMakeFiles/canopen-stack.dir/service/cia301/co_ssdo.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/service/cia301/co_ssdo.c.o.d"
+  "/root/repo/src/service/cia301/co_sync.c" "src/CMakeFiles/canopen-stack.dir/service/cia301/co_sync.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/service/cia301/co_sync.c.o.d"
+  "/root/repo/src/service/cia305/co_lss.c" "src/CMakeFiles/canopen-stack.dir/service/cia305/co_lss.c.o" "gcc" "src/CMakeFiles/canopen-stack.dir/service/cia305/co_lss.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
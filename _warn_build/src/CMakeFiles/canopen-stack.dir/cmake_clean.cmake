@@ -0,0 +1,95 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/canopen-stack.dir/config/callbacks.c.o"
+  "CMakeFiles/canopen-stack.dir/config/callbacks.c.o.d"
+  "CMakeFiles/canopen-stack.dir/core/co_core.c.o"
+  "CMakeFiles/canopen-stack.dir/core/co_core.c.o.d"
+  "CMakeFiles/canopen-stack.dir/core/co_crc.c.o"
+  "CMakeFiles/canopen-stack.dir/core/co_crc.c.o.d"
+  "CMakeFiles/canopen-stack.dir/core/co_dict.c.o"
+  "CMakeFiles/canopen-stack.dir/core/co_dict.c.o.d"
+  "CMakeFiles/canopen-stack.dir/core/co_disp.c.o"
+  "CMakeFiles/canopen-stack.dir/core/co_disp.c.o.d"
+  "CMakeFiles/canopen-stack.dir/core/co_filter.c.o"
+  "CMakeFiles/canopen-stack.dir/core/co_filter.c.o.d"
+  "CMakeFiles/canopen-stack.dir/core/co_nmt.c.o"
+  "CMakeFiles/canopen-stack.dir/core/co_nmt.c.o.d"
+  "CMakeFiles/canopen-stack.dir/core/co_obj.c.o"
+  "CMakeFiles/canopen-stack.dir/core/co_obj.c.o.d"
+  "CMakeFiles/canopen-stack.dir/core/co_tmr.c.o"
+  "CMakeFiles/canopen-stack.dir/core/co_tmr.c.o.d"
+  "CMakeFiles/canopen-stack.dir/core/co_ver.c.o"
+  "CMakeFiles/canopen-stack.dir/core/co_ver.c.o.d"
+  "CMakeFiles/canopen-stack.dir/hal/co_if.c.o"
+  "CMakeFiles/canopen-stack.dir/hal/co_if.c.o.d"
+  "CMakeFiles/canopen-stack.dir/hal/co_if_can.c.o"
+  "CMakeFiles/canopen-stack.dir/hal/co_if_can.c.o.d"
+  "CMakeFiles/canopen-stack.dir/hal/co_if_can_ring.c.o"
+  "CMakeFiles/canopen-stack.dir/hal/co_if_can_ring.c.o.d"
+  "CMakeFiles/canopen-stack.dir/hal/co_if_nvm.c.o"
+  "CMakeFiles/canopen-stack.dir/hal/co_if_nvm.c.o.d"
+  "CMakeFiles/canopen-stack.dir/hal/co_if_ring.c.o"
+  "CMakeFiles/canopen-stack.dir/hal/co_if_ring.c.o.d"
+  "CMakeFiles/canopen-stack.dir/hal/co_if_timer.c.o"
+  "CMakeFiles/canopen-stack.dir/hal/co_if_timer.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/basic/co_domain.c.o"
+  "CMakeFiles/canopen-stack.dir/object/basic/co_domain.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/basic/co_integer16.c.o"
+  "CMakeFiles/canopen-stack.dir/object/basic/co_integer16.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/basic/co_integer32.c.o"
+  "CMakeFiles/canopen-stack.dir/object/basic/co_integer32.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/basic/co_integer8.c.o"
+  "CMakeFiles/canopen-stack.dir/object/basic/co_integer8.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/basic/co_range.c.o"
+  "CMakeFiles/canopen-stack.dir/object/basic/co_range.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/basic/co_string.c.o"
+  "CMakeFiles/canopen-stack.dir/object/basic/co_string.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_emcy_hist.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_emcy_hist.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_emcy_id.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_emcy_id.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_hb_cons.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_hb_cons.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_hb_prod.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_hb_prod.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_para_log.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_para_log.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_para_restore.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_para_restore.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_para_store.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_para_store.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_event.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_event.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_id.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_id.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_map.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_map.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_num.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_num.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_type.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_pdo_type.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_sdo_id.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_sdo_id.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_sync_cycle.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_sync_cycle.c.o.d"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_sync_id.c.o"
+  "CMakeFiles/canopen-stack.dir/object/cia301/co_sync_id.c.o.d"
+  "CMakeFiles/canopen-stack.dir/service/cia301/co_csdo.c.o"
+  "CMakeFiles/canopen-stack.dir/service/cia301/co_csdo.c.o.d"
+  "CMakeFiles/canopen-stack.dir/service/cia301/co_emcy.c.o"
+  "CMakeFiles/canopen-stack.dir/service/cia301/co_emcy.c.o.d"
+  "CMakeFiles/canopen-stack.dir/service/cia301/co_pdo.c.o"
+  "CMakeFiles/canopen-stack.dir/service/cia301/co_pdo.c.o.d"
+  "CMakeFiles/canopen-stack.dir/service/cia301/co_ssdo.c.o"
+  "CMakeFiles/canopen-stack.dir/service/cia301/co_ssdo.c.o.d"
+  "CMakeFiles/canopen-stack.dir/service/cia301/co_sync.c.o"
+  "CMakeFiles/canopen-stack.dir/service/cia301/co_sync.c.o.d"
+  "CMakeFiles/canopen-stack.dir/service/cia305/co_lss.c.o"
+  "CMakeFiles/canopen-stack.dir/service/cia305/co_lss.c.o.d"
+  "libcanopen-stack.a"
+  "libcanopen-stack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/canopen-stack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
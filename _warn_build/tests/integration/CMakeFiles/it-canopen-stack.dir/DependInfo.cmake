@@ -0,0 +1,68 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/integration/app/app.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/app/app.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/app/app.c.o.d"
+  "/root/repo/tests/integration/app/app_dict.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/app/app_dict.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/app/app_dict.c.o.d"
+  "/root/repo/tests/integration/app/app_dom.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/app/app_dom.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/app/app_dom.c.o.d"
+  "/root/repo/tests/integration/app/app_emcy.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/app/app_emcy.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/app/app_emcy.c.o.d"
+  "/root/repo/tests/integration/app/app_env.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/app/app_env.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/app/app_env.c.o.d"
+  "/root/repo/tests/integration/app/app_hooks.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/app/app_hooks.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/app/app_hooks.c.o.d"
+  "/root/repo/tests/integration/driver/drv_can_sim.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/driver/drv_can_sim.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/driver/drv_can_sim.c.o.d"
+  "/root/repo/tests/integration/driver/drv_nvm_sim.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/driver/drv_nvm_sim.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/driver/drv_nvm_sim.c.o.d"
+  "/root/repo/tests/integration/driver/drv_timer_swcycle.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/driver/drv_timer_swcycle.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/driver/drv_timer_swcycle.c.o.d"
+  "/root/repo/tests/integration/testfrm/ts_context.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_context.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_context.c.o.d"
+  "/root/repo/tests/integration/testfrm/ts_env.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_env.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_env.c.o.d"
+  "/root/repo/tests/integration/testfrm/ts_list.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_list.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_list.c.o.d"
+  "/root/repo/tests/integration/testfrm/ts_lock.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_lock.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_lock.c.o.d"
+  "/root/repo/tests/integration/testfrm/ts_mem.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_mem.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_mem.c.o.d"
+  "/root/repo/tests/integration/testfrm/ts_output.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_output.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_output.c.o.d"
+  "/root/repo/tests/integration/testfrm/ts_pipe.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_pipe.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_pipe.c.o.d"
+  "/root/repo/tests/integration/testfrm/ts_printf.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_printf.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_printf.c.o.d"
+  "/root/repo/tests/integration/testfrm/ts_version.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_version.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/testfrm/ts_version.c.o.d"
+  "/root/repo/tests/integration/tests/core_batch.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/core_batch.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/core_batch.c.o.d"
+  "/root/repo/tests/integration/tests/core_ctx.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/core_ctx.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/core_ctx.c.o.d"
+  "/root/repo/tests/integration/tests/core_filter.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/core_filter.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/core_filter.c.o.d"
+  "/root/repo/tests/integration/tests/core_tmr.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/core_tmr.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/core_tmr.c.o.d"
+  "/root/repo/tests/integration/tests/core_txcfm.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/core_txcfm.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/core_txcfm.c.o.d"
+  "/root/repo/tests/integration/tests/emcy_api.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/emcy_api.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/emcy_api.c.o.d"
+  "/root/repo/tests/integration/tests/emcy_err.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/emcy_err.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/emcy_err.c.o.d"
+  "/root/repo/tests/integration/tests/emcy_hist.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/emcy_hist.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/emcy_hist.c.o.d"
+  "/root/repo/tests/integration/tests/emcy_state.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/emcy_state.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/emcy_state.c.o.d"
+  "/root/repo/tests/integration/tests/nmt_hbc.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/nmt_hbc.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/nmt_hbc.c.o.d"
+  "/root/repo/tests/integration/tests/nmt_hbp.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/nmt_hbp.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/nmt_hbp.c.o.d"
+  "/root/repo/tests/integration/tests/nmt_lss.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/nmt_lss.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/nmt_lss.c.o.d"
+  "/root/repo/tests/integration/tests/nmt_mgr.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/nmt_mgr.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/nmt_mgr.c.o.d"
+  "/root/repo/tests/integration/tests/od_api.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/od_api.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/od_api.c.o.d"
+  "/root/repo/tests/integration/tests/od_para.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/od_para.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/od_para.c.o.d"
+  "/root/repo/tests/integration/tests/pdo_dyn.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/pdo_dyn.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/pdo_dyn.c.o.d"
+  "/root/repo/tests/integration/tests/pdo_rx.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/pdo_rx.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/pdo_rx.c.o.d"
+  "/root/repo/tests/integration/tests/pdo_tx.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/pdo_tx.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/pdo_tx.c.o.d"
+  "/root/repo/tests/integration/tests/sdoc_blk_down.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdoc_blk_down.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdoc_blk_down.c.o.d"
+  "/root/repo/tests/integration/tests/sdoc_blk_up.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdoc_blk_up.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdoc_blk_up.c.o.d"
+  "/root/repo/tests/integration/tests/sdoc_exp_down.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdoc_exp_down.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdoc_exp_down.c.o.d"
+  "/root/repo/tests/integration/tests/sdoc_exp_up.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdoc_exp_up.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdoc_exp_up.c.o.d"
+  "/root/repo/tests/integration/tests/sdoc_seg_down.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdoc_seg_down.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdoc_seg_down.c.o.d"
+  "/root/repo/tests/integration/tests/sdoc_seg_up.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdoc_seg_up.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdoc_seg_up.c.o.d"
+  "/root/repo/tests/integration/tests/sdos_blk_down.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdos_blk_down.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdos_blk_down.c.o.d"
+  "/root/repo/tests/integration/tests/sdos_blk_up.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdos_blk_up.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdos_blk_up.c.o.d"
+  "/root/repo/tests/integration/tests/sdos_exp_down.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdos_exp_down.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdos_exp_down.c.o.d"
+  "/root/repo/tests/integration/tests/sdos_exp_up.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdos_exp_up.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdos_exp_up.c.o.d"
+  "/root/repo/tests/integration/tests/sdos_seg_down.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdos_seg_down.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdos_seg_down.c.o.d"
+  "/root/repo/tests/integration/tests/sdos_seg_up.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdos_seg_up.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sdos_seg_up.c.o.d"
+  "/root/repo/tests/integration/tests/sync_prod.c" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sync_prod.c.o" "gcc" "tests/integration/CMakeFiles/it-canopen-stack.dir/tests/sync_prod.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/tests/integration/CMakeFiles/it-canopen-stack-opt.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,107 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/it-canopen-stack.dir/app/app.c.o"
+  "CMakeFiles/it-canopen-stack.dir/app/app.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/app/app_dict.c.o"
+  "CMakeFiles/it-canopen-stack.dir/app/app_dict.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/app/app_dom.c.o"
+  "CMakeFiles/it-canopen-stack.dir/app/app_dom.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/app/app_emcy.c.o"
+  "CMakeFiles/it-canopen-stack.dir/app/app_emcy.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/app/app_env.c.o"
+  "CMakeFiles/it-canopen-stack.dir/app/app_env.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/app/app_hooks.c.o"
+  "CMakeFiles/it-canopen-stack.dir/app/app_hooks.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/driver/drv_can_sim.c.o"
+  "CMakeFiles/it-canopen-stack.dir/driver/drv_can_sim.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/driver/drv_nvm_sim.c.o"
+  "CMakeFiles/it-canopen-stack.dir/driver/drv_nvm_sim.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/driver/drv_timer_swcycle.c.o"
+  "CMakeFiles/it-canopen-stack.dir/driver/drv_timer_swcycle.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_context.c.o"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_context.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_env.c.o"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_env.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_list.c.o"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_list.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_lock.c.o"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_lock.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_mem.c.o"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_mem.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_output.c.o"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_output.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_pipe.c.o"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_pipe.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_printf.c.o"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_printf.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_version.c.o"
+  "CMakeFiles/it-canopen-stack.dir/testfrm/ts_version.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/core_batch.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/core_batch.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/core_ctx.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/core_ctx.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/core_filter.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/core_filter.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/core_tmr.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/core_tmr.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/core_txcfm.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/core_txcfm.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/emcy_api.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/emcy_api.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/emcy_err.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/emcy_err.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/emcy_hist.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/emcy_hist.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/emcy_state.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/emcy_state.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/nmt_hbc.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/nmt_hbc.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/nmt_hbp.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/nmt_hbp.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/nmt_lss.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/nmt_lss.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/nmt_mgr.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/nmt_mgr.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/od_api.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/od_api.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/od_para.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/od_para.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/pdo_dyn.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/pdo_dyn.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/pdo_rx.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/pdo_rx.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/pdo_tx.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/pdo_tx.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdoc_blk_down.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdoc_blk_down.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdoc_blk_up.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdoc_blk_up.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdoc_exp_down.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdoc_exp_down.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdoc_exp_up.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdoc_exp_up.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdoc_seg_down.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdoc_seg_down.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdoc_seg_up.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdoc_seg_up.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdos_blk_down.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdos_blk_down.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdos_blk_up.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdos_blk_up.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdos_exp_down.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdos_exp_down.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdos_exp_up.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdos_exp_up.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdos_seg_down.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdos_seg_down.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdos_seg_up.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/sdos_seg_up.c.o.d"
+  "CMakeFiles/it-canopen-stack.dir/tests/sync_prod.c.o"
+  "CMakeFiles/it-canopen-stack.dir/tests/sync_prod.c.o.d"
+  "it-canopen-stack"
+  "it-canopen-stack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/it-canopen-stack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
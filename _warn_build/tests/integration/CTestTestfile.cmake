@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/integration
+# Build directory: /root/repo/_warn_build/tests/integration
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[integration/all]=] "/root/repo/_warn_build/tests/integration/it-canopen-stack")
+set_tests_properties([=[integration/all]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/integration/CMakeLists.txt;143;add_test;/root/repo/tests/integration/CMakeLists.txt;0;")
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/core
+# Build directory: /root/repo/_warn_build/tests/unit/core
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("crc")
+subdirs("dict")
+subdirs("disp")
+subdirs("tmr")
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench-crc-calc"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/bench-crc-calc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-crc-calc.dir/main.c.o"
+  "CMakeFiles/ut-crc-calc.dir/main.c.o.d"
+  "ut-crc-calc"
+  "ut-crc-calc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-crc-calc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/core/crc/calc
+# Build directory: /root/repo/_warn_build/tests/unit/core/crc/calc
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/crc/calc/empty]=] "/root/repo/_warn_build/tests/unit/core/crc/calc/ut-crc-calc" "empty")
+set_tests_properties([=[unit/crc/calc/empty]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/crc/calc/CMakeLists.txt;24;add_test;/root/repo/tests/unit/core/crc/calc/CMakeLists.txt;0;")
+add_test([=[unit/crc/calc/check]=] "/root/repo/_warn_build/tests/unit/core/crc/calc/ut-crc-calc" "check")
+set_tests_properties([=[unit/crc/calc/check]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/crc/calc/CMakeLists.txt;25;add_test;/root/repo/tests/unit/core/crc/calc/CMakeLists.txt;0;")
+add_test([=[unit/crc/calc/reference]=] "/root/repo/_warn_build/tests/unit/core/crc/calc/ut-crc-calc" "reference")
+set_tests_properties([=[unit/crc/calc/reference]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/crc/calc/CMakeLists.txt;26;add_test;/root/repo/tests/unit/core/crc/calc/CMakeLists.txt;0;")
+add_test([=[unit/crc/calc/chunks]=] "/root/repo/_warn_build/tests/unit/core/crc/calc/ut-crc-calc" "chunks")
+set_tests_properties([=[unit/crc/calc/chunks]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/crc/calc/CMakeLists.txt;27;add_test;/root/repo/tests/unit/core/crc/calc/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/core/dict
+# Build directory: /root/repo/_warn_build/tests/unit/core/dict
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("find")
+subdirs("lookup")
+subdirs("overlay")
+subdirs("range")
+subdirs("ref")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-dict-find.dir/main.c.o"
+  "CMakeFiles/ut-dict-find.dir/main.c.o.d"
+  "ut-dict-find"
+  "ut-dict-find.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-dict-find.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/core/dict/find
+# Build directory: /root/repo/_warn_build/tests/unit/core/dict/find
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/dict/find/no_init]=] "/root/repo/_warn_build/tests/unit/core/dict/find/ut-dict-find" "no_init")
+set_tests_properties([=[unit/dict/find/no_init]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/find/CMakeLists.txt;23;add_test;/root/repo/tests/unit/core/dict/find/CMakeLists.txt;0;")
+add_test([=[unit/dict/find/empty]=] "/root/repo/_warn_build/tests/unit/core/dict/find/ut-dict-find" "empty")
+set_tests_properties([=[unit/dict/find/empty]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/find/CMakeLists.txt;24;add_test;/root/repo/tests/unit/core/dict/find/CMakeLists.txt;0;")
+add_test([=[unit/dict/find/single]=] "/root/repo/_warn_build/tests/unit/core/dict/find/ut-dict-find" "single")
+set_tests_properties([=[unit/dict/find/single]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/find/CMakeLists.txt;25;add_test;/root/repo/tests/unit/core/dict/find/CMakeLists.txt;0;")
+add_test([=[unit/dict/find/first]=] "/root/repo/_warn_build/tests/unit/core/dict/find/ut-dict-find" "first")
+set_tests_properties([=[unit/dict/find/first]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/find/CMakeLists.txt;26;add_test;/root/repo/tests/unit/core/dict/find/CMakeLists.txt;0;")
+add_test([=[unit/dict/find/middle]=] "/root/repo/_warn_build/tests/unit/core/dict/find/ut-dict-find" "middle")
+set_tests_properties([=[unit/dict/find/middle]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/find/CMakeLists.txt;27;add_test;/root/repo/tests/unit/core/dict/find/CMakeLists.txt;0;")
+add_test([=[unit/dict/find/last]=] "/root/repo/_warn_build/tests/unit/core/dict/find/ut-dict-find" "last")
+set_tests_properties([=[unit/dict/find/last]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/find/CMakeLists.txt;28;add_test;/root/repo/tests/unit/core/dict/find/CMakeLists.txt;0;")
+add_test([=[unit/dict/find/not_found]=] "/root/repo/_warn_build/tests/unit/core/dict/find/ut-dict-find" "not_found")
+set_tests_properties([=[unit/dict/find/not_found]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/find/CMakeLists.txt;29;add_test;/root/repo/tests/unit/core/dict/find/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench-dict-lookup"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/bench-dict-lookup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
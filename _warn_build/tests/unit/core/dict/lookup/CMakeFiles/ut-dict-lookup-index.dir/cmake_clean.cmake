@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-dict-lookup-index.dir/main.c.o"
+  "CMakeFiles/ut-dict-lookup-index.dir/main.c.o.d"
+  "ut-dict-lookup-index"
+  "ut-dict-lookup-index.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-dict-lookup-index.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
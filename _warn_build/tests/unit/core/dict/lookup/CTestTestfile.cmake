@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/core/dict/lookup
+# Build directory: /root/repo/_warn_build/tests/unit/core/dict/lookup
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/dict/lookup/search/unsorted]=] "/root/repo/_warn_build/tests/unit/core/dict/lookup/ut-dict-lookup" "unsorted")
+set_tests_properties([=[unit/dict/lookup/search/unsorted]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;48;add_test;/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;0;")
+add_test([=[unit/dict/lookup/search/duplicate]=] "/root/repo/_warn_build/tests/unit/core/dict/lookup/ut-dict-lookup" "duplicate")
+set_tests_properties([=[unit/dict/lookup/search/duplicate]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;49;add_test;/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;0;")
+add_test([=[unit/dict/lookup/search/large]=] "/root/repo/_warn_build/tests/unit/core/dict/lookup/ut-dict-lookup" "large")
+set_tests_properties([=[unit/dict/lookup/search/large]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;50;add_test;/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;0;")
+add_test([=[unit/dict/lookup/search/update]=] "/root/repo/_warn_build/tests/unit/core/dict/lookup/ut-dict-lookup" "update")
+set_tests_properties([=[unit/dict/lookup/search/update]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;51;add_test;/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;0;")
+add_test([=[unit/dict/lookup/index/unsorted]=] "/root/repo/_warn_build/tests/unit/core/dict/lookup/ut-dict-lookup-index" "unsorted")
+set_tests_properties([=[unit/dict/lookup/index/unsorted]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;55;add_test;/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;0;")
+add_test([=[unit/dict/lookup/index/duplicate]=] "/root/repo/_warn_build/tests/unit/core/dict/lookup/ut-dict-lookup-index" "duplicate")
+set_tests_properties([=[unit/dict/lookup/index/duplicate]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;56;add_test;/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;0;")
+add_test([=[unit/dict/lookup/index/large]=] "/root/repo/_warn_build/tests/unit/core/dict/lookup/ut-dict-lookup-index" "large")
+set_tests_properties([=[unit/dict/lookup/index/large]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;57;add_test;/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;0;")
+add_test([=[unit/dict/lookup/index/update]=] "/root/repo/_warn_build/tests/unit/core/dict/lookup/ut-dict-lookup-index" "update")
+set_tests_properties([=[unit/dict/lookup/index/update]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;58;add_test;/root/repo/tests/unit/core/dict/lookup/CMakeLists.txt;0;")
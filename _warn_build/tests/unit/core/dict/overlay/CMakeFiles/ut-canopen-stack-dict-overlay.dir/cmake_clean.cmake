@@ -0,0 +1,95 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/config/callbacks.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/config/callbacks.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_core.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_core.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_crc.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_crc.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_dict.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_dict.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_disp.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_disp.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_filter.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_filter.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_nmt.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_nmt.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_obj.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_obj.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_tmr.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_tmr.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_ver.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/core/co_ver.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/hal/co_if.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/hal/co_if.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/hal/co_if_can.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/hal/co_if_can.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/hal/co_if_can_ring.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/hal/co_if_can_ring.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/hal/co_if_nvm.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/hal/co_if_nvm.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/hal/co_if_ring.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/hal/co_if_ring.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/hal/co_if_timer.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/hal/co_if_timer.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/basic/co_domain.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/basic/co_domain.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/basic/co_integer16.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/basic/co_integer16.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/basic/co_integer32.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/basic/co_integer32.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/basic/co_integer8.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/basic/co_integer8.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/basic/co_range.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/basic/co_range.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/basic/co_string.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/basic/co_string.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_emcy_hist.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_emcy_hist.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_emcy_id.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_emcy_id.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_hb_cons.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_hb_cons.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_hb_prod.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_hb_prod.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_para_log.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_para_log.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_para_restore.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_para_restore.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_para_store.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_para_store.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_pdo_event.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_pdo_event.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_pdo_id.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_pdo_id.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_pdo_map.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_pdo_map.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_pdo_num.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_pdo_num.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_pdo_type.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_pdo_type.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_sdo_id.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_sdo_id.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_sync_cycle.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_sync_cycle.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_sync_id.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/object/cia301/co_sync_id.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/service/cia301/co_csdo.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/service/cia301/co_csdo.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/service/cia301/co_emcy.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/service/cia301/co_emcy.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/service/cia301/co_pdo.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/service/cia301/co_pdo.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/service/cia301/co_ssdo.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/service/cia301/co_ssdo.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/service/cia301/co_sync.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/service/cia301/co_sync.c.o.d"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/service/cia305/co_lss.c.o"
+  "CMakeFiles/ut-canopen-stack-dict-overlay.dir/__/__/__/__/__/src/service/cia305/co_lss.c.o.d"
+  "libut-canopen-stack-dict-overlay.a"
+  "libut-canopen-stack-dict-overlay.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-canopen-stack-dict-overlay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-dict-overlay.dir/main.c.o"
+  "CMakeFiles/ut-dict-overlay.dir/main.c.o.d"
+  "ut-dict-overlay"
+  "ut-dict-overlay.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-dict-overlay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
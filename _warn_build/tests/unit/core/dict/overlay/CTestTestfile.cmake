@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/core/dict/overlay
+# Build directory: /root/repo/_warn_build/tests/unit/core/dict/overlay
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/dict/overlay/init]=] "/root/repo/_warn_build/tests/unit/core/dict/overlay/ut-dict-overlay" "init")
+set_tests_properties([=[unit/dict/overlay/init]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;43;add_test;/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;0;")
+add_test([=[unit/dict/overlay/too_small]=] "/root/repo/_warn_build/tests/unit/core/dict/overlay/ut-dict-overlay" "too_small")
+set_tests_properties([=[unit/dict/overlay/too_small]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;44;add_test;/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;0;")
+add_test([=[unit/dict/overlay/no_overlay]=] "/root/repo/_warn_build/tests/unit/core/dict/overlay/ut-dict-overlay" "no_overlay")
+set_tests_properties([=[unit/dict/overlay/no_overlay]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;45;add_test;/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;0;")
+add_test([=[unit/dict/overlay/find]=] "/root/repo/_warn_build/tests/unit/core/dict/overlay/ut-dict-overlay" "find")
+set_tests_properties([=[unit/dict/overlay/find]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;49;add_test;/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;0;")
+add_test([=[unit/dict/overlay/nodes]=] "/root/repo/_warn_build/tests/unit/core/dict/overlay/ut-dict-overlay" "nodes")
+set_tests_properties([=[unit/dict/overlay/nodes]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;50;add_test;/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;0;")
+add_test([=[unit/dict/overlay/ref]=] "/root/repo/_warn_build/tests/unit/core/dict/overlay/ut-dict-overlay" "ref")
+set_tests_properties([=[unit/dict/overlay/ref]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;51;add_test;/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;0;")
+add_test([=[unit/dict/overlay/read_only]=] "/root/repo/_warn_build/tests/unit/core/dict/overlay/ut-dict-overlay" "read_only")
+set_tests_properties([=[unit/dict/overlay/read_only]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;52;add_test;/root/repo/tests/unit/core/dict/overlay/CMakeLists.txt;0;")
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libut-canopen-stack-obj-range.a"
+)
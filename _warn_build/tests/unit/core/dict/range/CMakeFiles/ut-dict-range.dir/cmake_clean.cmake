@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-dict-range.dir/main.c.o"
+  "CMakeFiles/ut-dict-range.dir/main.c.o.d"
+  "ut-dict-range"
+  "ut-dict-range.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-dict-range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
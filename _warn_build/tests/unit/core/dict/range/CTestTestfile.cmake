@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/core/dict/range
+# Build directory: /root/repo/_warn_build/tests/unit/core/dict/range
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/dict/range/init]=] "/root/repo/_warn_build/tests/unit/core/dict/range/ut-dict-range" "init")
+set_tests_properties([=[unit/dict/range/init]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/range/CMakeLists.txt;43;add_test;/root/repo/tests/unit/core/dict/range/CMakeLists.txt;0;")
+add_test([=[unit/dict/range/overlap]=] "/root/repo/_warn_build/tests/unit/core/dict/range/ut-dict-range" "overlap")
+set_tests_properties([=[unit/dict/range/overlap]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/range/CMakeLists.txt;44;add_test;/root/repo/tests/unit/core/dict/range/CMakeLists.txt;0;")
+add_test([=[unit/dict/range/bad_range]=] "/root/repo/_warn_build/tests/unit/core/dict/range/ut-dict-range" "bad_range")
+set_tests_properties([=[unit/dict/range/bad_range]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/range/CMakeLists.txt;45;add_test;/root/repo/tests/unit/core/dict/range/CMakeLists.txt;0;")
+add_test([=[unit/dict/range/find]=] "/root/repo/_warn_build/tests/unit/core/dict/range/ut-dict-range" "find")
+set_tests_properties([=[unit/dict/range/find]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/range/CMakeLists.txt;49;add_test;/root/repo/tests/unit/core/dict/range/CMakeLists.txt;0;")
+add_test([=[unit/dict/range/access]=] "/root/repo/_warn_build/tests/unit/core/dict/range/ut-dict-range" "access")
+set_tests_properties([=[unit/dict/range/access]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/range/CMakeLists.txt;50;add_test;/root/repo/tests/unit/core/dict/range/CMakeLists.txt;0;")
+add_test([=[unit/dict/range/keep]=] "/root/repo/_warn_build/tests/unit/core/dict/range/ut-dict-range" "keep")
+set_tests_properties([=[unit/dict/range/keep]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/range/CMakeLists.txt;51;add_test;/root/repo/tests/unit/core/dict/range/CMakeLists.txt;0;")
+add_test([=[unit/dict/range/ref]=] "/root/repo/_warn_build/tests/unit/core/dict/range/ut-dict-range" "ref")
+set_tests_properties([=[unit/dict/range/ref]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/range/CMakeLists.txt;52;add_test;/root/repo/tests/unit/core/dict/range/CMakeLists.txt;0;")
+add_test([=[unit/dict/range/elem_init]=] "/root/repo/_warn_build/tests/unit/core/dict/range/ut-dict-range" "elem_init")
+set_tests_properties([=[unit/dict/range/elem_init]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/range/CMakeLists.txt;53;add_test;/root/repo/tests/unit/core/dict/range/CMakeLists.txt;0;")
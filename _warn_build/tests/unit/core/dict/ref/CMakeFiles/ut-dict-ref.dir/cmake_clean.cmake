@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-dict-ref.dir/main.c.o"
+  "CMakeFiles/ut-dict-ref.dir/main.c.o.d"
+  "ut-dict-ref"
+  "ut-dict-ref.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-dict-ref.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/core/dict/ref
+# Build directory: /root/repo/_warn_build/tests/unit/core/dict/ref
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/dict/ref/resolve]=] "/root/repo/_warn_build/tests/unit/core/dict/ref/ut-dict-ref" "resolve")
+set_tests_properties([=[unit/dict/ref/resolve]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;24;add_test;/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;0;")
+add_test([=[unit/dict/ref/not_found]=] "/root/repo/_warn_build/tests/unit/core/dict/ref/ut-dict-ref" "not_found")
+set_tests_properties([=[unit/dict/ref/not_found]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;25;add_test;/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;0;")
+add_test([=[unit/dict/ref/read]=] "/root/repo/_warn_build/tests/unit/core/dict/ref/ut-dict-ref" "read")
+set_tests_properties([=[unit/dict/ref/read]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;26;add_test;/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;0;")
+add_test([=[unit/dict/ref/write]=] "/root/repo/_warn_build/tests/unit/core/dict/ref/ut-dict-ref" "write")
+set_tests_properties([=[unit/dict/ref/write]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;27;add_test;/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;0;")
+add_test([=[unit/dict/ref/bad_size]=] "/root/repo/_warn_build/tests/unit/core/dict/ref/ut-dict-ref" "bad_size")
+set_tests_properties([=[unit/dict/ref/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;28;add_test;/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;0;")
+add_test([=[unit/dict/ref/reinit]=] "/root/repo/_warn_build/tests/unit/core/dict/ref/ut-dict-ref" "reinit")
+set_tests_properties([=[unit/dict/ref/reinit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;29;add_test;/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;0;")
+add_test([=[unit/dict/ref/update]=] "/root/repo/_warn_build/tests/unit/core/dict/ref/ut-dict-ref" "update")
+set_tests_properties([=[unit/dict/ref/update]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;30;add_test;/root/repo/tests/unit/core/dict/ref/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench-disp-find"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/bench-disp-find.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
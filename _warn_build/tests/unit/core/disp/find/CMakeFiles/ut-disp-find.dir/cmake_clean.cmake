@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-disp-find.dir/main.c.o"
+  "CMakeFiles/ut-disp-find.dir/main.c.o.d"
+  "ut-disp-find"
+  "ut-disp-find.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-disp-find.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/core/disp/find
+# Build directory: /root/repo/_warn_build/tests/unit/core/disp/find
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/disp/find/none]=] "/root/repo/_warn_build/tests/unit/core/disp/find/ut-disp-find" "none")
+set_tests_properties([=[unit/disp/find/none]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/disp/find/CMakeLists.txt;43;add_test;/root/repo/tests/unit/core/disp/find/CMakeLists.txt;0;")
+add_test([=[unit/disp/find/nmt]=] "/root/repo/_warn_build/tests/unit/core/disp/find/ut-disp-find" "nmt")
+set_tests_properties([=[unit/disp/find/nmt]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/disp/find/CMakeLists.txt;44;add_test;/root/repo/tests/unit/core/disp/find/CMakeLists.txt;0;")
+add_test([=[unit/disp/find/ssdo]=] "/root/repo/_warn_build/tests/unit/core/disp/find/ut-disp-find" "ssdo")
+set_tests_properties([=[unit/disp/find/ssdo]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/disp/find/CMakeLists.txt;45;add_test;/root/repo/tests/unit/core/disp/find/CMakeLists.txt;0;")
+add_test([=[unit/disp/find/csdo]=] "/root/repo/_warn_build/tests/unit/core/disp/find/ut-disp-find" "csdo")
+set_tests_properties([=[unit/disp/find/csdo]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/disp/find/CMakeLists.txt;46;add_test;/root/repo/tests/unit/core/disp/find/CMakeLists.txt;0;")
+add_test([=[unit/disp/find/hbc]=] "/root/repo/_warn_build/tests/unit/core/disp/find/ut-disp-find" "hbc")
+set_tests_properties([=[unit/disp/find/hbc]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/disp/find/CMakeLists.txt;47;add_test;/root/repo/tests/unit/core/disp/find/CMakeLists.txt;0;")
+add_test([=[unit/disp/find/rpdo]=] "/root/repo/_warn_build/tests/unit/core/disp/find/ut-disp-find" "rpdo")
+set_tests_properties([=[unit/disp/find/rpdo]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/disp/find/CMakeLists.txt;48;add_test;/root/repo/tests/unit/core/disp/find/CMakeLists.txt;0;")
+add_test([=[unit/disp/find/rpdo_off]=] "/root/repo/_warn_build/tests/unit/core/disp/find/ut-disp-find" "rpdo_off")
+set_tests_properties([=[unit/disp/find/rpdo_off]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/disp/find/CMakeLists.txt;49;add_test;/root/repo/tests/unit/core/disp/find/CMakeLists.txt;0;")
+add_test([=[unit/disp/find/sync]=] "/root/repo/_warn_build/tests/unit/core/disp/find/ut-disp-find" "sync")
+set_tests_properties([=[unit/disp/find/sync]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/disp/find/CMakeLists.txt;50;add_test;/root/repo/tests/unit/core/disp/find/CMakeLists.txt;0;")
+add_test([=[unit/disp/find/shared]=] "/root/repo/_warn_build/tests/unit/core/disp/find/ut-disp-find" "shared")
+set_tests_properties([=[unit/disp/find/shared]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/disp/find/CMakeLists.txt;51;add_test;/root/repo/tests/unit/core/disp/find/CMakeLists.txt;0;")
+add_test([=[unit/disp/find/extended]=] "/root/repo/_warn_build/tests/unit/core/disp/find/ut-disp-find" "extended")
+set_tests_properties([=[unit/disp/find/extended]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/disp/find/CMakeLists.txt;52;add_test;/root/repo/tests/unit/core/disp/find/CMakeLists.txt;0;")
+add_test([=[unit/disp/find/invalidate]=] "/root/repo/_warn_build/tests/unit/core/disp/find/ut-disp-find" "invalidate")
+set_tests_properties([=[unit/disp/find/invalidate]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/disp/find/CMakeLists.txt;53;add_test;/root/repo/tests/unit/core/disp/find/CMakeLists.txt;0;")
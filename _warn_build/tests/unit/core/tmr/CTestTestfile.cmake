@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/core/tmr
+# Build directory: /root/repo/_warn_build/tests/unit/core/tmr
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("get_ticks")
+subdirs("min_time")
+subdirs("backend")
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench-tmr-backend"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/bench-tmr-backend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-tmr-backend.dir/main.c.o"
+  "CMakeFiles/ut-tmr-backend.dir/main.c.o.d"
+  "ut-tmr-backend"
+  "ut-tmr-backend.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-tmr-backend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
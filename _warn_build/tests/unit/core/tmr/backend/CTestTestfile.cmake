@@ -0,0 +1,26 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/core/tmr/backend
+# Build directory: /root/repo/_warn_build/tests/unit/core/tmr/backend
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/tmr/backend/list/order]=] "/root/repo/_warn_build/tests/unit/core/tmr/backend/ut-tmr-backend" "order")
+set_tests_properties([=[unit/tmr/backend/list/order]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;47;add_test;/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;0;")
+add_test([=[unit/tmr/backend/list/delete]=] "/root/repo/_warn_build/tests/unit/core/tmr/backend/ut-tmr-backend" "delete")
+set_tests_properties([=[unit/tmr/backend/list/delete]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;48;add_test;/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;0;")
+add_test([=[unit/tmr/backend/list/cycle]=] "/root/repo/_warn_build/tests/unit/core/tmr/backend/ut-tmr-backend" "cycle")
+set_tests_properties([=[unit/tmr/backend/list/cycle]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;49;add_test;/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;0;")
+add_test([=[unit/tmr/backend/list/long]=] "/root/repo/_warn_build/tests/unit/core/tmr/backend/ut-tmr-backend" "long")
+set_tests_properties([=[unit/tmr/backend/list/long]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;50;add_test;/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;0;")
+add_test([=[unit/tmr/backend/list/pool]=] "/root/repo/_warn_build/tests/unit/core/tmr/backend/ut-tmr-backend" "pool")
+set_tests_properties([=[unit/tmr/backend/list/pool]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;51;add_test;/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;0;")
+add_test([=[unit/tmr/backend/wheel/order]=] "/root/repo/_warn_build/tests/unit/core/tmr/backend/ut-tmr-backend-wheel" "order")
+set_tests_properties([=[unit/tmr/backend/wheel/order]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;55;add_test;/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;0;")
+add_test([=[unit/tmr/backend/wheel/delete]=] "/root/repo/_warn_build/tests/unit/core/tmr/backend/ut-tmr-backend-wheel" "delete")
+set_tests_properties([=[unit/tmr/backend/wheel/delete]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;56;add_test;/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;0;")
+add_test([=[unit/tmr/backend/wheel/cycle]=] "/root/repo/_warn_build/tests/unit/core/tmr/backend/ut-tmr-backend-wheel" "cycle")
+set_tests_properties([=[unit/tmr/backend/wheel/cycle]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;57;add_test;/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;0;")
+add_test([=[unit/tmr/backend/wheel/long]=] "/root/repo/_warn_build/tests/unit/core/tmr/backend/ut-tmr-backend-wheel" "long")
+set_tests_properties([=[unit/tmr/backend/wheel/long]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;58;add_test;/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;0;")
+add_test([=[unit/tmr/backend/wheel/pool]=] "/root/repo/_warn_build/tests/unit/core/tmr/backend/ut-tmr-backend-wheel" "pool")
+set_tests_properties([=[unit/tmr/backend/wheel/pool]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;59;add_test;/root/repo/tests/unit/core/tmr/backend/CMakeLists.txt;0;")
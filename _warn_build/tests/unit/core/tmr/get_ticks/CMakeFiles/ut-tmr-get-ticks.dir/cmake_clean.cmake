@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-tmr-get-ticks.dir/main.c.o"
+  "CMakeFiles/ut-tmr-get-ticks.dir/main.c.o.d"
+  "ut-tmr-get-ticks"
+  "ut-tmr-get-ticks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-tmr-get-ticks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,48 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/core/tmr/get_ticks
+# Build directory: /root/repo/_warn_build/tests/unit/core/tmr/get_ticks
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/tmr/get_ticks/1MHz_0ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1MHz_0ms")
+set_tests_properties([=[unit/tmr/get_ticks/1MHz_0ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;23;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1MHz_23ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1MHz_23ms")
+set_tests_properties([=[unit/tmr/get_ticks/1MHz_23ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;24;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1MHz_456ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1MHz_456ms")
+set_tests_properties([=[unit/tmr/get_ticks/1MHz_456ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;25;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1MHz_1000ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1MHz_1000ms")
+set_tests_properties([=[unit/tmr/get_ticks/1MHz_1000ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;26;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1MHz_65535ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1MHz_65535ms")
+set_tests_properties([=[unit/tmr/get_ticks/1MHz_65535ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;27;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1MHz_100us]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1MHz_100us")
+set_tests_properties([=[unit/tmr/get_ticks/1MHz_100us]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;28;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1MHz_2300us]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1MHz_2300us")
+set_tests_properties([=[unit/tmr/get_ticks/1MHz_2300us]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;29;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1MHz_72500us]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1MHz_72500us")
+set_tests_properties([=[unit/tmr/get_ticks/1MHz_72500us]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;30;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1MHz_6553500us]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1MHz_6553500us")
+set_tests_properties([=[unit/tmr/get_ticks/1MHz_6553500us]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;31;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1kHz_0ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1kHz_0ms")
+set_tests_properties([=[unit/tmr/get_ticks/1kHz_0ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;32;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1kHz_23ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1kHz_23ms")
+set_tests_properties([=[unit/tmr/get_ticks/1kHz_23ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;33;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1kHz_456ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1kHz_456ms")
+set_tests_properties([=[unit/tmr/get_ticks/1kHz_456ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;34;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1kHz_1000ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1kHz_1000ms")
+set_tests_properties([=[unit/tmr/get_ticks/1kHz_1000ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;35;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1kHz_65535ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1kHz_65535ms")
+set_tests_properties([=[unit/tmr/get_ticks/1kHz_65535ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;36;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/1kHz_100us]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "1kHz_100us")
+set_tests_properties([=[unit/tmr/get_ticks/1kHz_100us]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;37;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/100Hz_6ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "100Hz_6ms")
+set_tests_properties([=[unit/tmr/get_ticks/100Hz_6ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;38;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/100Hz_42ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "100Hz_42ms")
+set_tests_properties([=[unit/tmr/get_ticks/100Hz_42ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;39;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/100Hz_789ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "100Hz_789ms")
+set_tests_properties([=[unit/tmr/get_ticks/100Hz_789ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;40;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/100Hz_5000ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "100Hz_5000ms")
+set_tests_properties([=[unit/tmr/get_ticks/100Hz_5000ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;41;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/100Hz_65535ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "100Hz_65535ms")
+set_tests_properties([=[unit/tmr/get_ticks/100Hz_65535ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;42;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
+add_test([=[unit/tmr/get_ticks/100Hz_100us]=] "/root/repo/_warn_build/tests/unit/core/tmr/get_ticks/ut-tmr-get-ticks" "100Hz_100us")
+set_tests_properties([=[unit/tmr/get_ticks/100Hz_100us]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;43;add_test;/root/repo/tests/unit/core/tmr/get_ticks/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-tmr-min-time.dir/main.c.o"
+  "CMakeFiles/ut-tmr-min-time.dir/main.c.o.d"
+  "ut-tmr-min-time"
+  "ut-tmr-min-time.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-tmr-min-time.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/core/tmr/min_time
+# Build directory: /root/repo/_warn_build/tests/unit/core/tmr/min_time
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/tmr/min_time/1MHz_1ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/min_time/ut-tmr-min-time" "1MHz_1ms")
+set_tests_properties([=[unit/tmr/min_time/1MHz_1ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/min_time/CMakeLists.txt;23;add_test;/root/repo/tests/unit/core/tmr/min_time/CMakeLists.txt;0;")
+add_test([=[unit/tmr/min_time/1MHz_100us]=] "/root/repo/_warn_build/tests/unit/core/tmr/min_time/ut-tmr-min-time" "1MHz_100us")
+set_tests_properties([=[unit/tmr/min_time/1MHz_100us]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/min_time/CMakeLists.txt;24;add_test;/root/repo/tests/unit/core/tmr/min_time/CMakeLists.txt;0;")
+add_test([=[unit/tmr/min_time/1kHz_1ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/min_time/ut-tmr-min-time" "1kHz_1ms")
+set_tests_properties([=[unit/tmr/min_time/1kHz_1ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/min_time/CMakeLists.txt;25;add_test;/root/repo/tests/unit/core/tmr/min_time/CMakeLists.txt;0;")
+add_test([=[unit/tmr/min_time/1kHz_100us]=] "/root/repo/_warn_build/tests/unit/core/tmr/min_time/ut-tmr-min-time" "1kHz_100us")
+set_tests_properties([=[unit/tmr/min_time/1kHz_100us]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/min_time/CMakeLists.txt;26;add_test;/root/repo/tests/unit/core/tmr/min_time/CMakeLists.txt;0;")
+add_test([=[unit/tmr/min_time/100Hz_1ms]=] "/root/repo/_warn_build/tests/unit/core/tmr/min_time/ut-tmr-min-time" "100Hz_1ms")
+set_tests_properties([=[unit/tmr/min_time/100Hz_1ms]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/min_time/CMakeLists.txt;27;add_test;/root/repo/tests/unit/core/tmr/min_time/CMakeLists.txt;0;")
+add_test([=[unit/tmr/min_time/100Hz_100us]=] "/root/repo/_warn_build/tests/unit/core/tmr/min_time/ut-tmr-min-time" "100Hz_100us")
+set_tests_properties([=[unit/tmr/min_time/100Hz_100us]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/core/tmr/min_time/CMakeLists.txt;28;add_test;/root/repo/tests/unit/core/tmr/min_time/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/hal/can
+# Build directory: /root/repo/_warn_build/tests/unit/hal/can
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("fd")
+subdirs("txq")
+subdirs("stamp")
+subdirs("ctx")
+subdirs("ring")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-can-ctx.dir/main.c.o"
+  "CMakeFiles/ut-can-ctx.dir/main.c.o.d"
+  "ut-can-ctx"
+  "ut-can-ctx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-can-ctx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
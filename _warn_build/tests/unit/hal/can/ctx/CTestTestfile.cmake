@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/hal/can/ctx
+# Build directory: /root/repo/_warn_build/tests/unit/hal/can/ctx
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/hal/can/ctx/route]=] "/root/repo/_warn_build/tests/unit/hal/can/ctx/ut-can-ctx" "route")
+set_tests_properties([=[unit/hal/can/ctx/route]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/ctx/CMakeLists.txt;44;add_test;/root/repo/tests/unit/hal/can/ctx/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/ctx/compat]=] "/root/repo/_warn_build/tests/unit/hal/can/ctx/ut-can-ctx" "compat")
+set_tests_properties([=[unit/hal/can/ctx/compat]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/ctx/CMakeLists.txt;45;add_test;/root/repo/tests/unit/hal/can/ctx/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/ctx/tx_confirm]=] "/root/repo/_warn_build/tests/unit/hal/can/ctx/ut-can-ctx" "tx_confirm")
+set_tests_properties([=[unit/hal/can/ctx/tx_confirm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/ctx/CMakeLists.txt;46;add_test;/root/repo/tests/unit/hal/can/ctx/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/ctx/tx_global]=] "/root/repo/_warn_build/tests/unit/hal/can/ctx/ut-can-ctx" "tx_global")
+set_tests_properties([=[unit/hal/can/ctx/tx_global]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/ctx/CMakeLists.txt;47;add_test;/root/repo/tests/unit/hal/can/ctx/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/ctx/pdo_receive]=] "/root/repo/_warn_build/tests/unit/hal/can/ctx/ut-can-ctx" "pdo_receive")
+set_tests_properties([=[unit/hal/can/ctx/pdo_receive]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/ctx/CMakeLists.txt;48;add_test;/root/repo/tests/unit/hal/can/ctx/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench-can-fd"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/bench-can-fd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
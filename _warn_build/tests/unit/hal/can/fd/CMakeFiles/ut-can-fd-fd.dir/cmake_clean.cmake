@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-can-fd-fd.dir/main.c.o"
+  "CMakeFiles/ut-can-fd-fd.dir/main.c.o.d"
+  "ut-can-fd-fd"
+  "ut-can-fd-fd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-can-fd-fd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
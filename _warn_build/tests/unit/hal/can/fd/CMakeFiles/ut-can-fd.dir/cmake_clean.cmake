@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-can-fd.dir/main.c.o"
+  "CMakeFiles/ut-can-fd.dir/main.c.o.d"
+  "ut-can-fd"
+  "ut-can-fd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-can-fd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,61 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/config/callbacks.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/config/callbacks.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/config/callbacks.c.o.d"
+  "/root/repo/src/core/co_core.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_core.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_core.c.o.d"
+  "/root/repo/src/core/co_crc.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_crc.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_crc.c.o.d"
+  "/root/repo/src/core/co_dict.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_dict.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_dict.c.o.d"
+  "/root/repo/src/core/co_disp.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_disp.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_disp.c.o.d"
+  "/root/repo/src/core/co_filter.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_filter.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_filter.c.o.d"
+  "/root/repo/src/core/co_nmt.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_nmt.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_nmt.c.o.d"
+  "/root/repo/src/core/co_obj.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_obj.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_obj.c.o.d"
+  "/root/repo/src/core/co_tmr.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_tmr.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_tmr.c.o.d"
+  "/root/repo/src/core/co_ver.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_ver.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/core/co_ver.c.o.d"
+  "/root/repo/src/hal/co_if.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/hal/co_if.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/hal/co_if.c.o.d"
+  "/root/repo/src/hal/co_if_can.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/hal/co_if_can.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/hal/co_if_can.c.o.d"
+  "/root/repo/src/hal/co_if_can_ring.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/hal/co_if_can_ring.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/hal/co_if_can_ring.c.o.d"
+  "/root/repo/src/hal/co_if_nvm.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/hal/co_if_nvm.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/hal/co_if_nvm.c.o.d"
+  "/root/repo/src/hal/co_if_ring.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/hal/co_if_ring.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/hal/co_if_ring.c.o.d"
+  "/root/repo/src/hal/co_if_timer.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/hal/co_if_timer.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/hal/co_if_timer.c.o.d"
+  "/root/repo/src/object/basic/co_domain.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/basic/co_domain.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/basic/co_domain.c.o.d"
+  "/root/repo/src/object/basic/co_integer16.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/basic/co_integer16.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/basic/co_integer16.c.o.d"
+  "/root/repo/src/object/basic/co_integer32.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/basic/co_integer32.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/basic/co_integer32.c.o.d"
+  "/root/repo/src/object/basic/co_integer8.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/basic/co_integer8.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/basic/co_integer8.c.o.d"
+  "/root/repo/src/object/basic/co_range.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/basic/co_range.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/basic/co_range.c.o.d"
+  "/root/repo/src/object/basic/co_string.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/basic/co_string.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/basic/co_string.c.o.d"
+  "/root/repo/src/object/cia301/co_emcy_hist.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_emcy_hist.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_emcy_hist.c.o.d"
+  "/root/repo/src/object/cia301/co_emcy_id.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_emcy_id.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_emcy_id.c.o.d"
+  "/root/repo/src/object/cia301/co_hb_cons.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_hb_cons.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_hb_cons.c.o.d"
+  "/root/repo/src/object/cia301/co_hb_prod.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_hb_prod.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_hb_prod.c.o.d"
+  "/root/repo/src/object/cia301/co_para_log.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_para_log.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_para_log.c.o.d"
+  "/root/repo/src/object/cia301/co_para_restore.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_para_restore.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_para_restore.c.o.d"
+  "/root/repo/src/object/cia301/co_para_store.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_para_store.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_para_store.c.o.d"
+  "/root/repo/src/object/cia301/co_pdo_event.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_pdo_event.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_pdo_event.c.o.d"
+  "/root/repo/src/object/cia301/co_pdo_id.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_pdo_id.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_pdo_id.c.o.d"
+  "/root/repo/src/object/cia301/co_pdo_map.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_pdo_map.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_pdo_map.c.o.d"
+  "/root/repo/src/object/cia301/co_pdo_num.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_pdo_num.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_pdo_num.c.o.d"
+  "/root/repo/src/object/cia301/co_pdo_type.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_pdo_type.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_pdo_type.c.o.d"
+  "/root/repo/src/object/cia301/co_sdo_id.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_sdo_id.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_sdo_id.c.o.d"
+  "/root/repo/src/object/cia301/co_sync_cycle.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_sync_cycle.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_sync_cycle.c.o.d"
+  "/root/repo/src/object/cia301/co_sync_id.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_sync_id.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/object/cia301/co_sync_id.c.o.d"
+  "/root/repo/src/service/cia301/co_csdo.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/service/cia301/co_csdo.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/service/cia301/co_csdo.c.o.d"
+  "/root/repo/src/service/cia301/co_emcy.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/service/cia301/co_emcy.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/service/cia301/co_emcy.c.o.d"
+  "/root/repo/src/service/cia301/co_pdo.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/service/cia301/co_pdo.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/service/cia301/co_pdo.c.o.d"
+  "/root/repo/src/service/cia301/co_ssdo.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/service/cia301/co_ssdo.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/service/cia301/co_ssdo.c.o.d"
+  "/root/repo/src/service/cia301/co_sync.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/service/cia301/co_sync.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/service/cia301/co_sync.c.o.d"
+  "/root/repo/src/service/cia305/co_lss.c" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/service/cia305/co_lss.c.o" "gcc" "tests/unit/hal/can/fd/CMakeFiles/ut-canopen-stack-fd.dir/__/__/__/__/__/src/service/cia305/co_lss.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
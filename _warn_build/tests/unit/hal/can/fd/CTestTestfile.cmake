@@ -0,0 +1,42 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/hal/can/fd
+# Build directory: /root/repo/_warn_build/tests/unit/hal/can/fd
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/hal/can/classic/dlc]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd" "dlc")
+set_tests_properties([=[unit/hal/can/classic/dlc]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;47;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/classic/sdo_download]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd" "sdo_download")
+set_tests_properties([=[unit/hal/can/classic/sdo_download]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;48;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/classic/sdo_classic_seg]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd" "sdo_classic_seg")
+set_tests_properties([=[unit/hal/can/classic/sdo_classic_seg]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;49;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/classic/sdo_short_seg]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd" "sdo_short_seg")
+set_tests_properties([=[unit/hal/can/classic/sdo_short_seg]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;50;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/classic/csdo_classic_seg]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd" "csdo_classic_seg")
+set_tests_properties([=[unit/hal/can/classic/csdo_classic_seg]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;51;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/classic/csdo_short_seg]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd" "csdo_short_seg")
+set_tests_properties([=[unit/hal/can/classic/csdo_short_seg]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;52;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/classic/sdo_upload]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd" "sdo_upload")
+set_tests_properties([=[unit/hal/can/classic/sdo_upload]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;53;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/classic/pdo]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd" "pdo")
+set_tests_properties([=[unit/hal/can/classic/pdo]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;54;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/classic/pdo_map_len]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd" "pdo_map_len")
+set_tests_properties([=[unit/hal/can/classic/pdo_map_len]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;55;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/fd/dlc]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd-fd" "dlc")
+set_tests_properties([=[unit/hal/can/fd/dlc]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;59;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/fd/sdo_download]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd-fd" "sdo_download")
+set_tests_properties([=[unit/hal/can/fd/sdo_download]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;60;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/fd/sdo_classic_seg]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd-fd" "sdo_classic_seg")
+set_tests_properties([=[unit/hal/can/fd/sdo_classic_seg]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;61;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/fd/sdo_short_seg]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd-fd" "sdo_short_seg")
+set_tests_properties([=[unit/hal/can/fd/sdo_short_seg]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;62;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/fd/csdo_classic_seg]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd-fd" "csdo_classic_seg")
+set_tests_properties([=[unit/hal/can/fd/csdo_classic_seg]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;63;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/fd/csdo_short_seg]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd-fd" "csdo_short_seg")
+set_tests_properties([=[unit/hal/can/fd/csdo_short_seg]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;64;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/fd/sdo_upload]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd-fd" "sdo_upload")
+set_tests_properties([=[unit/hal/can/fd/sdo_upload]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;65;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/fd/pdo]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd-fd" "pdo")
+set_tests_properties([=[unit/hal/can/fd/pdo]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;66;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/fd/pdo_map_len]=] "/root/repo/_warn_build/tests/unit/hal/can/fd/ut-can-fd-fd" "pdo_map_len")
+set_tests_properties([=[unit/hal/can/fd/pdo_map_len]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;67;add_test;/root/repo/tests/unit/hal/can/fd/CMakeLists.txt;0;")
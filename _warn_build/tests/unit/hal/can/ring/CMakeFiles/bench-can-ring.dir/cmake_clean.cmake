@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench-can-ring"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/bench-can-ring.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-can-ring.dir/main.c.o"
+  "CMakeFiles/ut-can-ring.dir/main.c.o.d"
+  "ut-can-ring"
+  "ut-can-ring.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-can-ring.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
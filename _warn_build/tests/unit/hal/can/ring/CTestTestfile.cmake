@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/hal/can/ring
+# Build directory: /root/repo/_warn_build/tests/unit/hal/can/ring
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/hal/can/ring/init]=] "/root/repo/_warn_build/tests/unit/hal/can/ring/ut-can-ring" "init")
+set_tests_properties([=[unit/hal/can/ring/init]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;29;add_test;/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/ring/push_pop]=] "/root/repo/_warn_build/tests/unit/hal/can/ring/ut-can-ring" "push_pop")
+set_tests_properties([=[unit/hal/can/ring/push_pop]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;30;add_test;/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/ring/wrap]=] "/root/repo/_warn_build/tests/unit/hal/can/ring/ut-can-ring" "wrap")
+set_tests_properties([=[unit/hal/can/ring/wrap]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;31;add_test;/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/ring/full]=] "/root/repo/_warn_build/tests/unit/hal/can/ring/ut-can-ring" "full")
+set_tests_properties([=[unit/hal/can/ring/full]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;32;add_test;/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/ring/peek_skip]=] "/root/repo/_warn_build/tests/unit/hal/can/ring/ut-can-ring" "peek_skip")
+set_tests_properties([=[unit/hal/can/ring/peek_skip]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;33;add_test;/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/ring/drv_read]=] "/root/repo/_warn_build/tests/unit/hal/can/ring/ut-can-ring" "drv_read")
+set_tests_properties([=[unit/hal/can/ring/drv_read]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;37;add_test;/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/ring/drv_send]=] "/root/repo/_warn_build/tests/unit/hal/can/ring/ut-can-ring" "drv_send")
+set_tests_properties([=[unit/hal/can/ring/drv_send]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;38;add_test;/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/ring/drv_reject]=] "/root/repo/_warn_build/tests/unit/hal/can/ring/ut-can-ring" "drv_reject")
+set_tests_properties([=[unit/hal/can/ring/drv_reject]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;39;add_test;/root/repo/tests/unit/hal/can/ring/CMakeLists.txt;0;")
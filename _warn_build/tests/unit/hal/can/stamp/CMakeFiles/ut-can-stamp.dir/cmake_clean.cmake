@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-can-stamp.dir/main.c.o"
+  "CMakeFiles/ut-can-stamp.dir/main.c.o.d"
+  "ut-can-stamp"
+  "ut-can-stamp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-can-stamp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/hal/can/stamp
+# Build directory: /root/repo/_warn_build/tests/unit/hal/can/stamp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/hal/can/stamp/read]=] "/root/repo/_warn_build/tests/unit/hal/can/stamp/ut-can-stamp" "read")
+set_tests_properties([=[unit/hal/can/stamp/read]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/stamp/CMakeLists.txt;44;add_test;/root/repo/tests/unit/hal/can/stamp/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/stamp/tx_done]=] "/root/repo/_warn_build/tests/unit/hal/can/stamp/ut-can-stamp" "tx_done")
+set_tests_properties([=[unit/hal/can/stamp/tx_done]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/stamp/CMakeLists.txt;45;add_test;/root/repo/tests/unit/hal/can/stamp/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/stamp/rpdo]=] "/root/repo/_warn_build/tests/unit/hal/can/stamp/ut-can-stamp" "rpdo")
+set_tests_properties([=[unit/hal/can/stamp/rpdo]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/stamp/CMakeLists.txt;46;add_test;/root/repo/tests/unit/hal/can/stamp/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/stamp/sync_first]=] "/root/repo/_warn_build/tests/unit/hal/can/stamp/ut-can-stamp" "sync_first")
+set_tests_properties([=[unit/hal/can/stamp/sync_first]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/stamp/CMakeLists.txt;47;add_test;/root/repo/tests/unit/hal/can/stamp/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/stamp/sync_jitter]=] "/root/repo/_warn_build/tests/unit/hal/can/stamp/ut-can-stamp" "sync_jitter")
+set_tests_properties([=[unit/hal/can/stamp/sync_jitter]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/stamp/CMakeLists.txt;48;add_test;/root/repo/tests/unit/hal/can/stamp/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/stamp/sync_restart]=] "/root/repo/_warn_build/tests/unit/hal/can/stamp/ut-can-stamp" "sync_restart")
+set_tests_properties([=[unit/hal/can/stamp/sync_restart]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/stamp/CMakeLists.txt;49;add_test;/root/repo/tests/unit/hal/can/stamp/CMakeLists.txt;0;")
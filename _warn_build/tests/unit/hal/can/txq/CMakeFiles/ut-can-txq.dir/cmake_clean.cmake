@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-can-txq.dir/main.c.o"
+  "CMakeFiles/ut-can-txq.dir/main.c.o.d"
+  "ut-can-txq"
+  "ut-can-txq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-can-txq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
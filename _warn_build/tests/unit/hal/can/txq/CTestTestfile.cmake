@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/hal/can/txq
+# Build directory: /root/repo/_warn_build/tests/unit/hal/can/txq
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/hal/can/txq/bypass]=] "/root/repo/_warn_build/tests/unit/hal/can/txq/ut-can-txq" "bypass")
+set_tests_properties([=[unit/hal/can/txq/bypass]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;44;add_test;/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/txq/queue]=] "/root/repo/_warn_build/tests/unit/hal/can/txq/ut-can-txq" "queue")
+set_tests_properties([=[unit/hal/can/txq/queue]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;45;add_test;/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/txq/behind]=] "/root/repo/_warn_build/tests/unit/hal/can/txq/ut-can-txq" "behind")
+set_tests_properties([=[unit/hal/can/txq/behind]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;46;add_test;/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/txq/arbitration]=] "/root/repo/_warn_build/tests/unit/hal/can/txq/ut-can-txq" "arbitration")
+set_tests_properties([=[unit/hal/can/txq/arbitration]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;47;add_test;/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/txq/sequence]=] "/root/repo/_warn_build/tests/unit/hal/can/txq/ut-can-txq" "sequence")
+set_tests_properties([=[unit/hal/can/txq/sequence]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;48;add_test;/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/txq/credit]=] "/root/repo/_warn_build/tests/unit/hal/can/txq/ut-can-txq" "credit")
+set_tests_properties([=[unit/hal/can/txq/credit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;49;add_test;/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/txq/send_error]=] "/root/repo/_warn_build/tests/unit/hal/can/txq/ut-can-txq" "send_error")
+set_tests_properties([=[unit/hal/can/txq/send_error]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;50;add_test;/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/txq/evict]=] "/root/repo/_warn_build/tests/unit/hal/can/txq/ut-can-txq" "evict")
+set_tests_properties([=[unit/hal/can/txq/evict]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;51;add_test;/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/txq/drop]=] "/root/repo/_warn_build/tests/unit/hal/can/txq/ut-can-txq" "drop")
+set_tests_properties([=[unit/hal/can/txq/drop]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;52;add_test;/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/txq/tx_free]=] "/root/repo/_warn_build/tests/unit/hal/can/txq/ut-can-txq" "tx_free")
+set_tests_properties([=[unit/hal/can/txq/tx_free]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;53;add_test;/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/txq/reset]=] "/root/repo/_warn_build/tests/unit/hal/can/txq/ut-can-txq" "reset")
+set_tests_properties([=[unit/hal/can/txq/reset]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;54;add_test;/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;0;")
+add_test([=[unit/hal/can/txq/tx_done]=] "/root/repo/_warn_build/tests/unit/hal/can/txq/ut-can-txq" "tx_done")
+set_tests_properties([=[unit/hal/can/txq/tx_done]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;55;add_test;/root/repo/tests/unit/hal/can/txq/CMakeLists.txt;0;")
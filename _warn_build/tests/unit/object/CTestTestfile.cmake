@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object
+# Build directory: /root/repo/_warn_build/tests/unit/object
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("basic")
+subdirs("cia301")
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/basic
+# Build directory: /root/repo/_warn_build/tests/unit/object/basic
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("co_domain")
+subdirs("co_signed8")
+subdirs("co_signed16")
+subdirs("co_signed32")
+subdirs("co_string")
+subdirs("co_unsigned8")
+subdirs("co_unsigned16")
+subdirs("co_unsigned32")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-domain.dir/main.c.o"
+  "CMakeFiles/ut-domain.dir/main.c.o.d"
+  "ut-domain"
+  "ut-domain.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-domain.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,40 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/basic/co_domain
+# Build directory: /root/repo/_warn_build/tests/unit/object/basic/co_domain
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/domain/size/unknown]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "size_unknown")
+set_tests_properties([=[unit/object/domain/size/unknown]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/size/known]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "size_known")
+set_tests_properties([=[unit/object/domain/size/known]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/size/small]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "size_small")
+set_tests_properties([=[unit/object/domain/size/small]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/size/large]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "size_large")
+set_tests_properties([=[unit/object/domain/size/large]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/size/bad_size]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "bad_size")
+set_tests_properties([=[unit/object/domain/size/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/read/all]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "read_all")
+set_tests_properties([=[unit/object/domain/read/all]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/read/part]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "read_part")
+set_tests_properties([=[unit/object/domain/read/part]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "read_bad_node")
+set_tests_properties([=[unit/object/domain/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/write/all]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "write_all")
+set_tests_properties([=[unit/object/domain/write/all]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/write/part]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "write_part")
+set_tests_properties([=[unit/object/domain/write/part]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "write_bad_node")
+set_tests_properties([=[unit/object/domain/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/init/offset]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "init_offset")
+set_tests_properties([=[unit/object/domain/init/offset]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;34;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/reset/offset]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "reset_offset")
+set_tests_properties([=[unit/object/domain/reset/offset]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;35;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/region/start]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "region_start")
+set_tests_properties([=[unit/object/domain/region/start]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;36;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/region/offset]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "region_offset")
+set_tests_properties([=[unit/object/domain/region/offset]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;37;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/region/end]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "region_end")
+set_tests_properties([=[unit/object/domain/region/end]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;38;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
+add_test([=[unit/object/domain/region/none]=] "/root/repo/_warn_build/tests/unit/object/basic/co_domain/ut-domain" "region_none")
+set_tests_properties([=[unit/object/domain/region/none]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;39;add_test;/root/repo/tests/unit/object/basic/co_domain/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-signed16.dir/main.c.o"
+  "CMakeFiles/ut-signed16.dir/main.c.o.d"
+  "ut-signed16"
+  "ut-signed16.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-signed16.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
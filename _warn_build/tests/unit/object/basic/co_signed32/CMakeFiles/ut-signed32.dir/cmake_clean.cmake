@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-signed32.dir/main.c.o"
+  "CMakeFiles/ut-signed32.dir/main.c.o.d"
+  "ut-signed32"
+  "ut-signed32.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-signed32.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-signed8.dir/main.c.o"
+  "CMakeFiles/ut-signed8.dir/main.c.o.d"
+  "ut-signed8"
+  "ut-signed8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-signed8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
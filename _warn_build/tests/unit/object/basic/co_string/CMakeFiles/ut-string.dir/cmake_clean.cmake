@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-string.dir/main.c.o"
+  "CMakeFiles/ut-string.dir/main.c.o.d"
+  "ut-string"
+  "ut-string.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-string.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
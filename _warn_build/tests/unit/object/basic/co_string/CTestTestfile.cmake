@@ -0,0 +1,28 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/basic/co_string
+# Build directory: /root/repo/_warn_build/tests/unit/object/basic/co_string
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/string/size/unknown]=] "/root/repo/_warn_build/tests/unit/object/basic/co_string/ut-string" "size_unknown")
+set_tests_properties([=[unit/object/string/size/unknown]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;0;")
+add_test([=[unit/object/string/size/known]=] "/root/repo/_warn_build/tests/unit/object/basic/co_string/ut-string" "size_known")
+set_tests_properties([=[unit/object/string/size/known]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;0;")
+add_test([=[unit/object/string/size/bad_size]=] "/root/repo/_warn_build/tests/unit/object/basic/co_string/ut-string" "bad_size")
+set_tests_properties([=[unit/object/string/size/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;0;")
+add_test([=[unit/object/string/size/cached]=] "/root/repo/_warn_build/tests/unit/object/basic/co_string/ut-string" "size_cached")
+set_tests_properties([=[unit/object/string/size/cached]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;0;")
+add_test([=[unit/object/string/read/ref]=] "/root/repo/_warn_build/tests/unit/object/basic/co_string/ut-string" "read_ref")
+set_tests_properties([=[unit/object/string/read/ref]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;0;")
+add_test([=[unit/object/string/read/part]=] "/root/repo/_warn_build/tests/unit/object/basic/co_string/ut-string" "read_part")
+set_tests_properties([=[unit/object/string/read/part]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;0;")
+add_test([=[unit/object/string/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/basic/co_string/ut-string" "read_bad_node")
+set_tests_properties([=[unit/object/string/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;0;")
+add_test([=[unit/object/string/write/ref]=] "/root/repo/_warn_build/tests/unit/object/basic/co_string/ut-string" "write_ref")
+set_tests_properties([=[unit/object/string/write/ref]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;0;")
+add_test([=[unit/object/string/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/basic/co_string/ut-string" "write_bad_node")
+set_tests_properties([=[unit/object/string/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;0;")
+add_test([=[unit/object/string/init/offset]=] "/root/repo/_warn_build/tests/unit/object/basic/co_string/ut-string" "init_offset")
+set_tests_properties([=[unit/object/string/init/offset]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;0;")
+add_test([=[unit/object/string/reset/offset]=] "/root/repo/_warn_build/tests/unit/object/basic/co_string/ut-string" "reset_offset")
+set_tests_properties([=[unit/object/string/reset/offset]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/basic/co_string/CMakeLists.txt;0;")
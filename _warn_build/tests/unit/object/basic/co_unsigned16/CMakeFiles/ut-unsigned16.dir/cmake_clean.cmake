@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-unsigned16.dir/main.c.o"
+  "CMakeFiles/ut-unsigned16.dir/main.c.o.d"
+  "ut-unsigned16"
+  "ut-unsigned16.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-unsigned16.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
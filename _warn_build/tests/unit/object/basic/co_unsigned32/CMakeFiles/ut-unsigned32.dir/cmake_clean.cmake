@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-unsigned32.dir/main.c.o"
+  "CMakeFiles/ut-unsigned32.dir/main.c.o.d"
+  "ut-unsigned32"
+  "ut-unsigned32.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-unsigned32.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
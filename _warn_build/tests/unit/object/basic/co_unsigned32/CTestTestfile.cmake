@@ -0,0 +1,36 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/basic/co_unsigned32
+# Build directory: /root/repo/_warn_build/tests/unit/object/basic/co_unsigned32
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/unsigned32/size/unknown]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "size_unknown")
+set_tests_properties([=[unit/object/unsigned32/size/unknown]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/size/known]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "size_known")
+set_tests_properties([=[unit/object/unsigned32/size/known]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/size/bad_size]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "bad_size")
+set_tests_properties([=[unit/object/unsigned32/size/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/read/ref]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "read_ref")
+set_tests_properties([=[unit/object/unsigned32/read/ref]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/read/direct]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "read_direct")
+set_tests_properties([=[unit/object/unsigned32/read/direct]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/read/nodeid]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "read_nodeid")
+set_tests_properties([=[unit/object/unsigned32/read/nodeid]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "read_bad_node")
+set_tests_properties([=[unit/object/unsigned32/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/write/ref]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "write_ref")
+set_tests_properties([=[unit/object/unsigned32/write/ref]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/write/direct]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "write_direct")
+set_tests_properties([=[unit/object/unsigned32/write/direct]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/write/nodeid]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "write_nodeid")
+set_tests_properties([=[unit/object/unsigned32/write/nodeid]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/write/pdo_async]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "write_pdo_async")
+set_tests_properties([=[unit/object/unsigned32/write/pdo_async]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/write/pdo]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "write_pdo")
+set_tests_properties([=[unit/object/unsigned32/write/pdo]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;34;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "write_bad_node")
+set_tests_properties([=[unit/object/unsigned32/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;35;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/init/unused]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "init_unused")
+set_tests_properties([=[unit/object/unsigned32/init/unused]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;36;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
+add_test([=[unit/object/unsigned32/reset/unused]=] "/root/repo/_warn_build/tests/unit/object/basic/co_unsigned32/ut-unsigned32" "reset_unused")
+set_tests_properties([=[unit/object/unsigned32/reset/unused]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;37;add_test;/root/repo/tests/unit/object/basic/co_unsigned32/CMakeLists.txt;0;")
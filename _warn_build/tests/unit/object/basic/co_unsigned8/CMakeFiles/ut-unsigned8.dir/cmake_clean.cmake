@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-unsigned8.dir/main.c.o"
+  "CMakeFiles/ut-unsigned8.dir/main.c.o.d"
+  "ut-unsigned8"
+  "ut-unsigned8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-unsigned8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("co_emcy_hist")
+subdirs("co_emcy_id")
+subdirs("co_hb_cons")
+subdirs("co_hb_cons_engine")
+subdirs("co_hb_prod")
+subdirs("co_para_async")
+subdirs("co_para_log")
+subdirs("co_para_store")
+subdirs("co_para_restore")
+subdirs("co_pdo_event")
+subdirs("co_pdo_id")
+subdirs("co_pdo_map")
+subdirs("co_pdo_num")
+subdirs("co_pdo_type")
+subdirs("co_sdo_id")
+subdirs("co_sync_cycle")
+subdirs("co_sync_id")
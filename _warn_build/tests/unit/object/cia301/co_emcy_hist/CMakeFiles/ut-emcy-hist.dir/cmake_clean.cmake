@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-emcy-hist.dir/main.c.o"
+  "CMakeFiles/ut-emcy-hist.dir/main.c.o.d"
+  "ut-emcy-hist"
+  "ut-emcy-hist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-emcy-hist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
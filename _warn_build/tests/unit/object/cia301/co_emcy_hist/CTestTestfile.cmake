@@ -0,0 +1,36 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_emcy_hist
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/emcy-hist/size/sub_0]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "size_sub_0")
+set_tests_properties([=[unit/object/emcy-hist/size/sub_0]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/size/sub_1]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "size_sub_1")
+set_tests_properties([=[unit/object/emcy-hist/size/sub_1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/size/bad_size]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "bad_size")
+set_tests_properties([=[unit/object/emcy-hist/size/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/read/sub_0]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "read_sub_0")
+set_tests_properties([=[unit/object/emcy-hist/read/sub_0]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/read/sub_1]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "read_sub_1")
+set_tests_properties([=[unit/object/emcy-hist/read/sub_1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "read_bad_node")
+set_tests_properties([=[unit/object/emcy-hist/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/write/reset]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "write_reset")
+set_tests_properties([=[unit/object/emcy-hist/write/reset]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/write/no_reset]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "write_no_reset")
+set_tests_properties([=[unit/object/emcy-hist/write/no_reset]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/write/sub_1]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "write_sub_1")
+set_tests_properties([=[unit/object/emcy-hist/write/sub_1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "write_bad_node")
+set_tests_properties([=[unit/object/emcy-hist/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/init/hist_min]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "init_hist_min")
+set_tests_properties([=[unit/object/emcy-hist/init/hist_min]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/init/hist_8]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "init_hist_8")
+set_tests_properties([=[unit/object/emcy-hist/init/hist_8]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;34;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/init/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "init_bad_index")
+set_tests_properties([=[unit/object/emcy-hist/init/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;35;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/init/bad_hist]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "init_bad_hist")
+set_tests_properties([=[unit/object/emcy-hist/init/bad_hist]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;36;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
+add_test([=[unit/object/emcy-hist/reset/unused]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_emcy_hist/ut-emcy-hist" "reset_unused")
+set_tests_properties([=[unit/object/emcy-hist/reset/unused]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;37;add_test;/root/repo/tests/unit/object/cia301/co_emcy_hist/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-emcy-id.dir/main.c.o"
+  "CMakeFiles/ut-emcy-id.dir/main.c.o.d"
+  "ut-emcy-id"
+  "ut-emcy-id.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-emcy-id.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
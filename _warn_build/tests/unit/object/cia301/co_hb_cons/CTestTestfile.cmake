@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_hb_cons
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/hb-cons/size/sub_0]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons/ut-hb-cons" "size_sub_0")
+set_tests_properties([=[unit/object/hb-cons/size/sub_0]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/size/consumer]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons/ut-hb-cons" "size_consumer")
+set_tests_properties([=[unit/object/hb-cons/size/consumer]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/size/bad_size]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons/ut-hb-cons" "size_bad_size")
+set_tests_properties([=[unit/object/hb-cons/size/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/read/sub_0]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons/ut-hb-cons" "read_sub_0")
+set_tests_properties([=[unit/object/hb-cons/read/sub_0]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/read/consumer]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons/ut-hb-cons" "read_consumer")
+set_tests_properties([=[unit/object/hb-cons/read/consumer]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons/ut-hb-cons" "read_bad_node")
+set_tests_properties([=[unit/object/hb-cons/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/write/sub_0]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons/ut-hb-cons" "write_sub_0")
+set_tests_properties([=[unit/object/hb-cons/write/sub_0]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/write/consumer]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons/ut-hb-cons" "write_consumer")
+set_tests_properties([=[unit/object/hb-cons/write/consumer]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons/ut-hb-cons" "write_bad_node")
+set_tests_properties([=[unit/object/hb-cons/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/init/single]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons/ut-hb-cons" "init_single")
+set_tests_properties([=[unit/object/hb-cons/init/single]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/init/multiple]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons/ut-hb-cons" "init_multiple")
+set_tests_properties([=[unit/object/hb-cons/init/multiple]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/init/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons/ut-hb-cons" "init_bad_index")
+set_tests_properties([=[unit/object/hb-cons/init/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;34;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/reset/unused]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons/ut-hb-cons" "reset_unused")
+set_tests_properties([=[unit/object/hb-cons/reset/unused]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;35;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons/CMakeLists.txt;0;")
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/main.c" "tests/unit/object/cia301/co_hb_cons_engine/CMakeFiles/ut-hb-cons-engine-table.dir/main.c.o" "gcc" "tests/unit/object/cia301/co_hb_cons_engine/CMakeFiles/ut-hb-cons-engine-table.dir/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/CMakeFiles/ut-canopen-stack-hbc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-hb-cons-engine.dir/main.c.o"
+  "CMakeFiles/ut-hb-cons-engine.dir/main.c.o.d"
+  "ut-hb-cons-engine"
+  "ut-hb-cons-engine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-hb-cons-engine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
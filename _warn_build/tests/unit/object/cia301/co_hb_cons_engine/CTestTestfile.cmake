@@ -0,0 +1,38 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_hb_cons_engine
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/hb-cons/engine/timer/wait]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine" "wait")
+set_tests_properties([=[unit/object/hb-cons/engine/timer/wait]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;47;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/timer/miss]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine" "miss")
+set_tests_properties([=[unit/object/hb-cons/engine/timer/miss]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;48;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/timer/restart]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine" "restart")
+set_tests_properties([=[unit/object/hb-cons/engine/timer/restart]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;49;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/timer/repeat]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine" "repeat")
+set_tests_properties([=[unit/object/hb-cons/engine/timer/repeat]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;50;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/timer/state]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine" "state")
+set_tests_properties([=[unit/object/hb-cons/engine/timer/state]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;51;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/timer/double]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine" "double")
+set_tests_properties([=[unit/object/hb-cons/engine/timer/double]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;52;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/timer/disable]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine" "disable")
+set_tests_properties([=[unit/object/hb-cons/engine/timer/disable]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;53;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/timer/many]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine" "many")
+set_tests_properties([=[unit/object/hb-cons/engine/timer/many]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;54;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/table/wait]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine-table" "wait")
+set_tests_properties([=[unit/object/hb-cons/engine/table/wait]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;58;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/table/miss]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine-table" "miss")
+set_tests_properties([=[unit/object/hb-cons/engine/table/miss]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;59;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/table/restart]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine-table" "restart")
+set_tests_properties([=[unit/object/hb-cons/engine/table/restart]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;60;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/table/repeat]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine-table" "repeat")
+set_tests_properties([=[unit/object/hb-cons/engine/table/repeat]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;61;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/table/state]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine-table" "state")
+set_tests_properties([=[unit/object/hb-cons/engine/table/state]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;62;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/table/double]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine-table" "double")
+set_tests_properties([=[unit/object/hb-cons/engine/table/double]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;63;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/table/disable]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine-table" "disable")
+set_tests_properties([=[unit/object/hb-cons/engine/table/disable]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;64;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-cons/engine/table/many]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_cons_engine/ut-hb-cons-engine-table" "many")
+set_tests_properties([=[unit/object/hb-cons/engine/table/many]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;65;add_test;/root/repo/tests/unit/object/cia301/co_hb_cons_engine/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-hb-prod.dir/main.c.o"
+  "CMakeFiles/ut-hb-prod.dir/main.c.o.d"
+  "ut-hb-prod"
+  "ut-hb-prod.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-hb-prod.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
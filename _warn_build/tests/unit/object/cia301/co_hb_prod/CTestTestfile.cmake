@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_hb_prod
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/hb-prod/size/unknown]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod/ut-hb-prod" "size_unknown")
+set_tests_properties([=[unit/object/hb-prod/size/unknown]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-prod/size/known]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod/ut-hb-prod" "size_known")
+set_tests_properties([=[unit/object/hb-prod/size/known]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-prod/size/bad_size]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod/ut-hb-prod" "size_bad_size")
+set_tests_properties([=[unit/object/hb-prod/size/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-prod/read/time]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod/ut-hb-prod" "read_time")
+set_tests_properties([=[unit/object/hb-prod/read/time]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-prod/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod/ut-hb-prod" "read_bad_node")
+set_tests_properties([=[unit/object/hb-prod/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-prod/write/start]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod/ut-hb-prod" "write_start")
+set_tests_properties([=[unit/object/hb-prod/write/start]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-prod/write/restart]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod/ut-hb-prod" "write_restart")
+set_tests_properties([=[unit/object/hb-prod/write/restart]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-prod/write/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod/ut-hb-prod" "write_bad_index")
+set_tests_properties([=[unit/object/hb-prod/write/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-prod/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod/ut-hb-prod" "write_bad_node")
+set_tests_properties([=[unit/object/hb-prod/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-prod/init/check]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod/ut-hb-prod" "init_check")
+set_tests_properties([=[unit/object/hb-prod/init/check]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-prod/init/start]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod/ut-hb-prod" "init_start")
+set_tests_properties([=[unit/object/hb-prod/init/start]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-prod/init/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod/ut-hb-prod" "init_bad_index")
+set_tests_properties([=[unit/object/hb-prod/init/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;34;add_test;/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;0;")
+add_test([=[unit/object/hb-prod/reset/unused]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_hb_prod/ut-hb-prod" "reset_unused")
+set_tests_properties([=[unit/object/hb-prod/reset/unused]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;35;add_test;/root/repo/tests/unit/object/cia301/co_hb_prod/CMakeLists.txt;0;")
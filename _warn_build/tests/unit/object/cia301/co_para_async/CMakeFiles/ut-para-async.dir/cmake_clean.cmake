@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-para-async.dir/main.c.o"
+  "CMakeFiles/ut-para-async.dir/main.c.o.d"
+  "ut-para-async"
+  "ut-para-async.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-para-async.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
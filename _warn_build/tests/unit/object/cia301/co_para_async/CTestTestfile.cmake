@@ -0,0 +1,28 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_para_async
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_para_async
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/para-async/start]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_async/ut-para-async" "start")
+set_tests_properties([=[unit/object/para-async/start]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;45;add_test;/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;0;")
+add_test([=[unit/object/para-async/snapshot]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_async/ut-para-async" "snapshot")
+set_tests_properties([=[unit/object/para-async/snapshot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;46;add_test;/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;0;")
+add_test([=[unit/object/para-async/chunks]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_async/ut-para-async" "chunks")
+set_tests_properties([=[unit/object/para-async/chunks]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;47;add_test;/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;0;")
+add_test([=[unit/object/para-async/busy]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_async/ut-para-async" "busy")
+set_tests_properties([=[unit/object/para-async/busy]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;48;add_test;/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;0;")
+add_test([=[unit/object/para-async/nvm_err]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_async/ut-para-async" "nvm_err")
+set_tests_properties([=[unit/object/para-async/nvm_err]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;49;add_test;/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;0;")
+add_test([=[unit/object/para-async/all]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_async/ut-para-async" "all")
+set_tests_properties([=[unit/object/para-async/all]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;50;add_test;/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;0;")
+add_test([=[unit/object/para-async/flush]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_async/ut-para-async" "flush")
+set_tests_properties([=[unit/object/para-async/flush]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;51;add_test;/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;0;")
+add_test([=[unit/object/para-async/pending]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_async/ut-para-async" "pending")
+set_tests_properties([=[unit/object/para-async/pending]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;52;add_test;/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;0;")
+add_test([=[unit/object/para-async/pending_other]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_async/ut-para-async" "pending_other")
+set_tests_properties([=[unit/object/para-async/pending_other]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;53;add_test;/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;0;")
+add_test([=[unit/object/para-async/dirty]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_async/ut-para-async" "dirty")
+set_tests_properties([=[unit/object/para-async/dirty]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;54;add_test;/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;0;")
+add_test([=[unit/object/para-async/dirty_err]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_async/ut-para-async" "dirty_err")
+set_tests_properties([=[unit/object/para-async/dirty_err]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;55;add_test;/root/repo/tests/unit/object/cia301/co_para_async/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-para-log.dir/main.c.o"
+  "CMakeFiles/ut-para-log.dir/main.c.o.d"
+  "ut-para-log"
+  "ut-para-log.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-para-log.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
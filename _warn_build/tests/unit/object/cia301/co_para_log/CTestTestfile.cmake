@@ -0,0 +1,24 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_para_log
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_para_log
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/para-log/empty]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_log/ut-para-log" "empty")
+set_tests_properties([=[unit/object/para-log/empty]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;45;add_test;/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;0;")
+add_test([=[unit/object/para-log/reboot]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_log/ut-para-log" "reboot")
+set_tests_properties([=[unit/object/para-log/reboot]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;46;add_test;/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;0;")
+add_test([=[unit/object/para-log/latest]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_log/ut-para-log" "latest")
+set_tests_properties([=[unit/object/para-log/latest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;47;add_test;/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;0;")
+add_test([=[unit/object/para-log/torn]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_log/ut-para-log" "torn")
+set_tests_properties([=[unit/object/para-log/torn]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;48;add_test;/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;0;")
+add_test([=[unit/object/para-log/corrupt]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_log/ut-para-log" "corrupt")
+set_tests_properties([=[unit/object/para-log/corrupt]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;49;add_test;/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;0;")
+add_test([=[unit/object/para-log/swap]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_log/ut-para-log" "swap")
+set_tests_properties([=[unit/object/para-log/swap]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;50;add_test;/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;0;")
+add_test([=[unit/object/para-log/torn_swap]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_log/ut-para-log" "torn_swap")
+set_tests_properties([=[unit/object/para-log/torn_swap]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;51;add_test;/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;0;")
+add_test([=[unit/object/para-log/boot_scan]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_log/ut-para-log" "boot_scan")
+set_tests_properties([=[unit/object/para-log/boot_scan]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;52;add_test;/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;0;")
+add_test([=[unit/object/para-log/store]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_log/ut-para-log" "store")
+set_tests_properties([=[unit/object/para-log/store]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;53;add_test;/root/repo/tests/unit/object/cia301/co_para_log/CMakeLists.txt;0;")
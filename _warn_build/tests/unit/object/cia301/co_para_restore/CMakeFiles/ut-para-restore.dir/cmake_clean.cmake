@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-para-restore.dir/main.c.o"
+  "CMakeFiles/ut-para-restore.dir/main.c.o.d"
+  "ut-para-restore"
+  "ut-para-restore.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-para-restore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_para_restore
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_para_restore
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/para-restore/size/sub_0]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "size_sub_0")
+set_tests_properties([=[unit/object/para-restore/size/sub_0]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
+add_test([=[unit/object/para-restore/size/sub_1]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "size_sub_1")
+set_tests_properties([=[unit/object/para-restore/size/sub_1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
+add_test([=[unit/object/para-restore/size/bad_size]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "size_bad_size")
+set_tests_properties([=[unit/object/para-restore/size/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
+add_test([=[unit/object/para-restore/read/enabled]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "read_enabled")
+set_tests_properties([=[unit/object/para-restore/read/enabled]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
+add_test([=[unit/object/para-restore/read/disabled]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "read_disabled")
+set_tests_properties([=[unit/object/para-restore/read/disabled]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
+add_test([=[unit/object/para-restore/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "read_bad_node")
+set_tests_properties([=[unit/object/para-restore/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
+add_test([=[unit/object/para-restore/write/single]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "write_single")
+set_tests_properties([=[unit/object/para-restore/write/single]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
+add_test([=[unit/object/para-restore/write/all]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "write_all")
+set_tests_properties([=[unit/object/para-restore/write/all]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
+add_test([=[unit/object/para-restore/write/bad_signature]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "write_bad_signature")
+set_tests_properties([=[unit/object/para-restore/write/bad_signature]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
+add_test([=[unit/object/para-restore/write/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "write_bad_index")
+set_tests_properties([=[unit/object/para-restore/write/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
+add_test([=[unit/object/para-restore/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "write_bad_node")
+set_tests_properties([=[unit/object/para-restore/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
+add_test([=[unit/object/para-restore/init/check]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "init_check")
+set_tests_properties([=[unit/object/para-restore/init/check]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;34;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
+add_test([=[unit/object/para-restore/init/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "init_bad_index")
+set_tests_properties([=[unit/object/para-restore/init/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;35;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
+add_test([=[unit/object/para-restore/reset/unused]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_restore/ut-para-restore" "reset_unused")
+set_tests_properties([=[unit/object/para-restore/reset/unused]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;36;add_test;/root/repo/tests/unit/object/cia301/co_para_restore/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-para-store.dir/main.c.o"
+  "CMakeFiles/ut-para-store.dir/main.c.o.d"
+  "ut-para-store"
+  "ut-para-store.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-para-store.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
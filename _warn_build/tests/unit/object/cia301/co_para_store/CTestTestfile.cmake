@@ -0,0 +1,36 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_para_store
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_para_store
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/para-store/size/sub_0]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "size_sub_0")
+set_tests_properties([=[unit/object/para-store/size/sub_0]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/size/sub_1]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "size_sub_1")
+set_tests_properties([=[unit/object/para-store/size/sub_1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/size/bad_size]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "size_bad_size")
+set_tests_properties([=[unit/object/para-store/size/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/read/enabled]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "read_enabled")
+set_tests_properties([=[unit/object/para-store/read/enabled]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/read/autonomous]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "read_autonomous")
+set_tests_properties([=[unit/object/para-store/read/autonomous]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "read_bad_node")
+set_tests_properties([=[unit/object/para-store/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/write/single]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "write_single")
+set_tests_properties([=[unit/object/para-store/write/single]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/write/all]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "write_all")
+set_tests_properties([=[unit/object/para-store/write/all]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/write/bad_signature]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "write_bad_signature")
+set_tests_properties([=[unit/object/para-store/write/bad_signature]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/write/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "write_bad_index")
+set_tests_properties([=[unit/object/para-store/write/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "write_bad_node")
+set_tests_properties([=[unit/object/para-store/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/init/check]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "init_check")
+set_tests_properties([=[unit/object/para-store/init/check]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;34;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/init/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "init_bad_index")
+set_tests_properties([=[unit/object/para-store/init/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;35;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/reset/com]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "reset_com")
+set_tests_properties([=[unit/object/para-store/reset/com]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;36;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
+add_test([=[unit/object/para-store/reset/node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_para_store/ut-para-store" "reset_node")
+set_tests_properties([=[unit/object/para-store/reset/node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;37;add_test;/root/repo/tests/unit/object/cia301/co_para_store/CMakeLists.txt;0;")
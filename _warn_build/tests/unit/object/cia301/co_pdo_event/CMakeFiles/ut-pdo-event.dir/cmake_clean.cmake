@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-pdo-event.dir/main.c.o"
+  "CMakeFiles/ut-pdo-event.dir/main.c.o.d"
+  "ut-pdo-event"
+  "ut-pdo-event.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-pdo-event.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_pdo_event
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/pdo-event/size/unknown]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "size_unknown")
+set_tests_properties([=[unit/object/pdo-event/size/unknown]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-event/size/known]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "size_known")
+set_tests_properties([=[unit/object/pdo-event/size/known]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-event/size/bad_size]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "size_bad_size")
+set_tests_properties([=[unit/object/pdo-event/size/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-event/read/ref]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "read_ref")
+set_tests_properties([=[unit/object/pdo-event/read/ref]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-event/read/direct]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "read_direct")
+set_tests_properties([=[unit/object/pdo-event/read/direct]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-event/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "read_bad_node")
+set_tests_properties([=[unit/object/pdo-event/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-event/write/start]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "write_start")
+set_tests_properties([=[unit/object/pdo-event/write/start]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-event/write/change]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "write_change")
+set_tests_properties([=[unit/object/pdo-event/write/change]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-event/write/stop]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "write_stop")
+set_tests_properties([=[unit/object/pdo-event/write/stop]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-event/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "write_bad_node")
+set_tests_properties([=[unit/object/pdo-event/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-event/init/check]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "init_check")
+set_tests_properties([=[unit/object/pdo-event/init/check]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-event/init/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "init_bad_index")
+set_tests_properties([=[unit/object/pdo-event/init/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;34;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-event/init/bad_sub]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "init_bad_sub")
+set_tests_properties([=[unit/object/pdo-event/init/bad_sub]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;35;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-event/reset/unused]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_event/ut-pdo-event" "reset_unused")
+set_tests_properties([=[unit/object/pdo-event/reset/unused]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;36;add_test;/root/repo/tests/unit/object/cia301/co_pdo_event/CMakeLists.txt;0;")
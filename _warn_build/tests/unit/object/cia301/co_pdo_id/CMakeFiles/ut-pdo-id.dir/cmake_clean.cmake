@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-pdo-id.dir/main.c.o"
+  "CMakeFiles/ut-pdo-id.dir/main.c.o.d"
+  "ut-pdo-id"
+  "ut-pdo-id.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-pdo-id.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
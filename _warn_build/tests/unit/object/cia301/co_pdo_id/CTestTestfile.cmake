@@ -0,0 +1,34 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_pdo_id
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/pdo-id/size/unknown]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "size_unknown")
+set_tests_properties([=[unit/object/pdo-id/size/unknown]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-id/size/known]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "size_known")
+set_tests_properties([=[unit/object/pdo-id/size/known]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-id/size/size]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "bad_size")
+set_tests_properties([=[unit/object/pdo-id/size/size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-id/read/ref]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "read_ref")
+set_tests_properties([=[unit/object/pdo-id/read/ref]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-id/read/direct]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "read_direct")
+set_tests_properties([=[unit/object/pdo-id/read/direct]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-id/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "read_bad_node")
+set_tests_properties([=[unit/object/pdo-id/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-id/write/activate]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "write_activate")
+set_tests_properties([=[unit/object/pdo-id/write/activate]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-id/write/deactivate]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "write_deactivate")
+set_tests_properties([=[unit/object/pdo-id/write/deactivate]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-id/write/active]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "write_active")
+set_tests_properties([=[unit/object/pdo-id/write/active]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-id/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "write_bad_node")
+set_tests_properties([=[unit/object/pdo-id/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-id/init/check]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "init_check")
+set_tests_properties([=[unit/object/pdo-id/init/check]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-id/init/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "init_bad_index")
+set_tests_properties([=[unit/object/pdo-id/init/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;34;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-id/init/bad_sub]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "init_bad_sub")
+set_tests_properties([=[unit/object/pdo-id/init/bad_sub]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;35;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-id/reset/unused]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_id/ut-pdo-id" "reset_unused")
+set_tests_properties([=[unit/object/pdo-id/reset/unused]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;36;add_test;/root/repo/tests/unit/object/cia301/co_pdo_id/CMakeLists.txt;0;")
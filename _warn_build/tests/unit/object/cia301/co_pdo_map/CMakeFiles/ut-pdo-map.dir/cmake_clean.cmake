@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-pdo-map.dir/main.c.o"
+  "CMakeFiles/ut-pdo-map.dir/main.c.o.d"
+  "ut-pdo-map"
+  "ut-pdo-map.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-pdo-map.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_pdo_map
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_pdo_map
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/pdo-map/size/unknown]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_map/ut-pdo-map" "size_unknown")
+set_tests_properties([=[unit/object/pdo-map/size/unknown]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-map/size/known]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_map/ut-pdo-map" "size_known")
+set_tests_properties([=[unit/object/pdo-map/size/known]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-map/size/bad_size]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_map/ut-pdo-map" "size_bad_size")
+set_tests_properties([=[unit/object/pdo-map/size/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-map/read/ref]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_map/ut-pdo-map" "read_ref")
+set_tests_properties([=[unit/object/pdo-map/read/ref]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-map/read/direct]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_map/ut-pdo-map" "read_direct")
+set_tests_properties([=[unit/object/pdo-map/read/direct]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-map/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_map/ut-pdo-map" "read_bad_node")
+set_tests_properties([=[unit/object/pdo-map/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-map/write/mapping]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_map/ut-pdo-map" "write_mapping")
+set_tests_properties([=[unit/object/pdo-map/write/mapping]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-map/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_map/ut-pdo-map" "write_bad_node")
+set_tests_properties([=[unit/object/pdo-map/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-map/init/check]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_map/ut-pdo-map" "init_check")
+set_tests_properties([=[unit/object/pdo-map/init/check]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-map/init/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_map/ut-pdo-map" "init_bad_index")
+set_tests_properties([=[unit/object/pdo-map/init/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-map/reset/unused]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_map/ut-pdo-map" "reset_unused")
+set_tests_properties([=[unit/object/pdo-map/reset/unused]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/cia301/co_pdo_map/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-pdo-num.dir/main.c.o"
+  "CMakeFiles/ut-pdo-num.dir/main.c.o.d"
+  "ut-pdo-num"
+  "ut-pdo-num.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-pdo-num.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_pdo_num
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_pdo_num
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/pdo-num/size/unknown]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_num/ut-pdo-num" "size_unknown")
+set_tests_properties([=[unit/object/pdo-num/size/unknown]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-num/size/known]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_num/ut-pdo-num" "size_known")
+set_tests_properties([=[unit/object/pdo-num/size/known]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-num/size/bad_size]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_num/ut-pdo-num" "size_bad_size")
+set_tests_properties([=[unit/object/pdo-num/size/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-num/read/ref]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_num/ut-pdo-num" "read_ref")
+set_tests_properties([=[unit/object/pdo-num/read/ref]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-num/read/direct]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_num/ut-pdo-num" "read_direct")
+set_tests_properties([=[unit/object/pdo-num/read/direct]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-num/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_num/ut-pdo-num" "read_bad_node")
+set_tests_properties([=[unit/object/pdo-num/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-num/write/num]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_num/ut-pdo-num" "write_num")
+set_tests_properties([=[unit/object/pdo-num/write/num]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-num/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_num/ut-pdo-num" "write_bad_node")
+set_tests_properties([=[unit/object/pdo-num/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-num/init/check]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_num/ut-pdo-num" "init_check")
+set_tests_properties([=[unit/object/pdo-num/init/check]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-num/init/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_num/ut-pdo-num" "init_bad_index")
+set_tests_properties([=[unit/object/pdo-num/init/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-num/init/bad_sub]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_num/ut-pdo-num" "init_bad_sub")
+set_tests_properties([=[unit/object/pdo-num/init/bad_sub]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-num/reset/unused]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_num/ut-pdo-num" "reset_unused")
+set_tests_properties([=[unit/object/pdo-num/reset/unused]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;34;add_test;/root/repo/tests/unit/object/cia301/co_pdo_num/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-pdo-type.dir/main.c.o"
+  "CMakeFiles/ut-pdo-type.dir/main.c.o.d"
+  "ut-pdo-type"
+  "ut-pdo-type.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-pdo-type.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
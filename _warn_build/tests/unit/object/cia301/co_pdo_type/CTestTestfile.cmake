@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_pdo_type
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_pdo_type
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/pdo-type/size/unknown]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_type/ut-pdo-type" "size_unknown")
+set_tests_properties([=[unit/object/pdo-type/size/unknown]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-type/size/known]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_type/ut-pdo-type" "size_known")
+set_tests_properties([=[unit/object/pdo-type/size/known]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-type/size/bad_size]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_type/ut-pdo-type" "size_bad_size")
+set_tests_properties([=[unit/object/pdo-type/size/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-type/read/ref]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_type/ut-pdo-type" "read_ref")
+set_tests_properties([=[unit/object/pdo-type/read/ref]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-type/read/direct]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_type/ut-pdo-type" "read_direct")
+set_tests_properties([=[unit/object/pdo-type/read/direct]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-type/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_type/ut-pdo-type" "read_bad_node")
+set_tests_properties([=[unit/object/pdo-type/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-type/write/num]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_type/ut-pdo-type" "write_num")
+set_tests_properties([=[unit/object/pdo-type/write/num]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-type/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_type/ut-pdo-type" "write_bad_node")
+set_tests_properties([=[unit/object/pdo-type/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-type/init/check]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_type/ut-pdo-type" "init_check")
+set_tests_properties([=[unit/object/pdo-type/init/check]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-type/init/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_type/ut-pdo-type" "init_bad_index")
+set_tests_properties([=[unit/object/pdo-type/init/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-type/init/bad_sub]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_type/ut-pdo-type" "init_bad_sub")
+set_tests_properties([=[unit/object/pdo-type/init/bad_sub]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;0;")
+add_test([=[unit/object/pdo-type/reset/unused]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_pdo_type/ut-pdo-type" "reset_unused")
+set_tests_properties([=[unit/object/pdo-type/reset/unused]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;34;add_test;/root/repo/tests/unit/object/cia301/co_pdo_type/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-sdo-id.dir/main.c.o"
+  "CMakeFiles/ut-sdo-id.dir/main.c.o.d"
+  "ut-sdo-id"
+  "ut-sdo-id.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-sdo-id.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-sync-cycle.dir/main.c.o"
+  "CMakeFiles/ut-sync-cycle.dir/main.c.o.d"
+  "ut-sync-cycle"
+  "ut-sync-cycle.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-sync-cycle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/unit/object/cia301/co_sync_cycle
+# Build directory: /root/repo/_warn_build/tests/unit/object/cia301/co_sync_cycle
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit/object/sync-cycle/size/unknown]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_sync_cycle/ut-sync-cycle" "size_unknown")
+set_tests_properties([=[unit/object/sync-cycle/size/unknown]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;23;add_test;/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;0;")
+add_test([=[unit/object/sync-cycle/size/known]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_sync_cycle/ut-sync-cycle" "size_known")
+set_tests_properties([=[unit/object/sync-cycle/size/known]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;24;add_test;/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;0;")
+add_test([=[unit/object/sync-cycle/size/bad_size]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_sync_cycle/ut-sync-cycle" "size_bad_size")
+set_tests_properties([=[unit/object/sync-cycle/size/bad_size]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;25;add_test;/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;0;")
+add_test([=[unit/object/sync-cycle/read/time]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_sync_cycle/ut-sync-cycle" "read_time")
+set_tests_properties([=[unit/object/sync-cycle/read/time]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;26;add_test;/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;0;")
+add_test([=[unit/object/sync-cycle/read/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_sync_cycle/ut-sync-cycle" "read_bad_node")
+set_tests_properties([=[unit/object/sync-cycle/read/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;27;add_test;/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;0;")
+add_test([=[unit/object/sync-cycle/write/active]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_sync_cycle/ut-sync-cycle" "write_active")
+set_tests_properties([=[unit/object/sync-cycle/write/active]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;28;add_test;/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;0;")
+add_test([=[unit/object/sync-cycle/write/inactive]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_sync_cycle/ut-sync-cycle" "write_inactive")
+set_tests_properties([=[unit/object/sync-cycle/write/inactive]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;29;add_test;/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;0;")
+add_test([=[unit/object/sync-cycle/write/bad_node]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_sync_cycle/ut-sync-cycle" "write_bad_node")
+set_tests_properties([=[unit/object/sync-cycle/write/bad_node]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;30;add_test;/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;0;")
+add_test([=[unit/object/sync-cycle/init/check]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_sync_cycle/ut-sync-cycle" "init_check")
+set_tests_properties([=[unit/object/sync-cycle/init/check]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;31;add_test;/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;0;")
+add_test([=[unit/object/sync-cycle/init/bad_index]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_sync_cycle/ut-sync-cycle" "init_bad_index")
+set_tests_properties([=[unit/object/sync-cycle/init/bad_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;32;add_test;/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;0;")
+add_test([=[unit/object/sync-cycle/init/bad_sub]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_sync_cycle/ut-sync-cycle" "init_bad_sub")
+set_tests_properties([=[unit/object/sync-cycle/init/bad_sub]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;33;add_test;/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;0;")
+add_test([=[unit/object/sync-cycle/reset/unused]=] "/root/repo/_warn_build/tests/unit/object/cia301/co_sync_cycle/ut-sync-cycle" "reset_unused")
+set_tests_properties([=[unit/object/sync-cycle/reset/unused]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;34;add_test;/root/repo/tests/unit/object/cia301/co_sync_cycle/CMakeLists.txt;0;")
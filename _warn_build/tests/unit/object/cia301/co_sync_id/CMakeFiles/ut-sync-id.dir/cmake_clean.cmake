@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-sync-id.dir/main.c.o"
+  "CMakeFiles/ut-sync-id.dir/main.c.o.d"
+  "ut-sync-id"
+  "ut-sync-id.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut-sync-id.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -24,32 +24,10 @@
 * PRIVATE DEFINES
 ******************************************************************************/
 
-/* queue length is 128 messages per CAN bus and direction(send/receive) */
-#define SIM_CAN_Q_LEN               128u
-
 #define SIM_CAN_STAT_PASSIVE        (uint32_t)0x00000000
 #define SIM_CAN_STAT_INIT           (uint32_t)0x00000001
 #define SIM_CAN_STAT_ACTIVE         (uint32_t)0x00000002
 
-/******************************************************************************
-* PRIVATE TYPES
-******************************************************************************/
-
-typedef struct SIM_CAN_BUS_T {
-    struct SIM_CAN_BUS_T *Addr;
-    uint32_t              Status;
-    uint32_t              Baudrate;
-    uint32_t              TxOvr;
-    uint32_t              RxOvr;
-    CO_IF_FRM            *RxRd;
-    CO_IF_FRM            *RxWr;
-    CO_IF_FRM            *TxRd;
-    CO_IF_FRM            *TxWr;
-    CO_IF_FRM             RxQ[SIM_CAN_Q_LEN];
-    CO_IF_FRM             TxQ[SIM_CAN_Q_LEN];
-    SIM_CAN_IRQ           Handler;
-} SIM_CAN_BUS;
-
 /******************************************************************************
 * PRIVATE VARIABLES
 ******************************************************************************/
@@ -60,13 +38,32 @@ static SIM_CAN_BUS CanBus = { 0u };
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
+static void    SimBusInit     (SIM_CAN_BUS *bus);
+static void    SimBusEnable   (SIM_CAN_BUS *bus, uint32_t baudrate);
+static int16_t SimBusSend     (SIM_CAN_BUS *bus, CO_IF_FRM *frm);
+static int16_t SimBusRead     (SIM_CAN_BUS *bus, CO_IF_FRM *frm);
+static int16_t SimBusReadBatch(SIM_CAN_BUS *bus, CO_IF_FRM *frm, uint16_t max);
+static void    SimBusReset    (SIM_CAN_BUS *bus);
+static void    SimBusClose    (SIM_CAN_BUS *bus);
+
 static void    DrvCanInit   (void);
 static void    DrvCanEnable (uint32_t baudrate);
 static int16_t DrvCanSend   (CO_IF_FRM *frm);
 static int16_t DrvCanRead   (CO_IF_FRM *frm);
+static int16_t DrvCanReadBatch(CO_IF_FRM *frm, uint16_t max);
 static void    DrvCanReset  (void);
 static void    DrvCanClose  (void);
 
+#if USE_NODE_CTX
+static void    DrvCanCtxInit     (void *ctx);
+static void    DrvCanCtxEnable   (void *ctx, uint32_t baudrate);
+static int16_t DrvCanCtxSend     (void *ctx, CO_IF_FRM *frm);
+static int16_t DrvCanCtxRead     (void *ctx, CO_IF_FRM *frm);
+static int16_t DrvCanCtxReadBatch(void *ctx, CO_IF_FRM *frm, uint16_t max);
+static void    DrvCanCtxReset    (void *ctx);
+static void    DrvCanCtxClose    (void *ctx);
+#endif //USE_NODE_CTX
+
 /******************************************************************************
 * PUBLIC VARIABLE
 ******************************************************************************/
@@ -77,17 +74,34 @@ const CO_IF_CAN_DRV SimCanDriver = {
     DrvCanRead,
     DrvCanSend,
     DrvCanReset,
-    DrvCanClose
+    DrvCanClose,
+    DrvCanReadBatch,
+    NULL,                /* optional: Filter()    */
+    NULL,                /* optional: TxFree()    */
+    NULL                 /* optional: TxDone()    */
 };
 
+#if USE_NODE_CTX
+const CO_IF_CAN_CTX_DRV SimCanCtxDriver = {
+    DrvCanCtxInit,
+    DrvCanCtxEnable,
+    DrvCanCtxRead,
+    DrvCanCtxSend,
+    DrvCanCtxReset,
+    DrvCanCtxClose,
+    DrvCanCtxReadBatch,
+    NULL,                /* optional: Filter()    */
+    NULL,                /* optional: TxFree()    */
+    NULL                 /* optional: TxDone()    */
+};
+#endif //USE_NODE_CTX
+
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void DrvCanInit(void)
+static void SimBusInit(SIM_CAN_BUS *bus)
 {
-    SIM_CAN_BUS *bus = &CanBus;
-
     if (bus->Addr == bus) {                           /* reset init state    */
         bus->Status = SIM_CAN_STAT_INIT; 
     } else {                                          /* initialize bus      */
@@ -103,18 +117,15 @@ static void DrvCanInit(void)
     bus->TxRd     = &bus->TxQ[0u];
 }
 
-static void DrvCanEnable(uint32_t baudrate)
+static void SimBusEnable(SIM_CAN_BUS *bus, uint32_t baudrate)
 {
-    SIM_CAN_BUS *bus = &CanBus;
-
     bus->Status   |= SIM_CAN_STAT_ACTIVE;
     bus->Baudrate  = baudrate;
 }
 
-static int16_t DrvCanSend(CO_IF_FRM *frm)
+static int16_t SimBusSend(SIM_CAN_BUS *bus, CO_IF_FRM *frm)
 {
     int16_t       result = 0u;
-    SIM_CAN_BUS  *bus    = &CanBus;;
     CO_IF_FRM    *tx;
     uint8_t       byte;
     
@@ -145,10 +156,9 @@ static int16_t DrvCanSend(CO_IF_FRM *frm)
     return (result);
 }
 
-static int16_t DrvCanRead (CO_IF_FRM *frm)
+static int16_t SimBusRead(SIM_CAN_BUS *bus, CO_IF_FRM *frm)
 {
     int16_t       result = 0u;
-    SIM_CAN_BUS  *bus    = &CanBus;
     CO_IF_FRM    *rx;
     uint8_t       byte;
 
@@ -177,30 +187,131 @@ static int16_t DrvCanRead (CO_IF_FRM *frm)
     return (result);
 }
 
-static void DrvCanReset(void)
+static int16_t SimBusReadBatch(SIM_CAN_BUS *bus, CO_IF_FRM *frm, uint16_t max)
 {
-    SIM_CAN_BUS *bus      = &CanBus;
-    uint32_t     baudrate = bus->Baudrate;
+    int16_t       result = 0u;
+    CO_IF_FRM    *rx;
+    uint8_t       byte;
 
-    DrvCanInit();
-    DrvCanEnable(baudrate);
+    if ((bus->Status & SIM_CAN_STAT_ACTIVE) == 0u) {   /* CAN bus is passive */
+        return ((int16_t)-1u);
+    }
+
+    while ((bus->RxRd != bus->RxWr) &&            /* CAN frame is available */
+           ((uint16_t)result < max)) {
+        rx = bus->RxRd;
+        bus->RxRd++;
+        if (bus->RxRd >= &bus->RxQ[SIM_CAN_Q_LEN]) {
+            bus->RxRd = &bus->RxQ[0u];
+        }
+
+        frm->Identifier = rx->Identifier;
+        frm->DLC        = rx->DLC;
+        for (byte = 0u; byte < 8u; byte++) {
+            if (frm->DLC > byte) {
+                frm->Data[byte] = rx->Data[byte] & 0xFFu;
+            } else {
+                frm->Data[byte] = 0u;
+            }
+        }
+        frm++;
+        result++;
+    }
+    return (result);
 }
 
-static void DrvCanClose(void)
+static void SimBusReset(SIM_CAN_BUS *bus)
 {
-    SIM_CAN_BUS *bus = &CanBus;
+    uint32_t baudrate = bus->Baudrate;
 
+    SimBusInit(bus);
+    SimBusEnable(bus, baudrate);
+}
+
+static void SimBusClose(SIM_CAN_BUS *bus)
+{
     bus->Status &= ~SIM_CAN_STAT_ACTIVE;
 }
 
+static void DrvCanInit(void)
+{
+    SimBusInit(&CanBus);
+}
+
+static void DrvCanEnable(uint32_t baudrate)
+{
+    SimBusEnable(&CanBus, baudrate);
+}
+
+static int16_t DrvCanSend(CO_IF_FRM *frm)
+{
+    return (SimBusSend(&CanBus, frm));
+}
+
+static int16_t DrvCanRead(CO_IF_FRM *frm)
+{
+    return (SimBusRead(&CanBus, frm));
+}
+
+static int16_t DrvCanReadBatch(CO_IF_FRM *frm, uint16_t max)
+{
+    return (SimBusReadBatch(&CanBus, frm, max));
+}
+
+static void DrvCanReset(void)
+{
+    SimBusReset(&CanBus);
+}
+
+static void DrvCanClose(void)
+{
+    SimBusClose(&CanBus);
+}
+
+#if USE_NODE_CTX
+static void DrvCanCtxInit(void *ctx)
+{
+    SimBusInit((SIM_CAN_BUS *)ctx);
+}
+
+static void DrvCanCtxEnable(void *ctx, uint32_t baudrate)
+{
+    SimBusEnable((SIM_CAN_BUS *)ctx, baudrate);
+}
+
+static int16_t DrvCanCtxSend(void *ctx, CO_IF_FRM *frm)
+{
+    return (SimBusSend((SIM_CAN_BUS *)ctx, frm));
+}
+
+static int16_t DrvCanCtxRead(void *ctx, CO_IF_FRM *frm)
+{
+    return (SimBusRead((SIM_CAN_BUS *)ctx, frm));
+}
+
+static int16_t DrvCanCtxReadBatch(void *ctx, CO_IF_FRM *frm, uint16_t max)
+{
+    return (SimBusReadBatch((SIM_CAN_BUS *)ctx, frm, max));
+}
+
+static void DrvCanCtxReset(void *ctx)
+{
+    SimBusReset((SIM_CAN_BUS *)ctx);
+}
+
+static void DrvCanCtxClose(void *ctx)
+{
+    SimBusClose((SIM_CAN_BUS *)ctx);
+}
+#endif //USE_NODE_CTX
+
 /******************************************************************************
 * SPECIAL PUBLIC FUNCTIONS
 ******************************************************************************/
 
-int16_t SimCanGetFrm(uint8_t *buf, uint16_t size)
+int16_t SimCanBusGetFrm(SIM_CAN_BUS *bus, uint8_t *buf, uint16_t size)
 {
     int16_t         result = 0u;
-    SIM_CAN_BUS    *bus    = &CanBus;
     CO_IF_FRM      *tx;
     CO_IF_FRM      *frm;
 
@@ -232,12 +343,11 @@ int16_t SimCanGetFrm(uint8_t *buf, uint16_t size)
     return (result);
 }
 
-int16_t SimCanSetFrm (uint32_t Identifier, uint8_t DLC,
+int16_t SimCanBusSetFrm (SIM_CAN_BUS *bus, uint32_t Identifier, uint8_t DLC,
                   uint8_t Byte0, uint8_t Byte1, uint8_t Byte2, uint8_t Byte3,
                   uint8_t Byte4, uint8_t Byte5, uint8_t Byte6, uint8_t Byte7)
 {
     int16_t       result = 0u;
-    SIM_CAN_BUS  *bus    = &CanBus;
     CO_IF_FRM    *rx;
 
     rx = bus->RxWr;
@@ -265,6 +375,20 @@ int16_t SimCanSetFrm (uint32_t Identifier, uint8_t DLC,
     return (result);
 }
 
+int16_t SimCanGetFrm(uint8_t *buf, uint16_t size)
+{
+    return (SimCanBusGetFrm(&CanBus, buf, size));
+}
+
+int16_t SimCanSetFrm (uint32_t Identifier, uint8_t DLC,
+                  uint8_t Byte0, uint8_t Byte1, uint8_t Byte2, uint8_t Byte3,
+                  uint8_t Byte4, uint8_t Byte5, uint8_t Byte6, uint8_t Byte7)
+{
+    return (SimCanBusSetFrm(&CanBus, Identifier, DLC,
+                            Byte0, Byte1, Byte2, Byte3,
+                            Byte4, Byte5, Byte6, Byte7));
+}
+
 void SimCanSetIsr(SIM_CAN_IRQ handler)
 {
     SIM_CAN_BUS *bus = &CanBus;
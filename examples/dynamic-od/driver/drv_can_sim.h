@@ -31,13 +31,37 @@ extern "C" {
 * PUBLIC TYPES
 ******************************************************************************/
 
+/* queue length is 128 messages per CAN bus and direction(send/receive) */
+#define SIM_CAN_Q_LEN               128u
+
 typedef void (*SIM_CAN_IRQ)(void);
 
+/* Simulated CAN bus: the legacy driver SimCanDriver works on a bus inside
+ * the driver, the context driver SimCanCtxDriver on the bus given as
+ * driver context. Each node gets its own bus this way. */
+typedef struct SIM_CAN_BUS_T {
+    struct SIM_CAN_BUS_T *Addr;
+    uint32_t              Status;
+    uint32_t              Baudrate;
+    uint32_t              TxOvr;
+    uint32_t              RxOvr;
+    CO_IF_FRM            *RxRd;
+    CO_IF_FRM            *RxWr;
+    CO_IF_FRM            *TxRd;
+    CO_IF_FRM            *TxWr;
+    CO_IF_FRM             RxQ[SIM_CAN_Q_LEN];
+    CO_IF_FRM             TxQ[SIM_CAN_Q_LEN];
+    SIM_CAN_IRQ           Handler;
+} SIM_CAN_BUS;
+
 /******************************************************************************
 * PUBLIC SYMBOLS
 ******************************************************************************/
 
 extern const CO_IF_CAN_DRV SimCanDriver;
+#if USE_NODE_CTX
+extern const CO_IF_CAN_CTX_DRV SimCanCtxDriver;
+#endif //USE_NODE_CTX
 
 /******************************************************************************
 * SPECIAL PUBLIC DRIVER FUNCTIONS
@@ -53,6 +77,13 @@ void        SimCanSetIsr    (SIM_CAN_IRQ handler);
 void        SimCanRun       (void);
 void        SimCanFlush     (void);
 
+/* Same interface for a simulated bus, which is used as driver context */
+int16_t     SimCanBusGetFrm (SIM_CAN_BUS *bus, uint8_t *buf, uint16_t size);
+int16_t     SimCanBusSetFrm (SIM_CAN_BUS *bus, uint32_t Identifier, uint8_t DLC,
+                             uint8_t Byte0, uint8_t Byte1, uint8_t Byte2,
+                             uint8_t Byte3, uint8_t Byte4, uint8_t Byte5,
+                             uint8_t Byte6, uint8_t Byte7);
+
 #ifdef __cplusplus               /* for compatibility with C++ environments  */
 }
 #endif
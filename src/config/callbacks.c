@@ -153,6 +153,17 @@ void COIfCanReceive(CO_IF_FRM *frm)
      */
 }
 
+WEAK
+void COIfCanTxConfirm(CO_IF_FRM *frm)
+{
+    (void)frm;
+
+    /* Optional: place here some code, which is called
+     * when a CAN message is transmitted on the CAN bus,
+     * e.g. for flow control or latency measurement.
+     */
+}
+
 WEAK
 void COPdoTransmit(CO_IF_FRM *frm)
 {
@@ -201,6 +212,19 @@ int16_t COParaDefault(struct CO_PARA_T *pg)
     return (0u);
 }
 
+#if USE_PARA_ASYNC
+WEAK
+void COParaStoreDone(struct CO_PARA_T *pg, CO_ERR err)
+{
+    (void)pg;
+    (void)err;
+
+    /* Optional: place here some code, which is called
+     * when a store command is finished in the background.
+     */
+}
+#endif //USE_PARA_ASYNC
+
 WEAK
 void CORpdoWriteData(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
 {
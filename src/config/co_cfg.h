@@ -26,6 +26,17 @@
 #define CO_SSDO_N               1
 #endif
 
+/*! \brief DEFAULT SDO SERVER PENDING TIMEOUT
+*
+*    This configuration define specifies the time in ms, which an SDO
+*    server waits for the completion of a pending object access (see
+*    COSdoComplete()). When the time is elapsed, the SDO request is
+*    aborted with a timeout.
+*/
+#ifndef CO_SSDO_PEND_TMO
+#define CO_SSDO_PEND_TMO        1000
+#endif
+
 /*! \brief DEFAULT SDO CLIENT
 *
 *    This configuration define specifies how many SDO clients the library
@@ -62,6 +73,16 @@
 #define CO_TPDO_N               4
 #endif
 
+/*! \brief DEFAULT RECEIVE BATCH SIZE
+*
+*    This configuration define specifies how many CAN frames are read from
+*    the CAN driver with a single call within CONodeProcessBatch(). The
+*    frame buffer is allocated on the stack of the caller.
+*/
+#ifndef CO_RX_BATCH_N
+#define CO_RX_BATCH_N           8
+#endif
+
 /*! \brief DEFAULT ENABLE LSS
 *
 *    This configuration define specifies whether the LSS functionality will
@@ -80,4 +101,317 @@
 #define USE_CSDO                1
 #endif
 
+/*! \brief DEFAULT SDO CLIENT BLOCK SIZE
+*
+*    This configuration define specifies the number of segments per block
+*    (1..127), which the SDO client requests for a block upload.
+*/
+#ifndef CO_CSDO_BLK_SIZE
+#define CO_CSDO_BLK_SIZE      127
+#endif
+
+/*! \brief DEFAULT CRC SLICING
+*
+*    This configuration define specifies the number of bytes, which the
+*    CRC-16 of SDO block transfers processes per step (1 or 4). Slicing by
+*    4 needs a constant lookup table of 2048 bytes, a single byte per step
+*    needs 512 bytes.
+*/
+#ifndef CO_CRC_SLICE
+#define CO_CRC_SLICE            4
+#endif
+
+/*! \brief DEFAULT ENABLE COB-ID DISPATCH TABLE
+*
+*    This configuration define specifies whether received frames are
+*    dispatched to the services with a lookup table (2 bytes per 11-bit
+*    identifier in each node), or by asking each service in turn.
+*/
+#ifndef USE_DISPATCH
+#define USE_DISPATCH            0
+#endif
+
+/*! \brief DEFAULT ENABLE CAN ACCEPTANCE FILTER
+*
+*    This configuration define specifies whether the node computes the list
+*    of consumed CAN identifiers and passes it to the optional Filter()
+*    function of the CAN driver.
+*/
+#ifndef USE_CAN_FILTER
+#define USE_CAN_FILTER          0
+#endif
+
+/*! \brief DEFAULT NUMBER OF APPLICATION FILTER IDENTIFIERS
+*
+*    This configuration define specifies the maximal number of CAN
+*    identifiers, which the application adds to the acceptance filter.
+*/
+#ifndef CO_FILTER_APP_N
+#define CO_FILTER_APP_N         8
+#endif
+
+/*! \brief DEFAULT ENABLE CAN FD
+*
+*    This configuration define specifies whether the library is built for
+*    CAN FD with up to 64 data bytes per frame. PDOs carry up to 64 bytes
+*    of mapped data and SDO segments use the larger payload.
+*/
+#ifndef USE_CAN_FD
+#define USE_CAN_FD              0
+#endif
+
+/*! \brief DEFAULT NUMBER OF PDO MAPPING ENTRIES
+*
+*    This configuration define specifies the maximal number of mapping
+*    entries per PDO. CAN FD allows up to 64 entries (one byte each).
+*/
+#ifndef CO_PDO_MAP_N
+#if USE_CAN_FD
+#define CO_PDO_MAP_N           64
+#else
+#define CO_PDO_MAP_N            8
+#endif
+#endif
+
+/*! \brief DEFAULT ENABLE TIMING WHEEL
+*
+*    This configuration define specifies whether the timer management uses
+*    a hierarchical timing wheel (constant time create, delete and expire),
+*    or the sorted delta list of timer events.
+*/
+#ifndef USE_TMR_WHEEL
+#define USE_TMR_WHEEL           0
+#endif
+
+/*! \brief DEFAULT TIMING WHEEL SIZE
+*
+*    These configuration defines specify the number of slots per level of
+*    the timing wheel (as power of two) and the number of levels. The
+*    default covers 2^18 ticks; actions with a longer delay are parked in
+*    the last slot of the top level until they come into range.
+*/
+#ifndef CO_TMR_WHEEL_BITS
+#define CO_TMR_WHEEL_BITS       6
+#endif
+#ifndef CO_TMR_WHEEL_LVL
+#define CO_TMR_WHEEL_LVL        3
+#endif
+
+/*! \brief DEFAULT ENABLE HEARTBEAT CONSUMER TABLE
+*
+*    This configuration define specifies whether the heartbeat consumers
+*    are managed in a table indexed by the node-id and supervised with a
+*    single sweeping timer, or with a private monitor timer per consumer.
+*/
+#ifndef USE_HBC_TABLE
+#define USE_HBC_TABLE           0
+#endif
+
+/*! \brief DEFAULT HEARTBEAT CONSUMER SWEEP PERIOD
+*
+*    This configuration define specifies the period of the heartbeat
+*    consumer supervision sweep in ms. A missing heartbeat is detected
+*    within the consumer time plus one sweep period.
+*/
+#ifndef CO_HBC_SWEEP
+#define CO_HBC_SWEEP           10
+#endif
+
+/*! \brief DEFAULT ENABLE BACKGROUND PARAMETER STORE
+*
+*    This configuration define specifies whether a store command in the
+*    object 1010h is executed in the background. The parameter groups are
+*    copied into a staging buffer and written to NVM in chunks by a cyclic
+*    timer. The SDO response is held until the store is finished.
+*/
+#ifndef USE_PARA_ASYNC
+#define USE_PARA_ASYNC          0
+#endif
+
+/*! \brief DEFAULT BACKGROUND PARAMETER STORE BUFFER
+*
+*    This configuration define specifies the size of the staging buffer
+*    in bytes. Parameter groups, which are larger than this buffer, are
+*    written to NVM without a copy within a single step.
+*/
+#ifndef CO_PARA_BUF_BYTE
+#define CO_PARA_BUF_BYTE      256
+#endif
+
+/*! \brief DEFAULT BACKGROUND PARAMETER STORE CHUNK
+*
+*    This configuration define specifies the maximal number of bytes, which
+*    are written to NVM within a single step of the background store.
+*/
+#ifndef CO_PARA_CHUNK
+#define CO_PARA_CHUNK          32
+#endif
+
+/*! \brief DEFAULT BACKGROUND PARAMETER STORE CYCLE
+*
+*    This configuration define specifies the period of the background
+*    store steps in ms.
+*/
+#ifndef CO_PARA_CYCLE
+#define CO_PARA_CYCLE           1
+#endif
+
+/*! \brief DEFAULT ENABLE PARAMETER LOG
+*
+*    This configuration define specifies whether the parameter groups are
+*    stored in an append-only log of CRC protected records in NVM. The
+*    offset of a parameter group is used as identifier of the group
+*    within the log, instead of an address in NVM.
+*/
+#ifndef USE_PARA_LOG
+#define USE_PARA_LOG            0
+#endif
+
+/*! \brief DEFAULT PARAMETER LOG START
+*
+*    This configuration define specifies the start address of the
+*    parameter log in NVM. The log uses two banks of CO_PARA_LOG_BANK
+*    bytes each.
+*/
+#ifndef CO_PARA_LOG_START
+#define CO_PARA_LOG_START       0
+#endif
+
+/*! \brief DEFAULT PARAMETER LOG BANK SIZE
+*
+*    This configuration define specifies the size of a single bank of the
+*    parameter log in bytes. When the active bank is full, the latest
+*    record of each parameter group is copied into the other bank.
+*/
+#ifndef CO_PARA_LOG_BANK
+#define CO_PARA_LOG_BANK     1024
+#endif
+
+/*! \brief DEFAULT PARAMETER LOG GROUPS
+*
+*    This configuration define specifies the maximal number of parameter
+*    groups within the parameter log.
+*/
+#ifndef CO_PARA_LOG_N
+#define CO_PARA_LOG_N           8
+#endif
+
+/*! \brief DEFAULT ENABLE PARAMETER DIRTY TRACKING
+*
+*    This configuration define specifies whether writes via the object
+*    dictionary mark the changed ranges of a parameter group. A store
+*    writes only the changed ranges to NVM, when the parameter group is
+*    linked to dirty tracking data. Without effect, when USE_PARA_LOG
+*    is enabled.
+*/
+#ifndef USE_PARA_DIRTY
+#define USE_PARA_DIRTY          0
+#endif
+
+/*! \brief DEFAULT PARAMETER DIRTY RANGES
+*
+*    This configuration define specifies the maximal number of changed
+*    ranges per parameter group. When more ranges are changed, the two
+*    ranges with the smallest gap are merged.
+*/
+#ifndef CO_PARA_DIRTY_N
+#define CO_PARA_DIRTY_N         4
+#endif
+
+/*! \brief DEFAULT ENABLE DICTIONARY INDEX
+*
+*    This configuration define specifies whether the object dictionary is
+*    searched within a dense array of object keys. The key array with one
+*    entry per object entry is provided by the application in the node
+*    specification and is built during the dictionary initialization.
+*/
+#ifndef USE_DICT_INDEX
+#define USE_DICT_INDEX          0
+#endif
+
+/*! \brief DEFAULT ENABLE RANGE OBJECTS
+*
+*    This configuration define specifies whether a single object entry of
+*    type CO_TRANGE may describe a range of subindices of a homogeneous
+*    array. The dictionary search returns a view for each element.
+*/
+#ifndef USE_OBJ_RANGE
+#define USE_OBJ_RANGE           0
+#endif
+
+/*! \brief DEFAULT NUMBER OF ELEMENT VIEWS
+*
+*    This configuration define specifies the number of element views, which
+*    are returned by the dictionary search in turn. A view is valid until
+*    this number of further range elements are searched.
+*/
+#ifndef CO_DICT_VIEW_N
+#define CO_DICT_VIEW_N          4
+#endif
+
+/*! \brief DEFAULT ENABLE DICTIONARY OVERLAY
+*
+*    This configuration define specifies whether the object dictionary may
+*    be a constant template, which is shared by several nodes. The writable
+*    direct object entries are copied into an overlay of each node, which is
+*    provided by the application in the node specification.
+*/
+#ifndef USE_DICT_OVERLAY
+#define USE_DICT_OVERLAY        0
+#endif
+
+/*! \brief DEFAULT ENABLE TRANSMIT SCHEDULER
+*
+*    This configuration define specifies whether the CAN interface queues
+*    the transmit frames, which the driver is not able to accept, in a
+*    priority queue per frame class. The queued frames are passed to the
+*    driver in the order of the CAN identifier arbitration.
+*/
+#ifndef USE_CAN_TXQ
+#define USE_CAN_TXQ             0
+#endif
+
+/*! \brief DEFAULT NUMBER OF QUEUED TRANSMIT FRAMES
+*
+*    This configuration define specifies the size of the frame pool, which
+*    is shared by all transmit queues (max. 254 frames).
+*/
+#ifndef CO_TXQ_N
+#define CO_TXQ_N               16
+#endif
+
+/*! \brief DEFAULT ENABLE CAN FRAME TIMESTAMP
+*
+*    This configuration define specifies whether each CAN frame carries a
+*    64-bit timestamp. The driver sets the timestamp on reception and in
+*    the transmit confirmation; the SYNC consumer measures the SYNC
+*    intervals with it. Without timestamps, the frame size is unchanged.
+*/
+#ifndef USE_CAN_TIMESTAMP
+#define USE_CAN_TIMESTAMP       0
+#endif
+
+/*! \brief DEFAULT ENABLE NODE CONTEXT
+*
+*    This configuration define specifies whether each node holds its own
+*    table of application callbacks and may use a CAN driver, which gets
+*    a context argument. This allows many nodes in a single application.
+*    Missing callbacks and CAN drivers without context argument fall back
+*    to the global callback functions and driver functions.
+*/
+#ifndef USE_NODE_CTX
+#define USE_NODE_CTX            0
+#endif
+
+/*! \brief DEFAULT CACHE LINE SIZE
+*
+*    This configuration define specifies the size of a cache line in bytes.
+*    The frame rings (CO_IF_RING) keep the producer index and the consumer
+*    index in separate cache lines, so the two sides of a ring don't
+*    invalidate each other's cache. Targets without data cache may use 4.
+*/
+#ifndef CO_IF_RING_LINE
+#define CO_IF_RING_LINE         64
+#endif
+
 #endif  /* #ifndef CO_CFG_H_ */
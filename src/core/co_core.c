@@ -20,6 +20,16 @@
 
 #include "co_core.h"
 
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void    CONodeProcessFrame(CO_NODE *node, CO_IF_FRM *frm);
+static uint8_t CONodeDispatchChain(CO_NODE *node, CO_IF_FRM *frm, uint8_t allowed);
+#if USE_DISPATCH
+static uint8_t CONodeDispatch(CO_NODE *node, CO_IF_FRM *frm, uint8_t allowed);
+#endif //USE_DISPATCH
+
 /******************************************************************************
 * FUNCTIONS
 ******************************************************************************/
@@ -29,7 +39,7 @@
 */
 void CONodeInit(CO_NODE *node, CO_NODE_SPEC *spec)
 {
-    int16_t num;
+    int32_t num;
     CO_ERR  err;
 
     node->If.Drv   = spec->Drv;
@@ -38,14 +48,41 @@ void CONodeInit(CO_NODE *node, CO_NODE_SPEC *spec)
     node->NodeId   = spec->NodeId;
     node->Error    = CO_ERR_NONE;
     node->Nmt.Tmr  = -1;
+#if USE_NODE_CTX
+    node->Cb       = spec->Cb;
+    node->Ctx      = spec->Ctx;
+#endif //USE_NODE_CTX
 #if USE_LSS
-    err = COLssLoad(&node->Baudrate, &node->NodeId);
+    err = CO_CB_LSS_LOAD(node, &node->Baudrate, &node->NodeId);
     if (err != CO_ERR_NONE) {
         node->Error = CO_ERR_LSS_LOAD;
     }
 #endif //USE_LSS
     COIfInit(&node->If, node, spec->TmrFreq);
+#if USE_DISPATCH
+    CODispInit(&node->Disp, node);
+#endif //USE_DISPATCH
+#if USE_CAN_FILTER
+    COFilterInit(&node->Filter, node);
+#endif //USE_CAN_FILTER
     COTmrInit(&node->Tmr, node, spec->TmrMem, spec->TmrNum, spec->TmrFreq);
+#if USE_PARA_LOG
+    COParaLogInit(&node->ParaLog, node);
+#endif //USE_PARA_LOG
+#if USE_PARA_ASYNC
+    COParaAsyncInit(&node->ParaAsync, node);
+#endif //USE_PARA_ASYNC
+#if USE_PARA_DIRTY
+    node->ParaArea.Lo = NULL;
+    node->ParaArea.Hi = NULL;
+#endif //USE_PARA_DIRTY
+#if USE_DICT_INDEX
+    node->Dict.Index = spec->DictIdx;
+#endif //USE_DICT_INDEX
+#if USE_DICT_OVERLAY
+    node->Dict.Ovl    = spec->DictOvl;
+    node->Dict.OvlMax = spec->DictOvlLen;
+#endif //USE_DICT_OVERLAY
     num = CODictInit(&node->Dict, node, spec->Dict, spec->DictLen);
     if (num < 0) {
         node->Error = CO_ERR_DICT_INIT;
@@ -88,6 +125,9 @@ void CONodeStart(CO_NODE *node)
 */
 void CONodeStop(CO_NODE *node)
 {
+#if USE_PARA_ASYNC
+    COParaAsyncFlush(&node->ParaAsync);
+#endif //USE_PARA_ASYNC
     COTmrClear(&node->Tmr);
     CONmtSetMode(&node->Nmt, CO_INVALID);
     COIfCanClose(&node->If);
@@ -112,48 +152,165 @@ CO_ERR CONodeGetErr(CO_NODE *node)
 void CONodeProcess(CO_NODE *node)
 {
     CO_IF_FRM frm;
-    CO_ERR    err;
-    CO_SDO   *srv;
-#if USE_CSDO
-    CO_CSDO  *csdo;
-#endif
-    CO_RPDO  *rpdo;
     int16_t   result;
-    uint8_t   allowed;
 
+#if USE_CAN_FILTER
+    COFilterUpdate(&node->Filter);
+#endif //USE_CAN_FILTER
+    (void)COIfCanTxDone(&node->If);
+#if USE_CAN_TXQ
+    (void)COIfCanTxDrain(&node->If);
+#endif //USE_CAN_TXQ
+    if ((node->Nmt.Allowed & CO_SDO_ALLOWED) != (uint8_t)0) {
+        COSdoProcess(node->Sdo);
+#if USE_CSDO
+        COCSdoProcess(node->CSdo);
+#endif //USE_CSDO
+    }
     result = COIfCanRead(&node->If, &frm);
-    if (result <= 0) {
-        allowed = 0;
-    } else {
-        allowed = node->Nmt.Allowed;
+    if (result > 0) {
+        CONodeProcessFrame(node, &frm);
+    }
+}
+
+/*
+* see function definition
+*/
+uint16_t CONodeProcessBatch(CO_NODE *node, uint16_t max)
+{
+    CO_IF_FRM frm[CO_RX_BATCH_N];
+    uint16_t  done = 0;
+    uint16_t  req;
+    int16_t   num;
+    int16_t   n;
+
+#if USE_CAN_FILTER
+    COFilterUpdate(&node->Filter);
+#endif //USE_CAN_FILTER
+    (void)COIfCanTxDone(&node->If);
+#if USE_CAN_TXQ
+    (void)COIfCanTxDrain(&node->If);
+#endif //USE_CAN_TXQ
+    if ((node->Nmt.Allowed & CO_SDO_ALLOWED) != (uint8_t)0) {
+        COSdoProcess(node->Sdo);
+#if USE_CSDO
+        COCSdoProcess(node->CSdo);
+#endif //USE_CSDO
+    }
+    while (done < max) {
+        req = max - done;
+        if (req > (uint16_t)CO_RX_BATCH_N) {
+            req = (uint16_t)CO_RX_BATCH_N;
+        }
+        num = COIfCanReadBatch(&node->If, &frm[0], req);
+        if (num <= 0) {
+            break;
+        }
+        for (n = 0; n < num; n++) {
+            CONodeProcessFrame(node, &frm[n]);
+        }
+        done += (uint16_t)num;
+        if ((uint16_t)num < req) {
+            break;
+        }
+    }
+    return (done);
+}
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  PROCESS RECEIVED FRAME
+*
+*    This function passes a single received CAN frame to the responsible
+*    service, or to the application callback COIfCanReceive(), if the
+*    frame is not consumed by the stack.
+*
+* \param node
+*    Ptr to node info
+*
+* \param frm
+*    received CAN frame
+*/
+static void CONodeProcessFrame(CO_NODE *node, CO_IF_FRM *frm)
+{
+    uint8_t allowed;
 #if USE_LSS
-        result  = COLssCheck(&node->Lss, &frm);
-        if (result != 0) {
-            if (result > 0) {
-                (void)COIfCanSend(&node->If, &frm);
-            }
-            allowed = 0;
+    int16_t result;
+#endif //USE_LSS
+
+    allowed = node->Nmt.Allowed;
+#if USE_LSS
+    result  = COLssCheck(&node->Lss, frm);
+    if (result != 0) {
+        if (result > 0) {
+            (void)COIfCanSend(&node->If, frm);
         }
+        allowed = 0;
+    }
 #endif //USE_LSS
+
+    if (allowed != (uint8_t)0) {
+#if USE_DISPATCH
+        allowed = CONodeDispatch(node, frm, allowed);
+#else
+        allowed = CONodeDispatchChain(node, frm, allowed);
+#endif //USE_DISPATCH
+    }
+
+    if (allowed != (uint8_t)0) {
+        CO_CB_IF_RECEIVE(node, frm);
     }
+#if USE_CAN_FILTER
+    COFilterUpdate(&node->Filter);
+#endif //USE_CAN_FILTER
+}
+
+/*! \brief  DISPATCH FRAME BY ASKING ALL SERVICES
+*
+*    This function passes the received frame to each service in turn, until
+*    a service consumes the frame.
+*
+* \param node
+*    Ptr to node info
+*
+* \param frm
+*    received CAN frame
+*
+* \param allowed
+*    allowed objects in current NMT mode
+*
+* \return
+*    allowed objects for further processing (0 when frame is consumed)
+*/
+static uint8_t CONodeDispatchChain(CO_NODE *node, CO_IF_FRM *frm, uint8_t allowed)
+{
+    CO_ERR    err;
+    CO_SDO   *srv;
+#if USE_CSDO
+    CO_CSDO  *csdo;
+#endif
+    CO_RPDO  *rpdo;
+    int16_t   result;
 
     if ((allowed & CO_SDO_ALLOWED) != (uint8_t)0) {
-        srv = COSdoCheck(node->Sdo, &frm);
+        srv = COSdoCheck(node->Sdo, frm);
         if (srv != NULL) {
             err = COSdoResponse(srv);
             if ((err == CO_ERR_NONE     ) ||
                 (err == CO_ERR_SDO_ABORT)) {
-                (void)COIfCanSend(&node->If, &frm);
+                (void)COIfCanSend(&node->If, frm);
             }
             allowed = 0;
 #if USE_CSDO
         } else {
-            csdo = COCSdoCheck(node->CSdo, &frm);
+            csdo = COCSdoCheck(node->CSdo, frm);
             if (csdo != NULL) {
                 err = COCSdoResponse(csdo);
                 if ((err == CO_ERR_NONE) ||
                     (err == CO_ERR_SDO_ABORT)) {
-                    (void)COIfCanSend(&node->If, &frm);
+                    (void)COIfCanSend(&node->If, frm);
                 }
                 allowed = 0;
             }
@@ -162,31 +319,135 @@ void CONodeProcess(CO_NODE *node)
     }
 
     if ((allowed & CO_NMT_ALLOWED) != (uint8_t)0) {
-        if (CONmtCheck(&node->Nmt, &frm) >= 0) {
+        if (CONmtCheck(&node->Nmt, frm) >= 0) {
             allowed = 0;
         }
-        if (CONmtHbConsCheck(&node->Nmt, &frm) >= 0) {
+        if (CONmtHbConsCheck(&node->Nmt, frm) >= 0) {
             allowed = 0;
         }
     }
 
     if ((allowed & CO_PDO_ALLOWED) != (uint8_t)0) {
-        rpdo = CORPdoCheck(node->RPdo, &frm);
+        rpdo = CORPdoCheck(node->RPdo, frm);
         if (rpdo != NULL) {
-            CORPdoRx(rpdo, &frm);
+            CORPdoRx(rpdo, frm);
             allowed = 0;
         }
     }
 
     if ((allowed & CO_SYNC_ALLOWED) != (uint8_t)0) {
-        result = COSyncUpdate(&node->Sync, &frm);
+        result = COSyncUpdate(&node->Sync, frm);
         if (result >= 0) {
             COSyncHandler(&node->Sync);
             allowed = 0;
         }
     }
 
-    if (allowed != (uint8_t)0) {
-        COIfCanReceive(&frm);
+    return (allowed);
+}
+
+#if USE_DISPATCH
+
+/*! \brief  DISPATCH FRAME WITH COB-ID TABLE
+*
+*    This function looks up the service, which consumes the identifier of
+*    the received frame, and passes the frame directly to this service.
+*    Identifiers, which are shared by multiple services or are outside of
+*    the 11-bit range, are passed to \ref CONodeDispatchChain().
+*
+* \param node
+*    Ptr to node info
+*
+* \param frm
+*    received CAN frame
+*
+* \param allowed
+*    allowed objects in current NMT mode
+*
+* \return
+*    allowed objects for further processing (0 when frame is consumed)
+*/
+static uint8_t CONodeDispatch(CO_NODE *node, CO_IF_FRM *frm, uint8_t allowed)
+{
+    CO_ERR    err;
+    CO_SDO   *srv;
+#if USE_CSDO
+    CO_CSDO  *csdo;
+#endif
+    CO_RPDO  *rpdo;
+    uint16_t  entry;
+    uint16_t  num;
+
+    entry = CODispFind(&node->Disp, frm->Identifier);
+    num   = CO_DISP_NUM(entry);
+    switch (CO_DISP_KIND(entry)) {
+        case CO_DISP_NONE:
+            break;
+        case CO_DISP_SSDO:
+            if ((allowed & CO_SDO_ALLOWED) != (uint8_t)0) {
+                srv = COSdoMatch(&node->Sdo[num], frm);
+                if (srv != NULL) {
+                    err = COSdoResponse(srv);
+                    if ((err == CO_ERR_NONE     ) ||
+                        (err == CO_ERR_SDO_ABORT)) {
+                        (void)COIfCanSend(&node->If, frm);
+                    }
+                    allowed = 0;
+                }
+            }
+            break;
+#if USE_CSDO
+        case CO_DISP_CSDO:
+            if ((allowed & CO_SDO_ALLOWED) != (uint8_t)0) {
+                csdo = COCSdoMatch(&node->CSdo[num], frm);
+                if (csdo != NULL) {
+                    err = COCSdoResponse(csdo);
+                    if ((err == CO_ERR_NONE) ||
+                        (err == CO_ERR_SDO_ABORT)) {
+                        (void)COIfCanSend(&node->If, frm);
+                    }
+                    allowed = 0;
+                }
+            }
+            break;
+#endif
+        case CO_DISP_NMT:
+            if ((allowed & CO_NMT_ALLOWED) != (uint8_t)0) {
+                if (CONmtCheck(&node->Nmt, frm) >= 0) {
+                    allowed = 0;
+                }
+            }
+            break;
+        case CO_DISP_HBC:
+            if ((allowed & CO_NMT_ALLOWED) != (uint8_t)0) {
+                if (CONmtHbConsCheck(&node->Nmt, frm) >= 0) {
+                    allowed = 0;
+                }
+            }
+            break;
+        case CO_DISP_RPDO:
+            if ((allowed & CO_PDO_ALLOWED) != (uint8_t)0) {
+                rpdo = CORPdoMatch(&node->RPdo[num], frm);
+                if (rpdo != NULL) {
+                    CORPdoRx(rpdo, frm);
+                    allowed = 0;
+                }
+            }
+            break;
+        case CO_DISP_SYNC:
+            if ((allowed & CO_SYNC_ALLOWED) != (uint8_t)0) {
+                if (COSyncUpdate(&node->Sync, frm) >= 0) {
+                    COSyncHandler(&node->Sync);
+                    allowed = 0;
+                }
+            }
+            break;
+        default:
+            allowed = CONodeDispatchChain(node, frm, allowed);
+            break;
     }
+
+    return (allowed);
 }
+
+#endif //USE_DISPATCH
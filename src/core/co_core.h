@@ -34,6 +34,7 @@ extern "C" {
 #include "co_integer8.h"
 #include "co_integer16.h"
 #include "co_integer32.h"
+#include "co_range.h"
 
 /* cia301 types */
 #include "co_emcy_hist.h"
@@ -42,6 +43,7 @@ extern "C" {
 #include "co_hb_prod.h"
 #include "co_para.h"
 #include "co_para_store.h"
+#include "co_para_log.h"
 #include "co_para_restore.h"
 #include "co_pdo_event.h"
 #include "co_pdo_id.h"
@@ -52,7 +54,10 @@ extern "C" {
 #include "co_sync_cycle.h"
 #include "co_sync_id.h"
 
+#include "co_crc.h"
 #include "co_dict.h"
+#include "co_disp.h"
+#include "co_filter.h"
 #include "co_if.h"
 #include "co_emcy.h"
 #include "co_nmt.h"
@@ -73,6 +78,33 @@ extern "C" {
 * PUBLIC TYPES
 ******************************************************************************/
 
+#if USE_NODE_CTX
+
+struct CO_NODE_T;              /* Declaration of canopen node structure      */
+struct CO_PARA_T;              /* Declaration of parameter group structure   */
+
+/*! \brief NODE CALLBACKS
+*
+*    This data structure holds the application callbacks of a single node.
+*    Each callback gets the node as first argument and replaces the global
+*    callback function with the same name (e.g. PdoReceive replaces the
+*    function COPdoReceive()). A callback, which is set to NULL, falls back
+*    to the global callback function.
+*/
+typedef struct CO_NODE_CB_T {
+    void    (*TmrLock       )(struct CO_NODE_T *node);
+    void    (*TmrUnlock     )(struct CO_NODE_T *node);
+    CO_ERR  (*LssLoad       )(struct CO_NODE_T *node, uint32_t *baudrate, uint8_t *nodeId);
+    CO_ERR  (*LssStore      )(struct CO_NODE_T *node, uint32_t baudrate, uint8_t nodeId);
+    void    (*IfCanReceive  )(struct CO_NODE_T *node, CO_IF_FRM *frm);
+    void    (*IfCanTxConfirm)(struct CO_NODE_T *node, CO_IF_FRM *frm);
+    void    (*PdoTransmit   )(struct CO_NODE_T *node, CO_IF_FRM *frm);
+    int16_t (*PdoReceive    )(struct CO_NODE_T *node, CO_IF_FRM *frm);
+    void    (*ParaStoreDone )(struct CO_NODE_T *node, struct CO_PARA_T *pg, CO_ERR err);
+} CO_NODE_CB;
+
+#endif //USE_NODE_CTX
+
 /*! \brief CANOPEN NODE
 *
 *    This data structure holds all informations, which represents a complete
@@ -91,14 +123,33 @@ typedef struct CO_NODE_T {
 #endif
     struct CO_RPDO_T       RPdo[CO_RPDO_N];      /*!< RPDO Array             */
     struct CO_TPDO_T       TPdo[CO_TPDO_N];      /*!< TPDO Array             */
-    struct CO_TPDO_LINK_T  TMap[CO_TPDO_N * 8];  /*!< TPDO mapping links     */
+    struct CO_TPDO_SIG_T   TMap;                 /*!< TPDO mapping links     */
     struct CO_SYNC_T       Sync;                 /*!< SYNC management        */
+#if USE_DISPATCH
+    struct CO_DISP_T       Disp;                 /*!< COB-ID dispatch table  */
+#endif //USE_DISPATCH
+#if USE_CAN_FILTER
+    struct CO_FILTER_T     Filter;               /*!< CAN acceptance filter  */
+#endif //USE_CAN_FILTER
 #if USE_LSS
     struct CO_LSS_T        Lss;                  /*!< LSS slave handling     */
 #endif //USE_LSS
+#if USE_PARA_LOG
+    struct CO_PARA_LOG_T   ParaLog;              /*!< Parameter log index    */
+#endif //USE_PARA_LOG
+#if USE_PARA_ASYNC
+    struct CO_PARA_ASYNC_T ParaAsync;            /*!< Background para store  */
+#endif //USE_PARA_ASYNC
+#if USE_PARA_DIRTY
+    struct CO_PARA_AREA_T  ParaArea;             /*!< Dirty tracked memory   */
+#endif //USE_PARA_DIRTY
     enum   CO_ERR_T        Error;                /*!< detected error code    */
     uint32_t               Baudrate;             /*!< default CAN baudrate   */
     uint8_t                NodeId;               /*!< default Node-ID        */
+#if USE_NODE_CTX
+    const CO_NODE_CB      *Cb;                   /*!< node callbacks or NULL */
+    void                  *Ctx;                  /*!< application context    */
+#endif //USE_NODE_CTX
 
 } CO_NODE;
 
@@ -111,16 +162,74 @@ typedef struct CO_NODE_SPEC_T {
     uint8_t                NodeId;       /*!< default Node-Id                */
     uint32_t               Baudrate;     /*!< default Baudrate               */
     struct CO_OBJ_T       *Dict;         /*!< object dictionary              */
-    uint16_t               DictLen;      /*!< object dictionary (max) length */
+    uint32_t               DictLen;      /*!< object dictionary (max) length */
     struct CO_EMCY_TBL_T  *EmcyCode;     /*!< application EMCY info fields   */
     struct CO_TMR_MEM_T   *TmrMem;       /*!< timer memory blocks            */
     uint16_t               TmrNum;       /*!< number of timer memory blocks  */
     uint32_t               TmrFreq;      /*!< timer clock frequency in Hz    */
     CO_IF_DRV             *Drv;          /*!< linked interface drivers       */
     uint8_t               *SdoBuf;       /*!< SDO Transfer Buffer Memory     */
+#if USE_DICT_INDEX
+    uint32_t              *DictIdx;      /*!< key array with DictLen entries */
+#endif //USE_DICT_INDEX
+#if USE_DICT_OVERLAY
+    struct CO_OBJ_T       *DictOvl;      /*!< direct entries of node         */
+    uint32_t               DictOvlLen;   /*!< overlay (max) length           */
+#endif //USE_DICT_OVERLAY
+#if USE_NODE_CTX
+    const CO_NODE_CB      *Cb;           /*!< node callbacks (or NULL)       */
+    void                  *Ctx;          /*!< application context            */
+#endif //USE_NODE_CTX
 
 } CO_NODE_SPEC;
 
+/******************************************************************************
+* PUBLIC MACROS
+******************************************************************************/
+
+/*! \brief CALL NODE CALLBACK
+*
+*    These macros call the callback of the given node, or the global
+*    callback function, if the node holds no such callback. Without
+*    USE_NODE_CTX, the global callback function is called directly.
+*
+* \param n
+*    The CANopen node
+*/
+#if USE_NODE_CTX
+#define CO_NODE_CB_SET(n,f)          \
+    (((n)->Cb != NULL) && ((n)->Cb->f != NULL))
+
+#define CO_CB_TMR_LOCK(n)            \
+    (CO_NODE_CB_SET(n,TmrLock) ? (n)->Cb->TmrLock(n) : COTmrLock())
+#define CO_CB_TMR_UNLOCK(n)          \
+    (CO_NODE_CB_SET(n,TmrUnlock) ? (n)->Cb->TmrUnlock(n) : COTmrUnlock())
+#define CO_CB_LSS_LOAD(n,b,i)        \
+    (CO_NODE_CB_SET(n,LssLoad) ? (n)->Cb->LssLoad((n),(b),(i)) : COLssLoad((b),(i)))
+#define CO_CB_LSS_STORE(n,b,i)       \
+    (CO_NODE_CB_SET(n,LssStore) ? (n)->Cb->LssStore((n),(b),(i)) : COLssStore((b),(i)))
+#define CO_CB_IF_RECEIVE(n,f)        \
+    (CO_NODE_CB_SET(n,IfCanReceive) ? (n)->Cb->IfCanReceive((n),(f)) : COIfCanReceive(f))
+#define CO_CB_IF_TX_CONFIRM(n,f)     \
+    (CO_NODE_CB_SET(n,IfCanTxConfirm) ? (n)->Cb->IfCanTxConfirm((n),(f)) : COIfCanTxConfirm(f))
+#define CO_CB_PDO_TRANSMIT(n,f)      \
+    (CO_NODE_CB_SET(n,PdoTransmit) ? (n)->Cb->PdoTransmit((n),(f)) : COPdoTransmit(f))
+#define CO_CB_PDO_RECEIVE(n,f)       \
+    (CO_NODE_CB_SET(n,PdoReceive) ? (n)->Cb->PdoReceive((n),(f)) : COPdoReceive(f))
+#define CO_CB_PARA_STORE_DONE(n,p,e) \
+    (CO_NODE_CB_SET(n,ParaStoreDone) ? (n)->Cb->ParaStoreDone((n),(p),(e)) : COParaStoreDone((p),(e)))
+#else
+#define CO_CB_TMR_LOCK(n)            COTmrLock()
+#define CO_CB_TMR_UNLOCK(n)          COTmrUnlock()
+#define CO_CB_LSS_LOAD(n,b,i)        COLssLoad((b),(i))
+#define CO_CB_LSS_STORE(n,b,i)       COLssStore((b),(i))
+#define CO_CB_IF_RECEIVE(n,f)        COIfCanReceive(f)
+#define CO_CB_IF_TX_CONFIRM(n,f)     COIfCanTxConfirm(f)
+#define CO_CB_PDO_TRANSMIT(n,f)      COPdoTransmit(f)
+#define CO_CB_PDO_RECEIVE(n,f)       COPdoReceive(f)
+#define CO_CB_PARA_STORE_DONE(n,p,e) COParaStoreDone((p),(e))
+#endif //USE_NODE_CTX
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -188,11 +297,36 @@ CO_ERR CONodeGetErr(CO_NODE *node);
 *    handled by the stack, the user will get this CAN frame into the
 *    (optional) callback function \see CO_IfReceive()
 *
+*    An outdated CAN acceptance filter is passed to the CAN driver before
+*    the frame is read, and after the frame is processed. Pending SDO block
+*    upload segments and SDO client block download segments are sent before
+*    the frame is read, as far as the CAN driver reports free transmit slots.
+*
 * \param node
 *    Ptr to node info
 */
 void CONodeProcess(CO_NODE *node);
 
+/*! \brief  CAN RECEIVE BATCH PROCESSING
+*
+*    This function processes up to the given number of received CAN frames
+*    from the given CAN node. The frames are read in blocks of CO_RX_BATCH_N
+*    frames from the CAN driver (\see COIfCanReadBatch()), and each frame
+*    is processed as described in \ref CONodeProcess(). The function
+*    returns when no further frame is available, or the maximum number of
+*    frames is processed.
+*
+* \param node
+*    Ptr to node info
+*
+* \param max
+*    maximum number of frames to process within this call
+*
+* \return
+*    number of processed CAN frames
+*/
+uint16_t CONodeProcessBatch(CO_NODE *node, uint16_t max);
+
 /******************************************************************************
 * CALLBACK FUNCTIONS
 ******************************************************************************/
@@ -0,0 +1,68 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+#ifndef CO_CRC_H_
+#define CO_CRC_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_cfg.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_CRC16_INIT    ((uint16_t)0x0000) /*!< CRC-16 start value           */
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  CALCULATE CRC-16
+*
+*    This function calculates the CRC-16-CCITT (polynom x^16 + x^12 + x^5
+*    + 1) of the SDO block transfer. The calculation is incremental: the
+*    CRC of data, which is given in several chunks, is calculated by
+*    passing the result of the previous chunk as start value of the next
+*    chunk. The first chunk starts with CO_CRC16_INIT.
+*
+* \param crc
+*    CRC of the previous data chunk, or CO_CRC16_INIT
+*
+* \param buf
+*    reference to data chunk
+*
+* \param size
+*    number of bytes in data chunk
+*
+* \return
+*    CRC of all data up to the end of the given chunk
+*/
+uint16_t COCrc16(uint16_t crc, const uint8_t *buf, uint32_t size);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif  /* #ifndef CO_CRC_H_ */
@@ -23,6 +23,160 @@
 #include "co_obj.h"
 #include "co_core.h"
 
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  ACCESS OBJECT VIA HANDLE
+*
+*    This function reads or writes a value of the given width with the
+*    type functions, which are cached in the given object handle.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param ref
+*    pointer to the object handle
+*
+* \param val
+*    pointer to the value
+*
+* \param width
+*    width of the value in bytes
+*
+* \param write
+*    write access (=1) or read access (=0)
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+static CO_ERR CODictRefAccess(CO_DICT *cod, CO_DICT_REF *ref, void *val, uint8_t width, uint8_t write)
+{
+    CO_ERR  result = CO_ERR_OBJ_NOT_FOUND;
+    CO_OBJ *obj;
+
+    ASSERT_PTR_ERR(cod, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(ref, CO_ERR_BAD_ARG);
+
+    obj = CODictRefObj(cod, ref);
+    if (obj != NULL) {
+        if (ref->Size != (uint32_t)width) {
+            result = CO_ERR_OBJ_SIZE;
+        } else if (write != 0) {
+            result = CO_ERR_OBJ_ACC;
+            if (ref->Type->Write != NULL) {
+                result = ref->Type->Write(obj, cod->Node, val, width);
+#if USE_PARA_DIRTY
+                if (result == CO_ERR_NONE) {
+                    COParaDirtyObj(cod->Node, obj);
+                }
+#endif //USE_PARA_DIRTY
+            }
+        } else {
+            result = CO_ERR_OBJ_ACC;
+            if (ref->Type->Read != NULL) {
+                result = ref->Type->Read(obj, cod->Node, val, width);
+            }
+        }
+    }
+    return (result);
+}
+
+#if USE_DICT_OVERLAY
+/*! \brief  GET OVERLAY ENTRY
+*
+*    This function returns the copy of the given direct object entry
+*    within the overlay of the node.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param obj
+*    pointer to the found object entry (or NULL)
+*
+* \retval  >0    The pointer to the overlay entry or the given object entry
+* \retval  =0    The given object entry is NULL
+*/
+static CO_OBJ *CODictOverlay(CO_DICT *cod, CO_OBJ *obj)
+{
+    CO_OBJ  *result = obj;
+    uint32_t pattern;
+    int32_t  start = 0;
+    int32_t  end;
+    int32_t  center;
+
+    if ((obj != NULL) && (cod->Ovl != NULL) && (CO_IS_DIRECT(obj->Key) != 0)) {
+        /* the overlay holds the direct entries in same order */
+        pattern = CO_GET_DEV(obj->Key);
+        end     = (int32_t)cod->OvlNum - 1;
+        while (start <= end) {
+            center = start + ((end - start) / 2);
+            if (CO_GET_DEV(cod->Ovl[center].Key) == pattern) {
+                result = &(cod->Ovl[center]);
+                break;
+            }
+            if (CO_GET_DEV(cod->Ovl[center].Key) > pattern) {
+                end    = center - 1;
+            } else {
+                start  = center + 1;
+            }
+        }
+    }
+    return (result);
+}
+#endif //USE_DICT_OVERLAY
+
+#if USE_OBJ_RANGE
+/*! \brief  GET ELEMENT VIEW OF RANGE
+*
+*    This function checks the result of the dictionary search. When the
+*    key is not found, the predecessor object entry at the given position
+*    is checked for a range object entry, which covers the key.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param obj
+*    pointer to the found object entry (or NULL)
+*
+* \param pos
+*    position of the predecessor object entry, when the key is not found
+*
+* \param pattern
+*    searched object entry key without flags
+*
+* \retval  >0    The pointer to the object entry or the element view
+* \retval  =0    Addressed object was not found
+*/
+static CO_OBJ *CODictView(CO_DICT *cod, CO_OBJ *obj, int32_t pos, uint32_t pattern)
+{
+    CO_OBJ *result = obj;
+    CO_OBJ *view;
+
+    if (result == NULL) {
+        /* the end marker is no predecessor */
+        if (pos >= (int32_t)cod->Num) {
+            pos = (int32_t)cod->Num - 1;
+        }
+        if (pos >= 0) {
+            obj = &(cod->Root[pos]);
+        }
+    }
+    if ((obj != NULL) && (obj->Type == CO_TRANGE) &&
+        (CO_GET_IDX(obj->Key) == CO_GET_IDX(pattern))) {
+        view   = &(cod->View[cod->ViewPos]);
+        result = COTRangeView(obj, CO_GET_SUB(pattern), view);
+        if (result != NULL) {
+            cod->ViewPos++;
+            if (cod->ViewPos >= CO_DICT_VIEW_N) {
+                cod->ViewPos = 0;
+            }
+        }
+    }
+    return (result);
+}
+#endif //USE_OBJ_RANGE
+
 /******************************************************************************
 * PUBLIC API FUNCTIONS
 ******************************************************************************/
@@ -41,7 +195,32 @@ CO_OBJ *CODictFind(CO_DICT *cod, uint32_t key)
     ASSERT_PTR_ERR(cod->Root, NULL);
 
     pattern = CO_GET_DEV(key);
-    end = cod->Num;
+#if USE_DICT_INDEX
+    if (cod->Index != NULL) {
+        /* search in dense key array; touches 4 bytes per probe */
+        end = (int32_t)cod->Num - 1;
+        while (start <= end) {
+            center = start + ((end - start) / 2);
+            if (cod->Index[center] == pattern) {
+                result = &(cod->Root[center]);
+                break;
+            }
+            if (cod->Index[center] > pattern) {
+                end    = center - 1;
+            } else {
+                start  = center + 1;
+            }
+        }
+#if USE_DICT_OVERLAY
+        result = CODictOverlay(cod, result);
+#endif //USE_DICT_OVERLAY
+#if USE_OBJ_RANGE
+        result = CODictView(cod, result, end, pattern);
+#endif //USE_OBJ_RANGE
+        return (result);
+    }
+#endif //USE_DICT_INDEX
+    end = (int32_t)cod->Num;
     while (start <= end) {
         center = start + ((end - start) / 2);
         obj    = &(cod->Root[center]);
@@ -55,9 +234,97 @@ CO_OBJ *CODictFind(CO_DICT *cod, uint32_t key)
             start  = center + 1;
         }
     }
+#if USE_DICT_OVERLAY
+    result = CODictOverlay(cod, result);
+#endif //USE_DICT_OVERLAY
+#if USE_OBJ_RANGE
+    result = CODictView(cod, result, end, pattern);
+#endif //USE_OBJ_RANGE
     return(result);
 }
 
+CO_OBJ *CODictRef(CO_DICT *cod, uint32_t key, CO_DICT_REF *ref)
+{
+    CO_OBJ *obj;
+
+    ASSERT_PTR_ERR(cod, NULL);
+    ASSERT_PTR_ERR(ref, NULL);
+
+    obj       = CODictFind(cod, key);
+    ref->Obj  = obj;
+    ref->Key  = key;
+    ref->Gen  = cod->Gen;
+    ref->Type = NULL;
+    ref->Size = 0;
+    if (obj != NULL) {
+        ref->Type = obj->Type;
+        ref->Size = COObjGetSize(obj, cod->Node, 0);
+    }
+    return (obj);
+}
+
+CO_OBJ *CODictRefObj(CO_DICT *cod, CO_DICT_REF *ref)
+{
+    ASSERT_PTR_ERR(cod, NULL);
+    ASSERT_PTR_ERR(ref, NULL);
+
+    if (ref->Gen != cod->Gen) {
+        (void)CODictRef(cod, ref->Key, ref);
+#if USE_OBJ_RANGE
+    } else if ((ref->Obj >= &cod->View[0]) &&
+               (ref->Obj <  &cod->View[CO_DICT_VIEW_N])) {
+        /* element views are not held; search the element again */
+        ref->Obj = CODictFind(cod, ref->Key);
+#endif //USE_OBJ_RANGE
+    }
+    return (ref->Obj);
+}
+
+void CODictUpdate(CO_DICT *cod)
+{
+#if USE_DICT_INDEX || USE_OBJ_RANGE
+    uint32_t n;
+#endif
+
+    ASSERT_PTR(cod);
+
+#if USE_DICT_INDEX
+    if (cod->Index != NULL) {
+        for (n = 0; n < cod->Num; n++) {
+            cod->Index[n] = CO_GET_DEV(cod->Root[n].Key);
+        }
+    }
+#endif //USE_DICT_INDEX
+#if USE_OBJ_RANGE
+    for (n = 0; n < CO_DICT_VIEW_N; n++) {
+        cod->View[n].Key  = 0;
+        cod->View[n].Type = NULL;
+        cod->View[n].Data = (CO_DATA)0;
+    }
+    cod->ViewPos = 0;
+#endif //USE_OBJ_RANGE
+    cod->Gen++;
+    if (cod->Gen == 0) {
+        cod->Gen = 1;
+    }
+}
+
+#if USE_OBJ_RANGE
+CO_OBJ *CODictKeep(CO_DICT *cod, CO_OBJ *obj, CO_OBJ *keep)
+{
+    CO_OBJ *result = obj;
+
+    ASSERT_PTR_ERR(cod,  NULL);
+    ASSERT_PTR_ERR(keep, NULL);
+
+    if ((obj >= &cod->View[0]) && (obj < &cod->View[CO_DICT_VIEW_N])) {
+        *keep  = *obj;
+        result = keep;
+    }
+    return (result);
+}
+#endif //USE_OBJ_RANGE
+
 CO_ERR CODictRdByte(CO_DICT *cod, uint32_t key, uint8_t *val)
 {
     CO_ERR   result = CO_ERR_OBJ_NOT_FOUND;
@@ -211,26 +478,100 @@ CO_ERR CODictWrBuffer(CO_DICT *cod, uint32_t key, uint8_t *buf, uint32_t len)
     return(result);
 }
 
-int16_t CODictInit(CO_DICT *cod, CO_NODE *node, CO_OBJ *root, uint16_t max)
+CO_ERR CODictRefRdByte(CO_DICT *cod, CO_DICT_REF *ref, uint8_t *val)
+{
+    ASSERT_PTR_ERR(val, CO_ERR_BAD_ARG);
+
+    return (CODictRefAccess(cod, ref, (void *)val, 1u, 0));
+}
+
+CO_ERR CODictRefRdWord(CO_DICT *cod, CO_DICT_REF *ref, uint16_t *val)
+{
+    ASSERT_PTR_ERR(val, CO_ERR_BAD_ARG);
+
+    return (CODictRefAccess(cod, ref, (void *)val, 2u, 0));
+}
+
+CO_ERR CODictRefRdLong(CO_DICT *cod, CO_DICT_REF *ref, uint32_t *val)
+{
+    ASSERT_PTR_ERR(val, CO_ERR_BAD_ARG);
+
+    return (CODictRefAccess(cod, ref, (void *)val, 4u, 0));
+}
+
+CO_ERR CODictRefWrByte(CO_DICT *cod, CO_DICT_REF *ref, uint8_t val)
+{
+    return (CODictRefAccess(cod, ref, (void *)&val, 1u, 1));
+}
+
+CO_ERR CODictRefWrWord(CO_DICT *cod, CO_DICT_REF *ref, uint16_t val)
+{
+    return (CODictRefAccess(cod, ref, (void *)&val, 2u, 1));
+}
+
+CO_ERR CODictRefWrLong(CO_DICT *cod, CO_DICT_REF *ref, uint32_t val)
+{
+    return (CODictRefAccess(cod, ref, (void *)&val, 4u, 1));
+}
+
+int32_t CODictInit(CO_DICT *cod, CO_NODE *node, CO_OBJ *root, uint32_t max)
 {
     CO_OBJ   *obj;
-    uint16_t  num = 0;
+    uint32_t  num = 0;
+    uint32_t  last = 0;
+#if USE_OBJ_RANGE
+    CO_OBJ_RANGE *range;
+#endif
 
     ASSERT_PTR_ERR(cod,  -1);
     ASSERT_PTR_ERR(node, -1);
     ASSERT_PTR_ERR(root, -1);
-    ASSERT_NOT_ERR(max, (uint16_t)0, -1);
+    ASSERT_NOT_ERR(max, (uint32_t)0, -1);
+    ASSERT_LOWER_ERR(max, (uint32_t)0x80000000, -1);
 
+    /* count entries and check for ascending keys without duplicates */
     obj = root;
     while ((obj->Key != 0) && (num < max)) {
+        if ((num > 0) && (CO_GET_DEV(obj->Key) <= last)) {
+            return (-1);
+        }
+        last = CO_GET_DEV(obj->Key);
+#if USE_OBJ_RANGE
+        /* a range covers the subindices up to the last element */
+        if (obj->Type == CO_TRANGE) {
+            range = (CO_OBJ_RANGE *)(obj->Data);
+            if ((range == NULL) || (range->Num == 0) ||
+                ((uint32_t)CO_GET_SUB(obj->Key) + range->Num > 0x100u)) {
+                return (-1);
+            }
+            last += ((uint32_t)range->Num - 1u) << 8;
+        }
+#endif //USE_OBJ_RANGE
         num++;
         obj++;
     }
+#if USE_DICT_OVERLAY
+    /* copy the direct entries into the overlay of the node; the stack
+     * writes read-only entries, too (e.g. the error register 1001h) */
+    if (cod->Ovl != NULL) {
+        cod->OvlNum = 0;
+        for (obj = root; obj < &root[num]; obj++) {
+            if (CO_IS_DIRECT(obj->Key) != 0) {
+                if (cod->OvlNum >= cod->OvlMax) {
+                    return (-1);
+                }
+                cod->Ovl[cod->OvlNum] = *obj;
+                cod->OvlNum++;
+            }
+        }
+    }
+#endif //USE_DICT_OVERLAY
     cod->Root  = root;
     cod->Num   = num;
     cod->Max   = max;
     cod->Node  = node;
-    return ((int16_t)num);
+    CODictUpdate(cod);
+    return ((int32_t)num);
 }
 
 CO_ERR CODictObjInit(CO_DICT *cod, CO_NODE *node)
@@ -246,7 +587,11 @@ CO_ERR CODictObjInit(CO_DICT *cod, CO_NODE *node)
     while (obj->Key != 0) {
         obj++;
         if (obj->Key != 0) {
+#if USE_DICT_OVERLAY
+            err = COObjInit(CODictOverlay(cod, obj), node);
+#else
             err = COObjInit(obj, node);
+#endif //USE_DICT_OVERLAY
             if (err != CO_ERR_NONE) {
                 result = err;
             }
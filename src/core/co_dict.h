@@ -26,7 +26,9 @@ extern "C" {
 ******************************************************************************/
 
 #include "co_types.h"
+#include "co_cfg.h"
 #include "co_err.h"
+#include "co_obj.h"
 
 /******************************************************************************
 * PUBLIC TYPES
@@ -34,6 +36,7 @@ extern "C" {
 
 struct CO_NODE_T;              /* Declaration of canopen node structure      */
 struct CO_OBJ_T;               /* Declaration of object entry structure      */
+struct CO_OBJ_TYPE_T;          /* Declaration of object type structure       */
 
 /*! \brief OBJECT dictionary
 *
@@ -43,11 +46,39 @@ struct CO_OBJ_T;               /* Declaration of object entry structure      */
 typedef struct CO_DICT_T {
     struct CO_NODE_T *Node;     /*!< Ptr to parent CANopen node info         */
     struct CO_OBJ_T  *Root;     /*!< Ptr to root object of dictionary        */
-    uint16_t          Num;      /*!< Current number of objects in dictionary */
-    uint16_t          Max;      /*!< Maximal number of objects in dictionary */
+    uint32_t          Num;      /*!< Current number of objects in dictionary */
+    uint32_t          Max;      /*!< Maximal number of objects in dictionary */
+    uint16_t          Gen;      /*!< Generation; changed with dictionary     */
+#if USE_DICT_INDEX
+    uint32_t         *Index;    /*!< Dense array of object keys (or NULL)    */
+#endif //USE_DICT_INDEX
+#if USE_OBJ_RANGE
+    struct CO_OBJ_T   View[CO_DICT_VIEW_N]; /*!< Element views of ranges     */
+    uint8_t           ViewPos;  /*!< Next used element view              */
+#endif //USE_OBJ_RANGE
+#if USE_DICT_OVERLAY
+    struct CO_OBJ_T  *Ovl;      /*!< Direct object entries of node (or NULL) */
+    uint32_t          OvlNum;   /*!< Current number of overlay entries       */
+    uint32_t          OvlMax;   /*!< Maximal number of overlay entries       */
+#endif //USE_DICT_OVERLAY
 
 } CO_DICT;
 
+/*! \brief OBJECT HANDLE
+*
+*    This data structure holds a resolved object entry together with the
+*    object type and size at the time of resolving. A handle is resolved
+*    again on the next access, when the dictionary generation is changed.
+*/
+typedef struct CO_DICT_REF_T {
+    struct CO_OBJ_T            *Obj;   /*!< Resolved object entry or NULL    */
+    const struct CO_OBJ_TYPE_T *Type;  /*!< Object type of resolved entry    */
+    uint32_t                    Key;   /*!< Object entry key                 */
+    uint32_t                    Size;  /*!< Object size of resolved entry    */
+    uint16_t                    Gen;   /*!< Dictionary generation of handle  */
+
+} CO_DICT_REF;
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -56,6 +87,14 @@ typedef struct CO_DICT_T {
 *
 *    This function searches the given key within the given object dictionary.
 *
+*    With USE_OBJ_RANGE enabled, an element of a range object entry is
+*    returned as a view, which is valid for the next CO_DICT_VIEW_N
+*    searches of range elements only. Use CODictKeep() to hold a view
+*    for a longer time.
+*
+*    With USE_DICT_OVERLAY enabled, a direct object entry is returned from
+*    the overlay of the node.
+*
 * \param cod
 *    pointer to the object dictionary
 *
@@ -67,6 +106,76 @@ typedef struct CO_DICT_T {
 */
 struct CO_OBJ_T *CODictFind(CO_DICT *cod, uint32_t key);
 
+/*! \brief  RESOLVE OBJECT HANDLE
+*
+*    This function searches the given key within the given object dictionary
+*    and stores the result together with the object type and size in the
+*    given object handle.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param key
+*    object entry key; should be generated with the macro CO_DEV()
+*
+* \param ref
+*    pointer to the object handle
+*
+* \retval  >0    The pointer to the identified object entry
+* \retval  =0    Addressed object was not found
+*/
+struct CO_OBJ_T *CODictRef(CO_DICT *cod, uint32_t key, CO_DICT_REF *ref);
+
+/*! \brief  GET OBJECT ENTRY OF HANDLE
+*
+*    This function returns the object entry of the given object handle. The
+*    handle is resolved again, when the object dictionary is changed since
+*    the last resolving.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param ref
+*    pointer to the object handle
+*
+* \retval  >0    The pointer to the object entry
+* \retval  =0    Addressed object was not found
+*/
+struct CO_OBJ_T *CODictRefObj(CO_DICT *cod, CO_DICT_REF *ref);
+
+/*! \brief  INVALIDATE OBJECT HANDLES
+*
+*    This function must be called after the object entries of a dynamic
+*    object dictionary are changed. All existing object handles are resolved
+*    again on their next access, and the dictionary index is rebuilt.
+*
+* \param cod
+*    pointer to the object dictionary
+*/
+void CODictUpdate(CO_DICT *cod);
+
+#if USE_OBJ_RANGE
+/*! \brief  KEEP OBJECT ENTRY
+*
+*    This function copies an element view of a range object entry into the
+*    given object entry memory. Other object entries are returned without
+*    a copy.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param obj
+*    pointer to the object entry (or NULL)
+*
+* \param keep
+*    pointer to the object entry memory of the caller
+*
+* \retval  >0    The pointer to the object entry, which may be held
+* \retval  =0    The given object entry is NULL
+*/
+struct CO_OBJ_T *CODictKeep(CO_DICT *cod, struct CO_OBJ_T *obj, struct CO_OBJ_T *keep);
+#endif //USE_OBJ_RANGE
+
 /*! \brief  READ BYTE FROM OBJECT DICTIONARY
 *
 *    This function reads a 8bit value from the given object dictionary. The
@@ -234,6 +343,120 @@ CO_ERR CODictRdBuffer(CO_DICT *cod, uint32_t key, uint8_t *buf, uint32_t len);
 */
 CO_ERR CODictWrBuffer(CO_DICT *cod, uint32_t key, uint8_t *buf, uint32_t len);
 
+/*! \brief  READ BYTE VIA OBJECT HANDLE
+*
+*    This function reads a 8bit value from the object entry of the given
+*    object handle without searching the object dictionary.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param ref
+*    pointer to the object handle
+*
+* \param val
+*    pointer to the value destination
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+CO_ERR CODictRefRdByte(CO_DICT *cod, CO_DICT_REF *ref, uint8_t *val);
+
+/*! \brief  READ WORD VIA OBJECT HANDLE
+*
+*    This function reads a 16bit value from the object entry of the given
+*    object handle without searching the object dictionary.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param ref
+*    pointer to the object handle
+*
+* \param val
+*    pointer to the value destination
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+CO_ERR CODictRefRdWord(CO_DICT *cod, CO_DICT_REF *ref, uint16_t *val);
+
+/*! \brief  READ LONG VIA OBJECT HANDLE
+*
+*    This function reads a 32bit value from the object entry of the given
+*    object handle without searching the object dictionary.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param ref
+*    pointer to the object handle
+*
+* \param val
+*    pointer to the value destination
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+CO_ERR CODictRefRdLong(CO_DICT *cod, CO_DICT_REF *ref, uint32_t *val);
+
+/*! \brief  WRITE BYTE VIA OBJECT HANDLE
+*
+*    This function writes a 8bit value to the object entry of the given
+*    object handle without searching the object dictionary.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param ref
+*    pointer to the object handle
+*
+* \param val
+*    the source value
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+CO_ERR CODictRefWrByte(CO_DICT *cod, CO_DICT_REF *ref, uint8_t val);
+
+/*! \brief  WRITE WORD VIA OBJECT HANDLE
+*
+*    This function writes a 16bit value to the object entry of the given
+*    object handle without searching the object dictionary.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param ref
+*    pointer to the object handle
+*
+* \param val
+*    the source value
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+CO_ERR CODictRefWrWord(CO_DICT *cod, CO_DICT_REF *ref, uint16_t val);
+
+/*! \brief  WRITE LONG VIA OBJECT HANDLE
+*
+*    This function writes a 32bit value to the object entry of the given
+*    object handle without searching the object dictionary.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param ref
+*    pointer to the object handle
+*
+* \param val
+*    the source value
+*
+* \retval   =CO_ERR_NONE    Successfully operation
+* \retval  !=CO_ERR_NONE    An error is detected
+*/
+CO_ERR CODictRefWrLong(CO_DICT *cod, CO_DICT_REF *ref, uint32_t val);
+
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
@@ -246,7 +469,24 @@ CO_ERR CODictWrBuffer(CO_DICT *cod, uint32_t key, uint8_t *buf, uint32_t len);
 *
 *    The internal object dictionary information structure will be updated
 *    with the identified results and linked to the given node information
-*    structure.
+*    structure. The object entries must be sorted by index and subindex
+*    without duplicates; otherwise the initialization fails.
+*
+*    With USE_DICT_INDEX enabled, the key array which is linked in the
+*    dictionary before calling this function is built from the object
+*    entries.
+*
+*    With USE_OBJ_RANGE enabled, the next object entry after a range object
+*    entry must have a key above the last subindex of the range.
+*
+*    With USE_DICT_OVERLAY enabled, the overlay which is linked in the
+*    dictionary before calling this function receives a copy of all direct
+*    object entries, including the read-only entries, which are written by
+*    the stack itself (e.g. the error register 1001h). The stack writes
+*    into these copies only, so the object entry array may be a constant
+*    template, which is shared by several nodes. The initialization fails,
+*    when the overlay is too small. Note: object entries, which refer to
+*    data, access the same data for all nodes.
 *
 * \param cod
 *    pointer to object dictionary which must be initialized
@@ -260,14 +500,15 @@ CO_ERR CODictWrBuffer(CO_DICT *cod, uint32_t key, uint8_t *buf, uint32_t len);
 * \param max
 *    the length of the object entry array
 *
-* \retval   <0    An argument error is detected.
+* \retval   <0    An argument error, an unsorted object entry or an
+*                 overlay overflow is detected.
 * \retval  >=0    identified number of already configured object dictionary
 *                 entries
 */
-int16_t CODictInit(CO_DICT *cod,
+int32_t CODictInit(CO_DICT *cod,
                   struct CO_NODE_T *node,
                   struct CO_OBJ_T *root,
-                  uint16_t max);
+                  uint32_t max);
 
 /*! \brief  INIT OBJECT DICTIONARY OBJECTS
 *
@@ -0,0 +1,155 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+#if USE_DISPATCH
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_DISP_HB_COBID     ((uint32_t)0x700)
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void CODispAdd(CO_DISP *disp, uint32_t id, uint8_t kind, uint16_t num);
+
+/******************************************************************************
+* PROTECTED FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void CODispInit(CO_DISP *disp, struct CO_NODE_T *node)
+{
+    ASSERT_PTR_FATAL(disp);
+    ASSERT_PTR_FATAL(node);
+
+    disp->Node  = node;
+    disp->Valid = 0;
+}
+
+/*
+* see function definition
+*/
+void CODispInvalidate(struct CO_NODE_T *node)
+{
+    ASSERT_PTR(node);
+
+    node->Disp.Valid = 0;
+    COFilterInvalidate(node);
+}
+
+/*
+* see function definition
+*/
+void CODispBuild(CO_DISP *disp)
+{
+    CO_NODE   *node;
+    CO_HBCONS *hbc;
+    uint32_t   id;
+    uint16_t   n;
+
+    ASSERT_PTR(disp);
+
+    node = disp->Node;
+    for (id = 0; id < CO_DISP_STD_N; id++) {
+        disp->Tbl[id] = 0;
+    }
+
+    CODispAdd(disp, 0, CO_DISP_NMT, 0);
+    for (n = 0; n < (uint16_t)CO_SSDO_N; n++) {
+        CODispAdd(disp, node->Sdo[n].RxId, CO_DISP_SSDO, n);
+    }
+#if USE_CSDO
+    for (n = 0; n < (uint16_t)CO_CSDO_N; n++) {
+        CODispAdd(disp, node->CSdo[n].RxId, CO_DISP_CSDO, n);
+    }
+#endif
+    hbc = node->Nmt.HbCons;
+    while (hbc != NULL) {
+        CODispAdd(disp, CO_DISP_HB_COBID + hbc->NodeId, CO_DISP_HBC, hbc->NodeId);
+        hbc = hbc->Next;
+    }
+    for (n = 0; n < (uint16_t)CO_RPDO_N; n++) {
+        if ((node->RPdo[n].Flag & CO_RPDO_FLG__E) != 0) {
+            CODispAdd(disp, node->RPdo[n].Identifier, CO_DISP_RPDO, n);
+        }
+    }
+    CODispAdd(disp, node->Sync.CobId & CO_SYNC_COBID_MASK, CO_DISP_SYNC, 0);
+
+    disp->Valid = 1;
+}
+
+/*
+* see function definition
+*/
+uint16_t CODispFind(CO_DISP *disp, uint32_t id)
+{
+    uint16_t result = (uint16_t)CO_DISP_MULTI << 12;
+
+    if (id < CO_DISP_STD_N) {
+        if (disp->Valid == 0) {
+            CODispBuild(disp);
+        }
+        result = disp->Tbl[id];
+    }
+    return (result);
+}
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  ADD SERVICE TO DISPATCH TABLE
+*
+*    This function enters the given service instance for the identifier
+*    into the dispatch table. Identifiers outside of the 11-bit range are
+*    ignored, because these frames are always checked by all services.
+*
+* \param disp
+*    reference to dispatch table
+*
+* \param id
+*    receive COB-ID of service
+*
+* \param kind
+*    service kind (CO_DISP_NMT, CO_DISP_SSDO, ...)
+*
+* \param num
+*    instance number of service
+*/
+static void CODispAdd(CO_DISP *disp, uint32_t id, uint8_t kind, uint16_t num)
+{
+    if (id < CO_DISP_STD_N) {
+        if (disp->Tbl[id] == 0) {
+            disp->Tbl[id] = (uint16_t)(((uint16_t)kind << 12) | num);
+        } else {
+            disp->Tbl[id] = (uint16_t)CO_DISP_MULTI << 12;
+        }
+    }
+}
+
+#endif //USE_DISPATCH
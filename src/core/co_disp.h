@@ -0,0 +1,144 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+#ifndef CO_DISP_H_
+#define CO_DISP_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_cfg.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_DISP_STD_N    ((uint32_t)0x800)  /*!< number of 11-bit identifiers */
+
+#define CO_DISP_NONE     ((uint8_t)0x0)     /*!< no service on identifier     */
+#define CO_DISP_NMT      ((uint8_t)0x1)     /*!< NMT node control             */
+#define CO_DISP_SSDO     ((uint8_t)0x2)     /*!< SDO server request           */
+#define CO_DISP_CSDO     ((uint8_t)0x3)     /*!< SDO client response          */
+#define CO_DISP_HBC      ((uint8_t)0x4)     /*!< heartbeat consumer           */
+#define CO_DISP_RPDO     ((uint8_t)0x5)     /*!< receive PDO                  */
+#define CO_DISP_SYNC     ((uint8_t)0x6)     /*!< SYNC consumer                */
+#define CO_DISP_MULTI    ((uint8_t)0xF)     /*!< shared or extended identifier*/
+
+/*! \brief DISPATCH ENTRY DECODING
+*
+*    An entry of the dispatch table holds the service kind in the upper
+*    4 bits and the instance number of the service in the lower 12 bits.
+*/
+#define CO_DISP_KIND(e)  ((uint8_t)((uint16_t)(e) >> 12))
+#define CO_DISP_NUM(e)   ((uint16_t)((uint16_t)(e) & (uint16_t)0x0FFF))
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+#if USE_DISPATCH
+
+/*! \brief COB-ID DISPATCH TABLE
+*
+*    This structure holds the lookup table, which maps each 11-bit CAN
+*    identifier to the consuming service instance. The table is rebuilt
+*    on demand, after any receive COB-ID of the node is changed.
+*/
+typedef struct CO_DISP_T {
+    struct CO_NODE_T *Node;                  /*!< link to parent node        */
+    uint16_t          Tbl[CO_DISP_STD_N];    /*!< entry per 11-bit identifier*/
+    uint8_t           Valid;                 /*!< table matches COB-IDs      */
+
+} CO_DISP;
+
+#endif //USE_DISPATCH
+
+/******************************************************************************
+* PROTECTED FUNCTIONS
+******************************************************************************/
+
+#if USE_DISPATCH
+
+/*! \brief  INIT DISPATCH TABLE
+*
+*    This function initializes the dispatch table of the given node. The
+*    table content is built with the first lookup.
+*
+* \param disp
+*    reference to dispatch table
+*
+* \param node
+*    reference to parent node
+*/
+void CODispInit(CO_DISP *disp, struct CO_NODE_T *node);
+
+/*! \brief  INVALIDATE DISPATCH TABLE
+*
+*    This function marks the dispatch table of the given node as outdated.
+*    The services call this function whenever a receive COB-ID changes.
+*    The CAN acceptance filter is marked as outdated, too.
+*
+* \param node
+*    reference to parent node
+*/
+void CODispInvalidate(struct CO_NODE_T *node);
+
+/*! \brief  BUILD DISPATCH TABLE
+*
+*    This function collects the receive COB-IDs of all services within the
+*    node and builds the dispatch table. Identifiers, which are consumed by
+*    more than one service are marked with CO_DISP_MULTI.
+*
+* \param disp
+*    reference to dispatch table
+*/
+void CODispBuild(CO_DISP *disp);
+
+/*! \brief  FIND SERVICE FOR IDENTIFIER
+*
+*    This function returns the dispatch entry for the given CAN identifier.
+*    An outdated table is rebuilt before the lookup. All 29-bit identifiers
+*    return CO_DISP_MULTI, which requests the full check of all services.
+*
+* \param disp
+*    reference to dispatch table
+*
+* \param id
+*    received CAN identifier
+*
+* \return
+*    dispatch entry (decode with CO_DISP_KIND() and CO_DISP_NUM())
+*/
+uint16_t CODispFind(CO_DISP *disp, uint32_t id);
+
+#else
+
+#define CODispInvalidate(node)  COFilterInvalidate(node)
+
+#endif //USE_DISPATCH
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif  /* #ifndef CO_DISP_H_ */
@@ -139,7 +139,11 @@ typedef enum CO_ERR_T {
     CO_ERR_TYPE_INIT,            /*!< error during type initialization       */
     CO_ERR_TYPE_RD,              /*!< error during reading type              */
     CO_ERR_TYPE_WR,              /*!< error during writing type              */
-    CO_ERR_TYPE_RESET            /*!< error during reset type                */
+    CO_ERR_TYPE_RESET,           /*!< error during reset type                */
+
+    CO_ERR_IF_CAN_FILTER,        /*!< error during setting acceptance filter */
+    CO_ERR_OBJ_PENDING,          /*!< object access is completed later       */
+    CO_ERR_IF_CAN_TX_DROP        /*!< transmit frame dropped (queue full)    */
 
 } CO_ERR;
 
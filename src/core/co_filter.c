@@ -0,0 +1,198 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+#if USE_CAN_FILTER
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_FILTER_HB_COBID   ((uint32_t)0x700)
+#define CO_FILTER_ID_OFF     ((uint32_t)1 << 31)
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void COFilterAdd(CO_FILTER *flt, uint32_t id);
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+CO_ERR COFilterSetApp(CO_FILTER *flt, const uint32_t *id, uint16_t num)
+{
+    uint16_t n;
+
+    ASSERT_PTR_ERR(flt, CO_ERR_BAD_ARG);
+
+    if (num > (uint16_t)CO_FILTER_APP_N) {
+        return (CO_ERR_BAD_ARG);
+    }
+    for (n = 0; n < num; n++) {
+        flt->App[n] = id[n];
+    }
+    flt->AppNum = num;
+    flt->Valid  = 0;
+
+    return (CO_ERR_NONE);
+}
+
+/******************************************************************************
+* PROTECTED FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void COFilterInit(CO_FILTER *flt, struct CO_NODE_T *node)
+{
+    ASSERT_PTR_FATAL(flt);
+    ASSERT_PTR_FATAL(node);
+
+    flt->Node   = node;
+    flt->Num    = 0;
+    flt->AppNum = 0;
+    flt->Valid  = 0;
+}
+
+/*
+* see function definition
+*/
+void COFilterInvalidate(struct CO_NODE_T *node)
+{
+    ASSERT_PTR(node);
+
+    node->Filter.Valid = 0;
+}
+
+/*
+* see function definition
+*/
+void COFilterBuild(CO_FILTER *flt)
+{
+    CO_NODE   *node;
+    CO_HBCONS *hbc;
+    uint16_t   n;
+    uint8_t    allowed;
+
+    ASSERT_PTR(flt);
+
+    node     = flt->Node;
+    allowed  = node->Nmt.Allowed;
+    flt->Num = 0;
+
+#if USE_LSS
+    COFilterAdd(flt, CO_LSS_RX_ID);
+#endif //USE_LSS
+    if ((allowed & CO_NMT_ALLOWED) != (uint8_t)0) {
+        COFilterAdd(flt, 0);
+        hbc = node->Nmt.HbCons;
+        while (hbc != NULL) {
+            COFilterAdd(flt, CO_FILTER_HB_COBID + hbc->NodeId);
+            hbc = hbc->Next;
+        }
+    }
+    if ((allowed & CO_SDO_ALLOWED) != (uint8_t)0) {
+        for (n = 0; n < (uint16_t)CO_SSDO_N; n++) {
+            COFilterAdd(flt, node->Sdo[n].RxId);
+        }
+#if USE_CSDO
+        for (n = 0; n < (uint16_t)CO_CSDO_N; n++) {
+            COFilterAdd(flt, node->CSdo[n].RxId);
+        }
+#endif
+    }
+    if ((allowed & CO_PDO_ALLOWED) != (uint8_t)0) {
+        for (n = 0; n < (uint16_t)CO_RPDO_N; n++) {
+            if ((node->RPdo[n].Flag & CO_RPDO_FLG__E) != 0) {
+                COFilterAdd(flt, node->RPdo[n].Identifier);
+            }
+        }
+    }
+    if ((allowed & CO_SYNC_ALLOWED) != (uint8_t)0) {
+        if ((node->Sync.CobId & CO_SYNC_COBID_MASK) != (uint32_t)0) {
+            COFilterAdd(flt, node->Sync.CobId & CO_SYNC_COBID_MASK);
+        }
+    }
+    for (n = 0; n < flt->AppNum; n++) {
+        COFilterAdd(flt, flt->App[n]);
+    }
+}
+
+/*
+* see function definition
+*/
+void COFilterUpdate(CO_FILTER *flt)
+{
+    int16_t err;
+
+    ASSERT_PTR(flt);
+
+    if (flt->Valid == 0) {
+        COFilterBuild(flt);
+        err = COIfCanFilter(&flt->Node->If, &flt->Id[0], flt->Num);
+        if (err >= 0) {
+            flt->Valid = 1;
+        }
+    }
+}
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  ADD IDENTIFIER TO ACCEPTANCE FILTER
+*
+*    This function appends the given identifier to the identifier list.
+*    Disabled COB-IDs and identifiers, which are already in the list, are
+*    ignored.
+*
+* \param flt
+*    reference to acceptance filter
+*
+* \param id
+*    receive COB-ID of service
+*/
+static void COFilterAdd(CO_FILTER *flt, uint32_t id)
+{
+    uint16_t n;
+
+    if ((id & CO_FILTER_ID_OFF) != (uint32_t)0) {
+        return;
+    }
+    for (n = 0; n < flt->Num; n++) {
+        if (flt->Id[n] == id) {
+            return;
+        }
+    }
+    if (flt->Num < (uint16_t)CO_FILTER_N) {
+        flt->Id[flt->Num] = id;
+        flt->Num++;
+    }
+}
+
+#endif //USE_CAN_FILTER
@@ -0,0 +1,159 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_FILTER_H_
+#define CO_FILTER_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_cfg.h"
+#include "co_err.h"
+#include "co_nmt.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/*! \brief NUMBER OF FILTER IDENTIFIERS
+*
+*    The acceptance filter list holds the identifiers of NMT, SYNC, LSS,
+*    all SDO servers and clients, all RPDOs, all heartbeat consumers and
+*    the application identifiers.
+*/
+#define CO_FILTER_N      (3u + CO_SSDO_N + CO_CSDO_N + CO_RPDO_N + \
+                          CO_HBC_NODE_N + CO_FILTER_APP_N)
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+#if USE_CAN_FILTER
+
+/*! \brief CAN ACCEPTANCE FILTER
+*
+*    This structure holds the list of CAN identifiers, which are consumed
+*    by the node in the current NMT mode. The list is rebuilt and passed
+*    to the CAN driver, after any receive COB-ID or the NMT mode of the
+*    node is changed.
+*/
+typedef struct CO_FILTER_T {
+    struct CO_NODE_T *Node;                  /*!< link to parent node        */
+    uint32_t          Id[CO_FILTER_N];       /*!< accepted identifiers       */
+    uint32_t          App[CO_FILTER_APP_N];  /*!< application identifiers    */
+    uint16_t          Num;                   /*!< number of identifiers      */
+    uint16_t          AppNum;                /*!< number of app identifiers  */
+    uint8_t           Valid;                 /*!< list matches configuration */
+
+} CO_FILTER;
+
+#endif //USE_CAN_FILTER
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+#if USE_CAN_FILTER
+
+/*! \brief  SET APPLICATION IDENTIFIERS
+*
+*    This function sets the CAN identifiers, which are not consumed by the
+*    stack, but must pass the acceptance filter for the application. These
+*    frames are passed to the callback function COIfCanReceive(). The
+*    identifiers are copied; the call with num = 0 removes all application
+*    identifiers.
+*
+* \param flt
+*    reference to acceptance filter
+*
+* \param id
+*    array of application CAN identifiers
+*
+* \param num
+*    number of identifiers in array (0..CO_FILTER_APP_N)
+*
+* \retval  =CO_ERR_NONE    identifiers are set
+* \retval  =CO_ERR_BAD_ARG too many identifiers
+*/
+CO_ERR COFilterSetApp(CO_FILTER *flt, const uint32_t *id, uint16_t num);
+
+/******************************************************************************
+* PROTECTED FUNCTIONS
+******************************************************************************/
+
+/*! \brief  INIT ACCEPTANCE FILTER
+*
+*    This function initializes the acceptance filter of the given node. The
+*    identifier list is built and passed to the driver with the first
+*    update.
+*
+* \param flt
+*    reference to acceptance filter
+*
+* \param node
+*    reference to parent node
+*/
+void COFilterInit(CO_FILTER *flt, struct CO_NODE_T *node);
+
+/*! \brief  INVALIDATE ACCEPTANCE FILTER
+*
+*    This function marks the acceptance filter of the given node as
+*    outdated. This is done whenever a receive COB-ID or the NMT mode of
+*    the node changes.
+*
+* \param node
+*    reference to parent node
+*/
+void COFilterInvalidate(struct CO_NODE_T *node);
+
+/*! \brief  BUILD ACCEPTANCE FILTER
+*
+*    This function collects the receive COB-IDs of all services, which are
+*    allowed in the current NMT mode, and the application identifiers.
+*    Disabled services (COB-ID with bit 31 set) are not added.
+*
+* \param flt
+*    reference to acceptance filter
+*/
+void COFilterBuild(CO_FILTER *flt);
+
+/*! \brief  UPDATE ACCEPTANCE FILTER
+*
+*    This function rebuilds an outdated acceptance filter and passes the
+*    identifier list to the CAN driver.
+*
+* \param flt
+*    reference to acceptance filter
+*/
+void COFilterUpdate(CO_FILTER *flt);
+
+#else
+
+#define COFilterInvalidate(node)
+
+#endif //USE_CAN_FILTER
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif  /* #ifndef CO_FILTER_H_ */
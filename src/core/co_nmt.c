@@ -82,6 +82,11 @@ void CONmtReset(CO_NMT *nmt, CO_NMT_RESET type)
         nobootup = 0;
     }
 
+#if USE_PARA_ASYNC
+    /* finish a running background store before loading parameters */
+    COParaAsyncFlush(&nmt->Node->ParaAsync);
+#endif //USE_PARA_ASYNC
+
     /* check for parameter storage */
     store = CODictFind(&(nmt->Node->Dict), CO_DEV(0x1010, 0));
 
@@ -103,7 +108,7 @@ void CONmtReset(CO_NMT *nmt, CO_NMT_RESET type)
         }
 
 #if USE_LSS
-        err = COLssLoad(&nmt->Node->Baudrate, &nmt->Node->NodeId);
+        err = CO_CB_LSS_LOAD(nmt->Node, &nmt->Node->Baudrate, &nmt->Node->NodeId);
         if (err != CO_ERR_NONE) {
             nmt->Node->Error = CO_ERR_LSS_LOAD;
         }
@@ -123,11 +128,23 @@ void CONmtReset(CO_NMT *nmt, CO_NMT_RESET type)
 
 void CONmtInit(CO_NMT *nmt, CO_NODE *node)
 {
+#if USE_HBC_TABLE
+    uint16_t n;
+#endif
+
     ASSERT_PTR_FATAL(nmt);
     ASSERT_PTR_FATAL(node);
 
     nmt->Node = node;
     nmt->HbCons = NULL;
+#if USE_HBC_TABLE
+    for (n = 0; n < CO_HBC_NODE_N; n++) {
+        nmt->HbTbl[n] = NULL;
+    }
+    nmt->HbNow = 0;
+    nmt->HbTmr = -1;
+#endif
+    CODispInvalidate(node);
     CONmtSetMode(nmt, CO_INIT);
 }
 
@@ -195,6 +212,7 @@ void CONmtSetMode(CO_NMT *nmt, CO_MODE mode)
             CORPdoInit(nmt->Node->RPdo, nmt->Node);
         }
         CONmtModeChange(nmt, mode);
+        COFilterInvalidate(nmt->Node);
     }
     nmt->Mode    = mode;
     nmt->Allowed = CONmtModeObj[mode];
@@ -25,6 +25,7 @@ extern "C" {
 * INCLUDES
 ******************************************************************************/
 
+#include "co_cfg.h"
 #include "co_obj.h"
 #include "co_if.h"
 #include "co_err.h"
@@ -41,6 +42,8 @@ extern "C" {
 #define CO_SDO_ALLOWED   0x20    /*!< indication of SDO transfers allowed    */
 #define CO_PDO_ALLOWED   0x40    /*!< indication of PDO transfers allowed    */
 
+#define CO_HBC_NODE_N    128     /*!< number of heartbeat consumer node-ids  */
+
 /******************************************************************************
 * PUBLIC TYPES
 ******************************************************************************/
@@ -85,6 +88,11 @@ typedef struct CO_NMT_T {
     enum CO_MODE_T      Mode;    /*!< NMT mode of this node                  */
     int16_t             Tmr;     /*!< heartbeat producer timer identifier    */
     uint8_t             Allowed; /*!< encoding of allowed CAN objects        */
+#if USE_HBC_TABLE
+    struct CO_HBCONS_T *HbTbl[CO_HBC_NODE_N]; /*!< consumers by node-id      */
+    uint32_t            HbNow;   /*!< heartbeat consumer sweep counter       */
+    int16_t             HbTmr;   /*!< heartbeat consumer sweep timer         */
+#endif
 
 } CO_NMT;
 
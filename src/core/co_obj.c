@@ -105,6 +105,11 @@ CO_ERR COObjWrBufStart(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint8_t *bu
     if (type->Write != NULL) {
         (void)COObjReset(obj, node, 0);
         result = type->Write(obj, node, (void *)buffer, size);
+#if USE_PARA_DIRTY
+        if (result == CO_ERR_NONE) {
+            COParaDirtyObj(node, obj);
+        }
+#endif //USE_PARA_DIRTY
     }
     return (result);
 }
@@ -122,6 +127,32 @@ CO_ERR COObjWrBufCont(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint8_t *buf
     type = obj->Type;
     if (type->Write != NULL) {
         result = type->Write(obj, node, (void *)buffer, size);
+#if USE_PARA_DIRTY
+        if (result == CO_ERR_NONE) {
+            COParaDirtyObj(node, obj);
+        }
+#endif //USE_PARA_DIRTY
+    }
+    return (result);
+}
+
+uint8_t *COObjRegion(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t offset, uint32_t *size)
+{
+    const CO_OBJ_TYPE *type;
+    uint8_t *result = 0;
+
+    ASSERT_PTR_ERR(obj,       0);
+    ASSERT_PTR_ERR(obj->Type, 0);
+    ASSERT_PTR_ERR(node,      0);
+    ASSERT_PTR_ERR(size,      0);
+
+    *size = 0;
+    type  = obj->Type;
+    if (type->Region != NULL) {
+        result = type->Region(obj, node, offset, size);
+    }
+    if (result == 0) {
+        *size = 0;
     }
     return (result);
 }
@@ -190,6 +221,11 @@ CO_ERR COObjWrValue(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *value, u
     type = obj->Type;
     if (type->Write != NULL) {
         result = type->Write(obj, node, value, width);
+#if USE_PARA_DIRTY
+        if (result == CO_ERR_NONE) {
+            COParaDirtyObj(node, obj);
+        }
+#endif //USE_PARA_DIRTY
     }
     return (result);
 }
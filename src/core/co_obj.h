@@ -271,6 +271,8 @@ typedef CO_ERR   (*CO_OBJ_READ_FUNC) (struct CO_OBJ_T *obj, struct CO_NODE_T *no
 typedef CO_ERR   (*CO_OBJ_WRITE_FUNC)(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
 /*!< Reset type function prototype */
 typedef CO_ERR   (*CO_OBJ_RESET_FUNC)(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t para);
+/*!< Region type function prototype */
+typedef uint8_t *(*CO_OBJ_REGION_FUNC)(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t offset, uint32_t *size);
 
 /*! \brief OBJECT TYPE
 *
@@ -283,6 +285,7 @@ typedef struct CO_OBJ_TYPE_T {
     CO_OBJ_READ_FUNC   Read;           /*!< Read type value function         */
     CO_OBJ_WRITE_FUNC  Write;          /*!< Write type value function        */
     CO_OBJ_RESET_FUNC  Reset;          /*!< Reset type value function        */
+    CO_OBJ_REGION_FUNC Region;         /*!< Get memory region function       */
 
 } CO_OBJ_TYPE;
 
@@ -416,6 +419,31 @@ CO_ERR COObjWrBufStart(CO_OBJ *obj, struct CO_NODE_T *node, uint8_t *buffer, uin
 */
 CO_ERR COObjWrBufCont(CO_OBJ *obj, struct CO_NODE_T *node, uint8_t *buffer, uint32_t len);
 
+/*! \brief  GET MEMORY REGION OF OBJECT ENTRY
+*
+*    This function returns the contiguous memory region of the object
+*    entry, which starts at the given byte offset. The memory is directly
+*    readable and writable, so a caller may stream data without staging
+*    it in an intermediate buffer. The offset of the byte stream is not
+*    changed by this function.
+*
+* \param obj
+*    pointer to the object dictionary entry
+*
+* \param node
+*    reference to parent node
+*
+* \param offset
+*    byte offset within the object entry
+*
+* \param size
+*    pointer to the number of bytes in the returned region
+*
+* \retval  !=0    pointer to the start of the memory region
+* \retval   =0    type provides no memory region
+*/
+uint8_t *COObjRegion(CO_OBJ *obj, struct CO_NODE_T *node, uint32_t offset, uint32_t *size);
+
 /*! \brief TYPE SPECIFIC SDO ABORT CODE
 *
 *    This function is responsible to set a user defined SDO abort code
@@ -33,8 +33,20 @@ extern void COTmrUnlock(void);
 ******************************************************************************/
 
 static void         COTmrReset  (CO_TMR *tmr);
+#if USE_TMR_WHEEL
+static uint32_t     COTmrWheelNow    (CO_TMR *tmr);
+static uint32_t     COTmrWheelFind   (CO_TMR *tmr);
+static void         COTmrWheelNext   (CO_TMR *tmr);
+static void         COTmrWheelTick   (CO_TMR *tmr);
+static uint32_t     COTmrWheelPlace  (CO_TMR *tmr, CO_TMR_ACTION *action);
+static void         COTmrWheelInsert (CO_TMR *tmr, uint32_t dTnew, CO_TMR_ACTION *action);
+static void         COTmrWheelLink   (CO_TMR *tmr, uint16_t slot, CO_TMR_ACTION *action);
+static void         COTmrWheelUnlink (CO_TMR *tmr, CO_TMR_ACTION *action);
+static void         COTmrWheelFree   (CO_TMR *tmr, CO_TMR_ACTION *action);
+#else
 static CO_TMR_TIME *COTmrInsert (CO_TMR *tmr, uint32_t dTnew, CO_TMR_ACTION *action);
 static void         COTmrRemove (CO_TMR *tmr, CO_TMR_TIME *tx);
+#endif
 
 /******************************************************************************
 * PROTECTED FUNCTIONS
@@ -42,15 +54,17 @@ static void         COTmrRemove (CO_TMR *tmr, CO_TMR_TIME *tx);
 
 void COTmrInit(CO_TMR *tmr, CO_NODE *node, CO_TMR_MEM *mem, uint16_t num, uint32_t freq)
 {
-    COTmrLock();
+    CO_CB_TMR_LOCK(node);
     tmr->Node  = node;
     tmr->Max   = num;
+#if USE_TMR_WHEEL == 0
     tmr->TPool = &mem->Tmr;
+#endif
     tmr->APool = &mem->Act;
     tmr->Freq  = freq;
 
     COTmrReset(tmr);
-    COTmrUnlock();
+    CO_CB_TMR_UNLOCK(node);
 }
 
 void COTmrClear(CO_TMR *tmr)
@@ -128,7 +142,9 @@ int16_t COTmrCreate(CO_TMR      *tmr,
                     void        *para)
 {
     CO_TMR_ACTION *act;
+#if USE_TMR_WHEEL == 0
     CO_TMR_TIME   *tn;
+#endif
     int16_t        result;
 
     if (tmr == 0) {
@@ -151,10 +167,10 @@ int16_t COTmrCreate(CO_TMR      *tmr,
         return -1;
     }
 
-    COTmrLock();
+    CO_CB_TMR_LOCK(tmr->Node);
     if (tmr->Acts == 0) {
         tmr->Node->Error = CO_ERR_TMR_NO_ACT;
-        COTmrUnlock();
+        CO_CB_TMR_UNLOCK(tmr->Node);
         return -1;
     }
 
@@ -165,6 +181,10 @@ int16_t COTmrCreate(CO_TMR      *tmr,
     act->Para       = para;
     act->CycleTicks = cycleTicks;
 
+#if USE_TMR_WHEEL
+    COTmrWheelInsert(tmr, startTicks, act);
+    result = (int16_t)(act->Id);
+#else
     tn = COTmrInsert(tmr, startTicks, act);
     if (tn == (CO_TMR_TIME*)0) {
         act->CycleTicks  = 0;
@@ -177,12 +197,15 @@ int16_t COTmrCreate(CO_TMR      *tmr,
     } else {
         result = (int16_t)(act->Id);
     }
+#endif
 
-    COTmrUnlock();
+    CO_CB_TMR_UNLOCK(tmr->Node);
 
     return (result);
 }
 
+#if USE_TMR_WHEEL == 0
+
 WEAK_TEST
 int16_t COTmrDelete(CO_TMR *tmr, int16_t actId)
 {
@@ -197,7 +220,7 @@ int16_t COTmrDelete(CO_TMR *tmr, int16_t actId)
         return -1;
     }
 
-    COTmrLock();
+    CO_CB_TMR_LOCK(tmr->Node);
 
     /* search in used timer list */
     tx = tmr->Use;                     
@@ -271,7 +294,7 @@ int16_t COTmrDelete(CO_TMR *tmr, int16_t actId)
             result = 0;
         }
     }
-    COTmrUnlock();
+    CO_CB_TMR_UNLOCK(tmr->Node);
 
     return (result);
 }
@@ -328,7 +351,7 @@ void COTmrProcess(CO_TMR *tmr)
     void          *para;
 
     while (tmr->Elapsed != 0) {
-        COTmrLock();
+        CO_CB_TMR_LOCK(tmr->Node);
         tn            = tmr->Elapsed;
         tmr->Elapsed  = tn->Next;
 
@@ -338,7 +361,7 @@ void COTmrProcess(CO_TMR *tmr)
         tn->Delta     = 0;
         tn->Next      = tmr->Free;
         tmr->Free     = tn;
-        COTmrUnlock();
+        CO_CB_TMR_UNLOCK(tmr->Node);
 
         /* loop through all actions of elapsed timer event */
         while (act != 0) {
@@ -350,15 +373,15 @@ void COTmrProcess(CO_TMR *tmr)
             if (act->CycleTicks == 0) {
                 act->Para = 0;
                 act->Func = (CO_TMR_FUNC)0;
-                COTmrLock();
+                CO_CB_TMR_LOCK(tmr->Node);
                 act->Next = tmr->Acts;
                 tmr->Acts = act;
-                COTmrUnlock();
+                CO_CB_TMR_UNLOCK(tmr->Node);
 
             } else {
-                COTmrLock();
+                CO_CB_TMR_LOCK(tmr->Node);
                 res = COTmrInsert(tmr, act->CycleTicks, act);
-                COTmrUnlock();
+                CO_CB_TMR_UNLOCK(tmr->Node);
                 if (res == (CO_TMR_TIME*)0) {
                     tmr->Node->Error = CO_ERR_TMR_CREATE;
                 }
@@ -370,10 +393,345 @@ void COTmrProcess(CO_TMR *tmr)
     }
 }
 
+#else
+
+WEAK_TEST
+int16_t COTmrDelete(CO_TMR *tmr, int16_t actId)
+{
+    CO_TMR_MEM    *mem    = (CO_TMR_MEM *)tmr->APool;
+    CO_TMR_ACTION *act;
+    int16_t        result = -1;
+
+    if ( (actId < 0) ||
+         (actId >= (int16_t)(tmr->Max)) ) {
+        return -1;
+    }
+
+    CO_CB_TMR_LOCK(tmr->Node);
+
+    /* the action identifier is the index within the memory pool */
+    act = &mem[actId].Act;
+    if (act->Slot != CO_TMR_WHEEL_FREE) {
+        COTmrWheelUnlink(tmr, act);
+        COTmrWheelFree(tmr, act);
+        result = 0;
+    }
+    CO_CB_TMR_UNLOCK(tmr->Node);
+
+    return (result);
+}
+
+int16_t COTmrService(CO_TMR *tmr)
+{
+    CO_IF         *cif;
+    uint32_t       dt;
+    int16_t        result = 0;
+    int16_t        elapsed;
+
+    ASSERT_PTR_FATAL_ERR(tmr, -1);
+
+    cif = &tmr->Node->If;
+    elapsed = COIfTimerUpdate(cif);
+    if (elapsed > 0) {
+        tmr->Time += tmr->Load;
+
+        /* turn the wheel to all used ticks up to the current time */
+        while (tmr->Cur != tmr->Time) {
+            dt = COTmrWheelFind(tmr);
+            if ((dt == 0) || (dt > (tmr->Time - tmr->Cur))) {
+                tmr->Cur = tmr->Time;
+            } else {
+                tmr->Cur += dt;
+                COTmrWheelTick(tmr);
+            }
+        }
+
+        /* setup next timer event */
+        COTmrWheelNext(tmr);
+        result = 1;
+    }
+    return (result);
+}
+
+/*
+* see function definition
+*/
+void COTmrProcess(CO_TMR *tmr)
+{
+    CO_TMR_ACTION *act;
+    CO_TMR_FUNC    func;
+    void          *para;
+
+    CO_CB_TMR_LOCK(tmr->Node);
+    act = tmr->Wheel[CO_TMR_WHEEL_DONE];
+    while (act != 0) {
+        COTmrWheelUnlink(tmr, act);
+        func = act->Func;
+        para = act->Para;
+        if (act->CycleTicks == 0) {
+            COTmrWheelFree(tmr, act);
+        } else {
+            COTmrWheelInsert(tmr, act->CycleTicks, act);
+        }
+        CO_CB_TMR_UNLOCK(tmr->Node);
+
+        /* execute callback function */
+        func(para);
+
+        CO_CB_TMR_LOCK(tmr->Node);
+        act = tmr->Wheel[CO_TMR_WHEEL_DONE];
+    }
+    CO_CB_TMR_UNLOCK(tmr->Node);
+}
+
+#endif
+
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
+#if USE_TMR_WHEEL
+
+static void COTmrReset(CO_TMR *tmr)
+{
+    CO_TMR_MEM    *mem = (CO_TMR_MEM *)tmr->APool;
+    CO_TMR_ACTION *ap  = tmr->APool;
+    uint16_t       id  = 0;
+    uint16_t       blk;
+
+    for (blk = 0; blk <= CO_TMR_WHEEL_DONE; blk++) {
+        tmr->Wheel[blk] = 0;
+    }
+    for (blk = 0; blk < CO_TMR_WHEEL_MAP_N; blk++) {
+        tmr->Map[blk] = 0;
+    }
+    tmr->Time = 0;
+    tmr->Load = 0;
+    tmr->Cur  = 0;
+    tmr->Acts = tmr->APool;
+
+    for (blk = 1; blk <= tmr->Max; blk++) {
+        if (blk < tmr->Max) {
+            ap->Next  = &mem[blk].Act;
+        } else {
+            ap->Next  = 0;
+        }
+        ap->Id         = id;
+        ap->Func       = (CO_TMR_FUNC)0;
+        ap->Para       = 0;
+        ap->CycleTicks = 0;
+        ap->Prev       = 0;
+        ap->Expire     = 0;
+        ap->Slot       = CO_TMR_WHEEL_FREE;
+        ap             = ap->Next;
+        id++;
+    }
+}
+
+static uint32_t COTmrWheelNow(CO_TMR *tmr)
+{
+    uint32_t now = tmr->Time;
+
+    /* add the ticks of the running timer reload, which are already gone */
+    if (tmr->Load > 0) {
+        now += tmr->Load - COIfTimerDelay(&tmr->Node->If);
+    }
+    return (now);
+}
+
+static uint32_t COTmrWheelFind(CO_TMR *tmr)
+{
+    uint32_t result = 0;
+    uint32_t shift;
+    uint32_t idx;
+    uint32_t pos;
+    uint32_t dt;
+    uint32_t k;
+    uint16_t lvl;
+
+    /* search the next used slot in each level; unused words are skipped */
+    for (lvl = 0; lvl < CO_TMR_WHEEL_LVL; lvl++) {
+        shift = (uint32_t)lvl * CO_TMR_WHEEL_BITS;
+        idx   = tmr->Cur >> shift;
+
+        /* upper level slots are reached not before the next slot border */
+        if ((result > 0) && (result <= (((idx + 1) << shift) - tmr->Cur))) {
+            break;
+        }
+        for (k = 1; k <= CO_TMR_WHEEL_N; k++) {
+            pos = ((uint32_t)lvl * CO_TMR_WHEEL_N) + ((idx + k) & CO_TMR_WHEEL_MSK);
+            if (tmr->Map[pos >> 5] == 0) {
+                k += 31 - (pos & 31);
+            } else if ((tmr->Map[pos >> 5] & ((uint32_t)1 << (pos & 31))) != 0) {
+                dt = ((idx + k) << shift) - tmr->Cur;
+                if ((result == 0) || (dt < result)) {
+                    result = dt;
+                }
+                break;
+            }
+        }
+    }
+    return (result);
+}
+
+static void COTmrWheelNext(CO_TMR *tmr)
+{
+    CO_IF    *cif = &tmr->Node->If;
+    uint32_t  dt;
+
+    dt = COTmrWheelFind(tmr);
+    if (dt > 0) {
+        tmr->Load = dt;
+        COIfTimerReload(cif, dt);
+    } else {
+        tmr->Load = 0;
+        COIfTimerStop(cif);
+    }
+}
+
+static void COTmrWheelTick(CO_TMR *tmr)
+{
+    CO_TMR_ACTION *act;
+    CO_TMR_ACTION *next;
+    uint32_t       shift;
+    uint16_t       slot;
+    uint16_t       lvl;
+
+    /* cascade reached slots of upper levels, starting with top level */
+    for (lvl = CO_TMR_WHEEL_LVL - 1; lvl > 0; lvl--) {
+        shift = (uint32_t)lvl * CO_TMR_WHEEL_BITS;
+        if ((tmr->Cur & (((uint32_t)1 << shift) - 1)) == 0) {
+            slot = (uint16_t)((lvl * CO_TMR_WHEEL_N) +
+                              ((tmr->Cur >> shift) & CO_TMR_WHEEL_MSK));
+            act              = tmr->Wheel[slot];
+            tmr->Wheel[slot] = 0;
+            tmr->Map[slot >> 5] &= ~((uint32_t)1 << (slot & 31));
+            while (act != 0) {
+                next = act->Next;
+                (void)COTmrWheelPlace(tmr, act);
+                act  = next;
+            }
+        }
+    }
+
+    /* move expired actions of reached slot to elapsed list */
+    act = tmr->Wheel[tmr->Cur & CO_TMR_WHEEL_MSK];
+    while (act != 0) {
+        next = act->Next;
+        if ((int32_t)(act->Expire - tmr->Cur) <= 0) {
+            COTmrWheelUnlink(tmr, act);
+            COTmrWheelLink(tmr, CO_TMR_WHEEL_DONE, act);
+        }
+        act = next;
+    }
+}
+
+static uint32_t COTmrWheelPlace(CO_TMR *tmr, CO_TMR_ACTION *action)
+{
+    uint32_t dt    = action->Expire - tmr->Cur;
+    uint32_t shift = 0;
+    uint32_t idx;
+    uint16_t lvl   = 0;
+
+    /* search the level, which covers the remaining ticks */
+    while ((lvl < (CO_TMR_WHEEL_LVL - 1)) &&
+           ((dt >> shift) >= CO_TMR_WHEEL_N)) {
+        lvl++;
+        shift += CO_TMR_WHEEL_BITS;
+    }
+    if ((dt >> shift) < CO_TMR_WHEEL_N) {
+        idx = action->Expire >> shift;
+    } else {
+        /* out of range: park in the last slot of this revolution */
+        idx = (tmr->Cur >> shift) + CO_TMR_WHEEL_MSK;
+    }
+    COTmrWheelLink(tmr, (uint16_t)((lvl * CO_TMR_WHEEL_N) + (idx & CO_TMR_WHEEL_MSK)), action);
+
+    /* return the tick, which must be reached for this slot */
+    return (idx << shift);
+}
+
+static void COTmrWheelInsert(CO_TMR *tmr, uint32_t dTnew, CO_TMR_ACTION *action)
+{
+    CO_IF    *cif = &tmr->Node->If;
+    uint32_t  now = COTmrWheelNow(tmr);
+    uint32_t  load;
+
+    action->Expire = now + dTnew;
+    load = COTmrWheelPlace(tmr, action) - now;
+
+    /* slot of an upper level is already passed: turn wheel immediately */
+    if ((int32_t)load <= 0) {
+        load = 1;
+    }
+
+    /* no running timer: start timer */
+    if (tmr->Load == 0) {
+        tmr->Load = load;
+        COIfTimerReload(cif, load);
+        COIfTimerStart(cif);
+
+    /* new action is before running timer event: shorten timer */
+    } else if (load < (tmr->Time + tmr->Load - now)) {
+        tmr->Time = now;
+        tmr->Load = load;
+        COIfTimerReload(cif, load);
+    }
+}
+
+static void COTmrWheelLink(CO_TMR *tmr, uint16_t slot, CO_TMR_ACTION *action)
+{
+    CO_TMR_ACTION *head = tmr->Wheel[slot];
+
+    action->Slot = slot;
+    action->Next = 0;
+    if (head == 0) {
+        action->Prev     = action;
+        tmr->Wheel[slot] = action;
+        tmr->Map[slot >> 5] |= ((uint32_t)1 << (slot & 31));
+    } else {
+        action->Prev     = head->Prev;
+        head->Prev->Next = action;
+        head->Prev       = action;
+    }
+}
+
+static void COTmrWheelUnlink(CO_TMR *tmr, CO_TMR_ACTION *action)
+{
+    uint16_t       slot = action->Slot;
+    CO_TMR_ACTION *head = tmr->Wheel[slot];
+
+    if (action == head) {
+        tmr->Wheel[slot] = action->Next;
+        if (action->Next != 0) {
+            action->Next->Prev = action->Prev;
+        } else {
+            tmr->Map[slot >> 5] &= ~((uint32_t)1 << (slot & 31));
+        }
+    } else {
+        action->Prev->Next = action->Next;
+        if (action->Next != 0) {
+            action->Next->Prev = action->Prev;
+        } else {
+            head->Prev = action->Prev;
+        }
+    }
+    action->Next = 0;
+    action->Prev = 0;
+}
+
+static void COTmrWheelFree(CO_TMR *tmr, CO_TMR_ACTION *action)
+{
+    action->CycleTicks = 0;
+    action->Para       = 0;
+    action->Func       = (CO_TMR_FUNC)0;
+    action->Slot       = CO_TMR_WHEEL_FREE;
+    action->Next       = tmr->Acts;
+    tmr->Acts          = action;
+}
+
+#else
+
 static void COTmrReset(CO_TMR *tmr)
 {
     CO_TMR_MEM    *mem = (CO_TMR_MEM *)tmr->APool;
@@ -557,3 +915,5 @@ static void COTmrRemove(CO_TMR *tmr, CO_TMR_TIME *tx)
         }
     }
 }
+
+#endif
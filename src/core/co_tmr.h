@@ -35,6 +35,14 @@ extern "C" {
 #define CO_TMR_UNIT_1MS          1000
 #define CO_TMR_UNIT_100US        10000
 
+#if USE_TMR_WHEEL
+#define CO_TMR_WHEEL_N           (1 << CO_TMR_WHEEL_BITS)
+#define CO_TMR_WHEEL_MSK         ((uint32_t)CO_TMR_WHEEL_N - 1u)
+#define CO_TMR_WHEEL_DONE        (CO_TMR_WHEEL_N * CO_TMR_WHEEL_LVL)
+#define CO_TMR_WHEEL_FREE        ((uint16_t)0xFFFFu)
+#define CO_TMR_WHEEL_MAP_N       ((CO_TMR_WHEEL_DONE + 32) / 32)
+#endif
+
 /******************************************************************************
 * PUBLIC TYPES
 ******************************************************************************/
@@ -57,6 +65,11 @@ typedef struct CO_TMR_ACTION_T {
     CO_TMR_FUNC             Func;          /*!< pointer to callback function */
     void                   *Para;          /*!< callback function parameter  */
     uint32_t                CycleTicks;    /*!< action cycle time in ticks   */
+#if USE_TMR_WHEEL
+    struct CO_TMR_ACTION_T *Prev;          /*!< link to previous action      */
+    uint32_t                Expire;        /*!< absolute expiry tick         */
+    uint16_t                Slot;          /*!< wheel slot of action         */
+#endif
 
 } CO_TMR_ACTION;
 
@@ -90,16 +103,33 @@ typedef struct CO_TMR_MEM_T {
 *
 *    This structure holds all data, which are needed for managing the
 *    highspeed timer events.
+*
+*    With USE_TMR_WHEEL, the actions are hashed by their expiry tick into
+*    the slots of a hierarchical timing wheel. Each level holds
+*    CO_TMR_WHEEL_N slots; a slot of level L spans CO_TMR_WHEEL_N^L ticks
+*    and is cascaded into the lower levels when the wheel reaches it. Each
+*    slot holds a doubly linked action list, where the first action links
+*    back to the last one. The slot CO_TMR_WHEEL_DONE holds the elapsed
+*    actions. The timer event part of the memory pool is not used in this
+*    mode.
 */
 typedef struct CO_TMR_T {
     struct CO_NODE_T       *Node;      /*!< Link to parent node              */
     uint32_t                Max;       /*!< Num. of elements in pools        */
     struct CO_TMR_ACTION_T *APool;     /*!< Timer action pool                */
-    struct CO_TMR_TIME_T   *TPool;     /*!< Timer event pool                 */
     struct CO_TMR_ACTION_T *Acts;      /*!< Timer action free list           */
+#if USE_TMR_WHEEL
+    struct CO_TMR_ACTION_T *Wheel[CO_TMR_WHEEL_DONE + 1]; /*!< slot lists  */
+    uint32_t                Map[CO_TMR_WHEEL_MAP_N];  /*!< used slot bits  */
+    uint32_t                Time;      /*!< Tick at last timer reload        */
+    uint32_t                Load;      /*!< Ticks of last reload (0=stopped) */
+    uint32_t                Cur;       /*!< Last examined tick of wheel      */
+#else
+    struct CO_TMR_TIME_T   *TPool;     /*!< Timer event pool                 */
     struct CO_TMR_TIME_T   *Free;      /*!< Timer event free list            */
     struct CO_TMR_TIME_T   *Use;       /*!< Timer event used list            */
     struct CO_TMR_TIME_T   *Elapsed;   /*!< Timer event elapsed list         */
+#endif
     uint32_t                Freq;      /*!< Timer ticks per second           */
 
 } CO_TMR;
@@ -39,6 +39,8 @@ static int16_t DrvCanSend   (CO_IF_FRM *frm);
 static int16_t DrvCanRead   (CO_IF_FRM *frm);
 static void    DrvCanReset  (void);
 static void    DrvCanClose  (void);
+static int16_t DrvCanTxFree (void);
+static int16_t DrvCanTxDone (CO_IF_FRM *frm);
 
 /******************************************************************************
 * PUBLIC VARIABLE
@@ -53,7 +55,11 @@ const CO_IF_CAN_DRV DummyCanDriver = {
     DrvCanRead,
     DrvCanSend,
     DrvCanReset,
-    DrvCanClose
+    DrvCanClose,
+    NULL,                /* optional: ReadBatch() */
+    NULL,                /* optional: Filter()    */
+    DrvCanTxFree,        /* optional: or NULL     */
+    DrvCanTxDone         /* optional: or NULL     */
 };
 
 /******************************************************************************
@@ -77,6 +83,7 @@ static int16_t DrvCanSend(CO_IF_FRM *frm)
     (void)frm;
 
     /* TODO: wait for free CAN message slot and send the given CAN frame */
+    /* CAN FD: the DLC holds the number of data bytes, use COIfCanLenToDlc() */
     return (0u);
 }
 
@@ -85,6 +92,8 @@ static int16_t DrvCanRead (CO_IF_FRM *frm)
     (void)frm;
 
     /* TODO: wait for a CAN frame and read CAN frame from the CAN controller */
+    /* CAN FD: store the number of data bytes, use COIfCanDlcToLen()         */
+    /* USE_CAN_TIMESTAMP: store the receive time, use CO_SET_STAMP()        */
     return (0u);
 }
 
@@ -97,3 +106,27 @@ static void DrvCanClose(void)
 {
     /* TODO: remove CAN controller from CAN network */
 }
+
+static int16_t DrvCanTxFree(void)
+{
+    /* TODO: return the number of free CAN message slots (mailboxes and
+     *       transmit FIFO), which accept a CAN frame without waiting.
+     *       Returning 0 stalls the transmit queue and the SDO block
+     *       transfer pacing; return CO_IF_CAN_TX_FREE_MAX or remove
+     *       this function from the driver when the number is unknown.
+     */
+    return (CO_IF_CAN_TX_FREE_MAX);
+}
+
+static int16_t DrvCanTxDone(CO_IF_FRM *frm)
+{
+    (void)frm;
+
+    /* TODO: copy the next CAN frame, which is transmitted on the CAN bus,
+     *       to frm and return the size of CO_IF_FRM. Return 0 when no
+     *       further frame is transmitted. The transmit interrupt usually
+     *       collects the transmitted frames in a small queue.
+     *       USE_CAN_TIMESTAMP: store the transmit time, use CO_SET_STAMP()
+     */
+    return (0u);
+}
@@ -27,6 +27,8 @@ extern "C" {
 
 #include "co_types.h"
 #include "co_if_can.h"
+#include "co_if_ring.h"
+#include "co_if_can_ring.h"
 #include "co_if_timer.h"
 #include "co_if_nvm.h"
 
@@ -40,11 +42,22 @@ typedef struct CO_IF_DRV_T {         /*!< Type, which links driver functions */
     const CO_IF_CAN_DRV    *Can;     /*!< Link to CAN driver functions       */
     const CO_IF_TIMER_DRV  *Timer;   /*!< Link to Timer driver functions     */
     const CO_IF_NVM_DRV    *Nvm;     /*!< Link to NVM driver functions       */
+#if USE_NODE_CTX
+    const CO_IF_CAN_CTX_DRV *CanCtx; /*!< Link to CAN driver with context    */
+    void                    *Ctx;    /*!< CAN driver context (or NULL)       */
+#endif //USE_NODE_CTX
 } CO_IF_DRV;
 
 typedef struct CO_IF_T {          /*!< Driver interface structure            */
     struct CO_NODE_T *Node;       /*!< Link to parent node                   */
     CO_IF_DRV        *Drv;        /*!< Link to hardware driver functions     */
+#if USE_CAN_TXQ
+    CO_IF_CAN_TXQ     Txq;        /*!< Transmit scheduler queues             */
+#endif //USE_CAN_TXQ
+#if USE_NODE_CTX
+    CO_IF_CAN_CTX_DRV Can;        /*!< CAN driver functions in use           */
+    void             *CanCtx;     /*!< context argument of CAN driver        */
+#endif //USE_NODE_CTX
 } CO_IF;
 
 /******************************************************************************
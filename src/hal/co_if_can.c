@@ -20,6 +20,51 @@
 
 #include "co_core.h"
 
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* CAN driver functions in use, and the calls with 0, 1 or 2 arguments,
+ * which pass the driver context as leading argument with USE_NODE_CTX */
+#if USE_NODE_CTX
+#define CO_IF_CAN_OPS                  CO_IF_CAN_CTX_DRV
+#define CO_IF_CAN_FUNCS(cif)           (&(cif)->Can)
+#define CO_IF_CAN_CALL0(can,cif,f)     (can)->f((cif)->CanCtx)
+#define CO_IF_CAN_CALL1(can,cif,f,a)   (can)->f((cif)->CanCtx, (a))
+#define CO_IF_CAN_CALL2(can,cif,f,a,b) (can)->f((cif)->CanCtx, (a), (b))
+#else
+#define CO_IF_CAN_OPS                  CO_IF_CAN_DRV
+#define CO_IF_CAN_FUNCS(cif)           ((cif)->Drv->Can)
+#define CO_IF_CAN_CALL0(can,cif,f)     (can)->f()
+#define CO_IF_CAN_CALL1(can,cif,f,a)   (can)->f((a))
+#define CO_IF_CAN_CALL2(can,cif,f,a,b) (can)->f((a), (b))
+#endif //USE_NODE_CTX
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+#if USE_CAN_TXQ
+static void    COIfCanTxqInit  (CO_IF_CAN_TXQ *txq);
+static uint8_t COIfCanTxqClass (uint32_t id);
+static int16_t COIfCanTxqPut   (CO_IF *cif, CO_IF_FRM *frm);
+static int16_t COIfCanTxqCredit(CO_IF *cif);
+#endif //USE_CAN_TXQ
+
+#if USE_NODE_CTX
+static void    COIfCanCompat         (CO_IF *cif, const CO_IF_CAN_DRV *drv);
+static void    COIfCanCompatInit     (void *ctx);
+static void    COIfCanCompatEnable   (void *ctx, uint32_t baudrate);
+static int16_t COIfCanCompatRead     (void *ctx, CO_IF_FRM *frm);
+static int16_t COIfCanCompatSend     (void *ctx, CO_IF_FRM *frm);
+static void    COIfCanCompatReset    (void *ctx);
+static void    COIfCanCompatClose    (void *ctx);
+static int16_t COIfCanCompatReadBatch(void *ctx, CO_IF_FRM *frm, uint16_t max);
+static int16_t COIfCanCompatFilter   (void *ctx, const uint32_t *id, uint16_t num);
+static int16_t COIfCanCompatTxFree   (void *ctx);
+static int16_t COIfCanCompatTxDone   (void *ctx, CO_IF_FRM *frm);
+#endif //USE_NODE_CTX
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -29,9 +74,28 @@
 */
 void COIfCanInit(CO_IF *cif, struct CO_NODE_T *node)
 {
-    const CO_IF_CAN_DRV *can = cif->Drv->Can;
+    const CO_IF_CAN_OPS *can;
+#if USE_CAN_TXQ
+    uint8_t n;
+
+    for (n = 0u; n < (uint8_t)CO_TXQ_CLASS_N; n++) {
+        cif->Txq.Stat[n].Queued = 0u;
+        cif->Txq.Stat[n].Drop   = 0u;
+        cif->Txq.Stat[n].Peak   = 0u;
+    }
+    COIfCanTxqInit(&cif->Txq);
+#endif //USE_CAN_TXQ
+#if USE_NODE_CTX
+    if (cif->Drv->CanCtx != NULL) {
+        cif->Can    = *cif->Drv->CanCtx;
+        cif->CanCtx = cif->Drv->Ctx;
+    } else {
+        COIfCanCompat(cif, cif->Drv->Can);
+    }
+#endif //USE_NODE_CTX
     (void)node;
-    can->Init();
+    can = CO_IF_CAN_FUNCS(cif);
+    CO_IF_CAN_CALL0(can, cif, Init);
 }
 
 /*
@@ -40,12 +104,44 @@ void COIfCanInit(CO_IF *cif, struct CO_NODE_T *node)
 int16_t COIfCanRead (CO_IF *cif, CO_IF_FRM *frm)
 {
     int16_t err;
-    const CO_IF_CAN_DRV *can = cif->Drv->Can;
+    const CO_IF_CAN_OPS *can = CO_IF_CAN_FUNCS(cif);
+
+    err = CO_IF_CAN_CALL1(can, cif, Read, frm);
+    if (err < (int16_t)0) {
+        cif->Node->Error = CO_ERR_IF_CAN_READ;
+    }
+    return (err);
+}
+
+/*
+* see function definition
+*/
+int16_t COIfCanReadBatch(CO_IF *cif, CO_IF_FRM *frm, uint16_t max)
+{
+    int16_t  err;
+    int16_t  num;
+    const CO_IF_CAN_OPS *can = CO_IF_CAN_FUNCS(cif);
 
-    err = can->Read(frm);
+    if (can->ReadBatch != NULL) {
+        num = CO_IF_CAN_CALL2(can, cif, ReadBatch, frm, max);
+        err = num;
+    } else {
+        num = 0;
+        err = 0;
+        while ((uint16_t)num < max) {
+            err = CO_IF_CAN_CALL1(can, cif, Read, &frm[num]);
+            if (err <= (int16_t)0) {
+                break;
+            }
+            num++;
+        }
+    }
     if (err < (int16_t)0) {
         cif->Node->Error = CO_ERR_IF_CAN_READ;
     }
+    if (num > 0) {
+        err = num;
+    }
     return (err);
 }
 
@@ -55,12 +151,188 @@ int16_t COIfCanRead (CO_IF *cif, CO_IF_FRM *frm)
 int16_t COIfCanSend(CO_IF *cif, CO_IF_FRM *frm)
 {
     int16_t err;
-    const CO_IF_CAN_DRV *can = cif->Drv->Can;
+    const CO_IF_CAN_OPS *can = CO_IF_CAN_FUNCS(cif);
+#if USE_CAN_FD
+    uint8_t len;
 
-    err = can->Send(frm);
+    len = COIfCanDlcToLen(COIfCanLenToDlc(frm->DLC));
+    while (frm->DLC < len) {
+        frm->Data[frm->DLC] = 0u;
+        frm->DLC++;
+    }
+#endif
+
+#if USE_CAN_TXQ
+    /* bypass the queues, when no frame is waiting and the driver is free */
+    if ((cif->Txq.Used == 0u) && (COIfCanTxqCredit(cif) > (int16_t)0)) {
+        err = CO_IF_CAN_CALL1(can, cif, Send, frm);
+        if (err >= (int16_t)0) {
+            return (err);
+        }
+    }
+    err = COIfCanTxqPut(cif, frm);
+    if (err >= (int16_t)0) {
+        (void)COIfCanTxDrain(cif);
+    }
+#else
+    err = CO_IF_CAN_CALL1(can, cif, Send, frm);
     if (err < (int16_t)0) {
         cif->Node->Error = CO_ERR_IF_CAN_SEND;
     }
+#endif //USE_CAN_TXQ
+    return (err);
+}
+
+/*
+* see function definition
+*/
+int16_t COIfCanTxFree(CO_IF *cif)
+{
+    int16_t num = CO_IF_CAN_TX_FREE_MAX;
+    const CO_IF_CAN_OPS *can = CO_IF_CAN_FUNCS(cif);
+
+    if (can->TxFree != NULL) {
+        num = CO_IF_CAN_CALL0(can, cif, TxFree);
+        if (num < (int16_t)0) {
+            num = 0;
+        }
+    }
+#if USE_CAN_TXQ
+    if (num <= (CO_IF_CAN_TX_FREE_MAX - (int16_t)CO_TXQ_N)) {
+        num += (int16_t)CO_TXQ_N - (int16_t)cif->Txq.Used;
+    }
+#endif //USE_CAN_TXQ
+    return (num);
+}
+
+/*
+* see function definition
+*/
+int16_t COIfCanTxDone(CO_IF *cif)
+{
+    CO_IF_FRM frm;
+    int16_t   num = 0;
+    int16_t   err;
+    const CO_IF_CAN_OPS *can = CO_IF_CAN_FUNCS(cif);
+
+    if (can->TxDone == NULL) {
+        return (num);
+    }
+    do {
+        err = CO_IF_CAN_CALL1(can, cif, TxDone, &frm);
+        if (err > (int16_t)0) {
+            CO_CB_IF_TX_CONFIRM(cif->Node, &frm);
+            num++;
+        }
+    } while ((err > (int16_t)0) && (num < CO_IF_CAN_TX_FREE_MAX));
+    if (err < (int16_t)0) {
+        cif->Node->Error = CO_ERR_IF_CAN_SEND;
+    }
+#if USE_CAN_TXQ
+    if (num > (int16_t)0) {
+        (void)COIfCanTxDrain(cif);
+    }
+#endif //USE_CAN_TXQ
+    if (err < (int16_t)0) {
+        num = err;
+    }
+    return (num);
+}
+
+#if USE_CAN_TXQ
+/*
+* see function definition
+*/
+int16_t COIfCanTxDrain(CO_IF *cif)
+{
+    CO_IF_CAN_TXQ *txq = &cif->Txq;
+    const CO_IF_CAN_OPS *can = CO_IF_CAN_FUNCS(cif);
+    int16_t credit;
+    int16_t num = 0;
+    int16_t err;
+    uint8_t cls = 0u;
+    uint8_t idx;
+
+    if (txq->Used == 0u) {
+        return (num);
+    }
+    credit = COIfCanTxqCredit(cif);
+    while ((credit > (int16_t)0) && (txq->Used > 0u)) {
+        /* the first frame of the first non-empty queue wins arbitration */
+        while (txq->Head[cls] == CO_TXQ_END) {
+            cls++;
+        }
+        idx = txq->Head[cls];
+        err = CO_IF_CAN_CALL1(can, cif, Send, &txq->Frm[idx]);
+        if (err < (int16_t)0) {
+            break;
+        }
+        txq->Head[cls] = txq->Next[idx];
+        txq->Num[cls]--;
+        txq->Used--;
+        txq->Next[idx] = txq->Free;
+        txq->Free      = idx;
+        credit--;
+        num++;
+    }
+    return (num);
+}
+#endif //USE_CAN_TXQ
+
+/*
+* see function definition
+*/
+uint8_t COIfCanDlcToLen(uint8_t dlc)
+{
+    static const uint8_t len[16] = {
+        0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 12u, 16u, 20u, 24u, 32u, 48u, 64u
+    };
+    uint8_t result;
+
+    result = len[dlc & 0x0Fu];
+    if (result > CO_IF_FRM_DATA_N) {
+        result = CO_IF_FRM_DATA_N;
+    }
+    return (result);
+}
+
+/*
+* see function definition
+*/
+uint8_t COIfCanLenToDlc(uint8_t len)
+{
+    uint8_t result;
+
+    if (len <= 8u) {
+        result = len;
+    } else if (len > CO_IF_FRM_DATA_N) {
+        result = COIfCanLenToDlc(CO_IF_FRM_DATA_N);
+    } else if (len <= 24u) {
+        result = (uint8_t)(9u + ((len - 9u) >> 2));
+    } else if (len <= 32u) {
+        result = 13u;
+    } else if (len <= 48u) {
+        result = 14u;
+    } else {
+        result = 15u;
+    }
+    return (result);
+}
+
+/*
+* see function definition
+*/
+int16_t COIfCanFilter(CO_IF *cif, const uint32_t *id, uint16_t num)
+{
+    int16_t err = 0;
+    const CO_IF_CAN_OPS *can = CO_IF_CAN_FUNCS(cif);
+
+    if (can->Filter != NULL) {
+        err = CO_IF_CAN_CALL2(can, cif, Filter, id, num);
+        if (err < (int16_t)0) {
+            cif->Node->Error = CO_ERR_IF_CAN_FILTER;
+        }
+    }
     return (err);
 }
 
@@ -69,8 +341,11 @@ int16_t COIfCanSend(CO_IF *cif, CO_IF_FRM *frm)
 */
 void COIfCanReset(CO_IF *cif)
 {
-    const CO_IF_CAN_DRV *can = cif->Drv->Can;
-    can->Reset();    
+    const CO_IF_CAN_OPS *can = CO_IF_CAN_FUNCS(cif);
+#if USE_CAN_TXQ
+    COIfCanTxqInit(&cif->Txq);
+#endif //USE_CAN_TXQ
+    CO_IF_CAN_CALL0(can, cif, Reset);
 }
 
 /*
@@ -78,8 +353,8 @@ void COIfCanReset(CO_IF *cif)
 */
 void COIfCanClose(CO_IF *cif)
 {
-    const CO_IF_CAN_DRV *can = cif->Drv->Can;
-    can->Close(); 
+    const CO_IF_CAN_OPS *can = CO_IF_CAN_FUNCS(cif);
+    CO_IF_CAN_CALL0(can, cif, Close);
 }
 
 /*
@@ -87,7 +362,7 @@ void COIfCanClose(CO_IF *cif)
 */
 void COIfCanEnable(CO_IF *cif, uint32_t baudrate)
 {
-    const CO_IF_CAN_DRV *can = cif->Drv->Can;
+    const CO_IF_CAN_OPS *can = CO_IF_CAN_FUNCS(cif);
 
     if (baudrate == (uint32_t)0) {
     	baudrate = cif->Node->Baudrate;
@@ -95,5 +370,251 @@ void COIfCanEnable(CO_IF *cif, uint32_t baudrate)
       	cif->Node->Baudrate = baudrate;
     }
 
-    can->Enable(baudrate);
+    CO_IF_CAN_CALL1(can, cif, Enable, baudrate);
+}
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+#if USE_CAN_TXQ
+
+/*! \brief  INIT TRANSMIT QUEUES
+*
+*    This function clears all transmit queues and links all frames of the
+*    frame pool into the free list. The queue counters are kept.
+*
+* \param txq
+*    pointer to the transmit queues
+*/
+static void COIfCanTxqInit(CO_IF_CAN_TXQ *txq)
+{
+    uint8_t n;
+
+    for (n = 0u; n < (uint8_t)CO_TXQ_N; n++) {
+        txq->Next[n] = (uint8_t)(n + 1u);
+    }
+    txq->Next[CO_TXQ_N - 1] = CO_TXQ_END;
+    for (n = 0u; n < (uint8_t)CO_TXQ_CLASS_N; n++) {
+        txq->Head[n] = CO_TXQ_END;
+        txq->Num[n]  = 0u;
+    }
+    txq->Free = 0u;
+    txq->Used = 0u;
+}
+
+/*! \brief  GET TRANSMIT QUEUE CLASS
+*
+*    This function returns the transmit queue class of the given CAN
+*    identifier acc. to the predefined connection set.
+*
+* \param id
+*    CAN identifier
+*
+* \retval  the transmit queue class
+*/
+static uint8_t COIfCanTxqClass(uint32_t id)
+{
+    uint8_t result;
+
+    if (id < 0x180u) {
+        result = (uint8_t)CO_TXQ_SYS;
+    } else if (id < 0x580u) {
+        result = (uint8_t)CO_TXQ_PDO;
+    } else if (id < 0x700u) {
+        result = (uint8_t)CO_TXQ_SDO;
+    } else {
+        result = (uint8_t)CO_TXQ_MGMT;
+    }
+    return (result);
+}
+
+/*! \brief  GET DRIVER TRANSMIT CREDIT
+*
+*    This function returns the number of free transmit slots of the CAN
+*    driver, without the frames of the frame pool.
+*
+* \param cif
+*    pointer to the interface structure
+*
+* \retval  the number of free transmit slots of the driver
+*/
+static int16_t COIfCanTxqCredit(CO_IF *cif)
+{
+    int16_t num = CO_IF_CAN_TX_FREE_MAX;
+    const CO_IF_CAN_OPS *can = CO_IF_CAN_FUNCS(cif);
+
+    if (can->TxFree != NULL) {
+        num = CO_IF_CAN_CALL0(can, cif, TxFree);
+    }
+    return (num);
+}
+
+/*! \brief  QUEUE TRANSMIT FRAME
+*
+*    This function inserts a copy of the given CAN frame into the queue of
+*    its class behind all frames with a lower or equal identifier. If the
+*    frame pool is full, the frame with the lowest priority is dropped.
+*
+* \param cif
+*    pointer to the interface structure
+*
+* \param frm
+*    pointer to the CAN frame
+*
+* \retval  >0    the size of CO_IF_FRM (frame is queued)
+* \retval  <0    frame is dropped
+*/
+static int16_t COIfCanTxqPut(CO_IF *cif, CO_IF_FRM *frm)
+{
+    CO_IF_CAN_TXQ *txq = &cif->Txq;
+    uint32_t id  = CO_GET_ID(frm);
+    uint8_t  cls = COIfCanTxqClass(id);
+    uint8_t  low;
+    uint8_t  idx;
+    uint8_t  prv;
+
+    if (txq->Free == CO_TXQ_END) {
+        /* the last frame of the last non-empty queue has lowest priority */
+        low = (uint8_t)(CO_TXQ_CLASS_N - 1);
+        while (txq->Head[low] == CO_TXQ_END) {
+            low--;
+        }
+        prv = CO_TXQ_END;
+        idx = txq->Head[low];
+        while (txq->Next[idx] != CO_TXQ_END) {
+            prv = idx;
+            idx = txq->Next[idx];
+        }
+        if ((low < cls) ||
+            ((low == cls) && (CO_GET_ID(&txq->Frm[idx]) <= id))) {
+            txq->Stat[cls].Drop++;
+            cif->Node->Error = CO_ERR_IF_CAN_TX_DROP;
+            return ((int16_t)-1);
+        }
+        if (prv == CO_TXQ_END) {
+            txq->Head[low] = CO_TXQ_END;
+        } else {
+            txq->Next[prv] = CO_TXQ_END;
+        }
+        txq->Num[low]--;
+        txq->Used--;
+        txq->Next[idx] = CO_TXQ_END;
+        txq->Free      = idx;
+        txq->Stat[low].Drop++;
+        cif->Node->Error = CO_ERR_IF_CAN_TX_DROP;
+    }
+
+    idx            = txq->Free;
+    txq->Free      = txq->Next[idx];
+    txq->Frm[idx]  = *frm;
+
+    /* keep arbitration order; equal identifiers keep their sequence */
+    prv = CO_TXQ_END;
+    low = txq->Head[cls];
+    while ((low != CO_TXQ_END) && (CO_GET_ID(&txq->Frm[low]) <= id)) {
+        prv = low;
+        low = txq->Next[low];
+    }
+    txq->Next[idx] = low;
+    if (prv == CO_TXQ_END) {
+        txq->Head[cls] = idx;
+    } else {
+        txq->Next[prv] = idx;
+    }
+    txq->Num[cls]++;
+    txq->Used++;
+    txq->Stat[cls].Queued++;
+    if (txq->Num[cls] > txq->Stat[cls].Peak) {
+        txq->Stat[cls].Peak = txq->Num[cls];
+    }
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+#endif //USE_CAN_TXQ
+
+#if USE_NODE_CTX
+
+/*! \brief  LINK CAN DRIVER WITHOUT CONTEXT
+*
+*    This function links the functions of a CAN driver without context
+*    argument to the interface. The driver itself is used as context, and
+*    the compatibility functions call the driver functions. An optional
+*    driver function, which is not supported, stays unsupported.
+*
+* \param cif
+*    pointer to the interface structure
+*
+* \param drv
+*    pointer to the CAN driver without context
+*/
+static void COIfCanCompat(CO_IF *cif, const CO_IF_CAN_DRV *drv)
+{
+    CO_IF_CAN_CTX_DRV *can = &cif->Can;
+
+    can->Init      = COIfCanCompatInit;
+    can->Enable    = COIfCanCompatEnable;
+    can->Read      = COIfCanCompatRead;
+    can->Send      = COIfCanCompatSend;
+    can->Reset     = COIfCanCompatReset;
+    can->Close     = COIfCanCompatClose;
+    can->ReadBatch = (drv->ReadBatch != NULL) ? COIfCanCompatReadBatch : NULL;
+    can->Filter    = (drv->Filter    != NULL) ? COIfCanCompatFilter    : NULL;
+    can->TxFree    = (drv->TxFree    != NULL) ? COIfCanCompatTxFree    : NULL;
+    can->TxDone    = (drv->TxDone    != NULL) ? COIfCanCompatTxDone    : NULL;
+    cif->CanCtx    = (void *)drv;
 }
+
+/* compatibility functions: the context is the CAN driver without context */
+
+static void COIfCanCompatInit(void *ctx)
+{
+    ((const CO_IF_CAN_DRV *)ctx)->Init();
+}
+
+static void COIfCanCompatEnable(void *ctx, uint32_t baudrate)
+{
+    ((const CO_IF_CAN_DRV *)ctx)->Enable(baudrate);
+}
+
+static int16_t COIfCanCompatRead(void *ctx, CO_IF_FRM *frm)
+{
+    return (((const CO_IF_CAN_DRV *)ctx)->Read(frm));
+}
+
+static int16_t COIfCanCompatSend(void *ctx, CO_IF_FRM *frm)
+{
+    return (((const CO_IF_CAN_DRV *)ctx)->Send(frm));
+}
+
+static void COIfCanCompatReset(void *ctx)
+{
+    ((const CO_IF_CAN_DRV *)ctx)->Reset();
+}
+
+static void COIfCanCompatClose(void *ctx)
+{
+    ((const CO_IF_CAN_DRV *)ctx)->Close();
+}
+
+static int16_t COIfCanCompatReadBatch(void *ctx, CO_IF_FRM *frm, uint16_t max)
+{
+    return (((const CO_IF_CAN_DRV *)ctx)->ReadBatch(frm, max));
+}
+
+static int16_t COIfCanCompatFilter(void *ctx, const uint32_t *id, uint16_t num)
+{
+    return (((const CO_IF_CAN_DRV *)ctx)->Filter(id, num));
+}
+
+static int16_t COIfCanCompatTxFree(void *ctx)
+{
+    return (((const CO_IF_CAN_DRV *)ctx)->TxFree());
+}
+
+static int16_t COIfCanCompatTxDone(void *ctx, CO_IF_FRM *frm)
+{
+    return (((const CO_IF_CAN_DRV *)ctx)->TxDone(frm));
+}
+
+#endif //USE_NODE_CTX
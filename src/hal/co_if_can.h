@@ -26,6 +26,43 @@ extern "C" {
 ******************************************************************************/
 
 #include "co_types.h"
+#include "co_cfg.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/*! \brief FRAME PAYLOAD SIZE
+*
+*    This define holds the maximal number of data bytes in a CAN frame. The
+*    CAN FD build mode uses frames with up to 64 data bytes.
+*/
+#if USE_CAN_FD
+#define CO_IF_FRM_DATA_N     64u
+#else
+#define CO_IF_FRM_DATA_N      8u
+#endif
+
+/*! \brief UNLIMITED TRANSMIT CREDIT
+*
+*    This define holds the number of free transmit slots, which is reported
+*    for CAN drivers without the optional TxFree() function.
+*/
+#define CO_IF_CAN_TX_FREE_MAX   ((int16_t)0x7FFF)
+
+/*! \brief RECEIVE BATCH LIMIT
+*
+*    This define holds the maximal number of CAN frames, which are returned
+*    by a single ReadBatch() call of a CAN driver.
+*/
+#define CO_IF_CAN_RX_BATCH_MAX  ((int16_t)0x7FFF)
+
+/*! \brief END OF TRANSMIT QUEUE
+*
+*    This define marks the end of a transmit queue and of the list of free
+*    frames in the frame pool of the transmit scheduler.
+*/
+#define CO_TXQ_END              ((uint8_t)0xFF)
 
 /******************************************************************************
 * PUBLIC MACROS
@@ -57,6 +94,9 @@ extern "C" {
 /*! \brief GET DATA LENGTH CODE
 *
 *    This macro extracts the data length code (DLC) out of the CAN frame.
+*    Within the stack, the DLC holds the number of data bytes (0..8, CAN FD:
+*    0..64). The drivers use COIfCanLenToDlc() and COIfCanDlcToLen() for the
+*    conversion to and from the 4-bit code on the bus.
 *
 * \param f
 *    The CAN frame
@@ -85,10 +125,10 @@ extern "C" {
 *    The CAN frame
 *
 * \param p
-*    The data position (0..7)
+*    The data position (0..7, CAN FD: 0..63)
 */
 #define CO_GET_BYTE(f,p)     \
-    (uint8_t)( (uint8_t)(f)->Data[(p)&0x7] )
+    (uint8_t)( (uint8_t)(f)->Data[(p)&(CO_IF_FRM_DATA_N-1)] )
 
 /*! \brief SET DATA BYTE
 *
@@ -101,10 +141,10 @@ extern "C" {
 *    The data value
 *
 * \param p
-*    The data position (0..7)
+*    The data position (0..7, CAN FD: 0..63)
 */
 #define CO_SET_BYTE(f,n,p)   do {      \
-        (f)->Data[(p)&0x7] = (uint8_t)(n); \
+        (f)->Data[(p)&(CO_IF_FRM_DATA_N-1)] = (uint8_t)(n); \
     } while(0)
 
 /*! \brief GET DATA WORD
@@ -115,11 +155,11 @@ extern "C" {
 *    The CAN frame
 *
 * \param p
-*    The data position (0..6)
+*    The data position (0..6, CAN FD: 0..62)
 */
 #define CO_GET_WORD(f,p)     \
-    (uint16_t)( ( ( (uint16_t)((f)->Data[((p)+1)&0x7]) ) << 8 ) | \
-                ( ( (uint16_t)((f)->Data[((p)  )&0x7]) )      )   )
+    (uint16_t)( ( ( (uint16_t)((f)->Data[((p)+1)&(CO_IF_FRM_DATA_N-1)]) ) << 8 ) | \
+                ( ( (uint16_t)((f)->Data[((p)  )&(CO_IF_FRM_DATA_N-1)]) )      )   )
 
 /*! \brief SET DATA WORD
 *
@@ -132,11 +172,11 @@ extern "C" {
 *    The data value
 *
 * \param p
-*    The data position (0..6)
+*    The data position (0..6, CAN FD: 0..62)
 */
 #define CO_SET_WORD(f,n,p)  do {                                  \
-        (f)->Data[((p)  )&0x7] = (uint8_t)( ((uint16_t)(n) )     ); \
-        (f)->Data[((p)+1)&0x7] = (uint8_t)( ((uint16_t)(n) ) >> 8); \
+        (f)->Data[((p)  )&(CO_IF_FRM_DATA_N-1)] = (uint8_t)( ((uint16_t)(n) )     ); \
+        (f)->Data[((p)+1)&(CO_IF_FRM_DATA_N-1)] = (uint8_t)( ((uint16_t)(n) ) >> 8); \
     } while(0)
 
 /*! \brief GET DATA LONG
@@ -147,13 +187,13 @@ extern "C" {
 *    The CAN frame
 *
 * \param p
-*    The data position (0..4)
+*    The data position (0..4, CAN FD: 0..60)
 */
 #define CO_GET_LONG(f,p)     \
-    (uint32_t)( ( ( (uint32_t)((f)->Data[((p)+3)&0x7]) ) << 24 ) | \
-                ( ( (uint32_t)((f)->Data[((p)+2)&0x7]) ) << 16 ) | \
-                ( ( (uint32_t)((f)->Data[((p)+1)&0x7]) ) <<  8 ) | \
-                ( ( (uint32_t)((f)->Data[((p)  )&0x7]) )       )   )
+    (uint32_t)( ( ( (uint32_t)((f)->Data[((p)+3)&(CO_IF_FRM_DATA_N-1)]) ) << 24 ) | \
+                ( ( (uint32_t)((f)->Data[((p)+2)&(CO_IF_FRM_DATA_N-1)]) ) << 16 ) | \
+                ( ( (uint32_t)((f)->Data[((p)+1)&(CO_IF_FRM_DATA_N-1)]) ) <<  8 ) | \
+                ( ( (uint32_t)((f)->Data[((p)  )&(CO_IF_FRM_DATA_N-1)]) )       )   )
 
 /*! \brief SET DATA LONG
 *
@@ -166,15 +206,43 @@ extern "C" {
 *    The data value
 *
 * \param p
-*    The data position (0..4)
+*    The data position (0..4, CAN FD: 0..60)
 */
 #define CO_SET_LONG(f,n,p)   do { \
-        (f)->Data[((p)  )&0x7] = (uint8_t)(((uint32_t)(n))      ); \
-        (f)->Data[((p)+1)&0x7] = (uint8_t)(((uint32_t)(n)) >>  8); \
-        (f)->Data[((p)+2)&0x7] = (uint8_t)(((uint32_t)(n)) >> 16); \
-        (f)->Data[((p)+3)&0x7] = (uint8_t)(((uint32_t)(n)) >> 24); \
+        (f)->Data[((p)  )&(CO_IF_FRM_DATA_N-1)] = (uint8_t)(((uint32_t)(n))      ); \
+        (f)->Data[((p)+1)&(CO_IF_FRM_DATA_N-1)] = (uint8_t)(((uint32_t)(n)) >>  8); \
+        (f)->Data[((p)+2)&(CO_IF_FRM_DATA_N-1)] = (uint8_t)(((uint32_t)(n)) >> 16); \
+        (f)->Data[((p)+3)&(CO_IF_FRM_DATA_N-1)] = (uint8_t)(((uint32_t)(n)) >> 24); \
     } while(0)
 
+#if USE_CAN_TIMESTAMP
+
+/*! \brief GET TIMESTAMP
+*
+*    This macro extracts the timestamp out of the CAN frame. The unit of
+*    the timestamp is defined by the CAN driver (recommended: 1us).
+*
+* \param f
+*    The CAN frame
+*/
+#define CO_GET_STAMP(f)      \
+    ( (uint64_t)(f)->Timestamp )
+
+/*! \brief SET TIMESTAMP
+*
+*    This macro sets the timestamp within the CAN frame.
+*
+* \param f
+*    The CAN frame
+*
+* \param t
+*    The timestamp
+*/
+#define CO_SET_STAMP(f,t)    \
+    ((f)->Timestamp = (uint64_t)(t))
+
+#endif //USE_CAN_TIMESTAMP
+
 /******************************************************************************
 * PUBLIC TYPES
 ******************************************************************************/
@@ -184,16 +252,70 @@ struct CO_NODE_T;              /* Declaration of canopen node structure      */
 
 typedef struct CO_IF_FRM_T {         /*!< Type, which represents a CAN frame */
     uint32_t  Identifier;            /*!< CAN message identifier             */
-    uint8_t   Data[8];               /*!< CAN message Data (payload)         */
-    uint8_t   DLC;                   /*!< CAN message data length code (DLC) */
+    uint8_t   Data[CO_IF_FRM_DATA_N];/*!< CAN message Data (payload)         */
+    uint8_t   DLC;                   /*!< CAN message data length in bytes   */
+#if USE_CAN_TIMESTAMP
+    uint64_t  Timestamp;             /*!< receive or transmit time (driver)  */
+#endif //USE_CAN_TIMESTAMP
 } CO_IF_FRM;
 
 typedef void    (*CO_IF_CAN_INIT_FUNC  )(void);
 typedef void    (*CO_IF_CAN_ENABLE_FUNC)(uint32_t);
 typedef int16_t (*CO_IF_CAN_READ_FUNC  )(CO_IF_FRM *);
+typedef int16_t (*CO_IF_CAN_READ_BATCH_FUNC)(CO_IF_FRM *, uint16_t);
 typedef int16_t (*CO_IF_CAN_SEND_FUNC  )(CO_IF_FRM *);
 typedef void    (*CO_IF_CAN_RESET_FUNC )(void);
 typedef void    (*CO_IF_CAN_CLOSE_FUNC )(void);
+typedef int16_t (*CO_IF_CAN_FILTER_FUNC)(const uint32_t *, uint16_t);
+typedef int16_t (*CO_IF_CAN_TX_FREE_FUNC)(void);
+typedef int16_t (*CO_IF_CAN_TX_DONE_FUNC)(CO_IF_FRM *);
+
+#if USE_NODE_CTX
+typedef void    (*CO_IF_CAN_CTX_INIT_FUNC  )(void *);
+typedef void    (*CO_IF_CAN_CTX_ENABLE_FUNC)(void *, uint32_t);
+typedef int16_t (*CO_IF_CAN_CTX_READ_FUNC  )(void *, CO_IF_FRM *);
+typedef int16_t (*CO_IF_CAN_CTX_READ_BATCH_FUNC)(void *, CO_IF_FRM *, uint16_t);
+typedef int16_t (*CO_IF_CAN_CTX_SEND_FUNC  )(void *, CO_IF_FRM *);
+typedef void    (*CO_IF_CAN_CTX_RESET_FUNC )(void *);
+typedef void    (*CO_IF_CAN_CTX_CLOSE_FUNC )(void *);
+typedef int16_t (*CO_IF_CAN_CTX_FILTER_FUNC)(void *, const uint32_t *, uint16_t);
+typedef int16_t (*CO_IF_CAN_CTX_TX_FREE_FUNC)(void *);
+typedef int16_t (*CO_IF_CAN_CTX_TX_DONE_FUNC)(void *, CO_IF_FRM *);
+#endif //USE_NODE_CTX
+
+#if USE_CAN_TXQ
+
+/*! \brief TRANSMIT QUEUE CLASS
+*
+*    The transmit frames are queued per class of CAN identifiers. The
+*    classes are ordered like the identifier ranges of the predefined
+*    connection set, therefore a lower class wins the bus arbitration.
+*/
+typedef enum CO_IF_CAN_TXQ_CLASS_T {
+    CO_TXQ_SYS = 0,                  /*!< NMT, SYNC, EMCY, TIME (<0x180)     */
+    CO_TXQ_PDO,                      /*!< PDO (0x180..0x57F)                 */
+    CO_TXQ_SDO,                      /*!< SDO (0x580..0x6FF)                 */
+    CO_TXQ_MGMT,                     /*!< heartbeat, LSS, others (>=0x700)   */
+    CO_TXQ_CLASS_N                   /*!< number of transmit queues          */
+} CO_IF_CAN_TXQ_CLASS;
+
+typedef struct CO_IF_CAN_TXQ_STAT_T {/*!< Type, which counts queue events    */
+    uint32_t  Queued;                /*!< frames delayed in the queue        */
+    uint32_t  Drop;                  /*!< frames dropped on full frame pool  */
+    uint8_t   Peak;                  /*!< maximal number of queued frames    */
+} CO_IF_CAN_TXQ_STAT;
+
+typedef struct CO_IF_CAN_TXQ_T {     /*!< Type, which holds transmit queues  */
+    CO_IF_FRM Frm[CO_TXQ_N];         /*!< frame pool of all queues           */
+    uint8_t   Next[CO_TXQ_N];        /*!< next frame in queue or free list   */
+    uint8_t   Head[CO_TXQ_CLASS_N];  /*!< first frame of each queue          */
+    uint8_t   Num[CO_TXQ_CLASS_N];   /*!< number of frames in each queue     */
+    uint8_t   Free;                  /*!< first frame in free list           */
+    uint8_t   Used;                  /*!< number of frames in all queues     */
+    CO_IF_CAN_TXQ_STAT Stat[CO_TXQ_CLASS_N]; /*!< counters of each queue     */
+} CO_IF_CAN_TXQ;
+
+#endif //USE_CAN_TXQ
 
 typedef struct CO_IF_CAN_DRV_T {
     CO_IF_CAN_INIT_FUNC   Init;
@@ -202,15 +324,45 @@ typedef struct CO_IF_CAN_DRV_T {
     CO_IF_CAN_SEND_FUNC   Send;
     CO_IF_CAN_RESET_FUNC  Reset;
     CO_IF_CAN_CLOSE_FUNC  Close;
+    CO_IF_CAN_READ_BATCH_FUNC ReadBatch;   /* optional: NULL if not supported */
+    CO_IF_CAN_FILTER_FUNC     Filter;      /* optional: NULL if not supported */
+    CO_IF_CAN_TX_FREE_FUNC    TxFree;      /* optional: NULL if not supported */
+    CO_IF_CAN_TX_DONE_FUNC    TxDone;      /* optional: NULL if not supported */
 } CO_IF_CAN_DRV;
 
+#if USE_NODE_CTX
+
+/*! \brief CAN DRIVER WITH CONTEXT
+*
+*    The functions of this CAN driver get the driver context as the first
+*    argument, e.g. the instance data of the CAN controller. A single
+*    driver serves any number of nodes with different contexts.
+*/
+typedef struct CO_IF_CAN_CTX_DRV_T {
+    CO_IF_CAN_CTX_INIT_FUNC   Init;
+    CO_IF_CAN_CTX_ENABLE_FUNC Enable;
+    CO_IF_CAN_CTX_READ_FUNC   Read;
+    CO_IF_CAN_CTX_SEND_FUNC   Send;
+    CO_IF_CAN_CTX_RESET_FUNC  Reset;
+    CO_IF_CAN_CTX_CLOSE_FUNC  Close;
+    CO_IF_CAN_CTX_READ_BATCH_FUNC ReadBatch;   /* optional: NULL if not supported */
+    CO_IF_CAN_CTX_FILTER_FUNC     Filter;      /* optional: NULL if not supported */
+    CO_IF_CAN_CTX_TX_FREE_FUNC    TxFree;      /* optional: NULL if not supported */
+    CO_IF_CAN_CTX_TX_DONE_FUNC    TxDone;      /* optional: NULL if not supported */
+} CO_IF_CAN_CTX_DRV;
+
+#endif //USE_NODE_CTX
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
 
 /*! \brief  (RE-)INITIALIZE CAN INTERFACE
 *
-*    This function initialize CAN hardware interfaces.
+*    This function initialize CAN hardware interfaces. With USE_NODE_CTX,
+*    the CAN driver with context is used, if it is linked in the driver
+*    interface. Otherwise the CAN driver functions without context are
+*    called through a compatibility layer.
 *
 * \param cif
 *    pointer to the interface structure
@@ -245,9 +397,43 @@ void COIfCanInit(struct CO_IF_T *cif, struct CO_NODE_T *node);
 */
 int16_t COIfCanRead(struct CO_IF_T *cif, CO_IF_FRM *frm);
 
+/*! \brief  READ MULTIPLE CAN FRAMES
+*
+*    This function reads all available CAN frames from the interface, up to
+*    the given maximum number of frames. The frames are read with the
+*    optional ReadBatch() function of the CAN driver. For drivers without
+*    this function, the frames are read one by one with Read() until no
+*    further frame is available.
+*
+* \note  The fallback calls Read() until the driver reports no frame. Use
+*        this function with polling drivers or drivers with ReadBatch()
+*        only; blocking drivers would wait for the next frame.
+*
+* \param cif
+*    pointer to the interface structure
+*
+* \param frm
+*    pointer to the receive frame buffer array
+*
+* \param max
+*    maximum number of frames (length of the frame buffer array)
+*
+* \retval  >0    the number of received CAN frames
+* \retval  =0    special: nothing received during polling (timeout)
+* \retval  <0    the CAN driver error code
+*/
+int16_t COIfCanReadBatch(struct CO_IF_T *cif, CO_IF_FRM *frm, uint16_t max);
+
 /*! \brief  SEND CAN FRAME
 *
 *    This function sends the given CAN frame on the interface without delay.
+*    In CAN FD build mode, a data length without an exact DLC encoding is
+*    padded with zero bytes up to the next valid frame length.
+*
+*    With the transmit scheduler (USE_CAN_TXQ), a frame is queued when the
+*    driver is not able to accept it, or when other frames are waiting. If
+*    the frame pool is full, the queued frame with the lowest priority is
+*    dropped, unless the given frame has an even lower priority.
 *
 * \param cif
 *     pointer to the interface structure
@@ -255,11 +441,123 @@ int16_t COIfCanRead(struct CO_IF_T *cif, CO_IF_FRM *frm);
 * \param frm
 *     pointer to the receive frame buffer
 *
-* \retval  >0    the size of CO_IF_FRM on success
-* \retval  <0    the internal CanBus error code
+* \retval  >0    the size of CO_IF_FRM on success (or frame is queued)
+* \retval  <0    the internal CanBus error code (or frame is dropped)
 */
 int16_t COIfCanSend(struct CO_IF_T *cif, CO_IF_FRM *frm);
 
+/*! \brief  GET FREE TRANSMIT SLOTS
+*
+*    This function returns the number of CAN frames, which the driver is
+*    able to accept with COIfCanSend() without losing a frame. The number is
+*    read with the optional TxFree() function of the CAN driver. For drivers
+*    without this function, the credit is unlimited (CO_IF_CAN_TX_FREE_MAX).
+*    With the transmit scheduler (USE_CAN_TXQ), the free frames of the
+*    frame pool are added.
+*
+* \param cif
+*     pointer to the interface structure
+*
+* \retval  >0    the number of free transmit slots
+* \retval  =0    the transmit queue is full (or the driver reports an error)
+*/
+int16_t COIfCanTxFree(struct CO_IF_T *cif);
+
+/*! \brief  PROCESS TRANSMIT CONFIRMATIONS
+*
+*    This function reads the confirmations of all CAN frames, which left
+*    the CAN controller since the last call, with the optional TxDone()
+*    function of the CAN driver. The callback COIfCanTxConfirm() is called
+*    for each confirmed frame. With the transmit scheduler (USE_CAN_TXQ),
+*    the queued frames are passed into the released transmit slots. For
+*    drivers without TxDone(), the call is ignored.
+*
+* \note  The driver collects the confirmations (e.g. in the transmit
+*        interrupt) and this function delivers them in the context of the
+*        node processing, which calls this function.
+*
+* \param cif
+*     pointer to the interface structure
+*
+* \retval  >=0   the number of confirmed CAN frames
+* \retval  <0    the CAN driver error code
+*/
+int16_t COIfCanTxDone(struct CO_IF_T *cif);
+
+#if USE_CAN_TXQ
+
+/*! \brief  DRAIN TRANSMIT QUEUES
+*
+*    This function passes the queued CAN frames to the driver, as long as
+*    the driver reports free transmit slots. The frames are passed in the
+*    order of the CAN identifier arbitration; frames with the same
+*    identifier keep their order. The function is called by the node
+*    processing and should be called, when the driver reports a completed
+*    transmission or a free transmit slot.
+*
+* \note  The transmit queues are not locked. Call this function in the
+*        context of the node processing, not in an interrupt handler.
+*
+* \param cif
+*     pointer to the interface structure
+*
+* \retval  the number of frames passed to the driver
+*/
+int16_t COIfCanTxDrain(struct CO_IF_T *cif);
+
+#endif //USE_CAN_TXQ
+
+/*! \brief  DATA LENGTH CODE TO LENGTH
+*
+*    This function converts the 4-bit data length code (DLC) of a CAN frame
+*    on the bus into the number of data bytes. The codes 9 to 15 encode the
+*    lengths 12, 16, 20, 24, 32, 48 and 64 in CAN FD; a classic CAN frame
+*    holds at most 8 data bytes.
+*
+* \param dlc
+*     data length code (0..15)
+*
+* \retval  the number of data bytes
+*/
+uint8_t COIfCanDlcToLen(uint8_t dlc);
+
+/*! \brief  LENGTH TO DATA LENGTH CODE
+*
+*    This function converts the number of data bytes into the 4-bit data
+*    length code (DLC) of a CAN frame on the bus. Lengths without an exact
+*    encoding are rounded up to the next valid frame length; the driver
+*    transmits the additional bytes as zero padding.
+*
+* \param len
+*     number of data bytes (0..64)
+*
+* \retval  the data length code
+*/
+uint8_t COIfCanLenToDlc(uint8_t len);
+
+/*! \brief  SET CAN ACCEPTANCE FILTER
+*
+*    This function passes the list of CAN identifiers, which are consumed
+*    by the node, to the optional Filter() function of the CAN driver. The
+*    driver configures the acceptance filter of the CAN controller to
+*    receive these identifiers only. If the list does not fit into the
+*    controller, the driver shall receive all identifiers. Without this
+*    driver function, the call is ignored.
+*
+* \param cif
+*    pointer to the interface structure
+*
+* \param id
+*    pointer to the array of CAN identifiers
+*
+* \param num
+*    number of CAN identifiers
+*
+* \retval  >=0   filter is set (or not supported by driver)
+* \retval  <0    the CAN driver error code
+*/
+int16_t COIfCanFilter(struct CO_IF_T *cif, const uint32_t *id, uint16_t num);
+
 /*! \brief  RESET CAN INTERFACE
 *
 *    This function resets the CAN interface and flushes all already
@@ -298,7 +596,8 @@ void COIfCanEnable(struct CO_IF_T *cif, uint32_t baudrate);
 /*! \brief INTERFACE CAN RECEIVE CALLBACK
 *
 *    This function is called for each CAN frame, which is not consumed
-*    (processed) by the CANopen stack.
+*    (processed) by the CANopen stack. With USE_CAN_TIMESTAMP, the frame
+*    holds the receive time.
 *
 * \note
 *    The CAN frame pointer is checked to be valid before calling this
@@ -309,6 +608,22 @@ void COIfCanEnable(struct CO_IF_T *cif, uint32_t baudrate);
 */
 extern void COIfCanReceive(CO_IF_FRM *frm);
 
+/*! \brief INTERFACE CAN TRANSMIT CONFIRM CALLBACK
+*
+*    This function is called for each CAN frame, which is confirmed by the
+*    CAN driver to be transmitted on the CAN bus. The callback allows the
+*    application to pace the transmission or to measure the latency. With
+*    USE_CAN_TIMESTAMP, the frame holds the transmit time.
+*
+* \note
+*    The CAN frame pointer is checked to be valid before calling this
+*    function. The frame is valid during the callback only.
+*
+* \param frm
+*    The transmitted CAN frame
+*/
+extern void COIfCanTxConfirm(CO_IF_FRM *frm);
+
 #ifdef __cplusplus               /* for compatibility with C++ environments  */
 }
 #endif
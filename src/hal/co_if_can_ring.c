@@ -0,0 +1,233 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+#if USE_NODE_CTX
+static void    COIfCanRingCtxInit     (void *ctx);
+static void    COIfCanRingCtxEnable   (void *ctx, uint32_t baudrate);
+static int16_t COIfCanRingCtxRead     (void *ctx, CO_IF_FRM *frm);
+static int16_t COIfCanRingCtxSend     (void *ctx, CO_IF_FRM *frm);
+static void    COIfCanRingCtxReset    (void *ctx);
+static void    COIfCanRingCtxClose    (void *ctx);
+static int16_t COIfCanRingCtxReadBatch(void *ctx, CO_IF_FRM *frm, uint16_t max);
+static int16_t COIfCanRingCtxFilter   (void *ctx, const uint32_t *id, uint16_t num);
+static int16_t COIfCanRingCtxTxFree   (void *ctx);
+static int16_t COIfCanRingCtxTxDone   (void *ctx, CO_IF_FRM *frm);
+#endif //USE_NODE_CTX
+
+/******************************************************************************
+* PUBLIC CONSTANTS
+******************************************************************************/
+
+#if USE_NODE_CTX
+const CO_IF_CAN_CTX_DRV COIfCanRingCtxDriver = {
+    COIfCanRingCtxInit,
+    COIfCanRingCtxEnable,
+    COIfCanRingCtxRead,
+    COIfCanRingCtxSend,
+    COIfCanRingCtxReset,
+    COIfCanRingCtxClose,
+    COIfCanRingCtxReadBatch,
+    COIfCanRingCtxFilter,
+    COIfCanRingCtxTxFree,
+    COIfCanRingCtxTxDone
+};
+#endif //USE_NODE_CTX
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t COIfCanRingInit(CO_IF_CAN_RING      *can,
+                        const CO_IF_CAN_DRV *hw,
+                        CO_IF_FRM           *rx,
+                        uint32_t             rxNum,
+                        CO_IF_FRM           *tx,
+                        uint32_t             txNum)
+{
+    if (COIfRingInit(&can->Rx, rx, rxNum) < (int16_t)0) {
+        return (-1);
+    }
+    if (COIfRingInit(&can->Tx, tx, txNum) < (int16_t)0) {
+        return (-1);
+    }
+    can->Hw = hw;
+    return (0);
+}
+
+/*
+* see function definition
+*/
+int16_t COIfCanRingRxPoll(CO_IF_CAN_RING *can)
+{
+    CO_IF_FRM frm;
+    int16_t   err = 0;
+
+    if (can->Hw != NULL) {
+        err = can->Hw->Read(&frm);
+        if (err > (int16_t)0) {
+            (void)COIfRingPush(&can->Rx, &frm, 1u);
+        }
+    }
+    return (err);
+}
+
+/*
+* see function definition
+*/
+int16_t COIfCanRingTxPoll(CO_IF_CAN_RING *can)
+{
+    CO_IF_FRM frm;
+    int16_t   num = 0;
+    int16_t   err = 0;
+
+    if (can->Hw == NULL) {
+        return (num);
+    }
+    while ((num < CO_IF_CAN_TX_FREE_MAX) &&
+           (COIfRingPeek(&can->Tx, &frm, 1u) > 0u)) {
+        err = can->Hw->Send(&frm);
+        if (err <= (int16_t)0) {
+            break;
+        }
+        COIfRingSkip(&can->Tx, 1u);
+        num++;
+    }
+    if ((num == (int16_t)0) && (err < (int16_t)0)) {
+        num = err;
+    }
+    return (num);
+}
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+#if USE_NODE_CTX
+
+static void COIfCanRingCtxInit(void *ctx)
+{
+    CO_IF_CAN_RING *can = (CO_IF_CAN_RING *)ctx;
+
+    COIfRingClear(&can->Rx);
+    if (can->Hw != NULL) {
+        can->Hw->Init();
+    }
+}
+
+static void COIfCanRingCtxEnable(void *ctx, uint32_t baudrate)
+{
+    CO_IF_CAN_RING *can = (CO_IF_CAN_RING *)ctx;
+
+    if (can->Hw != NULL) {
+        can->Hw->Enable(baudrate);
+    }
+}
+
+static int16_t COIfCanRingCtxRead(void *ctx, CO_IF_FRM *frm)
+{
+    CO_IF_CAN_RING *can = (CO_IF_CAN_RING *)ctx;
+
+    if (COIfRingPop(&can->Rx, frm, 1u) == 0u) {
+        return (0);
+    }
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t COIfCanRingCtxSend(void *ctx, CO_IF_FRM *frm)
+{
+    CO_IF_CAN_RING *can = (CO_IF_CAN_RING *)ctx;
+
+    if (COIfRingPush(&can->Tx, frm, 1u) == 0u) {
+        return (-1);
+    }
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static void COIfCanRingCtxReset(void *ctx)
+{
+    CO_IF_CAN_RING *can = (CO_IF_CAN_RING *)ctx;
+
+    COIfRingClear(&can->Rx);
+    if (can->Hw != NULL) {
+        can->Hw->Reset();
+    }
+}
+
+static void COIfCanRingCtxClose(void *ctx)
+{
+    CO_IF_CAN_RING *can = (CO_IF_CAN_RING *)ctx;
+
+    if (can->Hw != NULL) {
+        can->Hw->Close();
+    }
+}
+
+static int16_t COIfCanRingCtxReadBatch(void *ctx, CO_IF_FRM *frm, uint16_t max)
+{
+    CO_IF_CAN_RING *can = (CO_IF_CAN_RING *)ctx;
+
+    if (max > (uint16_t)CO_IF_CAN_RX_BATCH_MAX) {
+        max = (uint16_t)CO_IF_CAN_RX_BATCH_MAX;
+    }
+    return ((int16_t)COIfRingPop(&can->Rx, frm, max));
+}
+
+static int16_t COIfCanRingCtxFilter(void *ctx, const uint32_t *id, uint16_t num)
+{
+    CO_IF_CAN_RING *can = (CO_IF_CAN_RING *)ctx;
+
+    if ((can->Hw == NULL) || (can->Hw->Filter == NULL)) {
+        return (0);
+    }
+    return (can->Hw->Filter(id, num));
+}
+
+static int16_t COIfCanRingCtxTxFree(void *ctx)
+{
+    CO_IF_CAN_RING *can = (CO_IF_CAN_RING *)ctx;
+    uint32_t        num;
+
+    num = COIfRingFree(&can->Tx);
+    if (num > (uint32_t)CO_IF_CAN_TX_FREE_MAX) {
+        num = (uint32_t)CO_IF_CAN_TX_FREE_MAX;
+    }
+    return ((int16_t)num);
+}
+
+static int16_t COIfCanRingCtxTxDone(void *ctx, CO_IF_FRM *frm)
+{
+    CO_IF_CAN_RING *can = (CO_IF_CAN_RING *)ctx;
+
+    if ((can->Hw == NULL) || (can->Hw->TxDone == NULL)) {
+        return (0);
+    }
+    return (can->Hw->TxDone(frm));
+}
+
+#endif //USE_NODE_CTX
@@ -0,0 +1,141 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_IF_CAN_RING_H_
+#define CO_IF_CAN_RING_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_if_can.h"
+#include "co_if_ring.h"
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief RING CAN DRIVER
+*
+*    This data structure decouples the node processing from the CAN
+*    hardware with two frame rings. A receive interrupt (or reader thread)
+*    puts the received frames into the receive ring, and the node reads
+*    them with the ring driver COIfCanRingCtxDriver (USE_NODE_CTX). The
+*    node puts the frames to send into the transmit ring, and a transmit
+*    interrupt (or writer thread) passes them to the CAN hardware.
+*/
+typedef struct CO_IF_CAN_RING_T {
+    CO_IF_RING           Rx;          /*!< received frames (ISR -> node)     */
+    CO_IF_RING           Tx;          /*!< frames to send (node -> ISR)      */
+    const CO_IF_CAN_DRV *Hw;          /*!< CAN hardware driver (or NULL)     */
+} CO_IF_CAN_RING;
+
+/******************************************************************************
+* PUBLIC CONSTANTS
+******************************************************************************/
+
+#if USE_NODE_CTX
+/*! \brief RING CAN DRIVER FUNCTIONS WITH CONTEXT
+*
+*    The CAN driver functions with context, which connect a node to the
+*    rings of the ring CAN driver in the driver context. Read() and
+*    ReadBatch() return immediately when the receive ring is empty; Send()
+*    fails when the transmit ring is full. The other functions are passed
+*    to the CAN hardware driver.
+*/
+extern const CO_IF_CAN_CTX_DRV COIfCanRingCtxDriver;
+#endif //USE_NODE_CTX
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  INITIALIZE RING CAN DRIVER
+*
+*    This function initializes the receive and transmit rings with the
+*    given frame storage and links the CAN hardware driver. The CAN
+*    hardware driver is optional: without it, the application feeds and
+*    drains the rings directly with COIfRingPush() and COIfRingPop().
+*
+* \param can
+*    pointer to the ring CAN driver
+*
+* \param hw
+*    pointer to the CAN hardware driver (or NULL)
+*
+* \param rx
+*    pointer to the receive frame storage array
+*
+* \param rxNum
+*    number of frames in the receive storage (power of two)
+*
+* \param tx
+*    pointer to the transmit frame storage array
+*
+* \param txNum
+*    number of frames in the transmit storage (power of two)
+*
+* \retval  =0    ring CAN driver is initialized
+* \retval  <0    the frame storage is invalid
+*/
+int16_t COIfCanRingInit(CO_IF_CAN_RING      *can,
+                        const CO_IF_CAN_DRV *hw,
+                        CO_IF_FRM           *rx,
+                        uint32_t             rxNum,
+                        CO_IF_FRM           *tx,
+                        uint32_t             txNum);
+
+/*! \brief  RECEIVE FROM CAN HARDWARE
+*
+*    This function reads a single CAN frame with the CAN hardware driver
+*    and puts it into the receive ring. Call this function in the receive
+*    interrupt or in a loop of the reader thread, where a blocking Read()
+*    of the CAN hardware driver is allowed.
+*
+* \param can
+*    pointer to the ring CAN driver
+*
+* \retval  >0    the size of CO_IF_FRM on success (or frame is dropped)
+* \retval  =0    special: nothing received during polling (timeout)
+* \retval  <0    the CAN hardware driver error code
+*/
+int16_t COIfCanRingRxPoll(CO_IF_CAN_RING *can);
+
+/*! \brief  SEND TO CAN HARDWARE
+*
+*    This function passes the frames of the transmit ring to the CAN
+*    hardware driver, until the ring is empty or the CAN hardware driver
+*    rejects a frame. A rejected frame stays in the transmit ring. Call
+*    this function in the transmit interrupt or in the writer thread.
+*
+* \param can
+*    pointer to the ring CAN driver
+*
+* \retval  >=0   the number of sent CAN frames
+* \retval  <0    the CAN hardware driver error code
+*/
+int16_t COIfCanRingTxPoll(CO_IF_CAN_RING *can);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif /* CO_IF_CAN_RING_H_ */
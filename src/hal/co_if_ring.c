@@ -0,0 +1,161 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t COIfRingInit(CO_IF_RING *ring, CO_IF_FRM *frm, uint32_t num)
+{
+    if ((frm == NULL) || (num < 2u) || ((num & (num - 1u)) != 0u)) {
+        return (-1);
+    }
+    ring->Frm       = frm;
+    ring->Mask      = num - 1u;
+    ring->Head      = 0u;
+    ring->TailCache = 0u;
+    ring->Drop      = 0u;
+    ring->Tail      = 0u;
+    ring->HeadCache = 0u;
+    return (0);
+}
+
+/*
+* see function definition
+*/
+uint32_t COIfRingPush(CO_IF_RING *ring, const CO_IF_FRM *frm, uint32_t num)
+{
+    uint32_t size = ring->Mask + 1u;
+    uint32_t head = ring->Head;
+    uint32_t free;
+    uint32_t pos;
+    uint32_t part;
+
+    /* read the consumer index only, when the last seen index is too old */
+    free = size - (head - ring->TailCache);
+    if (free < num) {
+        ring->TailCache = CO_IF_RING_LOAD(&ring->Tail);
+        free = size - (head - ring->TailCache);
+    }
+    if (free < num) {
+        ring->Drop += num - free;
+        num = free;
+    }
+    if (num > 0u) {
+        pos  = head & ring->Mask;
+        part = size - pos;
+        if (part > num) {
+            part = num;
+        }
+        (void)memcpy(&ring->Frm[pos], frm, part * sizeof(CO_IF_FRM));
+        (void)memcpy(&ring->Frm[0], &frm[part], (num - part) * sizeof(CO_IF_FRM));
+        CO_IF_RING_STORE(&ring->Head, head + num);
+    }
+    return (num);
+}
+
+/*
+* see function definition
+*/
+uint32_t COIfRingPop(CO_IF_RING *ring, CO_IF_FRM *frm, uint32_t max)
+{
+    uint32_t num;
+
+    num = COIfRingPeek(ring, frm, max);
+    if (num > 0u) {
+        COIfRingSkip(ring, num);
+    }
+    return (num);
+}
+
+/*
+* see function definition
+*/
+uint32_t COIfRingPeek(CO_IF_RING *ring, CO_IF_FRM *frm, uint32_t max)
+{
+    uint32_t size = ring->Mask + 1u;
+    uint32_t tail = ring->Tail;
+    uint32_t used;
+    uint32_t pos;
+    uint32_t part;
+
+    /* read the producer index only, when the last seen index is too old */
+    used = ring->HeadCache - tail;
+    if (used < max) {
+        ring->HeadCache = CO_IF_RING_LOAD(&ring->Head);
+        used = ring->HeadCache - tail;
+    }
+    if (used < max) {
+        max = used;
+    }
+    if (max > 0u) {
+        pos  = tail & ring->Mask;
+        part = size - pos;
+        if (part > max) {
+            part = max;
+        }
+        (void)memcpy(frm, &ring->Frm[pos], part * sizeof(CO_IF_FRM));
+        (void)memcpy(&frm[part], &ring->Frm[0], (max - part) * sizeof(CO_IF_FRM));
+    }
+    return (max);
+}
+
+/*
+* see function definition
+*/
+void COIfRingSkip(CO_IF_RING *ring, uint32_t num)
+{
+    CO_IF_RING_STORE(&ring->Tail, ring->Tail + num);
+}
+
+/*
+* see function definition
+*/
+void COIfRingClear(CO_IF_RING *ring)
+{
+    ring->HeadCache = CO_IF_RING_LOAD(&ring->Head);
+    CO_IF_RING_STORE(&ring->Tail, ring->HeadCache);
+}
+
+/*
+* see function definition
+*/
+uint32_t COIfRingUsed(CO_IF_RING *ring)
+{
+    uint32_t tail = CO_IF_RING_LOAD(&ring->Tail);
+    uint32_t head = CO_IF_RING_LOAD(&ring->Head);
+
+    return (head - tail);
+}
+
+/*
+* see function definition
+*/
+uint32_t COIfRingFree(CO_IF_RING *ring)
+{
+    return ((ring->Mask + 1u) - COIfRingUsed(ring));
+}
@@ -0,0 +1,230 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_IF_RING_H_
+#define CO_IF_RING_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_cfg.h"
+#include "co_if_can.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/*! \brief RING INDEX ACCESS
+*
+*    These macros read a ring index with acquire semantic and write a ring
+*    index with release semantic. The frames in the ring are completely
+*    written before the other side sees the new index. Without the GCC
+*    atomic builtins, the C11 atomics are used; for other compilers,
+*    define both macros and the index type CO_IF_RING_IDX in co_cfg.h.
+*
+* \param p
+*    Pointer to the ring index
+*
+* \param v
+*    The new ring index
+*/
+#ifndef CO_IF_RING_LOAD
+#if defined(__GNUC__) || defined(__clang__)
+#define CO_IF_RING_LOAD(p)      __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define CO_IF_RING_STORE(p,v)   __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#define CO_IF_RING_IDX          _Atomic uint32_t
+#define CO_IF_RING_LOAD(p)      atomic_load_explicit((p), memory_order_acquire)
+#define CO_IF_RING_STORE(p,v)   atomic_store_explicit((p), (v), memory_order_release)
+#else
+#error "define CO_IF_RING_LOAD() and CO_IF_RING_STORE() for this compiler in co_cfg.h"
+#endif
+#endif
+
+/*! \brief RING INDEX TYPE
+*
+*    This define holds the type of the ring indices, which are accessed
+*    with CO_IF_RING_LOAD() and CO_IF_RING_STORE().
+*/
+#ifndef CO_IF_RING_IDX
+#define CO_IF_RING_IDX          uint32_t
+#endif
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief FRAME RING
+*
+*    This data structure holds a lock-free frame ring with a single producer
+*    and a single consumer, e.g. a receive interrupt and the node processing.
+*    The number of frames is a power of two; the free running indices are
+*    masked to the frame position. The producer data and the consumer data
+*    are separated by a full cache line, so each side writes to its own
+*    cache line only.
+*/
+typedef struct CO_IF_RING_T {
+    CO_IF_FRM     *Frm;                   /*!< frame storage                 */
+    uint32_t       Mask;                  /*!< number of frames - 1          */
+    uint8_t        PadA[CO_IF_RING_LINE]; /*!< cache line separation         */
+    CO_IF_RING_IDX Head;                  /*!< write index (producer)        */
+    uint32_t       TailCache;             /*!< last seen read index          */
+    uint32_t       Drop;                  /*!< number of dropped frames      */
+    uint8_t        PadB[CO_IF_RING_LINE]; /*!< cache line separation         */
+    CO_IF_RING_IDX Tail;                  /*!< read index (consumer)         */
+    uint32_t       HeadCache;             /*!< last seen write index         */
+    uint8_t        PadC[CO_IF_RING_LINE]; /*!< cache line separation         */
+} CO_IF_RING;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  INITIALIZE FRAME RING
+*
+*    This function initializes an empty frame ring with the given frame
+*    storage. Call this function before the producer and the consumer use
+*    the ring.
+*
+* \param ring
+*    pointer to the frame ring
+*
+* \param frm
+*    pointer to the frame storage array
+*
+* \param num
+*    number of frames in the storage array (power of two, at least 2)
+*
+* \retval  =0    frame ring is initialized
+* \retval  <0    the storage is missing or the number is no power of two
+*/
+int16_t COIfRingInit(CO_IF_RING *ring, CO_IF_FRM *frm, uint32_t num);
+
+/*! \brief  PUT FRAMES INTO RING (PRODUCER)
+*
+*    This function copies the given frames into the ring. If the ring can't
+*    hold all frames, the remaining frames are dropped and counted.
+*
+* \param ring
+*    pointer to the frame ring
+*
+* \param frm
+*    pointer to the frame array
+*
+* \param num
+*    number of frames in the array
+*
+* \retval  the number of frames in the ring (others are dropped)
+*/
+uint32_t COIfRingPush(CO_IF_RING *ring, const CO_IF_FRM *frm, uint32_t num);
+
+/*! \brief  GET FRAMES FROM RING (CONSUMER)
+*
+*    This function copies the oldest frames out of the ring and releases
+*    them for the producer.
+*
+* \param ring
+*    pointer to the frame ring
+*
+* \param frm
+*    pointer to the frame array
+*
+* \param max
+*    maximum number of frames (length of the frame array)
+*
+* \retval  the number of frames, which are copied into the array
+*/
+uint32_t COIfRingPop(CO_IF_RING *ring, CO_IF_FRM *frm, uint32_t max);
+
+/*! \brief  READ FRAMES IN RING (CONSUMER)
+*
+*    This function copies the oldest frames out of the ring, but keeps them
+*    in the ring. Release the frames with COIfRingSkip() when they are
+*    processed, e.g. when the CAN controller accepted them.
+*
+* \param ring
+*    pointer to the frame ring
+*
+* \param frm
+*    pointer to the frame array
+*
+* \param max
+*    maximum number of frames (length of the frame array)
+*
+* \retval  the number of frames, which are copied into the array
+*/
+uint32_t COIfRingPeek(CO_IF_RING *ring, CO_IF_FRM *frm, uint32_t max);
+
+/*! \brief  RELEASE FRAMES IN RING (CONSUMER)
+*
+*    This function releases the given number of oldest frames for the
+*    producer. The number must not exceed the result of COIfRingPeek().
+*
+* \param ring
+*    pointer to the frame ring
+*
+* \param num
+*    number of frames to release
+*/
+void COIfRingSkip(CO_IF_RING *ring, uint32_t num);
+
+/*! \brief  CLEAR FRAME RING (CONSUMER)
+*
+*    This function releases all frames in the ring for the producer.
+*
+* \param ring
+*    pointer to the frame ring
+*/
+void COIfRingClear(CO_IF_RING *ring);
+
+/*! \brief  GET NUMBER OF FRAMES IN RING
+*
+*    This function returns the number of frames in the ring. The other side
+*    of the ring may change the number at any time; the consumer gets at
+*    least this number of frames.
+*
+* \param ring
+*    pointer to the frame ring
+*
+* \retval  the number of frames in the ring
+*/
+uint32_t COIfRingUsed(CO_IF_RING *ring);
+
+/*! \brief  GET NUMBER OF FREE FRAMES IN RING
+*
+*    This function returns the number of frames, which fit into the ring.
+*    The other side of the ring may change the number at any time; the
+*    producer puts at least this number of frames.
+*
+* \param ring
+*    pointer to the frame ring
+*
+* \retval  the number of free frames in the ring
+*/
+uint32_t COIfRingFree(CO_IF_RING *ring);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif /* CO_IF_RING_H_ */
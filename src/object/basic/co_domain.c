@@ -18,6 +18,8 @@
 * INCLUDES
 ******************************************************************************/
 
+#include <string.h>
+
 #include "co_core.h"
 
 /******************************************************************************
@@ -29,12 +31,13 @@ static CO_ERR   COTDomainRead (struct CO_OBJ_T *obj, struct CO_NODE_T *node, voi
 static CO_ERR   COTDomainWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
 static CO_ERR   COTDomainInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
 static CO_ERR   COTDomainReset(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t para);
+static uint8_t *COTDomainRegion(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t offset, uint32_t *size);
 
 /******************************************************************************
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTDomain = { COTDomainSize, COTDomainInit, COTDomainRead, COTDomainWrite, COTDomainReset };
+const CO_OBJ_TYPE COTDomain = { COTDomainSize, COTDomainInit, COTDomainRead, COTDomainWrite, COTDomainReset, COTDomainRegion };
 
 /******************************************************************************
 * FUNCTIONS
@@ -89,13 +92,8 @@ static CO_ERR COTDomainRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *
     }
 
     /* copy length bytes to given buffer */
-    while (len > 0) {
-        *dst = *src;
-        src++;
-        dst++;
-        len--;
-        dom->Offset++;
-    }
+    (void)memcpy(dst, src, len);
+    dom->Offset += len;
     return (CO_ERR_NONE);
 }
 
@@ -123,13 +121,8 @@ static CO_ERR COTDomainWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void
     }
 
     /* copy length bytes to domain */
-    while (len > 0) {
-        *dst = *src;
-        src++;
-        dst++;
-        len--;
-        dom->Offset++;
-    }
+    (void)memcpy(dst, src, len);
+    dom->Offset += len;
     return (CO_ERR_NONE);
 }
 
@@ -156,3 +149,20 @@ static CO_ERR COTDomainReset(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint3
     dom->Offset = para;
     return (CO_ERR_NONE);
 }
+
+static uint8_t *COTDomainRegion(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t offset, uint32_t *size)
+{
+    CO_OBJ_DOM *dom;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj->Data, 0);
+
+    dom = (CO_OBJ_DOM *)(obj->Data);
+    if (offset >= dom->Size) {
+        return (0);
+    }
+
+    /* the domain memory is contiguous up to the end of the domain */
+    *size = dom->Size - offset;
+    return (dom->Start + offset);
+}
@@ -67,6 +67,10 @@ typedef struct CO_OBJ_DOM_T {
 *    direct accessible memory (e.g. RAM). The reading from FLASH memory is
 *    no problem, but for the write access to FLASH memory, there should be
 *    a special DOMAIN implementation for each media.
+*
+*    The domain memory is provided as memory region, therefore an SDO
+*    block transfer reads and writes the domain memory without staging
+*    the data in the SDO transfer buffer.
 */
 extern const CO_OBJ_TYPE COTDomain;
 
@@ -38,7 +38,7 @@ static CO_ERR   COTInt16Write(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTInt16 = { COTInt16Size, 0, COTInt16Read, COTInt16Write, 0 };
+const CO_OBJ_TYPE COTInt16 = { COTInt16Size, 0, COTInt16Read, COTInt16Write, 0, 0 };
 
 /******************************************************************************
 * FUNCTIONS
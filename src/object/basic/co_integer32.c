@@ -38,7 +38,7 @@ static CO_ERR   COTInt32Write(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTInt32 = { COTInt32Size, 0, COTInt32Read, COTInt32Write, 0 };
+const CO_OBJ_TYPE COTInt32 = { COTInt32Size, 0, COTInt32Read, COTInt32Write, 0, 0 };
 
 /******************************************************************************
 * FUNCTIONS
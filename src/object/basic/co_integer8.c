@@ -38,7 +38,7 @@ static CO_ERR   COTInt8Write(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTInt8 = { COTInt8Size, 0, COTInt8Read, COTInt8Write, 0 };
+const CO_OBJ_TYPE COTInt8 = { COTInt8Size, 0, COTInt8Read, COTInt8Write, 0, 0 };
 
 /******************************************************************************
 * FUNCTIONS
@@ -0,0 +1,109 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+#if USE_OBJ_RANGE
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTRangeSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width);
+static CO_ERR   COTRangeInit(struct CO_OBJ_T *obj, struct CO_NODE_T *node);
+
+/******************************************************************************
+* PUBLIC GLOBALS
+******************************************************************************/
+
+const CO_OBJ_TYPE COTRange = { COTRangeSize, COTRangeInit, 0, 0, 0, 0 };
+
+/******************************************************************************
+* FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTRangeSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    CO_UNUSED(obj);
+    CO_UNUSED(node);
+    CO_UNUSED(width);
+
+    /* the range entry itself is not accessible */
+    return (uint32_t)0;
+}
+
+static CO_ERR COTRangeInit(struct CO_OBJ_T *obj, struct CO_NODE_T *node)
+{
+    CO_ERR        result = CO_ERR_NONE;
+    CO_ERR        err;
+    CO_OBJ_RANGE *range;
+    CO_OBJ        view;
+    uint8_t       first;
+    uint8_t       n;
+
+    ASSERT_PTR_ERR(obj,  CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(node, CO_ERR_BAD_ARG);
+
+    range = (CO_OBJ_RANGE *)(obj->Data);
+    if ((range == NULL) || (range->Type == NULL)) {
+        return (CO_ERR_TYPE_INIT);
+    }
+
+    /* initialize the element type for each element */
+    first = CO_GET_SUB(obj->Key);
+    for (n = 0; n < range->Num; n++) {
+        (void)COTRangeView(obj, (uint8_t)(first + n), &view);
+        err = COObjInit(&view, node);
+        if (err != CO_ERR_NONE) {
+            result = err;
+        }
+    }
+    return (result);
+}
+
+/******************************************************************************
+* PROTECTED API FUNCTIONS
+******************************************************************************/
+
+CO_OBJ *COTRangeView(CO_OBJ *obj, uint8_t sub, CO_OBJ *view)
+{
+    CO_OBJ       *result = NULL;
+    CO_OBJ_RANGE *range;
+    uint32_t      flags;
+    uint8_t       first;
+
+    ASSERT_PTR_ERR(obj,  NULL);
+    ASSERT_PTR_ERR(view, NULL);
+
+    if ((obj->Type == CO_TRANGE) && (obj->Data != (CO_DATA)0)) {
+        range = (CO_OBJ_RANGE *)(obj->Data);
+        first = CO_GET_SUB(obj->Key);
+        if ((sub >= first) && ((uint8_t)(sub - first) < range->Num)) {
+            flags      = obj->Key & (uint32_t)(0xFF & ~CO_OBJ_D_____);
+            view->Key  = CO_KEY(CO_GET_IDX(obj->Key), sub, flags);
+            view->Type = range->Type;
+            view->Data = (CO_DATA)(range->Base + ((uint32_t)(sub - first) * range->Stride));
+            result     = view;
+        }
+    }
+    return (result);
+}
+
+#endif //USE_OBJ_RANGE
@@ -0,0 +1,106 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_RANGE_H_
+#define CO_RANGE_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_cfg.h"
+#include "co_err.h"
+#include "co_obj.h"
+
+#if USE_OBJ_RANGE
+
+/******************************************************************************
+* DEFINES
+******************************************************************************/
+
+#define CO_TRANGE  ((const CO_OBJ_TYPE *)&COTRange)
+
+/******************************************************************************
+* PUBLIC TYPE DEFINITION
+******************************************************************************/
+
+/*! \brief RANGE MANAGEMENT STRUCTURE
+*
+*    This structure describes a homogeneous array of elements, which are
+*    addressed with consecutive subindices. The object entry, which links
+*    to this structure, holds the subindex of the first element.
+*/
+typedef struct CO_OBJ_RANGE_T {
+    const struct CO_OBJ_TYPE_T *Type;  /*!< Object type of the elements      */
+    uint8_t                    *Base;  /*!< Address of the first element     */
+    uint16_t                    Stride;/*!< Distance of elements in bytes    */
+    uint8_t                     Num;   /*!< Number of elements               */
+
+} CO_OBJ_RANGE;
+
+/******************************************************************************
+* PUBLIC CONSTANTS
+******************************************************************************/
+
+/*! \brief OBJECT TYPE RANGE
+*
+*    This type describes the subindices 'first' up to 'first + Num - 1' of
+*    an object with a single object entry. The key of the object entry
+*    holds the first subindex and the access flags of all elements, the
+*    range management structure is stored in the object entry member 'Data'.
+*
+*    The dictionary search returns a view for the addressed element: an
+*    object entry with the element key, the element type and the address
+*    'Base + (sub - first) * Stride' as data. Direct values are not
+*    supported for elements.
+*/
+extern const CO_OBJ_TYPE COTRange;
+
+/******************************************************************************
+* PROTECTED API FUNCTIONS
+******************************************************************************/
+
+/*! \brief  GET ELEMENT VIEW OF RANGE
+*
+*    This function fills the given object entry with the view of the
+*    element, which is addressed with the given subindex.
+*
+* \param obj
+*    pointer to the range object entry
+*
+* \param sub
+*    subindex of the element
+*
+* \param view
+*    pointer to the object entry, which receives the element view
+*
+* \retval  >0    The pointer to the element view
+* \retval  =0    Subindex is not covered by the range object entry
+*/
+struct CO_OBJ_T *COTRangeView(struct CO_OBJ_T *obj, uint8_t sub, struct CO_OBJ_T *view);
+
+#endif //USE_OBJ_RANGE
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif  /* #ifndef CO_RANGE_H_ */
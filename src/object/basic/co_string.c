@@ -18,6 +18,8 @@
 * INCLUDES
 ******************************************************************************/
 
+#include <string.h>
+
 #include "co_core.h"
 
 /******************************************************************************
@@ -33,7 +35,7 @@ static CO_ERR   COTStringReset(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uin
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTString = { COTStringSize, COTStringInit, COTStringRead, 0, COTStringReset };
+const CO_OBJ_TYPE COTString = { COTStringSize, COTStringInit, COTStringRead, 0, COTStringReset, 0 };
 
 /******************************************************************************
 * FUNCTIONS
@@ -41,47 +43,40 @@ const CO_OBJ_TYPE COTString = { COTStringSize, COTStringInit, COTStringRead, 0,
 
 static uint32_t COTStringSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
 {
-    uint32_t    strlen = 0;
     CO_OBJ_STR *str;
-    uint8_t    *ptr;
 
     CO_UNUSED(node);
     CO_UNUSED(width);
     ASSERT_PTR_ERR(obj->Data, 0);
 
     str = (CO_OBJ_STR *)(obj->Data);
-    ptr = str->Start;
-    while (*ptr != '\0') {
-        strlen++;
-        ptr++;
+    if (str->Len == 0) {
+        str->Len = (uint32_t)strlen((const char *)str->Start);
     }
-    return (strlen);
+    return (str->Len);
 }
 
 static CO_ERR COTStringRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
 {
-    uint32_t    offset;
+    uint32_t    len;
     uint32_t    num;
     CO_OBJ_STR *str;
-    uint8_t    *ptr;
-    uint8_t    *dst;
 
-    CO_UNUSED(node);
     ASSERT_PTR_ERR(obj->Data, CO_ERR_BAD_ARG);
 
-    str    = (CO_OBJ_STR *)(obj->Data);
-    offset = str->Offset;
-    ptr    = (uint8_t *)(str->Start) + offset;
-    dst    = (uint8_t *)buffer;
-    num    = size;
-    while ((*ptr != 0) && (num > 0)) {
-        *dst = *ptr;
-        offset++;
-        ptr++;
-        dst++;
-        num--;
+    str = (CO_OBJ_STR *)(obj->Data);
+    len = COTStringSize(obj, node, 0);
+
+    /* set length to minimum of buffer and remaining string size */
+    num = 0;
+    if (str->Offset < len) {
+        num = len - str->Offset;
+    }
+    if (num > size) {
+        num = size;
     }
-    str->Offset = offset;
+    (void)memcpy(buffer, str->Start + str->Offset, num);
+    str->Offset += num;
     return (CO_ERR_NONE);
 }
 
@@ -94,6 +89,7 @@ static CO_ERR COTStringInit(struct CO_OBJ_T *obj, struct CO_NODE_T *node)
 
     str = (CO_OBJ_STR *)(obj->Data);
     str->Offset = 0;
+    str->Len    = 0;
     return (CO_ERR_NONE);
 }
 
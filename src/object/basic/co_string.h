@@ -47,6 +47,7 @@ extern "C" {
 typedef struct CO_OBJ_STR_T {
     uint32_t  Offset;                  /*!< Internal offset information      */
     uint8_t  *Start;                   /*!< String start address             */
+    uint32_t  Len;                     /*!< Cached string length (0=unknown) */
 
 } CO_OBJ_STR;
 
@@ -60,6 +61,10 @@ typedef struct CO_OBJ_STR_T {
 *    It is assumed, that the strings are declared in nonvolatile memory
 *    (e.g. FLASH) and the string management structure is stored in the
 *    object entry member 'Data'.
+*
+*    The string length is determined once and cached in the string
+*    management structure. After changing a string in RAM, the length
+*    must be cleared (or the object entry initialized again).
 */
 extern const CO_OBJ_TYPE COTString;
 
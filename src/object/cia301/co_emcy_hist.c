@@ -37,11 +37,47 @@ static CO_ERR   COTEmcyHistRead (struct CO_OBJ_T *obj, struct CO_NODE_T *node, v
 static CO_ERR   COTEmcyHistWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
 static CO_ERR   COTEmcyHistInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
 
+/* helper functions */
+static CO_OBJ  *COTEmcyHistEntry(CO_DICT *cod, CO_OBJ *hist, uint8_t sub);
+
 /******************************************************************************
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTEmcyHist = { COTEmcyHistSize, COTEmcyHistInit, COTEmcyHistRead, COTEmcyHistWrite, 0 };
+const CO_OBJ_TYPE COTEmcyHist = { COTEmcyHistSize, COTEmcyHistInit, COTEmcyHistRead, COTEmcyHistWrite, 0, 0 };
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+static CO_OBJ *COTEmcyHistEntry(CO_DICT *cod, CO_OBJ *hist, uint8_t sub)
+{
+    CO_OBJ *result = &hist[sub];
+#if USE_OBJ_RANGE || USE_DICT_OVERLAY
+    uint8_t search = 0;
+#endif
+
+#if USE_DICT_OVERLAY
+    /* the entries may be copied into the overlay of the node */
+    if (cod->Ovl != NULL) {
+        search = 1;
+    }
+#endif //USE_DICT_OVERLAY
+#if USE_OBJ_RANGE
+    /* the array entries may be a single range entry after subindex 0 */
+    if ((search == 0) && (sub > 0) && (hist[1].Type == CO_TRANGE)) {
+        search = 1;
+    }
+#endif //USE_OBJ_RANGE
+#if USE_OBJ_RANGE || USE_DICT_OVERLAY
+    if (search != 0) {
+        result = CODictFind(cod, CO_DEV(COT_OBJECT, sub));
+    }
+#else
+    CO_UNUSED(cod);
+#endif
+    return (result);
+}
 
 /******************************************************************************
 * PRIVATE TYPE FUNCTIONS
@@ -64,7 +100,7 @@ static CO_ERR COTEmcyHistRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void
     const CO_OBJ_TYPE *uint32 = CO_TUNSIGNED32;
     const CO_OBJ_TYPE *uint8 = CO_TUNSIGNED8;
     CO_ERR   result = CO_ERR_TYPE_RD;
-    CO_OBJ  *subObj;
+    CO_OBJ  *hist;
     CO_DICT *cod;
     CO_EMCY *emcy;
     uint8_t  sub;
@@ -87,8 +123,10 @@ static CO_ERR COTEmcyHistRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void
             }
 
             /* get object entry and stored read value */
-            subObj = CODictFind(cod, CO_DEV(COT_OBJECT, map));
-            result = uint32->Read(subObj, node, buffer, COT_ENTRY_SIZE);
+            hist = CODictRefObj(cod, &emcy->Hist.Ref);
+            if (hist != NULL) {
+                result = uint32->Read(COTEmcyHistEntry(cod, hist, map), node, buffer, COT_ENTRY_SIZE);
+            }
         } else {
             if (sub < emcy->Hist.Max) {
                 *((uint32_t *)buffer) = (uint32_t)0;
@@ -142,8 +180,11 @@ static CO_ERR COTEmcyHistInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node)
             emcy->Hist.Num = 0;
             emcy->Hist.Off = 0;
 
-            /* scan through all existing array entries */
+            /* the array entries follow subindex 0 within the dictionary */
             cod = &node->Dict;
+            (void)CODictRef(cod, CO_DEV(COT_OBJECT, 0), &emcy->Hist.Ref);
+
+            /* scan through all existing array entries */
             sub = 0;
             do {
                 subobj = CODictFind(cod, CO_DEV(COT_OBJECT, sub + 1));
@@ -175,7 +216,7 @@ void COEmcyHistAdd(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr)
     const CO_OBJ_TYPE *uint8 = CO_TUNSIGNED8;
     CO_NODE *node;
     CO_DICT *cod;
-    CO_OBJ  *obj;
+    CO_OBJ  *hist;
     uint32_t val = 0;
     uint8_t  sub;
 
@@ -183,10 +224,14 @@ void COEmcyHistAdd(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr)
     if (emcy->Hist.Max == 0) {
         return;
     }
-
-    /* calculate next position in array */
     node = emcy->Node;
     cod  = &node->Dict;
+    hist = CODictRefObj(cod, &emcy->Hist.Ref);
+    if (hist == NULL) {
+        return;
+    }
+
+    /* calculate next position in array */
     emcy->Hist.Off++;
     if (emcy->Hist.Off > emcy->Hist.Max) {
         emcy->Hist.Off = 1;
@@ -198,16 +243,14 @@ void COEmcyHistAdd(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr)
     if (usr != NULL) {
         val |= (((uint32_t)usr->Hist) << 16);
     }
-    obj = CODictFind(cod, CO_DEV(COT_OBJECT, sub));
-    (void)uint32->Write(obj, node, &val, sizeof(val));
+    (void)uint32->Write(COTEmcyHistEntry(cod, hist, sub), node, &val, sizeof(val));
 
     /* update number of stored entries in history */
     emcy->Hist.Num++;
     if (emcy->Hist.Num > emcy->Hist.Max) {
         emcy->Hist.Num = emcy->Hist.Max;
     } else {
-        obj = CODictFind(cod, CO_DEV(COT_OBJECT, 0));
-        (void)uint8->Write(obj, node, &(emcy->Hist.Num), sizeof(emcy->Hist.Num));
+        (void)uint8->Write(COTEmcyHistEntry(cod, hist, 0), node, &(emcy->Hist.Num), sizeof(emcy->Hist.Num));
     }
 }
 
@@ -222,7 +265,7 @@ void COEmcyHistReset(CO_EMCY *emcy)
     const CO_OBJ_TYPE *uint8 = CO_TUNSIGNED8;
     CO_NODE  *node;
     CO_DICT  *cod;
-    CO_OBJ   *obj;
+    CO_OBJ   *hist;
     uint32_t  val32 = 0;
     uint8_t   val08 = 0;
     uint8_t   sub;
@@ -234,17 +277,16 @@ void COEmcyHistReset(CO_EMCY *emcy)
     cod  = &node->Dict;
 
     /* clear number of emergencies in history */
-    obj = CODictFind(cod, CO_DEV(COT_OBJECT, 0));
-    if (obj == NULL) {
+    hist = CODictRefObj(cod, &emcy->Hist.Ref);
+    if (hist == NULL) {
         node->Error = CO_ERR_NONE;
         return;
     }
-    (void)uint8->Write(obj, node, &val08, sizeof(val08));
+    (void)uint8->Write(COTEmcyHistEntry(cod, hist, 0), node, &val08, sizeof(val08));
 
     /* clear all emergency entries in history */
     for (sub = 1; sub <= emcy->Hist.Max; sub++) {
-        obj = CODictFind(cod, CO_DEV(COT_OBJECT, sub));
-        (void)uint32->Write(obj, node, &val32, sizeof(val32));
+        (void)uint32->Write(COTEmcyHistEntry(cod, hist, sub), node, &val32, sizeof(val32));
     }
 
     /* update history state */
@@ -42,7 +42,7 @@ static CO_ERR   COTEmcyIdInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTEmcyId = { COTEmcyIdSize, COTEmcyIdInit, COTEmcyIdRead, COTEmcyIdWrite, 0 };
+const CO_OBJ_TYPE COTEmcyId = { COTEmcyIdSize, COTEmcyIdInit, COTEmcyIdRead, COTEmcyIdWrite, 0, 0 };
 
 /******************************************************************************
 * PRIVATE TYPE FUNCTIONS
@@ -40,13 +40,17 @@ static CO_ERR   COTNmtHbConsWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node,
 static CO_ERR   COTNmtHbConsInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
 
 /* helper functions */
+#if USE_HBC_TABLE
+static void     CONmtHbConsSweep(void *parg);
+#else
 static void     CONmtHbConsMonitor(void *parg);
+#endif
 
 /******************************************************************************
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTNmtHbCons = { COTNmtHbConsSize, COTNmtHbConsInit, COTNmtHbConsRead, COTNmtHbConsWrite, 0 };
+const CO_OBJ_TYPE COTNmtHbCons = { COTNmtHbConsSize, COTNmtHbConsInit, COTNmtHbConsRead, COTNmtHbConsWrite, 0, 0 };
 
 /******************************************************************************
 * PRIVATE TYPE FUNCTIONS
@@ -161,6 +165,75 @@ static CO_ERR COTNmtHbConsInit(struct CO_OBJ_T *obj, struct CO_NODE_T *node)
 * PROTECTED HELPER FUNCTIONS
 ******************************************************************************/
 
+#if USE_HBC_TABLE
+
+WEAK_TEST
+CO_ERR CONmtHbConsActivate(CO_HBCONS *hbc, uint16_t time, uint8_t nodeid)
+{
+    CO_ERR      result = CO_ERR_NONE;
+    int16_t     err;
+    CO_NMT     *nmt;
+    CO_TMR     *tmr;
+    CO_HBCONS **prev;
+    uint32_t    ticks;
+
+    nmt = &(hbc->Node->Nmt);
+    tmr = &(nmt->Node->Tmr);
+    if ((time > 0) &&
+        (nodeid < CO_HBC_NODE_N) &&
+        (nmt->HbTbl[nodeid] != 0)) {
+        return (CO_ERR_OBJ_INCOMPATIBLE);
+    }
+
+    /* remove consumer from active chain and node-id table */
+    if ((hbc->NodeId < CO_HBC_NODE_N) &&
+        (nmt->HbTbl[hbc->NodeId] == hbc)) {
+        nmt->HbTbl[hbc->NodeId] = 0;
+        prev = &nmt->HbCons;
+        while (*prev != hbc) {
+            prev = &((*prev)->Next);
+        }
+        *prev = hbc->Next;
+    }
+
+    hbc->Time   = time;
+    hbc->NodeId = nodeid;
+    hbc->Tmr    = -1;
+    hbc->Event  = 0;
+    hbc->State  = CO_INVALID;
+    hbc->Node   = nmt->Node;
+    hbc->Seen   = 0;
+    hbc->Next   = 0;
+    if ((time > 0) && (nodeid < CO_HBC_NODE_N)) {
+        hbc->Next           = nmt->HbCons;
+        nmt->HbCons         = hbc;
+        nmt->HbTbl[nodeid]  = hbc;
+    }
+
+    /* single supervision timer runs while consumers are active */
+    if ((nmt->HbCons != 0) && (nmt->HbTmr < 0)) {
+        ticks = COTmrGetTicks(tmr, CO_HBC_SWEEP, CO_TMR_UNIT_1MS);
+        if (ticks == 0) {
+            ticks = 1;
+        }
+        nmt->HbTmr = COTmrCreate(tmr, ticks, ticks, CONmtHbConsSweep, nmt);
+        if (nmt->HbTmr < 0) {
+            result = CO_ERR_TMR_CREATE;
+        }
+    } else if ((nmt->HbCons == 0) && (nmt->HbTmr >= 0)) {
+        err = COTmrDelete(tmr, nmt->HbTmr);
+        if (err < 0) {
+            result = CO_ERR_TMR_DELETE;
+        }
+        nmt->HbTmr = -1;
+    }
+    CODispInvalidate(nmt->Node);
+
+    return (result);
+}
+
+#else
+
 WEAK_TEST
 CO_ERR CONmtHbConsActivate(CO_HBCONS *hbc, uint16_t time, uint8_t nodeid)
 {
@@ -221,14 +294,79 @@ CO_ERR CONmtHbConsActivate(CO_HBCONS *hbc, uint16_t time, uint8_t nodeid)
             hbc->Next   = 0;
         }
     }
+    CODispInvalidate(nmt->Node);
 
     return (result);
 }
 
+#endif
+
 /******************************************************************************
 * PROTECTED COM FUNCTION
 ******************************************************************************/
 
+#if USE_HBC_TABLE
+
+static void CONmtHbConsSweep(void *parg)
+{
+    CO_NMT    *nmt;
+    CO_HBCONS *hbc;
+    CO_HBCONS *next;
+    uint32_t   elapsed;
+
+    nmt = (CO_NMT *)parg;
+    nmt->HbNow++;
+    hbc = nmt->HbCons;
+    while (hbc != 0) {
+        next = hbc->Next;
+        /* supervision starts with the first received heartbeat */
+        if (hbc->Tmr >= 0) {
+            elapsed = (nmt->HbNow - hbc->Seen) * (uint32_t)CO_HBC_SWEEP;
+            if (elapsed >= (uint32_t)hbc->Time) {
+                hbc->Seen = nmt->HbNow;
+                if (hbc->Event < 0xFFu) {
+                    hbc->Event++;
+                }
+                CONmtHbConsEvent(nmt, hbc->NodeId);
+            }
+        }
+        hbc = next;
+    }
+}
+
+int16_t CONmtHbConsCheck(CO_NMT *nmt, CO_IF_FRM *frm)
+{
+    CO_HBCONS *hbc;
+    CO_MODE    state;
+    uint32_t   cobid;
+    uint8_t    nodeid;
+
+    cobid = frm->Identifier;
+    if ((cobid >= COT_HB_COBID) &&
+        (cobid <= COT_HB_COBID + 127)) {
+        nodeid = (uint8_t)(cobid - COT_HB_COBID);
+    } else {
+        return (-1);
+    }
+    hbc = nmt->HbTbl[nodeid];
+    if (hbc == 0) {
+        return (-1);
+    }
+
+    /* the heartbeat is received within the running sweep period */
+    hbc->Seen = nmt->HbNow + 1;
+    hbc->Tmr  = 0;
+    state = CONmtModeDecode(frm->Data[0]);
+    if (hbc->State != state) {
+        CONmtHbConsChange(nmt, hbc->NodeId, state);
+    }
+    hbc->State = state;
+
+    return ((int16_t)hbc->NodeId);
+}
+
+#else
+
 static void CONmtHbConsMonitor(void *parg)
 {
     CO_NODE   *node;
@@ -305,6 +443,8 @@ int16_t CONmtHbConsCheck(CO_NMT *nmt, CO_IF_FRM *frm)
     return (result);
 }
 
+#endif
+
 /******************************************************************************
 * PUBLIC API FUNCTION
 ******************************************************************************/
@@ -319,6 +459,15 @@ int16_t CONmtGetHbEvents(CO_NMT *nmt, uint8_t nodeId)
         return (result);
     }
 
+#if USE_HBC_TABLE
+    if (nodeId < CO_HBC_NODE_N) {
+        hbc = nmt->HbTbl[nodeId];
+        if (hbc != 0) {
+            result     = (int16_t)hbc->Event;
+            hbc->Event = 0;
+        }
+    }
+#else
     hbc = nmt->HbCons;
     while (hbc != 0) {
         if (nodeId == hbc->NodeId) {
@@ -327,6 +476,7 @@ int16_t CONmtGetHbEvents(CO_NMT *nmt, uint8_t nodeId)
         }
         hbc = hbc->Next;
     }
+#endif
 
     return (result);
 }
@@ -341,6 +491,14 @@ CO_MODE CONmtLastHbState(CO_NMT *nmt, uint8_t nodeId)
         return (result);
     }
 
+#if USE_HBC_TABLE
+    if (nodeId < CO_HBC_NODE_N) {
+        hbc = nmt->HbTbl[nodeId];
+        if (hbc != 0) {
+            result = hbc->State;
+        }
+    }
+#else
     hbc = nmt->HbCons;
     while (hbc != 0) {
         if (nodeId == hbc->NodeId) {
@@ -348,6 +506,7 @@ CO_MODE CONmtLastHbState(CO_NMT *nmt, uint8_t nodeId)
         }
         hbc = hbc->Next;
     }
+#endif
 
     return (result);
 }
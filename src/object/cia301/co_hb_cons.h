@@ -49,10 +49,13 @@ typedef struct CO_HBCONS_T {
     struct CO_NODE_T   *Node;    /*!< Link to parent node                    */
     struct CO_HBCONS_T *Next;    /*!< Link to next consumer in active chain  */
     CO_MODE             State;   /*!< Received Node-State                    */
-    int16_t             Tmr;     /*!< Timer Identifier                       */
+    int16_t             Tmr;     /*!< Timer Identifier (table: >=0 watched)  */
     uint16_t            Time;    /*!< Time   (Bit00-15 when read object)     */
     uint8_t             NodeId;  /*!< NodeId (Bit16-23 when read object)     */
     uint8_t             Event;   /*!< Event Counter                          */
+#if USE_HBC_TABLE
+    uint32_t            Seen;    /*!< Sweep count of last heartbeat          */
+#endif
 
 } CO_HBCONS;
 
@@ -45,7 +45,7 @@ static void CONmtHbProdSend(void *parg);
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTNmtHbProd = { COTNmtHbProdSize, COTNmtHbProdInit, COTNmtHbProdRead, COTNmtHbProdWrite, 0 };
+const CO_OBJ_TYPE COTNmtHbProd = { COTNmtHbProdSize, COTNmtHbProdInit, COTNmtHbProdRead, COTNmtHbProdWrite, 0, 0 };
 
 /******************************************************************************
 * PRIVATE TYPE FUNCTIONS
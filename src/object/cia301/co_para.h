@@ -37,10 +37,56 @@ extern "C" {
 #define CO_PARA__A_   0x0002     /*!< enable  (autonomously)                 */
 #define CO_PARA__AE   0x0003     /*!< enable  (autonomously and on command)  */
 
+#define CO_PARA_FAIL  0x40000000 /*!< background store failed (read only)   */
+#define CO_PARA_BUSY  0x80000000 /*!< background store active (read only)   */
+
 /******************************************************************************
 * PUBLIC TYPES
 ******************************************************************************/
 
+#if USE_PARA_DIRTY
+/*! \brief PARAMETER GROUP RANGE
+*
+*    This structure holds a range of bytes within a parameter group. The
+*    range is given relative to the start of the parameter memory block.
+*/
+typedef struct CO_PARA_SPAN_T {
+    uint32_t             Start;    /*!< First byte of range                  */
+    uint32_t             End;      /*!< Byte behind the range                */
+
+} CO_PARA_SPAN;
+
+/*! \brief PARAMETER GROUP DIRTY TRACKING
+*
+*    This structure holds the sorted, disjoint ranges of a parameter group,
+*    which are changed since the last store. While the NVM content of the
+*    parameter group is unknown (Valid = 0), the next store writes the
+*    whole parameter group.
+*
+* \note
+*    This structure must be placed in RAM. A zero initialized structure
+*    is a valid starting point.
+*/
+typedef struct CO_PARA_DIRTY_T {
+    uint8_t              Valid;    /*!< NVM matches parameters except ranges */
+    uint8_t              Num;      /*!< Number of changed ranges             */
+    CO_PARA_SPAN         Span[CO_PARA_DIRTY_N]; /*!< Changed ranges          */
+
+} CO_PARA_DIRTY;
+
+/*! \brief PARAMETER MEMORY AREA
+*
+*    This structure holds the memory area, which covers all parameter
+*    groups with dirty tracking. Writes outside of this area are ignored
+*    without a search of the parameter groups.
+*/
+typedef struct CO_PARA_AREA_T {
+    uint8_t             *Lo;       /*!< Start of tracked parameter memory    */
+    uint8_t             *Hi;       /*!< End of tracked parameter memory      */
+
+} CO_PARA_AREA;
+#endif //USE_PARA_DIRTY
+
 /*! \brief PARAMETER GROUP INFO
 *
 *    This structure holds the informations of a parameter group. The
@@ -48,7 +94,9 @@ extern "C" {
 *    an object dictionary for store and restore parameters.
 *
 * \note
-*    This structure may be placed into ROM to reduce RAM usage.
+*    This structure may be placed into ROM to reduce RAM usage. The dirty
+*    tracking data, which is linked with the member Dirty, is placed in
+*    RAM.
 */
 typedef struct CO_PARA_T {
     uint32_t             Offset;   /*!< Offset in non-volatile memory area   */
@@ -58,9 +106,41 @@ typedef struct CO_PARA_T {
     enum CO_NMT_RESET_T  Type;     /*!< Parameter reset type                 */
     void                *Ident;    /*!< Ptr to User Ident-Code               */
     uint32_t             Value;    /*!< value when reading parameter object  */
+#if USE_PARA_DIRTY
+    struct CO_PARA_DIRTY_T *Dirty; /*!< Dirty tracking (NULL: whole group)   */
+#endif //USE_PARA_DIRTY
 
 } CO_PARA;
 
+#if USE_PARA_ASYNC
+/*! \brief BACKGROUND PARAMETER STORE
+*
+*    This structure holds the state of a store command in the object 1010h,
+*    which is executed in the background. The parameter group in progress
+*    is copied into the staging buffer, and written to NVM in chunks.
+*/
+typedef struct CO_PARA_ASYNC_T {
+    struct CO_NODE_T    *Node;     /*!< Link to parent node                  */
+    struct CO_OBJ_T     *Obj;      /*!< Commanded entry (NULL, when idle)    */
+    struct CO_OBJ_T     *Fail;     /*!< Commanded entry of failed store      */
+    struct CO_SDO_T     *Sdo;      /*!< SDO server waiting for completion    */
+    struct CO_PARA_T    *Pg;       /*!< Parameter group in staging buffer    */
+    uint32_t             Pos;      /*!< Stored bytes of parameter group      */
+    enum CO_ERR_T        Err;      /*!< Result of the store command          */
+    int16_t              Tmr;      /*!< Timer action for store steps         */
+    uint8_t              First;    /*!< First subindex of store command      */
+    uint8_t              Last;     /*!< Last subindex of store command       */
+    uint8_t              Sub;      /*!< Next subindex to store               */
+#if USE_PARA_DIRTY
+    CO_PARA_SPAN         Span[CO_PARA_DIRTY_N]; /*!< Ranges to store         */
+    uint8_t              SpanNum;  /*!< Number of ranges to store            */
+    uint8_t              SpanIdx;  /*!< Range in progress                    */
+#endif //USE_PARA_DIRTY
+    uint8_t              Buf[CO_PARA_BUF_BYTE]; /*!< Staging buffer          */
+
+} CO_PARA_ASYNC;
+#endif //USE_PARA_ASYNC
+
 #ifdef __cplusplus               /* for compatibility with C++ environments  */
 }
 #endif
@@ -0,0 +1,562 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+#if USE_PARA_LOG
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_PARA_LOG_BANK_MARK  (uint16_t)0x4B42  /*!< bank header mark      */
+#define CO_PARA_LOG_REC_MARK   (uint16_t)0x4C50  /*!< record header mark    */
+#define CO_PARA_LOG_CHUNK      16u               /*!< copy and verify chunk */
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+/*! \brief PARAMETER LOG HEADER
+*
+*    This structure holds the decoded content of a bank or record header.
+*    In NVM, the header fields are stored in little endian byte order,
+*    followed by a CRC-16 over the header fields.
+*/
+typedef struct CO_PARA_LOG_REC_T {
+    uint16_t             Mark;     /*!< Bank or record mark                  */
+    uint16_t             Size;     /*!< Size of record data                  */
+    uint32_t             Seq;      /*!< Sequence number                      */
+    uint32_t             Key;      /*!< Parameter group identifier           */
+    uint16_t             Crc;      /*!< CRC-16 of record data                */
+
+} CO_PARA_LOG_REC;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint8_t          COParaLogGet  (CO_PARA_LOG *log, uint32_t addr, CO_PARA_LOG_REC *rec);
+static CO_ERR           COParaLogPut  (CO_PARA_LOG *log, uint32_t addr, CO_PARA_LOG_REC *rec);
+static uint16_t         COParaLogCrc  (CO_PARA_LOG *log, uint32_t addr, uint32_t size);
+static CO_ERR           COParaLogCopy (CO_PARA_LOG *log, uint32_t src, uint32_t dst, uint32_t size);
+static CO_ERR           COParaLogLoad (CO_PARA_LOG *log, uint32_t addr, uint32_t key, uint8_t *buf, uint32_t size);
+static CO_ERR           COParaLogSwap (CO_PARA_LOG *log);
+static CO_PARA_LOG_GRP *COParaLogFind (CO_PARA_LOG *log, uint32_t key, uint8_t add);
+
+/******************************************************************************
+* PUBLIC API FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void COParaLogInit(CO_PARA_LOG *log, struct CO_NODE_T *node)
+{
+    CO_PARA_LOG_REC  bank[2];
+    CO_PARA_LOG_REC  rec;
+    CO_PARA_LOG_GRP *grp;
+    uint8_t          valid[2];
+    uint32_t         addr;
+    uint32_t         end;
+    uint8_t          act;
+
+    ASSERT_PTR(log);
+
+    log->Node = node;
+    log->Num  = 0;
+    log->Seq  = 0;
+
+    /* select the valid bank with the latest generation */
+    for (act = 0; act < 2; act++) {
+        addr       = CO_PARA_LOG_START + (act * CO_PARA_LOG_BANK);
+        valid[act] = COParaLogGet(log, addr, &bank[act]);
+        if (bank[act].Mark != CO_PARA_LOG_BANK_MARK) {
+            valid[act] = 0;
+        }
+    }
+    if ((valid[0] == 0) && (valid[1] == 0)) {
+        /* empty log: the first write creates bank 0 */
+        log->Bank = CO_PARA_LOG_START + CO_PARA_LOG_BANK;
+        log->Tail = 0;
+        return;
+    }
+    act = 0;
+    if ((valid[1] != 0) &&
+        ((valid[0] == 0) || (bank[1].Seq > bank[0].Seq))) {
+        act = 1;
+    }
+    log->Bank = CO_PARA_LOG_START + (act * CO_PARA_LOG_BANK);
+    log->Seq  = bank[act].Seq;
+
+    /* walk through the record headers up to the end of the log */
+    end  = log->Bank + CO_PARA_LOG_BANK;
+    addr = log->Bank + CO_PARA_LOG_HDR;
+    while ((addr + CO_PARA_LOG_HDR) <= end) {
+        if (COParaLogGet(log, addr, &rec) == 0) {
+            break;
+        }
+        if ((rec.Mark != CO_PARA_LOG_REC_MARK) ||
+            (rec.Seq <= log->Seq)              ||
+            ((addr + CO_PARA_LOG_HDR + rec.Size) > end)) {
+            break;
+        }
+        grp = COParaLogFind(log, rec.Key, 1);
+        if (grp != NULL) {
+            grp->Prev = grp->Addr;
+            grp->Addr = addr;
+            grp->Size = rec.Size;
+            grp->Crc  = rec.Crc;
+        }
+        log->Seq = rec.Seq;
+        addr    += CO_PARA_LOG_HDR + rec.Size;
+    }
+    log->Tail = addr;
+}
+
+/*
+* see function definition
+*/
+CO_ERR COParaLogRead(CO_PARA_LOG *log, uint32_t key, uint8_t *buf, uint32_t size)
+{
+    CO_PARA_LOG_GRP *grp;
+    CO_ERR           result;
+
+    ASSERT_PTR_ERR(log, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(buf, CO_ERR_BAD_ARG);
+
+    grp = COParaLogFind(log, key, 0);
+    if ((grp == NULL) || (grp->Addr == CO_PARA_LOG_NONE)) {
+        return (CO_ERR_NONE);
+    }
+    result = COParaLogLoad(log, grp->Addr, key, buf, size);
+    if ((result != CO_ERR_NONE) && (grp->Prev != CO_PARA_LOG_NONE)) {
+        result = COParaLogLoad(log, grp->Prev, key, buf, size);
+    }
+    return (result);
+}
+
+/*
+* see function definition
+*/
+CO_ERR COParaLogWrite(CO_PARA_LOG *log, uint32_t key, uint8_t *buf, uint32_t size)
+{
+    CO_PARA_LOG_GRP *grp;
+    CO_PARA_LOG_REC  rec;
+    CO_ERR           result;
+    uint32_t         need;
+    uint32_t         bytes;
+
+    ASSERT_PTR_ERR(log, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(buf, CO_ERR_BAD_ARG);
+
+    need = CO_PARA_LOG_HDR + size;
+    if ((size > 0xFFFFu) || (need > (CO_PARA_LOG_BANK - CO_PARA_LOG_HDR))) {
+        return (CO_ERR_IF_NVM_WRITE);
+    }
+    grp = COParaLogFind(log, key, 1);
+    if (grp == NULL) {
+        return (CO_ERR_IF_NVM_WRITE);
+    }
+
+    /* compact the log into the other bank, when the active bank is full */
+    if ((log->Tail == 0) ||
+        ((log->Tail + need) > (log->Bank + CO_PARA_LOG_BANK))) {
+        result = COParaLogSwap(log);
+        if (result != CO_ERR_NONE) {
+            return (result);
+        }
+        if ((log->Tail + need) > (log->Bank + CO_PARA_LOG_BANK)) {
+            return (CO_ERR_IF_NVM_WRITE);
+        }
+    }
+
+    /* write record data before the record header */
+    bytes = COIfNvmWrite(&log->Node->If, log->Tail + CO_PARA_LOG_HDR, buf, size);
+    if (bytes != size) {
+        return (CO_ERR_IF_NVM_WRITE);
+    }
+    rec.Mark = CO_PARA_LOG_REC_MARK;
+    rec.Size = (uint16_t)size;
+    rec.Seq  = log->Seq + 1;
+    rec.Key  = key;
+    rec.Crc  = COCrc16(CO_CRC16_INIT, buf, size);
+    result   = COParaLogPut(log, log->Tail, &rec);
+    if (result != CO_ERR_NONE) {
+        return (result);
+    }
+
+    log->Seq   = rec.Seq;
+    grp->Prev  = grp->Addr;
+    grp->Addr  = log->Tail;
+    grp->Size  = rec.Size;
+    grp->Crc   = rec.Crc;
+    log->Tail += need;
+    return (CO_ERR_NONE);
+}
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief GET HEADER
+*
+*    This function reads and decodes the bank or record header at the
+*    given NVM address.
+*
+* \param log
+*    Ptr to parameter log
+*
+* \param addr
+*    NVM address of header
+*
+* \param rec
+*    Ptr to decoded header
+*
+* \retval  >0    header is valid
+* \retval  =0    header is not readable or corrupted
+*/
+static uint8_t COParaLogGet(CO_PARA_LOG *log, uint32_t addr, CO_PARA_LOG_REC *rec)
+{
+    uint8_t  hdr[CO_PARA_LOG_HDR];
+    uint32_t bytes;
+    uint16_t crc;
+
+    rec->Mark = 0;
+    bytes = COIfNvmRead(&log->Node->If, addr, hdr, CO_PARA_LOG_HDR);
+    if (bytes != CO_PARA_LOG_HDR) {
+        return (0);
+    }
+    crc = (uint16_t)hdr[14] | ((uint16_t)hdr[15] << 8);
+    if (COCrc16(CO_CRC16_INIT, hdr, 14) != crc) {
+        return (0);
+    }
+    rec->Mark = (uint16_t)hdr[0] | ((uint16_t)hdr[1] << 8);
+    rec->Size = (uint16_t)hdr[2] | ((uint16_t)hdr[3] << 8);
+    rec->Seq  = (uint32_t)hdr[4]         | ((uint32_t)hdr[5] << 8) |
+                ((uint32_t)hdr[6] << 16) | ((uint32_t)hdr[7] << 24);
+    rec->Key  = (uint32_t)hdr[8]          | ((uint32_t)hdr[9] << 8) |
+                ((uint32_t)hdr[10] << 16) | ((uint32_t)hdr[11] << 24);
+    rec->Crc  = (uint16_t)hdr[12] | ((uint16_t)hdr[13] << 8);
+    return (1);
+}
+
+/*! \brief PUT HEADER
+*
+*    This function encodes and writes the bank or record header to the
+*    given NVM address.
+*
+* \param log
+*    Ptr to parameter log
+*
+* \param addr
+*    NVM address of header
+*
+* \param rec
+*    Ptr to header content
+*
+* \retval  ==CO_ERR_NONE          header written
+* \retval  ==CO_ERR_IF_NVM_WRITE  error during writing NVM
+*/
+static CO_ERR COParaLogPut(CO_PARA_LOG *log, uint32_t addr, CO_PARA_LOG_REC *rec)
+{
+    uint8_t  hdr[CO_PARA_LOG_HDR];
+    uint32_t bytes;
+    uint16_t crc;
+
+    hdr[0]  = (uint8_t)(rec->Mark);
+    hdr[1]  = (uint8_t)(rec->Mark >> 8);
+    hdr[2]  = (uint8_t)(rec->Size);
+    hdr[3]  = (uint8_t)(rec->Size >> 8);
+    hdr[4]  = (uint8_t)(rec->Seq);
+    hdr[5]  = (uint8_t)(rec->Seq >> 8);
+    hdr[6]  = (uint8_t)(rec->Seq >> 16);
+    hdr[7]  = (uint8_t)(rec->Seq >> 24);
+    hdr[8]  = (uint8_t)(rec->Key);
+    hdr[9]  = (uint8_t)(rec->Key >> 8);
+    hdr[10] = (uint8_t)(rec->Key >> 16);
+    hdr[11] = (uint8_t)(rec->Key >> 24);
+    hdr[12] = (uint8_t)(rec->Crc);
+    hdr[13] = (uint8_t)(rec->Crc >> 8);
+    crc     = COCrc16(CO_CRC16_INIT, hdr, 14);
+    hdr[14] = (uint8_t)(crc);
+    hdr[15] = (uint8_t)(crc >> 8);
+
+    bytes = COIfNvmWrite(&log->Node->If, addr, hdr, CO_PARA_LOG_HDR);
+    if (bytes != CO_PARA_LOG_HDR) {
+        return (CO_ERR_IF_NVM_WRITE);
+    }
+    return (CO_ERR_NONE);
+}
+
+/*! \brief CALCULATE RECORD CRC
+*
+*    This function calculates the CRC-16 of the record data in NVM.
+*
+* \param log
+*    Ptr to parameter log
+*
+* \param addr
+*    NVM address of record data
+*
+* \param size
+*    Size of record data
+*
+* \return
+*    CRC-16 of record data
+*/
+static uint16_t COParaLogCrc(CO_PARA_LOG *log, uint32_t addr, uint32_t size)
+{
+    uint8_t  chunk[CO_PARA_LOG_CHUNK];
+    uint16_t crc = CO_CRC16_INIT;
+    uint32_t num;
+
+    while (size > 0) {
+        num = (size > CO_PARA_LOG_CHUNK) ? CO_PARA_LOG_CHUNK : size;
+        if (COIfNvmRead(&log->Node->If, addr, chunk, num) != num) {
+            /* force a CRC mismatch in the caller */
+            return ((uint16_t)~crc);
+        }
+        crc   = COCrc16(crc, chunk, num);
+        addr += num;
+        size -= num;
+    }
+    return (crc);
+}
+
+/*! \brief COPY RECORD DATA
+*
+*    This function copies record data within the NVM.
+*
+* \param log
+*    Ptr to parameter log
+*
+* \param src
+*    NVM source address
+*
+* \param dst
+*    NVM destination address
+*
+* \param size
+*    Size of record data
+*
+* \retval  ==CO_ERR_NONE          data copied
+* \retval  !=CO_ERR_NONE          error during reading or writing NVM
+*/
+static CO_ERR COParaLogCopy(CO_PARA_LOG *log, uint32_t src, uint32_t dst, uint32_t size)
+{
+    uint8_t  chunk[CO_PARA_LOG_CHUNK];
+    uint32_t num;
+
+    while (size > 0) {
+        num = (size > CO_PARA_LOG_CHUNK) ? CO_PARA_LOG_CHUNK : size;
+        if (COIfNvmRead(&log->Node->If, src, chunk, num) != num) {
+            return (CO_ERR_IF_NVM_READ);
+        }
+        if (COIfNvmWrite(&log->Node->If, dst, chunk, num) != num) {
+            return (CO_ERR_IF_NVM_WRITE);
+        }
+        src  += num;
+        dst  += num;
+        size -= num;
+    }
+    return (CO_ERR_NONE);
+}
+
+/*! \brief LOAD RECORD
+*
+*    This function verifies the record at the given NVM address and
+*    reads the record data into the given buffer. The buffer is changed
+*    only, when the record is valid.
+*
+* \param log
+*    Ptr to parameter log
+*
+* \param addr
+*    NVM address of record
+*
+* \param key
+*    Expected parameter group identifier
+*
+* \param buf
+*    Ptr to destination buffer
+*
+* \param size
+*    Expected size of record data
+*
+* \retval  ==CO_ERR_NONE         record loaded
+* \retval  ==CO_ERR_IF_NVM_READ  record is not valid
+*/
+static CO_ERR COParaLogLoad(CO_PARA_LOG *log, uint32_t addr, uint32_t key, uint8_t *buf, uint32_t size)
+{
+    CO_PARA_LOG_REC rec;
+    uint32_t        bytes;
+
+    if (COParaLogGet(log, addr, &rec) == 0) {
+        return (CO_ERR_IF_NVM_READ);
+    }
+    if ((rec.Key != key) || (rec.Size != size)) {
+        return (CO_ERR_IF_NVM_READ);
+    }
+    if (COParaLogCrc(log, addr + CO_PARA_LOG_HDR, size) != rec.Crc) {
+        return (CO_ERR_IF_NVM_READ);
+    }
+    bytes = COIfNvmRead(&log->Node->If, addr + CO_PARA_LOG_HDR, buf, size);
+    if (bytes != size) {
+        return (CO_ERR_IF_NVM_READ);
+    }
+    return (CO_ERR_NONE);
+}
+
+/*! \brief SWAP BANK
+*
+*    This function copies the latest record of each parameter group into
+*    the other bank. The bank header is written as the last step, so an
+*    interrupted compaction leaves the current bank active.
+*
+* \param log
+*    Ptr to parameter log
+*
+* \retval  ==CO_ERR_NONE          other bank is active
+* \retval  !=CO_ERR_NONE          error during compaction
+*/
+static CO_ERR COParaLogSwap(CO_PARA_LOG *log)
+{
+    CO_PARA_LOG_GRP *grp;
+    CO_PARA_LOG_REC  rec;
+    CO_ERR           result;
+    uint32_t         dst;
+    uint32_t         pos;
+    uint32_t         gen;
+    uint32_t         seq;
+    uint8_t          n;
+
+    dst = CO_PARA_LOG_START;
+    if (log->Bank == CO_PARA_LOG_START) {
+        dst += CO_PARA_LOG_BANK;
+    }
+
+    /* invalidate the bank header of the target bank */
+    rec.Mark = 0;
+    rec.Size = 0;
+    rec.Seq  = 0;
+    rec.Key  = 0;
+    rec.Crc  = 0;
+    result   = COParaLogPut(log, dst, &rec);
+    if (result != CO_ERR_NONE) {
+        return (result);
+    }
+
+    gen = log->Seq + 1;
+    seq = gen;
+    pos = dst + CO_PARA_LOG_HDR;
+    for (n = 0; n < log->Num; n++) {
+        grp = &log->Grp[n];
+        if (grp->Addr == CO_PARA_LOG_NONE) {
+            continue;
+        }
+        if ((pos + CO_PARA_LOG_HDR + grp->Size) > (dst + CO_PARA_LOG_BANK)) {
+            return (CO_ERR_IF_NVM_WRITE);
+        }
+        result = COParaLogCopy(log, grp->Addr + CO_PARA_LOG_HDR, pos + CO_PARA_LOG_HDR, grp->Size);
+        if (result != CO_ERR_NONE) {
+            return (result);
+        }
+        seq++;
+        rec.Mark = CO_PARA_LOG_REC_MARK;
+        rec.Size = grp->Size;
+        rec.Seq  = seq;
+        rec.Key  = grp->Key;
+        rec.Crc  = grp->Crc;
+        result   = COParaLogPut(log, pos, &rec);
+        if (result != CO_ERR_NONE) {
+            return (result);
+        }
+        pos += CO_PARA_LOG_HDR + grp->Size;
+    }
+
+    /* activate the target bank */
+    rec.Mark = CO_PARA_LOG_BANK_MARK;
+    rec.Size = 0;
+    rec.Seq  = gen;
+    rec.Key  = 0;
+    rec.Crc  = 0;
+    result   = COParaLogPut(log, dst, &rec);
+    if (result != CO_ERR_NONE) {
+        return (result);
+    }
+
+    /* relocate the index into the target bank */
+    pos = dst + CO_PARA_LOG_HDR;
+    for (n = 0; n < log->Num; n++) {
+        grp = &log->Grp[n];
+        if (grp->Addr == CO_PARA_LOG_NONE) {
+            continue;
+        }
+        grp->Addr = pos;
+        grp->Prev = CO_PARA_LOG_NONE;
+        pos      += CO_PARA_LOG_HDR + grp->Size;
+    }
+    log->Bank = dst;
+    log->Tail = pos;
+    log->Seq  = seq;
+    return (CO_ERR_NONE);
+}
+
+/*! \brief FIND GROUP ENTRY
+*
+*    This function searches the RAM index for the given parameter group.
+*
+* \param log
+*    Ptr to parameter log
+*
+* \param key
+*    Parameter group identifier
+*
+* \param add
+*    Add a new entry, when the parameter group is not found (>0)
+*
+* \return
+*    Ptr to group entry, or NULL if not found or index is full
+*/
+static CO_PARA_LOG_GRP *COParaLogFind(CO_PARA_LOG *log, uint32_t key, uint8_t add)
+{
+    CO_PARA_LOG_GRP *grp;
+    uint8_t          n;
+
+    for (n = 0; n < log->Num; n++) {
+        if (log->Grp[n].Key == key) {
+            return (&log->Grp[n]);
+        }
+    }
+    if ((add == 0) || (log->Num >= CO_PARA_LOG_N)) {
+        return (NULL);
+    }
+    grp       = &log->Grp[log->Num];
+    grp->Key  = key;
+    grp->Addr = CO_PARA_LOG_NONE;
+    grp->Prev = CO_PARA_LOG_NONE;
+    grp->Size = 0;
+    grp->Crc  = 0;
+    log->Num++;
+    return (grp);
+}
+
+#endif //USE_PARA_LOG
@@ -0,0 +1,148 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_PARA_LOG_H_
+#define CO_PARA_LOG_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_cfg.h"
+#include "co_err.h"
+
+#if USE_PARA_LOG
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_PARA_LOG_HDR   16u          /*!< size of record header in NVM    */
+#define CO_PARA_LOG_NONE  0xFFFFFFFFu  /*!< no record address               */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief PARAMETER LOG GROUP
+*
+*    This structure holds the location of the latest and the previous
+*    record of a single parameter group within the active bank.
+*/
+typedef struct CO_PARA_LOG_GRP_T {
+    uint32_t             Key;      /*!< Parameter group identifier           */
+    uint32_t             Addr;     /*!< NVM address of latest record         */
+    uint32_t             Prev;     /*!< NVM address of previous record       */
+    uint16_t             Size;     /*!< Size of latest record data           */
+    uint16_t             Crc;      /*!< CRC-16 of latest record data         */
+
+} CO_PARA_LOG_GRP;
+
+/*! \brief PARAMETER LOG
+*
+*    This structure holds the RAM index of the parameter log. The log is
+*    organized in two banks. Records are appended to the active bank;
+*    when the active bank is full, the latest records are copied into the
+*    other bank, which becomes active when its bank header is written.
+*/
+typedef struct CO_PARA_LOG_T {
+    struct CO_NODE_T    *Node;     /*!< Link to parent node                  */
+    uint32_t             Bank;     /*!< Start address of active bank         */
+    uint32_t             Tail;     /*!< Next free address (0: no bank)       */
+    uint32_t             Seq;      /*!< Last used sequence number            */
+    uint8_t              Num;      /*!< Number of used group entries         */
+    CO_PARA_LOG_GRP      Grp[CO_PARA_LOG_N]; /*!< Group index              */
+
+} CO_PARA_LOG;
+
+/******************************************************************************
+* PUBLIC API FUNCTIONS
+******************************************************************************/
+
+/*! \brief INIT PARAMETER LOG
+*
+*    This function selects the active bank and builds the RAM index of
+*    the parameter log. Only the record headers of the active bank are
+*    read; the scan stops at the first record with an invalid header or
+*    a non-increasing sequence number, which marks the end of the log.
+*
+* \param log
+*    Ptr to parameter log
+*
+* \param node
+*    Ptr to parent node
+*/
+void COParaLogInit(CO_PARA_LOG *log, struct CO_NODE_T *node);
+
+/*! \brief READ PARAMETER GROUP
+*
+*    This function reads the latest valid record of the given parameter
+*    group into the given buffer. When the data of the latest record is
+*    corrupted, the previous record is used. The buffer is not changed,
+*    when the parameter group is not stored in the log.
+*
+* \param log
+*    Ptr to parameter log
+*
+* \param key
+*    Parameter group identifier
+*
+* \param buf
+*    Ptr to destination buffer
+*
+* \param size
+*    Size of parameter group in bytes
+*
+* \retval  ==CO_ERR_NONE         parameter group loaded or not stored
+* \retval  ==CO_ERR_IF_NVM_READ  no valid record found
+*/
+CO_ERR COParaLogRead(CO_PARA_LOG *log, uint32_t key, uint8_t *buf, uint32_t size);
+
+/*! \brief WRITE PARAMETER GROUP
+*
+*    This function appends a new record of the given parameter group to
+*    the log. The record data is written before the record header, so an
+*    interrupted write leaves the previous record as the latest record.
+*
+* \param log
+*    Ptr to parameter log
+*
+* \param key
+*    Parameter group identifier
+*
+* \param buf
+*    Ptr to source buffer
+*
+* \param size
+*    Size of parameter group in bytes
+*
+* \retval  ==CO_ERR_NONE          parameter group stored
+* \retval  ==CO_ERR_IF_NVM_WRITE  parameter group not stored
+*/
+CO_ERR COParaLogWrite(CO_PARA_LOG *log, uint32_t key, uint8_t *buf, uint32_t size);
+
+#endif //USE_PARA_LOG
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif  /* #ifndef CO_PARA_LOG_H_ */
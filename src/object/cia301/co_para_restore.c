@@ -43,7 +43,7 @@ static CO_ERR   COTParaRestoreInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTParaRestore = { COTParaRestoreSize, COTParaRestoreInit, COTParaRestoreRead, COTParaRestoreWrite, 0 };
+const CO_OBJ_TYPE COTParaRestore = { COTParaRestoreSize, COTParaRestoreInit, COTParaRestoreRead, COTParaRestoreWrite, 0, 0 };
 
 /******************************************************************************
 * PRIVATE TYPE FUNCTIONS
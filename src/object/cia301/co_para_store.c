@@ -18,6 +18,8 @@
 * INCLUDES
 ******************************************************************************/
 
+#include <string.h>
+
 #include "co_core.h"
 #include "co_para_store.h"
 
@@ -40,11 +42,24 @@ static CO_ERR   COTParaStoreWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node,
 static CO_ERR   COTParaStoreInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
 static CO_ERR   COTParaStoreReset(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t para);
 
+#if (USE_PARA_LOG == 0) && USE_PARA_DIRTY
+/* dirty tracking */
+static uint8_t  COParaDirtyTake  (CO_PARA *pg, CO_PARA_SPAN *span);
+#endif
+
+#if USE_PARA_ASYNC
+/* background store */
+static CO_ERR   COParaAsyncStart (CO_PARA_ASYNC *pa, struct CO_OBJ_T *obj, uint8_t first, uint8_t last);
+static void     COParaAsyncStep  (void *parg);
+static void     COParaAsyncDrain (CO_PARA_ASYNC *pa, uint32_t max);
+static void     COParaAsyncFinish(CO_PARA_ASYNC *pa);
+#endif //USE_PARA_ASYNC
+
 /******************************************************************************
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTParaStore = { COTParaStoreSize, COTParaStoreInit, COTParaStoreRead, COTParaStoreWrite, COTParaStoreReset };
+const CO_OBJ_TYPE COTParaStore = { COTParaStoreSize, COTParaStoreInit, COTParaStoreRead, COTParaStoreWrite, COTParaStoreReset, 0 };
 
 /******************************************************************************
 * PRIVATE TYPE FUNCTIONS
@@ -77,6 +92,18 @@ static CO_ERR COTParaStoreRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, voi
     } else {
         pg = (CO_PARA *)(obj->Data);
         *(uint32_t *)buffer = pg->Value;
+#if USE_PARA_ASYNC
+        if (node->ParaAsync.Obj != NULL) {
+            if ((obj == node->ParaAsync.Obj) ||
+                ((CO_GET_SUB(obj->Key) >= node->ParaAsync.First) &&
+                 (CO_GET_SUB(obj->Key) <= node->ParaAsync.Last))) {
+                *(uint32_t *)buffer |= CO_PARA_BUSY;
+            }
+        }
+        if (obj == node->ParaAsync.Fail) {
+            *(uint32_t *)buffer |= CO_PARA_FAIL;
+        }
+#endif //USE_PARA_ASYNC
         result = CO_ERR_NONE;
     }
     return (result);
@@ -87,8 +114,10 @@ static CO_ERR COTParaStoreWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, vo
     const CO_OBJ_TYPE *uint8 = CO_TUNSIGNED8;
     CO_ERR    result = CO_ERR_TYPE_WR;
     CO_DICT  *cod;
+#if USE_PARA_ASYNC == 0
     CO_OBJ   *pwo;
     CO_PARA  *pg;
+#endif
     uint32_t  value;
     uint8_t   num;
     uint8_t   sub;
@@ -110,6 +139,15 @@ static CO_ERR COTParaStoreWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, vo
         (void)CODictRdByte(cod, CO_DEV(COT_OBJECT, 0), &num);
 
         sub = CO_GET_SUB(obj->Key);
+#if USE_PARA_ASYNC
+        if ((sub == 1) && (num > 1)) {
+            /* store all parameter groups 2..N in background */
+            result = COParaAsyncStart(&node->ParaAsync, obj, 2, num);
+        } else {
+            /* store single parameter group in background */
+            result = COParaAsyncStart(&node->ParaAsync, obj, sub, sub);
+        }
+#else
         if ((sub == 1) && (num > 1)) {
 
             /* store all parameter groups 2..N */
@@ -129,6 +167,7 @@ static CO_ERR COTParaStoreWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, vo
             pg = (CO_PARA *)(obj->Data);
             result = COParaStore(pg, node);
         }
+#endif //USE_PARA_ASYNC
     }
     return (result);
 }
@@ -209,12 +248,40 @@ CO_ERR CONodeParaLoad(struct CO_NODE_T *node, enum CO_NMT_RESET_T type)
 
             /* check parameter group type */
             pg = (CO_PARA *)(obj->Data);
+#if USE_PARA_DIRTY
+            if (pg->Dirty != NULL) {
+                /* extend the memory area of dirty tracked parameter groups */
+                if ((node->ParaArea.Lo == NULL) || (pg->Start < node->ParaArea.Lo)) {
+                    node->ParaArea.Lo = pg->Start;
+                }
+                if ((node->ParaArea.Hi == NULL) || (&pg->Start[pg->Size] > node->ParaArea.Hi)) {
+                    node->ParaArea.Hi = &pg->Start[pg->Size];
+                }
+            }
+#endif //USE_PARA_DIRTY
             if (pg->Type == type) {
+#if USE_PARA_LOG
+                bytes = pg->Size;
+                if (COParaLogRead(&node->ParaLog, pg->Offset, pg->Start, pg->Size) != CO_ERR_NONE) {
+                    bytes = 0;
+                }
+#else
                 bytes = COIfNvmRead(&node->If, pg->Offset, pg->Start, pg->Size);
+#endif //USE_PARA_LOG
                 if (bytes != pg->Size) {
                     node->Error = CO_ERR_IF_NVM_READ;
                     result      = CO_ERR_IF_NVM_READ;
                 }
+#if USE_PARA_DIRTY
+                if (pg->Dirty != NULL) {
+                    /* the loaded parameters match the NVM content */
+                    pg->Dirty->Valid = 0;
+                    if (bytes == pg->Size) {
+                        pg->Dirty->Valid = 1;
+                    }
+                    pg->Dirty->Num = 0;
+                }
+#endif //USE_PARA_DIRTY
             }
         }
     }
@@ -229,17 +296,482 @@ WEAK_TEST
 CO_ERR COParaStore(struct CO_PARA_T *pg, struct CO_NODE_T *node)
 {
     CO_ERR   result = CO_ERR_NONE;
+#if USE_PARA_LOG == 0
     uint32_t bytes;
+#endif
+#if (USE_PARA_LOG == 0) && USE_PARA_DIRTY
+    CO_PARA_SPAN span[CO_PARA_DIRTY_N];
+    uint32_t     size;
+    uint8_t      num;
+    uint8_t      n;
+#endif
 
     ASSERT_PTR_ERR(pg, CO_ERR_BAD_ARG);
     ASSERT_PTR_ERR(node, CO_ERR_BAD_ARG);
 
     /* call nvm write driver function */
     if ((pg->Value & CO_PARA___E) != 0) {
+#if USE_PARA_LOG
+        result = COParaLogWrite(&node->ParaLog, pg->Offset, pg->Start, pg->Size);
+#elif USE_PARA_DIRTY
+        /* write the changed ranges only */
+        num = COParaDirtyTake(pg, span);
+        for (n = 0; n < num; n++) {
+            size  = span[n].End - span[n].Start;
+            bytes = COIfNvmWrite(&node->If, pg->Offset + span[n].Start, &pg->Start[span[n].Start], size);
+            if (bytes != size) {
+                if (pg->Dirty != NULL) {
+                    pg->Dirty->Valid = 0;
+                }
+                result = CO_ERR_IF_NVM_WRITE;
+                break;
+            }
+        }
+#else
         bytes = COIfNvmWrite(&node->If, pg->Offset, pg->Start, pg->Size);
         if (bytes != pg->Size) {
             result = CO_ERR_IF_NVM_WRITE;
         }
+#endif //USE_PARA_LOG
     }
     return (result);
 }
+
+#if USE_PARA_DIRTY
+
+/*
+* see function definition
+*/
+void COParaDirtyMark(CO_PARA *pg, uint32_t offset, uint32_t size)
+{
+    CO_PARA_DIRTY *dirty;
+    CO_PARA_SPAN   span[CO_PARA_DIRTY_N + 1];
+    uint32_t       start;
+    uint32_t       end;
+    uint32_t       gap;
+    uint8_t        num = 0;
+    uint8_t        best;
+    uint8_t        n;
+
+    ASSERT_PTR(pg);
+
+    dirty = pg->Dirty;
+    if ((dirty == NULL) || (dirty->Valid == 0) ||
+        (size == 0) || (offset >= pg->Size)) {
+        return;
+    }
+    start = offset;
+    end   = pg->Size;
+    if (size < (pg->Size - offset)) {
+        end = offset + size;
+    }
+
+    /* merge the new range with all overlapping or adjacent ranges */
+    for (n = 0; n < dirty->Num; n++) {
+        if (dirty->Span[n].End < start) {
+            span[num] = dirty->Span[n];
+            num++;
+        } else if (dirty->Span[n].Start > end) {
+            break;
+        } else {
+            if (dirty->Span[n].Start < start) {
+                start = dirty->Span[n].Start;
+            }
+            if (dirty->Span[n].End > end) {
+                end = dirty->Span[n].End;
+            }
+        }
+    }
+    span[num].Start = start;
+    span[num].End   = end;
+    num++;
+    for (; n < dirty->Num; n++) {
+        span[num] = dirty->Span[n];
+        num++;
+    }
+
+    /* too many ranges: merge the two ranges with the smallest gap */
+    if (num > CO_PARA_DIRTY_N) {
+        best = 0;
+        gap  = span[1].Start - span[0].End;
+        for (n = 1; n < (num - 1); n++) {
+            if ((span[n + 1].Start - span[n].End) < gap) {
+                gap  = span[n + 1].Start - span[n].End;
+                best = n;
+            }
+        }
+        span[best].End = span[best + 1].End;
+        for (n = best + 1; n < (num - 1); n++) {
+            span[n] = span[n + 1];
+        }
+        num--;
+    }
+    (void)memcpy(dirty->Span, span, num * sizeof(CO_PARA_SPAN));
+    dirty->Num = num;
+}
+
+/*
+* see function definition
+*/
+void COParaDirtyObj(struct CO_NODE_T *node, struct CO_OBJ_T *obj)
+{
+    CO_DICT  *cod;
+    CO_OBJ   *pwo;
+    CO_PARA  *pg;
+    uint8_t  *mem;
+    uint8_t  *lo;
+    uint8_t  *hi;
+    uint32_t  size;
+    uint8_t   num = 0;
+    uint8_t   sub;
+
+    ASSERT_PTR(node);
+    ASSERT_PTR(obj);
+
+    if ((node->ParaArea.Hi == NULL) || (CO_IS_DIRECT(obj->Key) != 0)) {
+        return;
+    }
+
+    /* get the memory of the written object entry */
+    mem = COObjRegion(obj, node, 0, &size);
+    if (mem == NULL) {
+        mem  = (uint8_t *)(obj->Data);
+        size = COObjGetSize(obj, node, 0);
+    }
+    if ((mem == NULL) || (size == 0) ||
+        (mem >= node->ParaArea.Hi) || (&mem[size] <= node->ParaArea.Lo)) {
+        return;
+    }
+
+    cod = &node->Dict;
+    pwo = CODictFind(cod, CO_DEV(COT_OBJECT, 0));
+    if ((pwo == NULL) || (COObjRdValue(pwo, node, &num, 1) != CO_ERR_NONE)) {
+        return;
+    }
+    for (sub = 1; sub <= num; sub++) {
+        pwo = CODictFind(cod, CO_DEV(COT_OBJECT, sub));
+        if (pwo == NULL) {
+            continue;
+        }
+        pg = (CO_PARA *)(pwo->Data);
+        if ((pg->Dirty == NULL) ||
+            (mem >= &pg->Start[pg->Size]) || (&mem[size] <= pg->Start)) {
+            continue;
+        }
+
+        /* mark the part of the object entry within the parameter group */
+        lo = mem;
+        if (lo < pg->Start) {
+            lo = pg->Start;
+        }
+        hi = &mem[size];
+        if (hi > &pg->Start[pg->Size]) {
+            hi = &pg->Start[pg->Size];
+        }
+        COParaDirtyMark(pg, (uint32_t)(lo - pg->Start), (uint32_t)(hi - lo));
+    }
+}
+
+#endif //USE_PARA_DIRTY
+
+#if USE_PARA_ASYNC
+
+/*
+* see function definition
+*/
+void COParaAsyncInit(CO_PARA_ASYNC *pa, struct CO_NODE_T *node)
+{
+    ASSERT_PTR(pa);
+
+    pa->Node  = node;
+    pa->Obj   = NULL;
+    pa->Fail  = NULL;
+    pa->Sdo   = NULL;
+    pa->Pg    = NULL;
+    pa->Pos   = 0;
+    pa->Err   = CO_ERR_NONE;
+    pa->Tmr   = -1;
+    pa->First = 0;
+    pa->Last  = 0;
+    pa->Sub   = 0;
+}
+
+/*
+* see function definition
+*/
+void COParaAsyncFlush(CO_PARA_ASYNC *pa)
+{
+    ASSERT_PTR(pa);
+
+    while (pa->Obj != NULL) {
+        COParaAsyncDrain(pa, pa->Pg != NULL ? pa->Pg->Size : CO_PARA_CHUNK);
+    }
+}
+
+#endif //USE_PARA_ASYNC
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+#if (USE_PARA_LOG == 0) && USE_PARA_DIRTY
+/*! \brief TAKE RANGES TO STORE
+*
+*    This function returns the ranges of the given parameter group, which
+*    must be written to NVM, and clears the changed ranges. The whole
+*    parameter group is returned, when the NVM content is unknown.
+*
+* \param pg
+*    Ptr to parameter group info
+*
+* \param span
+*    Ptr to range array with CO_PARA_DIRTY_N elements
+*
+* \retval  the number of ranges in the range array
+*/
+static uint8_t COParaDirtyTake(CO_PARA *pg, CO_PARA_SPAN *span)
+{
+    CO_PARA_DIRTY *dirty = pg->Dirty;
+    uint8_t        num;
+
+    if ((dirty == NULL) || (dirty->Valid == 0)) {
+        /* unknown NVM content: store the whole parameter group */
+        span[0].Start = 0;
+        span[0].End   = pg->Size;
+        num           = 1;
+    } else {
+        num = dirty->Num;
+        (void)memcpy(span, dirty->Span, num * sizeof(CO_PARA_SPAN));
+    }
+    if (dirty != NULL) {
+        dirty->Valid = 1;
+        dirty->Num   = 0;
+    }
+    return (num);
+}
+#endif
+
+#if USE_PARA_ASYNC
+
+/*! \brief START BACKGROUND STORE
+*
+*    This function starts the background store of the parameter groups
+*    within the given range of subindices. A store command, which is
+*    received via an SDO server, is answered after the store is finished.
+*
+* \param pa
+*    Ptr to background parameter store
+*
+* \param obj
+*    Ptr to commanded object entry
+*
+* \param first
+*    First subindex of parameter groups
+*
+* \param last
+*    Last subindex of parameter groups
+*
+* \retval  ==CO_ERR_NONE         store started
+* \retval  ==CO_ERR_OBJ_PENDING  store started, SDO response is held
+* \retval  !=CO_ERR_NONE         store is not possible
+*/
+static CO_ERR COParaAsyncStart(CO_PARA_ASYNC *pa, struct CO_OBJ_T *obj, uint8_t first, uint8_t last)
+{
+    CO_NODE  *node = pa->Node;
+    CO_ERR    result = CO_ERR_NONE;
+    uint32_t  ticks;
+    uint8_t   n;
+
+    if (pa->Obj != NULL) {
+        COObjTypeUserSDOAbort(obj, node, CO_SDO_ERR_TOS_STATE);
+        return (CO_ERR_OBJ_ACC);
+    }
+
+    ticks = COTmrGetTicks(&node->Tmr, CO_PARA_CYCLE, CO_TMR_UNIT_1MS);
+    if (ticks == 0) {
+        ticks = 1;
+    }
+    pa->Tmr = COTmrCreate(&node->Tmr, ticks, ticks, COParaAsyncStep, pa);
+    if (pa->Tmr < 0) {
+        return (CO_ERR_TMR_CREATE);
+    }
+
+    pa->Obj   = obj;
+    pa->Fail  = NULL;
+    pa->Sdo   = NULL;
+    pa->Pg    = NULL;
+    pa->Pos   = 0;
+    pa->Err   = CO_ERR_NONE;
+    pa->First = first;
+    pa->Last  = last;
+    pa->Sub   = first;
+
+    /* hold the response of a store command via SDO */
+    for (n = 0; n < CO_SSDO_N; n++) {
+        if (node->Sdo[n].Obj == obj) {
+            pa->Sdo = &node->Sdo[n];
+            result  = CO_ERR_OBJ_PENDING;
+            break;
+        }
+    }
+    return (result);
+}
+
+/*! \brief BACKGROUND STORE STEP
+*
+*    This timer callback function writes the next chunk of the active
+*    store command to NVM.
+*
+* \param parg
+*    Ptr to background parameter store
+*/
+static void COParaAsyncStep(void *parg)
+{
+    CO_PARA_ASYNC *pa = (CO_PARA_ASYNC *)parg;
+
+    COParaAsyncDrain(pa, CO_PARA_CHUNK);
+}
+
+/*! \brief DRAIN STAGING BUFFER
+*
+*    This function writes up to the given number of bytes of the active
+*    store command to NVM. The next parameter group is copied into the
+*    staging buffer, when the previous group is completely written.
+*
+* \param pa
+*    Ptr to background parameter store
+*
+* \param max
+*    Maximal number of bytes to write
+*/
+static void COParaAsyncDrain(CO_PARA_ASYNC *pa, uint32_t max)
+{
+    CO_NODE  *node = pa->Node;
+    CO_OBJ   *pwo;
+    CO_PARA  *pg;
+#if USE_PARA_LOG == 0
+    uint32_t  end;
+    uint32_t  num;
+    uint32_t  bytes;
+#endif
+
+    while ((pa->Obj != NULL) && (max > 0)) {
+        if (pa->Pg == NULL) {
+            if (pa->Sub > pa->Last) {
+                COParaAsyncFinish(pa);
+                break;
+            }
+            pwo = CODictFind(&node->Dict, CO_DEV(COT_OBJECT, pa->Sub));
+            pa->Sub++;
+            if (pwo == NULL) {
+                continue;
+            }
+            pg = (CO_PARA *)(pwo->Data);
+            if ((pg->Value & CO_PARA___E) == 0) {
+                continue;
+            }
+            if (pg->Size > CO_PARA_BUF_BYTE) {
+                /* too large for staging buffer: store within this step */
+                pa->Err = COParaStore(pg, node);
+                if (pa->Err != CO_ERR_NONE) {
+                    COParaAsyncFinish(pa);
+                }
+                break;
+            }
+
+            /* copy-on-write snapshot of parameter group */
+            (void)memcpy(pa->Buf, pg->Start, pg->Size);
+            pa->Pg  = pg;
+            pa->Pos = 0;
+#if (USE_PARA_LOG == 0) && USE_PARA_DIRTY
+            pa->SpanNum = COParaDirtyTake(pg, pa->Span);
+            pa->SpanIdx = 0;
+            if (pa->SpanNum == 0) {
+                /* nothing changed since last store */
+                pa->Pg = NULL;
+                continue;
+            }
+            pa->Pos = pa->Span[0].Start;
+#endif
+        }
+
+#if USE_PARA_LOG
+        /* a log record is appended as a whole within a single step */
+        pa->Err = COParaLogWrite(&node->ParaLog, pa->Pg->Offset, pa->Buf, pa->Pg->Size);
+        pa->Pg  = NULL;
+        if (pa->Err != CO_ERR_NONE) {
+            COParaAsyncFinish(pa);
+        }
+        break;
+#else
+
+        pg  = pa->Pg;
+#if USE_PARA_DIRTY
+        end = pa->Span[pa->SpanIdx].End;
+#else
+        end = pg->Size;
+#endif //USE_PARA_DIRTY
+        num = end - pa->Pos;
+        if (num > max) {
+            num = max;
+        }
+        bytes = COIfNvmWrite(&node->If, pg->Offset + pa->Pos, &pa->Buf[pa->Pos], num);
+        if (bytes != num) {
+#if USE_PARA_DIRTY
+            if (pg->Dirty != NULL) {
+                pg->Dirty->Valid = 0;
+            }
+#endif //USE_PARA_DIRTY
+            pa->Err = CO_ERR_IF_NVM_WRITE;
+            COParaAsyncFinish(pa);
+            break;
+        }
+        pa->Pos += num;
+        max     -= num;
+        if (pa->Pos >= end) {
+            pa->Pg = NULL;
+#if USE_PARA_DIRTY
+            pa->SpanIdx++;
+            if (pa->SpanIdx < pa->SpanNum) {
+                /* continue with the next changed range */
+                pa->Pg  = pg;
+                pa->Pos = pa->Span[pa->SpanIdx].Start;
+            }
+#endif //USE_PARA_DIRTY
+        }
+#endif //USE_PARA_LOG
+    }
+}
+
+/*! \brief FINISH BACKGROUND STORE
+*
+*    This function stops the background store and reports the result to
+*    the application and the waiting SDO server.
+*
+* \param pa
+*    Ptr to background parameter store
+*/
+static void COParaAsyncFinish(CO_PARA_ASYNC *pa)
+{
+    CO_OBJ *obj = pa->Obj;
+    CO_SDO *srv = pa->Sdo;
+
+    if (pa->Tmr >= 0) {
+        (void)COTmrDelete(&pa->Node->Tmr, pa->Tmr);
+        pa->Tmr = -1;
+    }
+    pa->Obj = NULL;
+    pa->Sdo = NULL;
+    pa->Pg  = NULL;
+    if (pa->Err != CO_ERR_NONE) {
+        pa->Fail = obj;
+    }
+
+    CO_CB_PARA_STORE_DONE(pa->Node, (CO_PARA *)(obj->Data), pa->Err);
+    if ((srv != NULL) && (srv->Pend != 0) && (srv->Obj == obj)) {
+        /* the SDO server is still waiting for this store command */
+        (void)COSdoComplete(srv, pa->Err);
+    }
+}
+
+#endif //USE_PARA_ASYNC
@@ -75,6 +75,25 @@ extern const CO_OBJ_TYPE COTParaStore;
 */
 CO_ERR CONodeParaLoad(struct CO_NODE_T *node, CO_NMT_RESET type);
 
+#if USE_PARA_DIRTY
+
+/*! \brief MARK WRITTEN OBJECT ENTRY
+*
+*    This function marks the memory of the written object entry as changed
+*    in all parameter groups with dirty tracking, which contain this
+*    memory. The function is called after a successful write access via
+*    the object dictionary.
+*
+* \param node
+*    Ptr to node info
+*
+* \param obj
+*    Ptr to written object entry
+*/
+void COParaDirtyObj(struct CO_NODE_T *node, struct CO_OBJ_T *obj);
+
+#endif //USE_PARA_DIRTY
+
 /******************************************************************************
 * PUBLIC API FUNCTIONS
 ******************************************************************************/
@@ -83,7 +102,8 @@ CO_ERR CONodeParaLoad(struct CO_NODE_T *node, CO_NMT_RESET type);
 *
 *    This function is responsible for the storing activities of the given
 *    parameter group. The whole parameter group will be stored in NVM by
-*    calling the nvm driver function.
+*    calling the nvm driver function. With dirty tracking, only the changed
+*    ranges of the parameter group are written.
 *
 * \param pg
 *    Ptr to parameter group info
@@ -96,6 +116,73 @@ CO_ERR CONodeParaLoad(struct CO_NODE_T *node, CO_NMT_RESET type);
 */
 CO_ERR COParaStore(CO_PARA *pg, struct CO_NODE_T *node);
 
+#if USE_PARA_DIRTY
+
+/*! \brief MARK CHANGED PARAMETERS
+*
+*    This function marks a range of the given parameter group as changed.
+*    The next store writes only the changed ranges to NVM. Call this
+*    function after the application changed parameters directly in
+*    memory; writes via the object dictionary are marked automatically.
+*
+* \param pg
+*    Ptr to parameter group info
+*
+* \param offset
+*    Offset of the changed range within the parameter memory block
+*
+* \param size
+*    Size of the changed range in bytes
+*/
+void COParaDirtyMark(CO_PARA *pg, uint32_t offset, uint32_t size);
+
+#endif //USE_PARA_DIRTY
+
+#if USE_PARA_ASYNC
+
+/*! \brief INIT BACKGROUND PARAMETER STORE
+*
+*    This function initializes the background parameter store of the given
+*    node. No store command is active after this function call.
+*
+* \param pa
+*    Ptr to background parameter store
+*
+* \param node
+*    Ptr to node info
+*/
+void COParaAsyncInit(CO_PARA_ASYNC *pa, struct CO_NODE_T *node);
+
+/*! \brief FLUSH BACKGROUND PARAMETER STORE
+*
+*    This function finishes an active store command without further delay.
+*    The function is called before a reset of the node, to ensure that the
+*    parameters in NVM are complete before they are loaded.
+*
+* \param pa
+*    Ptr to background parameter store
+*/
+void COParaAsyncFlush(CO_PARA_ASYNC *pa);
+
+/******************************************************************************
+* CALLBACK FUNCTIONS
+******************************************************************************/
+
+/*! \brief PARAMETER STORE FINISHED
+*
+*    This function is called after a store command in the object 1010h is
+*    finished in the background.
+*
+* \param pg
+*    Ptr to the parameter group of the commanded subindex
+*
+* \param err
+*    Result of the store command (CO_ERR_NONE on success)
+*/
+extern void COParaStoreDone(CO_PARA *pg, CO_ERR err);
+
+#endif //USE_PARA_ASYNC
+
 #ifdef __cplusplus               /* for compatibility with C++ environments  */
 }
 #endif
@@ -43,7 +43,7 @@ static CO_ERR   COTPdoEventInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTPdoEvent = { COTPdoEventSize, COTPdoEventInit, COTPdoEventRead, COTPdoEventWrite, 0 };
+const CO_OBJ_TYPE COTPdoEvent = { COTPdoEventSize, COTPdoEventInit, COTPdoEventRead, COTPdoEventWrite, 0, 0 };
 
 /******************************************************************************
 * PRIVATE TYPE FUNCTIONS
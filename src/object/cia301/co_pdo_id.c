@@ -44,7 +44,7 @@ static CO_ERR   COTPdoIdInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTPdoId = { COTPdoIdSize, COTPdoIdInit, COTPdoIdRead, COTPdoIdWrite, 0 };
+const CO_OBJ_TYPE COTPdoId = { COTPdoIdSize, COTPdoIdInit, COTPdoIdRead, COTPdoIdWrite, 0, 0 };
 
 /******************************************************************************
 * PRIVATE TYPE FUNCTIONS
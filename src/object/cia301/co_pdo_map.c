@@ -43,7 +43,7 @@ static CO_ERR   COTPdoMapInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTPdoMap = { COTPdoMapSize, COTPdoMapInit, COTPdoMapRead, COTPdoMapWrite, 0 };
+const CO_OBJ_TYPE COTPdoMap = { COTPdoMapSize, COTPdoMapInit, COTPdoMapRead, COTPdoMapWrite, 0, 0 };
 
 /******************************************************************************
 * PRIVATE TYPE FUNCTIONS
@@ -72,7 +72,7 @@ static CO_ERR COTPdoMapWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void
     uint32_t  maps;
     uint16_t  pmapidx;
     uint16_t  pcomidx;
-    uint8_t   mapn;
+    uint8_t   mapn   = 0;
 
     CO_UNUSED(size);
     ASSERT_PTR_ERR(obj, CO_ERR_BAD_ARG);
@@ -43,7 +43,7 @@ static CO_ERR   COTPdoNumInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTPdoNum = { COTPdoNumSize, COTPdoNumInit, COTPdoNumRead, COTPdoNumWrite, 0 };
+const CO_OBJ_TYPE COTPdoNum = { COTPdoNumSize, COTPdoNumInit, COTPdoNumRead, COTPdoNumWrite, 0, 0 };
 
 /******************************************************************************
 * PRIVATE TYPE FUNCTIONS
@@ -70,7 +70,7 @@ static CO_ERR COTPdoNumWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void
     uint32_t  mapentry;
     uint16_t  pmapidx;
     uint16_t  pcomidx;
-    uint8_t   mapbytes;
+    uint16_t  mapbytes;
     uint8_t   mapnum;
     uint8_t   i;
 
@@ -89,7 +89,7 @@ static CO_ERR COTPdoNumWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void
 
     /* check maximal number of linked objects */        
     mapnum = (uint8_t)(*(uint8_t *)buffer);
-    if (mapnum > 8) {
+    if (mapnum > CO_PDO_MAP_N) {
         return (CO_ERR_OBJ_MAP_LEN);
     }
 
@@ -100,9 +100,9 @@ static CO_ERR COTPdoNumWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void
         if (result != CO_ERR_NONE) {
             return (CO_ERR_OBJ_MAP_TYPE);
         }
-        mapbytes += ((uint8_t)mapentry) >> 3u;
+        mapbytes += (uint16_t)(((uint8_t)mapentry) >> 3u);
     }
-    if (mapbytes > 8) {
+    if (mapbytes > CO_IF_FRM_DATA_N) {
         return (CO_ERR_OBJ_MAP_LEN);
     }
 
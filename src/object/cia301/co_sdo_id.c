@@ -42,7 +42,7 @@ static CO_ERR   COTSdoIdInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTSdoId = { COTSdoIdSize, COTSdoIdInit, COTSdoIdRead, COTSdoIdWrite, 0 };
+const CO_OBJ_TYPE COTSdoId = { COTSdoIdSize, COTSdoIdInit, COTSdoIdRead, COTSdoIdWrite, 0, 0 };
 
 /******************************************************************************
 * PRIVATE TYPE FUNCTIONS
@@ -41,7 +41,7 @@ static CO_ERR   COTSyncCycleInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTSyncCycle = { COTSyncCycleSize, COTSyncCycleInit, COTSyncCycleRead, COTSyncCycleWrite, 0 };
+const CO_OBJ_TYPE COTSyncCycle = { COTSyncCycleSize, COTSyncCycleInit, COTSyncCycleRead, COTSyncCycleWrite, 0, 0 };
 
 /******************************************************************************
 * PRIVATE TYPE FUNCTIONS
@@ -41,7 +41,7 @@ static CO_ERR   COTSyncIdInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
 * PUBLIC GLOBALS
 ******************************************************************************/
 
-const CO_OBJ_TYPE COTSyncId = { COTSyncIdSize, COTSyncIdInit, COTSyncIdRead, COTSyncIdWrite, 0 };
+const CO_OBJ_TYPE COTSyncId = { COTSyncIdSize, COTSyncIdInit, COTSyncIdRead, COTSyncIdWrite, 0, 0 };
 
 /******************************************************************************
 * PRIVATE TYPE FUNCTIONS
@@ -71,6 +71,7 @@ static CO_ERR COTSyncIdWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void
 
     sync = &node->Sync;
     nid = *(uint32_t*)buffer;
+    CODispInvalidate(node);
     (void)uint32->Read(obj, node, &oid, sizeof(oid));
 
     /* when current entry is generating SYNCs, bits 0 to 29 shall not be changed */
@@ -123,6 +124,7 @@ static CO_ERR COTSyncIdInit(struct CO_OBJ_T *obj, struct CO_NODE_T *node)
     /* check for emergency cob-id object */
     if (CO_DEV(COT_OBJECT, 0) == CO_GET_DEV(obj->Key)) {
         result = uint32->Read(obj, node, &node->Sync.CobId, 4);
+        CODispInvalidate(node);
         COSyncProdActivate(&node->Sync);
     }
     return (result);
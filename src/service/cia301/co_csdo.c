@@ -35,6 +35,16 @@ static CO_ERR COCSdoUploadSegmented        (CO_CSDO *csdo);
 static CO_ERR COCSdoInitDownloadSegmented  (CO_CSDO *csdo);
 static CO_ERR COCSdoDownloadSegmented      (CO_CSDO *csdo);
 static CO_ERR COCSdoFinishDownloadSegmented(CO_CSDO *csdo);
+static CO_ERR COCSdoInitUploadBlock        (CO_CSDO *csdo);
+static CO_ERR COCSdoUploadBlock            (CO_CSDO *csdo);
+static CO_ERR COCSdoEndUploadBlock         (CO_CSDO *csdo);
+static CO_ERR COCSdoInitDownloadBlock      (CO_CSDO *csdo);
+static CO_ERR COCSdoAckDownloadBlock       (CO_CSDO *csdo);
+static void   COCSdoDownloadBlock          (CO_CSDO *csdo);
+static void   COCSdoSendBlock              (CO_CSDO *csdo);
+static void   COCSdoRefresh                (CO_CSDO *csdo);
+static void   COCSdoSendAbort              (CO_CSDO *csdo, uint32_t err);
+static void   COCSdoAbortBlock             (CO_CSDO *csdo, uint32_t err);
 static void   COCSdoAbort                  (CO_CSDO *csdo, uint32_t err);
 static void   COCSdoTransferFinalize       (CO_CSDO *csdo);
 static void   COCSdoTimeout                (void *parg);
@@ -45,24 +55,46 @@ static void   COCSdoTimeout                (void *parg);
 
 static void COCSdoAbort(CO_CSDO *csdo, uint32_t err)
 {
-    CO_IF_FRM frm;
-
     /* store abort code */
     csdo->Tfer.Abort = err;
 
     /* send the SDO timeout response */
     if (err == CO_SDO_ERR_TIMEOUT) {
-        CO_SET_ID  (&frm, csdo->TxId        );
-        CO_SET_BYTE(&frm, 0x80,           0u);
-        CO_SET_WORD(&frm, csdo->Tfer.Idx, 1u);
-        CO_SET_BYTE(&frm, csdo->Tfer.Sub, 3u);
-        CO_SET_LONG(&frm, err,            4u);
-        CO_SET_DLC (&frm,                 8u);
-
-        (void)COIfCanSend(&csdo->Node->If, &frm);
+        COCSdoSendAbort(csdo, err);
     }
 }
 
+static void COCSdoSendAbort(CO_CSDO *csdo, uint32_t err)
+{
+    CO_IF_FRM frm;
+
+    CO_SET_ID  (&frm, csdo->TxId        );
+    CO_SET_BYTE(&frm, 0x80,           0u);
+    CO_SET_WORD(&frm, csdo->Tfer.Idx, 1u);
+    CO_SET_BYTE(&frm, csdo->Tfer.Sub, 3u);
+    CO_SET_LONG(&frm, err,            4u);
+    CO_SET_DLC (&frm,                 8u);
+
+    (void)COIfCanSend(&csdo->Node->If, &frm);
+}
+
+static void COCSdoAbortBlock(CO_CSDO *csdo, uint32_t err)
+{
+    /* the server waits for further block frames: abort transfer on both sides */
+    COCSdoAbort(csdo, err);
+    COCSdoSendAbort(csdo, err);
+    COCSdoTransferFinalize(csdo);
+}
+
+static void COCSdoRefresh(CO_CSDO *csdo)
+{
+    uint32_t ticks;
+
+    (void)COTmrDelete(&(csdo->Node->Tmr), csdo->Tfer.Tmr);
+    ticks = COTmrGetTicks(&(csdo->Node->Tmr), csdo->Tfer.Tmt, CO_TMR_UNIT_1MS);
+    csdo->Tfer.Tmr = COTmrCreate(&(csdo->Node->Tmr), ticks, 0, &COCSdoTimeout, csdo);
+}
+
 static void COCSdoReset(CO_CSDO *csdo, uint8_t num, struct CO_NODE_T *node)
 {
     CO_CSDO *csdonum;
@@ -83,6 +115,7 @@ static void COCSdoReset(CO_CSDO *csdo, uint8_t num, struct CO_NODE_T *node)
     csdonum->RxId  = CO_SDO_ID_OFF;
     csdonum->TxId  = CO_SDO_ID_OFF;
     csdonum->State = CO_CSDO_STATE_INVALID;
+    CODispInvalidate(node);
 
     /* Reset transfer context */
     csdonum->Tfer.Csdo    = csdonum;
@@ -95,6 +128,7 @@ static void COCSdoReset(CO_CSDO *csdo, uint8_t num, struct CO_NODE_T *node)
     csdonum->Tfer.Call    = NULL;
     csdonum->Tfer.Buf_Idx = 0;
     csdonum->Tfer.TBit    = 0;
+    csdonum->Tfer.Blk.State = CO_CSDO_BLK_INIT;
 
     if (csdonum->Tfer.Tmr >= 0) {
         tid = COTmrDelete(&(node->Tmr), csdonum->Tfer.Tmr);
@@ -122,6 +156,7 @@ static void COCSdoEnable(CO_CSDO *csdo, uint8_t num)
     csdonum->State = CO_CSDO_STATE_INVALID;
 
     node = csdo->Node;
+    CODispInvalidate(node);
     err = CODictRdLong(&node->Dict, CO_DEV((uint32_t)0x1280u + (uint32_t)num, 1u), &txId);
     if (err != CO_ERR_NONE) {
         return;
@@ -170,9 +205,15 @@ static void COCSdoTransferFinalize(CO_CSDO *csdo)
         csdo->Tfer.Size  = 0;
         csdo->Tfer.Tmt   = 0;
         csdo->Tfer.Call  = NULL;
-        csdo->Tfer.Tmr   = -1;
         csdo->Tfer.Buf_Idx = 0;
         csdo->Tfer.TBit = 0;
+        csdo->Tfer.Blk.State = CO_CSDO_BLK_INIT;
+
+        /* Stop timeout supervision of finished transfer */
+        if (csdo->Tfer.Tmr >= 0) {
+            (void)COTmrDelete(&(csdo->Node->Tmr), csdo->Tfer.Tmr);
+            csdo->Tfer.Tmr = -1;
+        }
 
         /* Release SDO client for next request */
         csdo->Frm   = NULL;
@@ -186,6 +227,8 @@ static void COCSdoTimeout(void *parg)
 
     csdo = (CO_CSDO *)parg;
     if (csdo->State == CO_CSDO_STATE_BUSY) {
+        /* Timer is expired, no further delete */
+        csdo->Tfer.Tmr = -1;
         /* Abort SDO transfer because of timeout */
         COCSdoAbort(csdo, CO_SDO_ERR_TIMEOUT);
         /* Finalize aborted transfer */
@@ -268,13 +311,31 @@ static CO_ERR COCSdoUploadSegmented(CO_CSDO *csdo)
     CO_ERR    result = CO_ERR_SDO_SILENT;
     uint32_t  ticks;
     uint8_t   cmd;
+    uint8_t   num;
     uint8_t   n;
     CO_IF_FRM frm;
 
     cmd = CO_GET_BYTE(csdo->Frm, 0u);
     if (((cmd >> 4u) & 0x01u) == csdo->Tfer.TBit) {
 
-        for (n = 1u; (n < 8u) && (csdo->Tfer.Buf_Idx < csdo->Tfer.Size); n++) {
+        /* a segment holds the command byte and at least one data byte */
+        if (CO_GET_DLC(csdo->Frm) < 2u) {
+            COCSdoAbort(csdo, CO_SDO_ERR_CMD);
+            COCSdoTransferFinalize(csdo);
+            return result;
+        }
+
+        /* a classic segment within a CAN FD build holds 7 bytes only */
+        num = (uint8_t)(CO_GET_DLC(csdo->Frm) - 1u);
+        if (num > CO_SDO_SEG_DATA) {
+            num = CO_SDO_SEG_DATA;
+        }
+        n = (uint8_t)((cmd >> 1u) & 0x07u);
+        if (((cmd & 0x01u) != 0u) && (n != 0u) && (num > (uint8_t)(7u - n))) {
+            num = (uint8_t)(7u - n);
+        }
+
+        for (n = 1u; (n <= num) && (csdo->Tfer.Buf_Idx < csdo->Tfer.Size); n++) {
             csdo->Tfer.Buf[csdo->Tfer.Buf_Idx] = CO_GET_BYTE(csdo->Frm, n);
             csdo->Tfer.Buf_Idx++;
         }
@@ -318,8 +379,8 @@ static CO_ERR COCSdoInitDownloadSegmented(CO_CSDO *csdo)
     uint32_t  ticks;
     uint16_t  Idx;
     uint8_t   Sub;
+    uint32_t  width;
     uint8_t   n;
-    uint8_t   width;
     uint8_t   c_bit = 1;
     uint8_t   cmd;
     CO_IF_FRM frm;
@@ -335,8 +396,8 @@ static CO_ERR COCSdoInitDownloadSegmented(CO_CSDO *csdo)
         CO_SET_LONG(&frm, 0, 4u);
 
         width = csdo->Tfer.Size - csdo->Tfer.Buf_Idx;
-        if (width > 7u) {
-            width = 7u;
+        if (width > CO_SDO_SEG_DATA) {
+            width = CO_SDO_SEG_DATA;
             c_bit = 0u;
         }
 
@@ -346,9 +407,10 @@ static CO_ERR COCSdoInitDownloadSegmented(CO_CSDO *csdo)
         }
 
         cmd = (uint8_t)(csdo->Tfer.TBit << 4u) |
-              (uint8_t)(((7u - width) << 1u)) | 
+              (uint8_t)((CO_SDO_SEG_N(width) << 1u)) | 
               (uint8_t)(c_bit);
         CO_SET_BYTE(&frm, cmd, 0u);
+        CO_SET_DLC (&frm, CO_SDO_SEG_DLC(width));
 
         /* refresh timer */
         (void)COTmrDelete(&(csdo->Node->Tmr), csdo->Tfer.Tmr);
@@ -368,9 +430,9 @@ static CO_ERR COCSdoDownloadSegmented(CO_CSDO *csdo)
 {
     CO_ERR    result = CO_ERR_SDO_SILENT;
     uint32_t  ticks;
+    uint32_t  width;
     uint8_t   cmd;
     uint8_t   n;
-    uint8_t   width;
     uint8_t   c_bit = 1;
     CO_IF_FRM frm;
 
@@ -387,8 +449,8 @@ static CO_ERR COCSdoDownloadSegmented(CO_CSDO *csdo)
 
         width = csdo->Tfer.Size - csdo->Tfer.Buf_Idx;
 
-        if (width > 7u) {
-            width = 7u;
+        if (width > CO_SDO_SEG_DATA) {
+            width = CO_SDO_SEG_DATA;
             c_bit = 0u;
         }
         
@@ -398,10 +460,11 @@ static CO_ERR COCSdoDownloadSegmented(CO_CSDO *csdo)
         }
 
         cmd = (uint8_t)(csdo->Tfer.TBit << 4u) |
-              (uint8_t)(((7u - width) << 1u)) | 
+              (uint8_t)((CO_SDO_SEG_N(width) << 1u)) | 
               (uint8_t)(c_bit);
 
         CO_SET_BYTE(&frm, cmd, 0u);
+        CO_SET_DLC (&frm, CO_SDO_SEG_DLC(width));
 
          /* refresh timer */
         (void)COTmrDelete(&(csdo->Node->Tmr), csdo->Tfer.Tmr);
@@ -423,6 +486,277 @@ static CO_ERR COCSdoFinishDownloadSegmented(CO_CSDO *csdo)
     return CO_ERR_SDO_SILENT;
 }
 
+static CO_ERR COCSdoInitUploadBlock(CO_CSDO *csdo)
+{
+    CO_ERR    result = CO_ERR_SDO_SILENT;
+    uint32_t  obj_size;
+    uint16_t  Idx;
+    uint8_t   Sub;
+    uint8_t   cmd;
+    CO_IF_FRM frm;
+
+    cmd = CO_GET_BYTE(csdo->Frm, 0u);
+    obj_size = CO_GET_LONG(csdo->Frm, 4u);
+    Idx = CO_GET_WORD(csdo->Frm, 1u);
+    Sub = CO_GET_BYTE(csdo->Frm, 3u);
+
+    /* verify Idx, Sub and the size (if indicated) */
+    if ((Idx != csdo->Tfer.Idx) ||
+        (Sub != csdo->Tfer.Sub)) {
+        COCSdoAbortBlock(csdo, CO_SDO_ERR_PARA_INCOMP);
+    } else if (((cmd & 0x02u) != 0u) &&
+               (obj_size != csdo->Tfer.Size)) {
+        COCSdoAbortBlock(csdo, CO_SDO_ERR_LEN);
+    } else {
+        /* CRC is used, when supported by server (sc) */
+        csdo->Tfer.Blk.Crc    = (uint8_t)((cmd >> 2u) & 0x01u);
+        csdo->Tfer.Blk.State  = CO_CSDO_BLK_SEG;
+        csdo->Tfer.Blk.Pos    = 0u;
+        csdo->Tfer.Blk.SegCnt = 0u;
+        csdo->Tfer.Blk.Err    = 0u;
+
+        /* start upload of first block */
+        CO_SET_ID  (&frm, csdo->TxId);
+        CO_SET_DLC (&frm, 8u);
+        CO_SET_BYTE(&frm, 0xA3, 0u);
+        CO_SET_WORD(&frm, 0, 1u);
+        CO_SET_BYTE(&frm, 0, 3u);
+        CO_SET_LONG(&frm, 0, 4u);
+
+        COCSdoRefresh(csdo);
+        (void)COIfCanSend(&csdo->Node->If, &frm);
+    }
+
+    return result;
+}
+
+static CO_ERR COCSdoUploadBlock(CO_CSDO *csdo)
+{
+    CO_ERR    result = CO_ERR_SDO_SILENT;
+    uint8_t   cmd;
+    uint8_t   seq;
+    uint8_t   n;
+    CO_IF_FRM frm;
+
+    cmd = CO_GET_BYTE(csdo->Frm, 0u);
+    seq = cmd & 0x7Fu;
+    if (seq == 0u) {
+        COCSdoAbortBlock(csdo, CO_SDO_ERR_SEQ_NUM);
+        return result;
+    }
+
+    if ((csdo->Tfer.Blk.Err == 0u) &&
+        (seq == (csdo->Tfer.Blk.SegCnt + 1u))) {
+        /* segment in sequence: store data, padding of last segment is
+         * removed with the end of the block transfer */
+        for (n = 1u; (n <= 7u) && (csdo->Tfer.Buf_Idx < csdo->Tfer.Size); n++) {
+            csdo->Tfer.Buf[csdo->Tfer.Buf_Idx] = CO_GET_BYTE(csdo->Frm, n);
+            csdo->Tfer.Buf_Idx++;
+        }
+        csdo->Tfer.Blk.Pos += 7u;
+        csdo->Tfer.Blk.SegCnt = seq;
+        if ((cmd & 0x80u) != 0u) {
+            csdo->Tfer.Blk.State = CO_CSDO_BLK_END;
+        }
+    } else {
+        /* ignore segments until end of block, the server repeats
+         * all segments after the last acknowledged sequence number */
+        csdo->Tfer.Blk.Err = 1u;
+    }
+
+    if ((seq == csdo->Tfer.Blk.Size) || ((cmd & 0x80u) != 0u)) {
+        CO_SET_ID  (&frm, csdo->TxId);
+        CO_SET_DLC (&frm, 8u);
+        CO_SET_BYTE(&frm, 0xA2, 0u);
+        CO_SET_BYTE(&frm, csdo->Tfer.Blk.SegCnt, 1u);
+        CO_SET_BYTE(&frm, csdo->Tfer.Blk.Size, 2u);
+        CO_SET_BYTE(&frm, 0, 3u);
+        CO_SET_LONG(&frm, 0, 4u);
+
+        csdo->Tfer.Blk.SegCnt = 0u;
+        csdo->Tfer.Blk.Err    = 0u;
+
+        (void)COIfCanSend(&csdo->Node->If, &frm);
+    }
+    COCSdoRefresh(csdo);
+
+    return result;
+}
+
+static CO_ERR COCSdoEndUploadBlock(CO_CSDO *csdo)
+{
+    CO_ERR    result = CO_ERR_SDO_SILENT;
+    uint16_t  crc;
+    uint8_t   cmd;
+    uint8_t   n;
+    CO_IF_FRM frm;
+
+    cmd = CO_GET_BYTE(csdo->Frm, 0u);
+    n   = (cmd >> 2u) & 0x07u;
+    if ((csdo->Tfer.Blk.Pos - n) != csdo->Tfer.Size) {
+        COCSdoAbortBlock(csdo, CO_SDO_ERR_LEN);
+        return result;
+    }
+    if (csdo->Tfer.Blk.Crc != 0u) {
+        crc = COCrc16(CO_CRC16_INIT, csdo->Tfer.Buf, csdo->Tfer.Size);
+        if (crc != CO_GET_WORD(csdo->Frm, 1u)) {
+            COCSdoAbortBlock(csdo, CO_SDO_ERR_CRC);
+            return result;
+        }
+    }
+
+    CO_SET_ID  (&frm, csdo->TxId);
+    CO_SET_DLC (&frm, 8u);
+    CO_SET_BYTE(&frm, 0xA1, 0u);
+    CO_SET_WORD(&frm, 0, 1u);
+    CO_SET_BYTE(&frm, 0, 3u);
+    CO_SET_LONG(&frm, 0, 4u);
+    (void)COIfCanSend(&csdo->Node->If, &frm);
+
+    COCSdoTransferFinalize(csdo);
+    return result;
+}
+
+static CO_ERR COCSdoInitDownloadBlock(CO_CSDO *csdo)
+{
+    CO_ERR   result = CO_ERR_SDO_SILENT;
+    uint16_t Idx;
+    uint8_t  Sub;
+    uint8_t  cmd;
+    uint8_t  size;
+
+    cmd  = CO_GET_BYTE(csdo->Frm, 0u);
+    Idx  = CO_GET_WORD(csdo->Frm, 1u);
+    Sub  = CO_GET_BYTE(csdo->Frm, 3u);
+    size = CO_GET_BYTE(csdo->Frm, 4u);
+    if ((Idx != csdo->Tfer.Idx) ||
+        (Sub != csdo->Tfer.Sub)) {
+        COCSdoAbortBlock(csdo, CO_SDO_ERR_PARA_INCOMP);
+    } else if ((size < 1u) || (size > 127u)) {
+        COCSdoAbortBlock(csdo, CO_SDO_ERR_BLK_SIZE);
+    } else {
+        /* CRC is used, when supported by server (sc) */
+        csdo->Tfer.Blk.Crc   = (uint8_t)((cmd >> 2u) & 0x01u);
+        csdo->Tfer.Blk.Size  = size;
+        COCSdoDownloadBlock(csdo);
+    }
+
+    return result;
+}
+
+static CO_ERR COCSdoAckDownloadBlock(CO_CSDO *csdo)
+{
+    CO_ERR    result = CO_ERR_SDO_SILENT;
+    uint8_t   ackseq;
+    uint8_t   size;
+    uint8_t   cmd;
+    CO_IF_FRM frm;
+
+    ackseq = CO_GET_BYTE(csdo->Frm, 1u);
+    size   = CO_GET_BYTE(csdo->Frm, 2u);
+    if (ackseq > csdo->Tfer.Blk.SegCnt) {
+        COCSdoAbortBlock(csdo, CO_SDO_ERR_SEQ_NUM);
+        return result;
+    }
+    if ((size < 1u) || (size > 127u)) {
+        COCSdoAbortBlock(csdo, CO_SDO_ERR_BLK_SIZE);
+        return result;
+    }
+
+    /* continue after the last acknowledged segment; this repeats the
+     * segments, which are lost or received out of sequence */
+    csdo->Tfer.Buf_Idx = csdo->Tfer.Blk.Pos + ((uint32_t)ackseq * 7u);
+    if (csdo->Tfer.Buf_Idx > csdo->Tfer.Size) {
+        csdo->Tfer.Buf_Idx = csdo->Tfer.Size;
+    }
+
+    if (csdo->Tfer.Buf_Idx < csdo->Tfer.Size) {
+        csdo->Tfer.Blk.Size = size;
+        COCSdoDownloadBlock(csdo);
+    } else {
+        /* all data acknowledged: end block download */
+        cmd = (uint8_t)(0xC1u | ((7u - csdo->Tfer.Blk.Last) << 2u));
+        CO_SET_ID  (&frm, csdo->TxId);
+        CO_SET_DLC (&frm, 8u);
+        CO_SET_BYTE(&frm, cmd, 0u);
+        if (csdo->Tfer.Blk.Crc != 0u) {
+            CO_SET_WORD(&frm, COCrc16(CO_CRC16_INIT, csdo->Tfer.Buf, csdo->Tfer.Size), 1u);
+        } else {
+            CO_SET_WORD(&frm, 0, 1u);
+        }
+        CO_SET_BYTE(&frm, 0, 3u);
+        CO_SET_LONG(&frm, 0, 4u);
+        csdo->Tfer.Blk.State = CO_CSDO_BLK_END;
+
+        COCSdoRefresh(csdo);
+        (void)COIfCanSend(&csdo->Node->If, &frm);
+    }
+
+    return result;
+}
+
+static void COCSdoDownloadBlock(CO_CSDO *csdo)
+{
+    /* start the block at the current position; the segments are sent
+     * without waiting for a response, as far as transmit slots are free */
+    csdo->Tfer.Blk.Pos    = csdo->Tfer.Buf_Idx;
+    csdo->Tfer.Blk.SegCnt = 0u;
+    csdo->Tfer.Blk.State  = CO_CSDO_BLK_SEND;
+    COCSdoRefresh(csdo);
+    COCSdoSendBlock(csdo);
+}
+
+static void COCSdoSendBlock(CO_CSDO *csdo)
+{
+    uint32_t  width;
+    int16_t   credit;
+    int16_t   err;
+    uint8_t   seq;
+    uint8_t   cmd;
+    uint8_t   n;
+    CO_IF_FRM frm;
+
+    CO_SET_ID  (&frm, csdo->TxId);
+    CO_SET_DLC (&frm, 8u);
+
+    credit = COIfCanTxFree(&csdo->Node->If);
+    while ((csdo->Tfer.Blk.State == CO_CSDO_BLK_SEND) && (credit > 0)) {
+        seq   = (uint8_t)(csdo->Tfer.Blk.SegCnt + 1u);
+        cmd   = seq;
+        width = csdo->Tfer.Size - csdo->Tfer.Buf_Idx;
+        if (width > 7u) {
+            width = 7u;
+        } else {
+            cmd |= 0x80u;
+        }
+
+        CO_SET_LONG(&frm, 0, 0u);
+        CO_SET_LONG(&frm, 0, 4u);
+        CO_SET_BYTE(&frm, cmd, 0u);
+        for (n = 1u; n <= width; n++) {
+            CO_SET_BYTE(&frm, csdo->Tfer.Buf[csdo->Tfer.Buf_Idx + n - 1u], n);
+        }
+        err = COIfCanSend(&csdo->Node->If, &frm);
+        if (err <= (int16_t)0) {
+            /* segment is not accepted: repeat with next node processing */
+            break;
+        }
+        credit--;
+
+        csdo->Tfer.Blk.SegCnt = seq;
+        csdo->Tfer.Buf_Idx   += width;
+        if ((cmd & 0x80u) != 0u) {
+            csdo->Tfer.Blk.Last = (uint8_t)width;
+        }
+        if (((cmd & 0x80u) != 0u) ||
+            (seq >= csdo->Tfer.Blk.Size)) {
+            /* block is sent: wait for block acknowledge */
+            csdo->Tfer.Blk.State = CO_CSDO_BLK_SEG;
+            COCSdoRefresh(csdo);
+        }
+    }
+}
+
 /******************************************************************************
 * PROTECTED API FUNCTIONS
 ******************************************************************************/
@@ -449,29 +783,7 @@ CO_CSDO *COCSdoCheck(CO_CSDO *csdo, CO_IF_FRM *frm)
         n = 0;
         while ((n       < (uint8_t)CO_CSDO_N) &&
                (result == NULL              )) {
-            /*
-             * Match configured COB-ID
-             * and current client state.
-             * Idle client state means
-             * that it did not initiate
-             * any transfer (or timed out),
-             * which means we are not
-             * interested in response
-             * anymore.
-             */
-            if ((CO_GET_ID(frm) == csdo[n].RxId) &&
-                (csdo[n].State  == CO_CSDO_STATE_BUSY)) {
-                /*
-                 * Update frame with COB-ID
-                 * and return client handle
-                 * for further processing.
-                 */
-                CO_SET_ID(frm, csdo[n].TxId);
-                csdo[n].Frm        = frm;
-                csdo[n].Tfer.Abort = 0;
-                result = &csdo[n];
-                break;
-            }
+            result = COCSdoMatch(&csdo[n], frm);
             n++;
         }
     }
@@ -479,6 +791,49 @@ CO_CSDO *COCSdoCheck(CO_CSDO *csdo, CO_IF_FRM *frm)
     return (result);
 }
 
+CO_CSDO *COCSdoMatch(CO_CSDO *csdo, CO_IF_FRM *frm)
+{
+    CO_CSDO *result = NULL;
+
+    /*
+     * Match configured COB-ID
+     * and current client state.
+     * Idle client state means
+     * that it did not initiate
+     * any transfer (or timed out),
+     * which means we are not
+     * interested in response
+     * anymore.
+     */
+    if ((CO_GET_ID(frm) == csdo->RxId) &&
+        (csdo->State    == CO_CSDO_STATE_BUSY)) {
+        /*
+         * Update frame with COB-ID
+         * and return client handle
+         * for further processing.
+         */
+        CO_SET_ID(frm, csdo->TxId);
+        csdo->Frm        = frm;
+        csdo->Tfer.Abort = 0;
+        result = csdo;
+    }
+
+    return (result);
+}
+
+void COCSdoProcess(CO_CSDO *csdo)
+{
+    uint8_t n;
+
+    for (n = 0; n < (uint8_t)CO_CSDO_N; n++) {
+        if ((csdo[n].State           == CO_CSDO_STATE_BUSY) &&
+            (csdo[n].Tfer.Type       == CO_CSDO_TRANSFER_DOWNLOAD_BLOCK) &&
+            (csdo[n].Tfer.Blk.State  == CO_CSDO_BLK_SEND)) {
+            COCSdoSendBlock(&csdo[n]);
+        }
+    }
+}
+
 CO_ERR COCSdoResponse(CO_CSDO *csdo)
 {
     CO_ERR   result = CO_ERR_SDO_SILENT;
@@ -523,6 +878,32 @@ CO_ERR COCSdoResponse(CO_CSDO *csdo)
             COCSdoAbort(csdo, CO_SDO_ERR_CMD);
             COCSdoTransferFinalize(csdo);
         }
+    } else if (csdo->Tfer.Type == CO_CSDO_TRANSFER_UPLOAD_BLOCK) {
+        if ((csdo->Tfer.Blk.State == CO_CSDO_BLK_INIT) &&
+            ((cmd & 0xF9u) == 0xC0u)) {
+            (void)COCSdoInitUploadBlock(csdo);
+        } else if (csdo->Tfer.Blk.State == CO_CSDO_BLK_SEG) {
+            (void)COCSdoUploadBlock(csdo);
+        } else if ((csdo->Tfer.Blk.State == CO_CSDO_BLK_END) &&
+                   ((cmd & 0xE3u) == 0xC1u)) {
+            (void)COCSdoEndUploadBlock(csdo);
+        } else {
+            COCSdoAbortBlock(csdo, CO_SDO_ERR_CMD);
+        }
+    } else if (csdo->Tfer.Type == CO_CSDO_TRANSFER_DOWNLOAD_BLOCK) {
+        if ((csdo->Tfer.Blk.State == CO_CSDO_BLK_INIT) &&
+            ((cmd & 0xFBu) == 0xA0u)) {
+            (void)COCSdoInitDownloadBlock(csdo);
+        } else if (((csdo->Tfer.Blk.State == CO_CSDO_BLK_SEG ) ||
+                    (csdo->Tfer.Blk.State == CO_CSDO_BLK_SEND)) &&
+                   (cmd == 0xA2u)) {
+            (void)COCSdoAckDownloadBlock(csdo);
+        } else if ((csdo->Tfer.Blk.State == CO_CSDO_BLK_END) &&
+                   (cmd == 0xA1u)) {
+            COCSdoTransferFinalize(csdo);
+        } else {
+            COCSdoAbortBlock(csdo, CO_SDO_ERR_CMD);
+        }
     } else if (cmd == 0x60u) {
         result = COCSdoDownloadExpedited(csdo);
         return (result);
@@ -706,4 +1087,131 @@ CO_ERR COCSdoRequestDownload(CO_CSDO *csdo,
     return CO_ERR_NONE;
 }
 
+CO_ERR COCSdoRequestUploadBlock(CO_CSDO *csdo,
+                                uint32_t key,
+                                uint8_t *buf,
+                                uint32_t size,
+                                CO_CSDO_CALLBACK_T callback,
+                                uint32_t timeout)
+{
+    CO_IF_FRM frm;
+    uint32_t  ticks;
+
+    ASSERT_PTR_ERR(csdo, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(buf, CO_ERR_BAD_ARG);
+    ASSERT_NOT_ERR(size, (uint32_t)0, CO_ERR_BAD_ARG);
+
+    if (callback == (CO_CSDO_CALLBACK_T)NULL) {
+        /* no callback is given */
+        return CO_ERR_BAD_ARG;
+    }
+    if (csdo->State == CO_CSDO_STATE_INVALID) {
+        /* Requested SDO client is disabled */
+        return CO_ERR_SDO_OFF;
+    }
+    if (csdo->State == CO_CSDO_STATE_BUSY) {
+        /* Requested SDO client is busy */
+        return CO_ERR_SDO_BUSY;
+    }
+
+    /* Set client as busy to prevent its usage
+     * until requested transfer is complete
+     */
+    csdo->State = CO_CSDO_STATE_BUSY;
+
+    /* Update transfer info */
+    csdo->Tfer.Type       = CO_CSDO_TRANSFER_UPLOAD_BLOCK;
+    csdo->Tfer.Abort      = 0;
+    csdo->Tfer.Idx        = CO_GET_IDX(key);
+    csdo->Tfer.Sub        = CO_GET_SUB(key);
+    csdo->Tfer.Buf        = buf;
+    csdo->Tfer.Size       = size;
+    csdo->Tfer.Tmt        = timeout;
+    csdo->Tfer.Call       = callback;
+    csdo->Tfer.Buf_Idx    = 0;
+    csdo->Tfer.TBit       = 0;
+    csdo->Tfer.Blk.State  = CO_CSDO_BLK_INIT;
+    csdo->Tfer.Blk.Size   = (uint8_t)CO_CSDO_BLK_SIZE;
+    csdo->Tfer.Blk.Crc    = 0;
+
+    /* Transmit transfer initiation directly (client supports CRC) */
+    CO_SET_ID  (&frm, csdo->TxId        );
+    CO_SET_DLC (&frm, 8u                );
+    CO_SET_BYTE(&frm, 0xA4          , 0u);
+    CO_SET_WORD(&frm, csdo->Tfer.Idx, 1u);
+    CO_SET_BYTE(&frm, csdo->Tfer.Sub, 3u);
+    CO_SET_LONG(&frm, 0,              4u);
+    CO_SET_BYTE(&frm, csdo->Tfer.Blk.Size, 4u);
+
+    ticks = COTmrGetTicks(&(csdo->Node->Tmr), timeout, CO_TMR_UNIT_1MS);
+    csdo->Tfer.Tmr = COTmrCreate(&(csdo->Node->Tmr), ticks, 0, &COCSdoTimeout, csdo);
+
+    (void)COIfCanSend(&csdo->Node->If, &frm);
+
+    return CO_ERR_NONE;
+}
+
+CO_ERR COCSdoRequestDownloadBlock(CO_CSDO *csdo,
+                                  uint32_t key,
+                                  uint8_t *buffer,
+                                  uint32_t size,
+                                  CO_CSDO_CALLBACK_T callback,
+                                  uint32_t timeout)
+{
+    CO_IF_FRM frm;
+    uint32_t  ticks;
+
+    ASSERT_PTR_ERR(csdo, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(buffer, CO_ERR_BAD_ARG);
+    ASSERT_NOT_ERR(size, (uint32_t)0, CO_ERR_BAD_ARG);
+
+    if (callback == (CO_CSDO_CALLBACK_T)NULL) {
+        /* no callback is given */
+        return CO_ERR_BAD_ARG;
+    }
+    if (csdo->State == CO_CSDO_STATE_INVALID) {
+        /* Requested SDO client is disabled */
+        return CO_ERR_SDO_OFF;
+    }
+    if (csdo->State == CO_CSDO_STATE_BUSY) {
+        /* Requested SDO client is busy */
+        return CO_ERR_SDO_BUSY;
+    }
+
+    /* Set client as busy to prevent its usage
+     * until requested transfer is complete
+     */
+    csdo->State = CO_CSDO_STATE_BUSY;
+
+    /* Update transfer info */
+    csdo->Tfer.Type       = CO_CSDO_TRANSFER_DOWNLOAD_BLOCK;
+    csdo->Tfer.Abort      = 0;
+    csdo->Tfer.Idx        = CO_GET_IDX(key);
+    csdo->Tfer.Sub        = CO_GET_SUB(key);
+    csdo->Tfer.Buf        = buffer;
+    csdo->Tfer.Size       = size;
+    csdo->Tfer.Tmt        = timeout;
+    csdo->Tfer.Call       = callback;
+    csdo->Tfer.Buf_Idx    = 0;
+    csdo->Tfer.TBit       = 0;
+    csdo->Tfer.Blk.State  = CO_CSDO_BLK_INIT;
+    csdo->Tfer.Blk.Size   = 0;
+    csdo->Tfer.Blk.Crc    = 0;
+
+    /* Transmit transfer initiation directly (client supports CRC) */
+    CO_SET_ID  (&frm, csdo->TxId        );
+    CO_SET_DLC (&frm, 8u                );
+    CO_SET_BYTE(&frm, 0xC6          , 0u);
+    CO_SET_WORD(&frm, csdo->Tfer.Idx, 1u);
+    CO_SET_BYTE(&frm, csdo->Tfer.Sub, 3u);
+    CO_SET_LONG(&frm, size,           4u);
+
+    ticks = COTmrGetTicks(&(csdo->Node->Tmr), timeout, CO_TMR_UNIT_1MS);
+    csdo->Tfer.Tmr = COTmrCreate(&(csdo->Node->Tmr), ticks, 0, &COCSdoTimeout, csdo);
+
+    (void)COIfCanSend(&csdo->Node->If, &frm);
+
+    return CO_ERR_NONE;
+}
+
 #endif
@@ -59,6 +59,8 @@ typedef enum {
     CO_CSDO_TRANSFER_DOWNLOAD = 2,   /*!< SDO download is being executed     */
     CO_CSDO_TRANSFER_UPLOAD_SEGMENT = 3,  /*!< SDO segment upload is being executed     */
     CO_CSDO_TRANSFER_DOWNLOAD_SEGMENT = 4, /*!< SDO segment download is being executed     */
+    CO_CSDO_TRANSFER_UPLOAD_BLOCK = 5,    /*!< SDO block upload is being executed       */
+    CO_CSDO_TRANSFER_DOWNLOAD_BLOCK = 6,  /*!< SDO block download is being executed     */
 
 } CO_CSDO_TRANSFER_TYPE;
 
@@ -99,6 +101,33 @@ typedef struct CO_CSDO_SEG_T {
 
 } CO_CSDO_SEG;
 
+/*! \brief SDO CLIENT BLOCK TRANSFER STATE
+*
+*    This enumeration holds the possible states of a block transfer.
+*/
+typedef enum {
+    CO_CSDO_BLK_INIT = 0,        /*!< wait for initiate response            */
+    CO_CSDO_BLK_SEG  = 1,        /*!< transfer segments of a block          */
+    CO_CSDO_BLK_END  = 2,        /*!< wait for end of block transfer        */
+    CO_CSDO_BLK_SEND = 3,        /*!< send pending segments of a block      */
+
+} CO_CSDO_BLK_STATE;
+
+/*! \brief SDO CLIENT BLOCK TRANSFER
+*
+*    This structure holds the data, which are needed for the block
+*    SDO transfer.
+*/
+typedef struct CO_CSDO_BLK_T {
+    CO_CSDO_BLK_STATE State;     /*!< Block transfer state                  */
+    uint32_t  Pos;               /*!< Buffer index at start of block        */
+    uint8_t   Size;              /*!< Number of segments per block          */
+    uint8_t   SegCnt;            /*!< Last (valid or sent) sequence number  */
+    uint8_t   Last;              /*!< Number of data bytes in last segment  */
+    uint8_t   Crc;               /*!< CRC negotiated with SDO server        */
+    uint8_t   Err;               /*!< Sequence error within current block   */
+
+} CO_CSDO_BLK;
 
 
 /*! \brief SDO CLIENT TRANSFER
@@ -120,6 +149,7 @@ typedef struct CO_CSDO_TRANSFER_T {
     CO_CSDO_CALLBACK_T     Call;        /*!< Notification callback           */
     uint32_t               Buf_Idx;     /*!< Buffer Index                    */
     uint8_t                TBit;        /*!< Segment toggle bit              */
+    CO_CSDO_BLK            Blk;         /*!< Block transfer info             */
 } CO_CSDO_TRANSFER;
 
 /*! \brief SDO CLIENT
@@ -226,6 +256,81 @@ CO_ERR COCSdoRequestDownload(CO_CSDO *csdo,
                              CO_CSDO_CALLBACK_T callback,
                              uint32_t timeout);
 
+/*! \brief
+ *
+ *   This function initiates SDO block upload sequence. The SDO server
+ *   transfers the data in blocks of up to CO_CSDO_BLK_SIZE segments and
+ *   each block is confirmed with a single response. A CRC is used, when
+ *   the SDO server supports it.
+ *
+ * \param csdo
+ *   Reference to SDO client
+ *
+ * \param key
+ *    object entry key; should be generated with the macro CO_DEV()
+ *
+ * \param buf
+ *   Reference to buffer for the uploaded data
+ *
+ * \param size
+ *   Size of uploaded data
+ *
+ * \param callback
+ *   Notification callback on tranfer end (complete or abort)
+ *
+ * \param timeout
+ *   SDO server response timeout in milliseconds
+ *
+ * \retval  ==CO_ERR_NONE   transfer initiated successfuly
+ * \retval  !=CO_ERR_NONE   SDO client is busy or invalid
+ *
+ */
+CO_ERR COCSdoRequestUploadBlock(CO_CSDO *csdo,
+                                uint32_t key,
+                                uint8_t *buf,
+                                uint32_t size,
+                                CO_CSDO_CALLBACK_T callback,
+                                uint32_t timeout);
+
+/*! \brief
+ *
+ *   This function initiates SDO block download sequence. The data is
+ *   transfered in blocks with the number of segments given by the SDO
+ *   server and each block is confirmed with a single response. Segments
+ *   which are not confirmed by the SDO server are repeated. A CRC is
+ *   used, when the SDO server supports it. The segments of a block are
+ *   sent as far as the CAN driver reports free transmit slots, and the
+ *   remaining segments are sent with the next node processing.
+ *
+ * \param csdo
+ *   Reference to SDO client
+ *
+ * \param key
+ *    object entry key; should be generated with the macro CO_DEV()
+ *
+ * \param buf
+ *   Reference to data to be downloaded to server
+ *
+ * \param size
+ *   Size of downloaded data
+ *
+ * \param callback
+ *   Notification callback on tranfer end (complete or abort)
+ *
+ * \param timeout
+ *   SDO server response timeout in milliseconds
+ *
+ * \retval  ==CO_ERR_NONE   transfer initiated successfuly
+ * \retval  !=CO_ERR_NONE   SDO client is busy or invalid
+ *
+ */
+CO_ERR COCSdoRequestDownloadBlock(CO_CSDO *csdo,
+                                  uint32_t key,
+                                  uint8_t *buf,
+                                  uint32_t size,
+                                  CO_CSDO_CALLBACK_T callback,
+                                  uint32_t timeout);
+
 /******************************************************************************
 * PROTECTED API FUNCTIONS
 ******************************************************************************/
@@ -265,6 +370,22 @@ void COCSdoInit(CO_CSDO *csdo, struct CO_NODE_T *node);
 */
 CO_CSDO *COCSdoCheck(CO_CSDO *csdo, CO_IF_FRM *frm);
 
+/*! \brief  MATCH RESPONSE TO SDO CLIENT
+*
+*    This function checks the given frame to be a response to the given
+*    SDO client. The frame is prepared as described in \ref COCSdoCheck().
+*
+* \param csdo
+*    Ptr to single SDO client
+*
+* \param frm
+*    Frame, received from CAN bus
+*
+* \retval  >0    pointer to given SDO client
+* \retval  =0    not a response for this SDO client
+*/
+CO_CSDO *COCSdoMatch(CO_CSDO *csdo, CO_IF_FRM *frm);
+
 /*! \brief  GENERATE SDO CLIENT RESPONSE
 *
 *    This function interprets the data byte #0 of the response
@@ -280,6 +401,18 @@ CO_CSDO *COCSdoCheck(CO_CSDO *csdo, CO_IF_FRM *frm);
 */
 CO_ERR COCSdoResponse(CO_CSDO *csdo);
 
+/*! \brief  SEND PENDING BLOCK DOWNLOAD SEGMENTS
+*
+*    This function continues sending the segments of the current block
+*    download for all SDO clients. The sending stops when the CAN driver
+*    reports no free transmit slot, or rejects a segment, and is continued
+*    with the next call of this function.
+*
+* \param csdo
+*    Ptr to root element of SDO client array
+*/
+void COCSdoProcess(CO_CSDO *csdo);
+
 #if defined __cplusplus
 }
 #endif
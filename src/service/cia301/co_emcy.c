@@ -99,7 +99,7 @@ static void COEmcyUpdate(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr, uint8_t s
     regbit  =  emcy->Root[err].Reg;
     regmask =  (uint8_t)(1u << regbit);
 
-    (void)CODictRdByte(dir, CO_DEV(0x1001,0), &reg);
+    (void)CODictRefRdByte(dir, &emcy->Reg, &reg);
 
     if (state != 0) { /* set error */
         if ((reg & regmask) == 0) {
@@ -121,7 +121,7 @@ static void COEmcyUpdate(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr, uint8_t s
             }
         }
     }
-    (void)CODictWrByte(dir, CO_DEV(0x1001,0), reg);
+    (void)CODictRefWrByte(dir, &emcy->Reg, reg);
 }
 
 static void COEmcySend(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr, uint8_t state)
@@ -145,7 +145,7 @@ static void COEmcySend(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr, uint8_t sta
     dir  = &node->Dict;
     data = &emcy->Root[err];
 
-    (void)CODictRdLong(dir, CO_DEV(0x1014,0), &frm.Identifier);
+    (void)CODictRefRdLong(dir, &emcy->Id, &frm.Identifier);
     frm.DLC = 8;
     if (state == 1) {
         frm.Data[0] = (uint8_t)(data->Code);
@@ -154,7 +154,7 @@ static void COEmcySend(CO_EMCY *emcy, uint8_t err, CO_EMCY_USR *usr, uint8_t sta
         frm.Data[0] = (uint8_t)0;
         frm.Data[1] = (uint8_t)0;
     }
-    (void)CODictRdByte(dir, CO_DEV(0x1001,0), &frm.Data[2]);
+    (void)CODictRefRdByte(dir, &emcy->Reg, &frm.Data[2]);
     for (n=0; n<5; n++) {
         frm.Data[3+n] = 0;
     }
@@ -191,7 +191,7 @@ void COEmcyInit(CO_EMCY *emcy, CO_NODE *node, CO_EMCY_TBL *root)
     }
 
     /* error register is mandatory */
-    obj = CODictFind(&node->Dict, CO_DEV(0x1001,0));
+    obj = CODictRef(&node->Dict, CO_DEV(0x1001,0), &emcy->Reg);
     if (obj == 0) {
         node->Error = CO_ERR_CFG_1001_0;
         return;
@@ -204,8 +204,8 @@ void COEmcyInit(CO_EMCY *emcy, CO_NODE *node, CO_EMCY_TBL *root)
     }
 
     /* emergency cob-id is mandatory when an emergency table exists */
+    obj = CODictRef(&node->Dict, CO_DEV(0x1014,0), &emcy->Id);
     if (root != 0) {
-        obj = CODictFind(&node->Dict, CO_DEV(0x1014,0));
         if (obj == 0) {
             node->Error = CO_ERR_CFG_1014_0;
             return;
@@ -30,6 +30,7 @@ extern "C" {
 #include "co_err.h"
 
 #include "co_obj.h"
+#include "co_dict.h"
 
 /******************************************************************************
 * PUBLIC DEFINES
@@ -103,6 +104,7 @@ struct CO_OBJ_T;               /* Declaration of object entry structure      */
 *    management within the object dictionary.
 */
 typedef struct CO_EMCY_HIST_T {
+    CO_DICT_REF Ref;             /*!< Handle to EMCY history subindex 0      */
     uint8_t Max;                 /*!< Total length of EMCY history           */
     uint8_t Num;                 /*!< Number of EMCY in history              */
     uint8_t Off;                 /*!< Subindex-Offset to newest EMCY entry   */
@@ -140,6 +142,8 @@ typedef struct CO_EMCY_T {
     struct CO_NODE_T      *Node;                  /*!< parent node           */
     struct CO_EMCY_TBL_T  *Root;                  /*!< root to EMCY table    */
     struct CO_EMCY_HIST_T  Hist;                  /*!< EMCY history          */
+    struct CO_DICT_REF_T   Reg;                   /*!< handle to 1001h       */
+    struct CO_DICT_REF_T   Id;                    /*!< handle to 1014h       */
     uint8_t                Cnt[CO_EMCY_REG_NUM];  /*!< count register bits   */
     uint8_t                Err[CO_EMCY_STORAGE];  /*!< error status storage  */
 
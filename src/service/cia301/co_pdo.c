@@ -26,22 +26,61 @@
 * PRIVATE HELPER FUNCTION PROTOTYPES
 ******************************************************************************/
 
-static void COTPdoMapClear(CO_TPDO_LINK *map);
+static void     COTPdoMapClear(CO_TPDO_SIG *map);
+static uint16_t COTPdoMapHash(CO_OBJ *obj);
+static uint8_t  COPdoMapOp(CO_OBJ *obj, CO_NODE *node, uint8_t size);
 
 /******************************************************************************
 * PRIVATE HELPER FUNCTIONS
 ******************************************************************************/
 
-static void COTPdoMapClear(CO_TPDO_LINK *map)
+static void COTPdoMapClear(CO_TPDO_SIG *map)
 {
     uint16_t id;
 
-    for (id = 0; id < (CO_TPDO_N << 3); id++) {
-        map[id].Obj  = 0;
-        map[id].Num  = 0xFFFF;
+    for (id = 0; id < CO_TPDO_SIG_N; id++) {
+        map->Link[id].Obj  = 0;
+        map->Link[id].Next = CO_TPDO_SIG_END;
+        map->Head[id]      = CO_TPDO_SIG_END;
     }
 }
 
+static uint16_t COTPdoMapHash(CO_OBJ *obj)
+{
+    uint32_t pos;
+
+    /* hash the object address (index:subindex): the same object entry may
+     * be a kept element view; neighbours get neighbour chains */
+    pos = CO_GET_DEV(obj->Key) >> 8;
+    return ((uint16_t)(pos % CO_TPDO_SIG_N));
+}
+
+static uint8_t COPdoMapOp(CO_OBJ *obj, CO_NODE *node, uint8_t size)
+{
+    uint8_t  op = CO_PDO_OP_OBJ;
+    uint32_t sz;
+
+    /* plain integer objects without node-id offset are copied directly */
+    if (((obj->Type == CO_TUNSIGNED8 ) ||
+         (obj->Type == CO_TUNSIGNED16) ||
+         (obj->Type == CO_TUNSIGNED32)) &&
+        (CO_IS_NODEID(obj->Key) == 0)) {
+        sz = COObjGetSize(obj, node, 0L);
+        if ((sz == size) || ((sz == 4u) && (size == 3u))) {
+            if (CO_IS_DIRECT(obj->Key) != 0) {
+                op = CO_PDO_OP_DIR;
+            } else if (sz == 1u) {
+                op = CO_PDO_OP_REF8;
+            } else if (sz == 2u) {
+                op = CO_PDO_OP_REF16;
+            } else {
+                op = CO_PDO_OP_REF32;
+            }
+        }
+    }
+    return (op);
+}
+
 /******************************************************************************
 * PROTECTED API FUNCTIONS
 ******************************************************************************/
@@ -56,16 +95,17 @@ void COTPdoInit(CO_TPDO *pdo, CO_NODE *node)
     ASSERT_PTR_FATAL(pdo);
     ASSERT_PTR_FATAL(node);
     
-    COTPdoMapClear(node->TMap);
+    COTPdoMapClear(&node->TMap);
     for (num = 0; num < CO_TPDO_N; num++) {
         pdo[num].Node       = node;
         pdo[num].EvTmr      = -1;
         pdo[num].InTmr      = -1;
         pdo[num].Identifier = CO_TPDO_COBID_OFF;
         pdo[num].ObjNum     = 0;
-        for (on = 0; on < 8; on++) {
+        for (on = 0; on < CO_PDO_MAP_N; on++) {
             pdo[num].Map[on]  = 0;
             pdo[num].Size[on] = 0;
+            pdo[num].Op[on]   = CO_PDO_OP_OBJ;
         }
         err = CODictRdByte(&node->Dict, CO_DEV(0x1800 + num,0),&tnum);
         if (err == CO_ERR_NONE) {
@@ -92,6 +132,7 @@ void COTPdoReset(CO_TPDO *pdo, uint16_t num)
     cod  = &wp->Node->Dict;
     tmr  = &wp->Node->Tmr;
     sync = &pdo->Node->Sync;
+    COTPdoMapDelNum(&wp->Node->TMap, num);
     if (wp->EvTmr >= 0) {
         (void)COTmrDelete(tmr, wp->EvTmr);
         wp->EvTmr = -1;
@@ -170,12 +211,12 @@ CO_ERR COTPdoGetMap (CO_TPDO *pdo, uint16_t num)
     CO_ERR    err;
     uint8_t   mapnum;
     uint8_t   size;
-    uint8_t   dlc;
+    uint16_t  dlc;
 
     cod = &pdo[num].Node->Dict;
     idx = 0x1A00 + num;
     err = CODictRdByte(cod, CO_DEV(idx, 0), &mapnum);
-    if (err != CO_ERR_NONE) {
+    if ((err != CO_ERR_NONE) || (mapnum > CO_PDO_MAP_N)) {
         return (CO_ERR_TPDO_MAP_OBJ);
     }
 
@@ -189,16 +230,20 @@ CO_ERR COTPdoGetMap (CO_TPDO *pdo, uint16_t num)
 
         size = (uint8_t)(mapping & 0xFF) >> 3;
         dlc += size;
-        if (dlc > 8) {
+        if (dlc > CO_IF_FRM_DATA_N) {
             return (CO_ERR_TPDO_MAP_OBJ);
         }
         obj = CODictFind(&pdo->Node->Dict, mapping);
         if (obj == 0) {
             return (CO_ERR_TPDO_MAP_OBJ);
         } else {
+#if USE_OBJ_RANGE
+            obj = CODictKeep(cod, obj, &pdo[num].MapView[on]);
+#endif //USE_OBJ_RANGE
             pdo[num].Map[on]  = obj;
             pdo[num].Size[on] = size;
-            COTPdoMapAdd(pdo->Node->TMap, obj, num);
+            pdo[num].Op[on]   = COPdoMapOp(obj, pdo->Node, size);
+            COTPdoMapAdd(&pdo->Node->TMap, obj, num, (uint8_t)on);
         }
     }
     pdo[num].ObjNum = mapnum;
@@ -206,16 +251,45 @@ CO_ERR COTPdoGetMap (CO_TPDO *pdo, uint16_t num)
     return (CO_ERR_NONE);
 }
 
-void COTPdoMapAdd(CO_TPDO_LINK *map, CO_OBJ *obj, uint16_t num)
+void COTPdoMapAdd(CO_TPDO_SIG *map, CO_OBJ *obj, uint16_t num, uint8_t on)
 {
+    uint16_t hash;
     uint16_t id;
-    
-    for (id = 0; id < (CO_TPDO_N << 3); id++) {
-        if (map[id].Obj == 0) {
-            map[id].Obj = obj;
-            map[id].Num = num;
-            break;
+
+    hash = COTPdoMapHash(obj);
+    id   = map->Head[hash];
+    while (id != CO_TPDO_SIG_END) {
+        if ((CO_GET_DEV(map->Link[id].Obj->Key) == CO_GET_DEV(obj->Key)) &&
+            ((id / CO_PDO_MAP_N) == num)) {
+            return;
         }
+        id = map->Link[id].Next;
+    }
+
+    id = (uint16_t)((num * CO_PDO_MAP_N) + on);
+    map->Link[id].Obj  = obj;
+    map->Link[id].Next = map->Head[hash];
+    map->Head[hash]    = id;
+}
+
+void COTPdoMapDelNum(CO_TPDO_SIG *map, uint16_t num)
+{
+    uint16_t *prev;
+    uint16_t  id;
+    uint8_t   on;
+
+    for (on = 0; on < CO_PDO_MAP_N; on++) {
+        id = (uint16_t)((num * CO_PDO_MAP_N) + on);
+        if (map->Link[id].Obj == 0) {
+            continue;
+        }
+        prev = &map->Head[COTPdoMapHash(map->Link[id].Obj)];
+        while (*prev != id) {
+            prev = &map->Link[*prev].Next;
+        }
+        *prev              = map->Link[id].Next;
+        map->Link[id].Obj  = 0;
+        map->Link[id].Next = CO_TPDO_SIG_END;
     }
 }
 
@@ -227,16 +301,17 @@ void COTPdoClear(CO_TPDO *pdo, CO_NODE *node)
     ASSERT_PTR(pdo);
     ASSERT_PTR(node);
     
-    COTPdoMapClear(node->TMap);
+    COTPdoMapClear(&node->TMap);
     for (num = 0; num < CO_TPDO_N; num++) {
         pdo[num].Node       = node;
         pdo[num].EvTmr      = -1;
         pdo[num].InTmr      = -1;
         pdo[num].Identifier = CO_TPDO_COBID_OFF;
         pdo[num].ObjNum     = 0;
-        for (on = 0; on < 8; on++) {
+        for (on = 0; on < CO_PDO_MAP_N; on++) {
             pdo[num].Map[on]  = 0;
             pdo[num].Size[on] = 0;
+            pdo[num].Op[on]   = CO_PDO_OP_OBJ;
         }
     }
 }
@@ -266,11 +341,14 @@ void COTPdoTmrInhibit(void *parg)
 void COTPdoTx(CO_TPDO *pdo)
 {
     CO_TMR    *tmr;
+    CO_OBJ    *obj;
     CO_IF_FRM  frm;
     uint32_t   sz;
     uint8_t    pdosz;
     uint32_t   data;
     uint8_t    num;
+    uint8_t    op;
+    uint8_t    pos;
 
     if ((pdo->Node->Nmt.Allowed & CO_PDO_ALLOWED) == 0) {
         return;
@@ -310,10 +388,28 @@ void COTPdoTx(CO_TPDO *pdo)
     frm.DLC        = 0;
     for (num = 0; num < pdo->ObjNum; num++) {
         pdosz = pdo->Size[num];
-        if (pdosz <= 4) {
+        op    = pdo->Op[num];
+        if (op != CO_PDO_OP_OBJ) {
+            /* plain integer: copy value into frame (little endian) */
+            obj = pdo->Map[num];
+            if (op == CO_PDO_OP_DIR) {
+                data = (uint32_t)obj->Data;
+            } else if (op == CO_PDO_OP_REF8) {
+                data = *((uint8_t *)(obj->Data));
+            } else if (op == CO_PDO_OP_REF16) {
+                data = *((uint16_t *)(obj->Data));
+            } else {
+                data = *((uint32_t *)(obj->Data));
+            }
+            for (pos = 0; pos < pdosz; pos++) {
+                frm.Data[frm.DLC] = (uint8_t)data;
+                frm.DLC++;
+                data >>= 8;
+            }
+        } else if (pdosz <= 4) {
             /* supported mapping: 1 to 4 bytes */
             sz = COObjGetSize(pdo->Map[num], pdo->Node, 0L);
-            if (sz <= (uint32_t)(8 - frm.DLC)) {
+            if (sz <= (uint32_t)(CO_IF_FRM_DATA_N - frm.DLC)) {
                 if (pdosz == 3) {
                     /* for 3bytes, read a basic 32bit type */
                     COObjRdValue(pdo->Map[num], pdo->Node, &data, 4u);
@@ -339,7 +435,7 @@ void COTPdoTx(CO_TPDO *pdo)
         }
     }
 
-    COPdoTransmit(&frm);
+    CO_CB_PDO_TRANSMIT(pdo->Node, &frm);
     (void)COIfCanSend(&pdo->Node->If, &frm);
 }
 
@@ -350,15 +446,17 @@ void COTPdoTx(CO_TPDO *pdo)
 WEAK_TEST
 void COTPdoTrigObj(CO_TPDO *pdo, CO_OBJ *obj)
 {
-    uint32_t n;
-    uint16_t num;
+    CO_TPDO_SIG *map;
+    uint16_t     id;
 
     if (CO_IS_PDOMAP(obj->Key) != 0) {
-        for (n=0; n < (CO_TPDO_N << 3); n++) {
-            if (pdo->Node->TMap[n].Obj == obj) {
-                num = pdo->Node->TMap[n].Num;
-                COTPdoTrigPdo(pdo, num);
+        map = &pdo->Node->TMap;
+        id  = map->Head[COTPdoMapHash(obj)];
+        while (id != CO_TPDO_SIG_END) {
+            if (CO_GET_DEV(map->Link[id].Obj->Key) == CO_GET_DEV(obj->Key)) {
+                COTPdoTrigPdo(pdo, (uint16_t)(id / CO_PDO_MAP_N));
             }
+            id = map->Link[id].Next;
         }
     } else {
         pdo->Node->Error = CO_ERR_TPDO_OBJ_TRIGGER;
@@ -386,6 +484,7 @@ void CORPdoClear(CO_RPDO *pdo, CO_NODE *node)
         pdo[num].Identifier = 0;
         pdo[num].ObjNum     = 0;
     }
+    CODispInvalidate(node);
 }
 
 void CORPdoInit(CO_RPDO *pdo, CO_NODE *node)
@@ -422,16 +521,21 @@ CO_ERR CORPdoReset(CO_RPDO *pdo, uint16_t num)
     wp             = &pdo[num];
     cod            = &wp->Node->Dict;
     wp->Identifier = 0;
+    CODispInvalidate(wp->Node);
     wp->ObjNum     = 0;
-    for (on = 0; on < 8; on++) {
+    for (on = 0; on < CO_PDO_MAP_N; on++) {
         wp->Map[on]  = 0;
         wp->Size[on] = 0;
+        wp->Op[on]   = CO_PDO_OP_OBJ;
     }
 
     if ((wp->Flag & CO_RPDO_FLG_S_) != 0) {
         COSyncRemove(&pdo->Node->Sync, num, CO_SYNC_FLG_RX);
     }
     wp->Flag = 0;
+#if USE_CAN_TIMESTAMP
+    wp->Timestamp = 0;
+#endif //USE_CAN_TIMESTAMP
     
     /* communication */
     err = CODictRdByte(cod, CO_DEV(0x1400 + num, 2), &type);
@@ -482,14 +586,14 @@ CO_ERR CORPdoGetMap(CO_RPDO *pdo, uint16_t num)
     CO_ERR    err;
     uint8_t   on;
     uint8_t   mapnum;
-    uint8_t   dlc;
+    uint16_t  dlc;
     uint8_t   size;
     uint8_t   dummy = 0;
 
     cod = &pdo[num].Node->Dict;
     idx = 0x1600 + num;
     err = CODictRdByte(cod, CO_DEV(idx, 0), &mapnum);
-    if (err != CO_ERR_NONE) {
+    if ((err != CO_ERR_NONE) || (mapnum > CO_PDO_MAP_N)) {
         return (CO_ERR_RPDO_MAP_OBJ);
     }
 
@@ -502,7 +606,7 @@ CO_ERR CORPdoGetMap(CO_RPDO *pdo, uint16_t num)
 
         size = (uint8_t)(mapping & 0xFF) >> 3;
         dlc += size;
-        if (dlc > 8) {
+        if (dlc > CO_IF_FRM_DATA_N) {
             return (CO_ERR_RPDO_MAP_OBJ);
         }
         link = mapping >> 16;
@@ -528,8 +632,12 @@ CO_ERR CORPdoGetMap(CO_RPDO *pdo, uint16_t num)
             if (obj == 0) {
                 return (CO_ERR_RPDO_MAP_OBJ);
             } else {
+#if USE_OBJ_RANGE
+                obj = CODictKeep(cod, obj, &pdo[num].MapView[on + dummy]);
+#endif //USE_OBJ_RANGE
                 pdo[num].Map[on + dummy] = obj;
                 pdo[num].Size[on + dummy] = size;
+                pdo[num].Op[on + dummy] = COPdoMapOp(obj, pdo->Node, size);
             }
         }
     }
@@ -541,8 +649,11 @@ void CORPdoRx(CO_RPDO *pdo, CO_IF_FRM *frm)
 {
     int16_t err = 0;
 
-    err = COPdoReceive(frm);
+    err = CO_CB_PDO_RECEIVE(pdo->Node, frm);
     if (err == 0) {
+#if USE_CAN_TIMESTAMP
+        pdo->Timestamp = frm->Timestamp;
+#endif //USE_CAN_TIMESTAMP
         if ((pdo->Flag & CO_RPDO_FLG_S_) == 0) {
             CORPdoWrite(pdo, frm);
         } else {
@@ -558,33 +669,75 @@ CO_RPDO *CORPdoCheck(CO_RPDO *pdo, CO_IF_FRM *frm)
 
     n = 0;
     while (n < CO_RPDO_N) {
-        if ((pdo[n].Flag & CO_RPDO_FLG__E) != 0) {
-            if (pdo[n].Identifier == frm->Identifier) {
-                result = &pdo[n];
-                break;
-            }
+        result = CORPdoMatch(&pdo[n], frm);
+        if (result != NULL) {
+            break;
         }
         n++;
     }
     return (result);
 }
 
+CO_RPDO *CORPdoMatch(CO_RPDO *pdo, CO_IF_FRM *frm)
+{
+    CO_RPDO *result = NULL;
+
+    if ((pdo->Flag & CO_RPDO_FLG__E) != 0) {
+        if (pdo->Identifier == frm->Identifier) {
+            result = pdo;
+        }
+    }
+    return (result);
+}
+
 void CORPdoWrite(CO_RPDO *pdo, CO_IF_FRM *frm)
 {
     CO_OBJ  *obj;
     uint32_t val32;
+    uint32_t old32;
     uint16_t val16;
     uint8_t  val08;
     uint8_t  on;
     uint8_t  sz;
+    uint8_t  op;
+    uint8_t  pos;
     uint8_t  pdosz;
     uint8_t  dlc = 0;
 
     for (on = 0; on < pdo->ObjNum; on++) {
         obj   = pdo->Map[on];
         pdosz = pdo->Size[on];
+        op    = pdo->Op[on];
         if (obj != 0) {
-            if (pdosz <= 4) {
+            if (op != CO_PDO_OP_OBJ) {
+                /* plain integer: copy value out of frame (little endian) */
+                val32 = 0;
+                for (pos = pdosz; pos > 0; pos--) {
+                    val32 = (val32 << 8) | frm->Data[(dlc + pos - 1) & (CO_IF_FRM_DATA_N - 1)];
+                }
+                dlc += pdosz;
+                if (op == CO_PDO_OP_DIR) {
+                    old32     = (uint32_t)obj->Data;
+                    obj->Data = (CO_DATA)val32;
+                } else if (op == CO_PDO_OP_REF8) {
+                    old32 = *((uint8_t *)(obj->Data));
+                    *((uint8_t *)(obj->Data)) = (uint8_t)val32;
+                } else if (op == CO_PDO_OP_REF16) {
+                    old32 = *((uint16_t *)(obj->Data));
+                    *((uint16_t *)(obj->Data)) = (uint16_t)val32;
+                } else {
+                    old32 = *((uint32_t *)(obj->Data));
+                    *((uint32_t *)(obj->Data)) = val32;
+                }
+#if USE_PARA_DIRTY
+                COParaDirtyObj(pdo->Node, obj);
+#endif //USE_PARA_DIRTY
+                if ((CO_IS_ASYNC(obj->Key)  != 0    ) &&
+                    (CO_IS_PDOMAP(obj->Key) != 0    ) &&
+                    (old32                  != val32)) {
+                    COTPdoTrigObj(pdo->Node->TPdo, obj);
+                }
+            } else if (pdosz <= 4) {
                 /* supported mapping: 1 to 4 bytes */
                 sz = (uint8_t)COObjGetSize(obj, pdo->Node, 0L);
                 if (sz == 1u) {
@@ -51,6 +51,15 @@ extern "C" {
 #define CO_RPDO_FLG__E      0x01                    /*!< enabled RPDO        */
 #define CO_RPDO_FLG_S_      0x02                    /*!< synchronized RPDO   */
 
+#define CO_PDO_OP_OBJ       0      /*!< access via object type functions     */
+#define CO_PDO_OP_DIR       1      /*!< copy value stored in object data     */
+#define CO_PDO_OP_REF8      2      /*!< copy referenced 8bit variable        */
+#define CO_PDO_OP_REF16     3      /*!< copy referenced 16bit variable       */
+#define CO_PDO_OP_REF32     4      /*!< copy referenced 32bit variable       */
+
+#define CO_TPDO_SIG_N       (CO_TPDO_N * CO_PDO_MAP_N) /*!< number of TPDO links */
+#define CO_TPDO_SIG_END     0xFFFF        /*!< end of TPDO link chain          */
+
 
 /*! \brief RPDO COB-ID parameter
 *
@@ -167,28 +176,48 @@ extern "C" {
 
 struct CO_OBJ_T;
 
-/*! \brief TPDO SIGNAL LINK TABLE
+/*! \brief TPDO SIGNAL LINK
 *
-*    This structure holds all data, which are needed for managing the links
-*    from a signal to all TPDOs, which has active mapping entries to this
-*    signal.
+*    This structure holds a single link from a signal to a TPDO, which has
+*    an active mapping entry to this signal. The link of mapping entry 'on'
+*    in TPDO 'num' is located at position (num * 8 + on) in the link map,
+*    therefore the TPDO number is given by the link position.
 */
 typedef struct CO_TPDO_LINK_T {
-    struct CO_OBJ_T *Obj;        /*!< pointer to object                      */
-    uint16_t         Num;        /*!< currently mapped to TPDO-num (0..511)  */
+    struct CO_OBJ_T *Obj;        /*!< pointer to object (0 = unused)         */
+    uint16_t         Next;       /*!< next link with same object hash        */
 
 } CO_TPDO_LINK;
 
+/*! \brief TPDO SIGNAL LINK MAP
+*
+*    This structure holds the reverse index from a signal to all TPDOs,
+*    which has active mapping entries to this signal. The links are chained
+*    per object hash, so a signal trigger visits only the links of objects
+*    with the same hash.
+*/
+typedef struct CO_TPDO_SIG_T {
+    CO_TPDO_LINK Link[CO_TPDO_SIG_N];  /*!< link per TPDO mapping entry      */
+    uint16_t     Head[CO_TPDO_SIG_N];  /*!< first link per object hash       */
+
+} CO_TPDO_SIG;
+
 /*! \brief TPDO DATA
 *
 *    This structure holds all data, which are needed for managing a
-*    single TPDO.
+*    single TPDO. The copy operation of each mapped object is selected
+*    once in COTPdoGetMap(): plain integer objects are copied from their
+*    memory, all other objects are read via their object type functions.
 */
 typedef struct CO_TPDO_T {
     struct CO_NODE_T *Node;        /*!< link to parent CANopen node          */
     uint32_t          Identifier;  /*!< message identifier                   */
-    struct CO_OBJ_T  *Map[8];      /*!< pointer list with mapped objects     */
-    uint8_t           Size[8];     /*!< size of mapped object value in bytes */
+    struct CO_OBJ_T  *Map[CO_PDO_MAP_N];  /*!< mapped objects                  */
+    uint8_t           Size[CO_PDO_MAP_N]; /*!< size of mapped value in bytes   */
+    uint8_t           Op[CO_PDO_MAP_N];   /*!< copy operation of mapped object */
+#if USE_OBJ_RANGE
+    struct CO_OBJ_T   MapView[CO_PDO_MAP_N]; /*!< kept element views           */
+#endif //USE_OBJ_RANGE
     int16_t           EvTmr;       /*!< event timer id                       */
     uint32_t          Event;       /*!< event time in timer ticks            */
     int16_t           InTmr;       /*!< inhibit timer id                     */
@@ -201,15 +230,23 @@ typedef struct CO_TPDO_T {
 /*! \brief RPDO DATA
 *
 *    This structure holds all data, which are needed for managing a
-*    single RPDO.
+*    single RPDO. The copy operation of each mapped object is selected
+*    once in CORPdoGetMap() (see CO_TPDO).
 */
 typedef struct CO_RPDO_T {
     struct CO_NODE_T *Node;        /*!< link to parent CANopen node          */
     uint32_t          Identifier;  /*!< message identifier                   */
-    struct CO_OBJ_T  *Map[8];      /*!< pointer list with mapped objects     */
-    uint8_t           Size[8];     /*!< size of mapped object value in bytes */
+    struct CO_OBJ_T  *Map[CO_PDO_MAP_N];  /*!< mapped objects                  */
+    uint8_t           Size[CO_PDO_MAP_N]; /*!< size of mapped value in bytes   */
+    uint8_t           Op[CO_PDO_MAP_N];   /*!< copy operation of mapped object */
+#if USE_OBJ_RANGE
+    struct CO_OBJ_T   MapView[CO_PDO_MAP_N]; /*!< kept element views           */
+#endif //USE_OBJ_RANGE
     uint8_t           ObjNum;      /*!< Number of linked objects             */
     uint8_t           Flag;        /*!< Flags attributed of PDO              */
+#if USE_CAN_TIMESTAMP
+    uint64_t          Timestamp;   /*!< receive time of last accepted frame  */
+#endif //USE_CAN_TIMESTAMP
 
 } CO_RPDO;
 
@@ -354,18 +391,22 @@ void COTPdoTx(CO_TPDO *pdo);
 /*! \brief TPDO LINK MAP ADD
 *
 *    This function is used to add an entry into the signal to TPDO link
-*    mapping table.
+*    mapping table. An object, which is mapped multiple times into the
+*    same TPDO is linked only once.
 *
 * \param map
-*    Pointer to start of link mapping table
+*    Pointer to link mapping table
 *
 * \param obj
 *    Pointer to object entry
 *
 * \param num
 *    Linked TPDO number
+*
+* \param on
+*    Mapping entry within the TPDO (0..7)
 */
-void COTPdoMapAdd(CO_TPDO_LINK *map, struct CO_OBJ_T *obj, uint16_t num);
+void COTPdoMapAdd(CO_TPDO_SIG *map, struct CO_OBJ_T *obj, uint16_t num, uint8_t on);
 
 /*! \brief TPDO LINK MAP DEL VIA TPDO-NUM
 *
@@ -373,25 +414,12 @@ void COTPdoMapAdd(CO_TPDO_LINK *map, struct CO_OBJ_T *obj, uint16_t num);
 *    TPDO number.
 *
 * \param map
-*    Pointer to start of link mapping table
+*    Pointer to link mapping table
 *
 * \param num
 *    Linked TPDO number
 */
-void COTPdoMapDelNum(CO_TPDO_LINK *map, uint16_t num);
-
-/*! \brief TPDO LINK MAP DEL VIA SIGNAL-ID
-*
-*    This function is used to delete all entries, which contains the given
-*    signal identifier.
-*
-* \param map
-*    Pointer to start of link mapping table
-*
-* \param obj
-*    Pointer to object entry
-*/
-void COTPdoMapDelSig(CO_TPDO_LINK *map, struct CO_OBJ_T *obj);
+void COTPdoMapDelNum(CO_TPDO_SIG *map, uint16_t num);
 
 /*! \brief RPDO CLEAR
 *
@@ -482,6 +510,22 @@ CO_ERR CORPdoGetMap(CO_RPDO *pdo, uint16_t num);
 */
 CO_RPDO *CORPdoCheck(CO_RPDO *pdo, CO_IF_FRM *frm);
 
+/*! \brief RPDO MATCH
+*
+*    This function is used to check the received CAN message frame to be
+*    the given RPDO message.
+*
+* \param pdo
+*    Pointer to single RPDO
+*
+* \param frm
+*    Received CAN message frame
+*
+* \retval  !=NULL    Pointer to the given receive PDO
+* \retval  ==NULL    Not a CAN message for this RPDO
+*/
+CO_RPDO *CORPdoMatch(CO_RPDO *pdo, CO_IF_FRM *frm);
+
 /*! \brief RPDO RECEIVE
 *
 *    This function is responsible for the distribution of a RPDO into the
@@ -529,7 +573,8 @@ extern void COPdoTransmit(CO_IF_FRM *frm);
 *    is able to <i>consume</i> the PDO message frame, e.g. the distribution
 *    into the object dictionary will be skipped. Furthermore without
 *    <i>consuming</i> the PDO message frame, this function could modify the
-*    recieved data before distribution takes place.
+*    recieved data before distribution takes place. With USE_CAN_TIMESTAMP,
+*    the frame holds the receive time.
 *
 * \param frm
 *    Pointer to PDO message frame
@@ -102,6 +102,27 @@ extern "C"{
 #define CO_SDO_ERR_PARA_INCOMP  0x06040043    /*!< parameter incompatibility reason       */
 #define CO_SDO_ERR_GENERAL      0x08000000    /*!< General error                          */
 
+/*! \brief SDO segment payload
+*
+*    These macros define the number of data bytes in a segment of the
+*    segmented SDO transfer, the value of the 3-bit field 'n' (number of
+*    bytes without data) and the frame length of a segment carrying the
+*    given number of data bytes. In CAN FD build mode, a segment carries up
+*    to 63 data bytes; the field 'n' is zero for segments with 7 or more
+*    data bytes and the length of the last segment is derived from the
+*    transfer size.
+* \{
+*/
+#if USE_CAN_FD
+#define CO_SDO_SEG_DATA    63u
+#else
+#define CO_SDO_SEG_DATA     7u
+#endif
+
+#define CO_SDO_SEG_N(w)    (((w) < 7u) ? (7u - (w)) : 0u)
+#define CO_SDO_SEG_DLC(w)  (((w) < 7u) ? 8u : ((w) + 1u))
+/*! \} */
+
 #define CO_SDO_BUF_SEG     127
 #define CO_SDO_BUF_BYTE    (CO_SDO_BUF_SEG*7) /*!< transfer buffer size in byte           */
 
@@ -18,8 +18,68 @@
 * INCLUDES
 ******************************************************************************/
 
+#include <string.h>
+
 #include "co_core.h"
 
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void COSdoPendTimeout(void *parg);
+
+/******************************************************************************
+* PUBLIC API FUNCTIONS
+******************************************************************************/
+
+CO_ERR COSdoComplete(CO_SDO *srv, CO_ERR err)
+{
+    CO_IF_FRM frm;
+    CO_ERR    result;
+    uint8_t   mode;
+
+    ASSERT_PTR_ERR(srv, CO_ERR_BAD_ARG);
+
+    if (srv->Pend == 0) {
+        return (CO_ERR_BAD_ARG);
+    }
+    mode      = srv->Pend;
+    srv->Pend = 0;
+    if (srv->PendTmr >= 0) {
+        (void)COTmrDelete(&srv->Node->Tmr, srv->PendTmr);
+        srv->PendTmr = -1;
+    }
+
+    CO_SET_ID(&frm, srv->TxId);
+    CO_SET_DLC(&frm, 8u);
+    srv->Frm = &frm;
+    CO_SET_WORD(srv->Frm, srv->Idx, 1);
+    CO_SET_BYTE(srv->Frm, srv->Sub, 3);
+    if (err != CO_ERR_NONE) {
+        if (mode == CO_SDO_WR) {
+            COSdoAbortWrite(srv, err);
+        } else if (srv->Abort > 0) {
+            COSdoAbort(srv, srv->Abort);
+        } else {
+            COSdoAbort(srv, CO_SDO_ERR_TOS);
+        }
+        result = CO_ERR_SDO_ABORT;
+    } else if (mode == CO_SDO_WR) {
+        CO_SET_BYTE(srv->Frm, 0x60, 0);
+        CO_SET_LONG(srv->Frm,    0, 4);
+        srv->Obj = 0;
+        result   = CO_ERR_NONE;
+    } else {
+        result = COSdoUploadExpedited(srv);
+    }
+    if ((result == CO_ERR_NONE     ) ||
+        (result == CO_ERR_SDO_ABORT)) {
+        (void)COIfCanSend(&srv->Node->If, srv->Frm);
+    }
+    srv->Frm = 0;
+    return (CO_ERR_NONE);
+}
+
 /******************************************************************************
 * PROTECTED API FUNCTIONS
 ******************************************************************************/
@@ -57,6 +117,11 @@ void COSdoReset(CO_SDO *srv, uint8_t num, CO_NODE *node)
     srvnum->Seg.Num      = 0;
     srvnum->Seg.Size     = 0;
     srvnum->Blk.State    = BLK_IDLE;
+    srvnum->Blk.Crc      = CO_CRC16_INIT;
+    srvnum->Blk.CrcUse   = 0;
+    srvnum->Pend         = 0;
+    srvnum->PendTmr      = -1;
+    CODispInvalidate(node);
 }
 
 WEAK_TEST
@@ -75,6 +140,7 @@ void COSdoEnable(CO_SDO *srv, uint8_t num)
     srvnum->TxId = CO_SDO_ID_OFF;
 
     node = srv->Node;
+    CODispInvalidate(node);
     err  = CODictRdLong(&node->Dict, CO_DEV(0x1200 + num, 1), &rxId);
     if (err != CO_ERR_NONE) {
         return;
@@ -99,22 +165,30 @@ CO_SDO *COSdoCheck(CO_SDO *srv, CO_IF_FRM *frm)
     if (frm != 0) {
         n = 0;
         while ((n < CO_SSDO_N) && (result == 0)) {
-            if (CO_GET_ID(frm) == srv[n].RxId) {
-                CO_SET_ID(frm, srv[n].TxId);
-                srv[n].Frm   = frm;
-                srv[n].Abort = 0;
-                if (srv[n].Obj == 0) {
-                    srv[n].Idx = CO_GET_WORD(frm, 1);
-                    srv[n].Sub = CO_GET_BYTE(frm, 3);
-                }
-                result = &srv[n];
-            }
+            result = COSdoMatch(&srv[n], frm);
             n++;
         }
     }
     return (result);
 }
 
+CO_SDO *COSdoMatch(CO_SDO *srv, CO_IF_FRM *frm)
+{
+    CO_SDO *result = 0;
+
+    if (CO_GET_ID(frm) == srv->RxId) {
+        CO_SET_ID(frm, srv->TxId);
+        srv->Frm   = frm;
+        srv->Abort = 0;
+        if (srv->Obj == 0) {
+            srv->Idx = CO_GET_WORD(frm, 1);
+            srv->Sub = CO_GET_BYTE(frm, 3);
+        }
+        result = srv;
+    }
+    return (result);
+}
+
 CO_ERR COSdoResponse(CO_SDO *srv)
 {
     CO_ERR  result = CO_ERR_SDO_ABORT;
@@ -128,6 +202,14 @@ CO_ERR COSdoResponse(CO_SDO *srv)
         return (result);
     }
 
+    /* pending object access */
+    if (srv->Pend != 0) {
+        COSdoAbort(srv, CO_SDO_ERR_CMD);
+        COSdoAbortReq(srv);
+        CO_SET_DLC(srv->Frm, 8u);
+        return (result);
+    }
+
     /* active block transfer */
     if (srv->Blk.State == BLK_DOWNLOAD) {
         result = COSdoDownloadBlock(srv);
@@ -150,6 +232,10 @@ CO_ERR COSdoResponse(CO_SDO *srv)
             COSdoAbortReq(srv);
         }
         return (result);
+    } else if (srv->Blk.State == BLK_SENDING) {
+        COSdoAbort(srv, CO_SDO_ERR_CMD);
+        COSdoAbortReq(srv);
+        return (result);
     }
 
     /* expedited transfer */
@@ -174,6 +260,7 @@ CO_ERR COSdoResponse(CO_SDO *srv)
         result = COSdoDownloadSegmented(srv);
     } else if ((cmd & 0xEF) == 0x60) {
         result = COSdoUploadSegmented(srv);
+        return (result);
 
     /* block transfer */
     } else if ((cmd & 0xF9) == 0xC0) {
@@ -198,6 +285,17 @@ CO_ERR COSdoResponse(CO_SDO *srv)
     return (result);
 }
 
+void COSdoProcess(CO_SDO *srv)
+{
+    uint8_t n;
+
+    for (n = 0; n < CO_SSDO_N; n++) {
+        if (srv[n].Blk.State == BLK_SENDING) {
+            COSdoSendBlock(&srv[n]);
+        }
+    }
+}
+
 CO_ERR COSdoGetObject(CO_SDO *srv, uint16_t mode)
 {
     CO_ERR   result = CO_ERR_SDO_ABORT;
@@ -206,6 +304,9 @@ CO_ERR COSdoGetObject(CO_SDO *srv, uint16_t mode)
 
     key = CO_DEV(srv->Idx, srv->Sub);
     obj = CODictFind(&srv->Node->Dict, key);
+#if USE_OBJ_RANGE
+    obj = CODictKeep(&srv->Node->Dict, obj, &srv->View);
+#endif //USE_OBJ_RANGE
     if (obj != 0) {
         if (mode == CO_SDO_RD) {
             if (CO_IS_READ(obj->Key) != 0) {
@@ -269,6 +370,18 @@ uint32_t COSdoGetSize(CO_SDO *srv, uint32_t width, bool strict)
     return (result);
 }
 
+uint8_t *COSdoGetRegion(CO_SDO *srv, uint32_t size)
+{
+    uint8_t *result;
+    uint32_t num;
+
+    result = COObjRegion(srv->Obj, srv->Node, 0, &num);
+    if (num < size) {
+        result = 0;
+    }
+    return (result);
+}
+
 CO_ERR COSdoUploadExpedited(CO_SDO *srv)
 {
     CO_ERR   result = CO_ERR_SDO_ABORT;
@@ -282,7 +395,9 @@ CO_ERR COSdoUploadExpedited(CO_SDO *srv)
         return (result);
     } else if (size <= 4) {
         err = COObjRdValue(srv->Obj, srv->Node, (void *)&data, (uint8_t)size);
-        if (err != CO_ERR_NONE) {
+        if (err == CO_ERR_OBJ_PENDING) {
+            return (COSdoPend(srv, CO_SDO_RD));
+        } else if (err != CO_ERR_NONE) {
             if (srv->Abort > 0) {
                 COSdoAbort(srv, srv->Abort);
             } else {
@@ -323,22 +438,10 @@ CO_ERR COSdoDownloadExpedited(CO_SDO *srv)
     if ((size > 0) && (size <= 4)) {
         data   = CO_GET_LONG(srv->Frm, 4);
         err    = COObjWrValue(srv->Obj, srv->Node, (void*)&data, (uint8_t)size);
-        if (err != CO_ERR_NONE) {
-            if (srv->Abort > 0) {
-                COSdoAbort(srv, srv->Abort);
-            } else if (err == CO_ERR_OBJ_RANGE) {
-                COSdoAbort(srv, CO_SDO_ERR_RANGE);
-            } else if (err == CO_ERR_OBJ_MAP_TYPE) {
-                COSdoAbort(srv, CO_SDO_ERR_OBJ_MAP);
-            } else if (err == CO_ERR_OBJ_ACC) {
-                COSdoAbort(srv, CO_SDO_ERR_TOS);
-            } else if (err == CO_ERR_OBJ_MAP_LEN) {
-                COSdoAbort(srv, CO_SDO_ERR_OBJ_MAP_N);
-            } else if (err == CO_ERR_OBJ_INCOMPATIBLE) {
-                COSdoAbort(srv, CO_SDO_ERR_PARA_INCOMP);
-            } else {
-                COSdoAbort(srv, CO_SDO_ERR_TOS);
-            }
+        if (err == CO_ERR_OBJ_PENDING) {
+            result = COSdoPend(srv, CO_SDO_WR);
+        } else if (err != CO_ERR_NONE) {
+            COSdoAbortWrite(srv, err);
         } else {
             CO_SET_BYTE(srv->Frm, 0x60, 0);
             CO_SET_LONG(srv->Frm,    0, 4);
@@ -359,6 +462,42 @@ void COSdoAbort(CO_SDO *srv, uint32_t err)
     srv->Obj = 0;
 }
 
+void COSdoAbortWrite(CO_SDO *srv, CO_ERR err)
+{
+    if (srv->Abort > 0) {
+        COSdoAbort(srv, srv->Abort);
+    } else if (err == CO_ERR_OBJ_RANGE) {
+        COSdoAbort(srv, CO_SDO_ERR_RANGE);
+    } else if (err == CO_ERR_OBJ_MAP_TYPE) {
+        COSdoAbort(srv, CO_SDO_ERR_OBJ_MAP);
+    } else if (err == CO_ERR_OBJ_ACC) {
+        COSdoAbort(srv, CO_SDO_ERR_TOS);
+    } else if (err == CO_ERR_OBJ_MAP_LEN) {
+        COSdoAbort(srv, CO_SDO_ERR_OBJ_MAP_N);
+    } else if (err == CO_ERR_OBJ_INCOMPATIBLE) {
+        COSdoAbort(srv, CO_SDO_ERR_PARA_INCOMP);
+    } else {
+        COSdoAbort(srv, CO_SDO_ERR_TOS);
+    }
+}
+
+CO_ERR COSdoPend(CO_SDO *srv, uint8_t mode)
+{
+    uint32_t ticks;
+
+    srv->Pend    = mode;
+    ticks        = COTmrGetTicks(&srv->Node->Tmr, CO_SSDO_PEND_TMO, CO_TMR_UNIT_1MS);
+    srv->PendTmr = COTmrCreate(&srv->Node->Tmr, ticks, 0, &COSdoPendTimeout, srv);
+    if (srv->PendTmr < 0) {
+        /* without timeout, a lost completion would block the server */
+        srv->Pend    = 0;
+        srv->PendTmr = -1;
+        COSdoAbort(srv, CO_SDO_ERR_TOS);
+        return (CO_ERR_SDO_ABORT);
+    }
+    return (CO_ERR_SDO_SILENT);
+}
+
 CO_ERR COSdoInitUploadSegmented(CO_SDO *srv, uint32_t size)
 {
     CO_ERR  result = CO_ERR_NONE;
@@ -393,7 +532,9 @@ CO_ERR COSdoUploadSegmented(CO_SDO *srv)
     uint32_t width;
     uint8_t  cmd;
     uint8_t  c_bit  = 0;
-    uint8_t  i;
+
+    /* set DLC for the SDO response (abort or short segment) */
+    CO_SET_DLC(srv->Frm, 8u);
 
     if (srv->Obj == 0) {
         COSdoAbort(srv, CO_SDO_ERR_CMD);
@@ -407,8 +548,8 @@ CO_ERR COSdoUploadSegmented(CO_SDO *srv)
     }
 
     width = srv->Seg.Size - srv->Seg.Num;
-    if (width > 7) {
-        width = 7;
+    if (width > CO_SDO_SEG_DATA) {
+        width = CO_SDO_SEG_DATA;
     } else {
         c_bit = 1;
     }
@@ -419,20 +560,16 @@ CO_ERR COSdoUploadSegmented(CO_SDO *srv)
         return (CO_ERR_SDO_ABORT);
     }
 
-    srv->Buf.Cur = srv->Buf.Start;
-    for (i = 0; i < (uint8_t)width; i++) {
-        CO_SET_BYTE(srv->Frm, *(srv->Buf.Cur), 1 + i);
-        srv->Buf.Cur++;
-    }
-    for (i = (uint8_t)(width + 1); i <= 7; i++) {
-        CO_SET_BYTE(srv->Frm, 0, 1 + i);
-    }
+    (void)memcpy(&srv->Frm->Data[1], srv->Buf.Start, width);
+    (void)memset(&srv->Frm->Data[1 + width], 0, CO_SDO_SEG_DATA - width);
+    srv->Buf.Cur = srv->Buf.Start + width;
 
     cmd = (uint8_t)0x00 |
           (uint8_t)(srv->Seg.TBit << 4) |
-          (uint8_t)(((7 - width) << 1) & 0x0E) |
+          (uint8_t)((CO_SDO_SEG_N(width) << 1) & 0x0E) |
           (uint8_t)c_bit;
     CO_SET_BYTE(srv->Frm, cmd, 0);
+    CO_SET_DLC(srv->Frm, CO_SDO_SEG_DLC(width));
 
     if (c_bit == 1) {
         srv->Seg.Size  = 0;
@@ -495,7 +632,6 @@ CO_ERR COSdoDownloadSegmented(CO_SDO *srv)
     uint32_t len;
     uint8_t  n;
     uint8_t  cmd;
-    uint8_t  bid;
 
     cmd = CO_GET_BYTE(srv->Frm, 0);
     if ((cmd >> 4) != srv->Seg.TBit) {
@@ -503,24 +639,29 @@ CO_ERR COSdoDownloadSegmented(CO_SDO *srv)
         return (CO_ERR_SDO_ABORT);
     }
 
+    /* a segment holds the command byte and at least one data byte */
+    if (CO_GET_DLC(srv->Frm) < 2u) {
+        COSdoAbort(srv, CO_SDO_ERR_CMD);
+        return (CO_ERR_SDO_ABORT);
+    }
+
     n = ((cmd >> 1) & 0x07);
     if (n == 0) {
         num = srv->Seg.Size - srv->Seg.Num;
-        if (num > 7) {
-            num = 7;
+        if (num > CO_SDO_SEG_DATA) {
+            num = CO_SDO_SEG_DATA;
+        }
+        /* a classic segment within a CAN FD build holds 7 bytes only */
+        if (num > (uint32_t)CO_GET_DLC(srv->Frm) - 1u) {
+            num = (uint32_t)CO_GET_DLC(srv->Frm) - 1u;
         }
     } else {
         num = 7 - n;
     }
 
-    bid = 1;
-    while (num > 0) {
-        *(srv->Buf.Cur) = CO_GET_BYTE(srv->Frm, bid);
-        srv->Buf.Num++;
-        srv->Buf.Cur++;
-        bid++;
-        num--;
-    }
+    (void)memcpy(srv->Buf.Cur, &srv->Frm->Data[1], num);
+    srv->Buf.Num += num;
+    srv->Buf.Cur += num;
     srv->Seg.Num += srv->Buf.Num;
 
     len = (uint32_t)srv->Buf.Num;
@@ -582,10 +723,14 @@ CO_ERR COSdoInitDownloadBlock(CO_SDO *srv)
         srv->Blk.SegOk  = 0;
         srv->Blk.Size   = size;
         srv->Blk.Len    = size;
+        srv->Blk.Crc    = CO_CRC16_INIT;
+        srv->Blk.CrcUse = (uint8_t)((cmd >> 2) & 0x01);
+        srv->Blk.Region = 0;
         srv->Buf.Cur    = srv->Buf.Start;
         srv->Buf.Num    = 0;
 
-        CO_SET_BYTE(srv->Frm, 0xA0, 0);
+        /* confirm the CRC support (sc), when requested by the client (cc) */
+        CO_SET_BYTE(srv->Frm, (uint8_t)(0xA0 | (srv->Blk.CrcUse << 2)), 0);
         CO_SET_LONG(srv->Frm, (uint32_t)CO_SDO_BUF_SEG, 4);
         
         if (size <= 4) {
@@ -599,6 +744,13 @@ CO_ERR COSdoInitDownloadBlock(CO_SDO *srv)
             COSdoAbort(srv, CO_SDO_ERR_TOS);
             return (result);
         }
+        if (size > 4) {
+            /* receive the segments directly into the object memory */
+            srv->Blk.Region = COSdoGetRegion(srv, size);
+            if (srv->Blk.Region != 0) {
+                srv->Buf.Cur = srv->Blk.Region;
+            }
+        }
         result = CO_ERR_NONE;
     }
     return (result);
@@ -607,7 +759,9 @@ CO_ERR COSdoInitDownloadBlock(CO_SDO *srv)
 CO_ERR COSdoEndDownloadBlock(CO_SDO *srv)
 {
     CO_ERR   result = CO_ERR_SDO_ABORT;
+    uint8_t *buf;
     uint32_t len;
+    uint16_t crc;
     uint8_t  cmd;
     uint8_t  n;
 
@@ -615,21 +769,43 @@ CO_ERR COSdoEndDownloadBlock(CO_SDO *srv)
     if ((cmd & 0x01) != 0) {
         n      = (cmd & 0x1C) >> 2;
         len    = ((uint32_t)srv->Buf.Num - n);
-        result = COObjWrBufCont(srv->Obj, srv->Node, srv->Buf.Start, len);
-        if (result != CO_ERR_NONE) {
-            srv->Node->Error = CO_ERR_SDO_WRITE;
-            COSdoAbort(srv, CO_SDO_ERR_TOS);
+        buf    = srv->Buf.Start;
+        if (srv->Blk.Region != 0) {
+            /* the last block is already stored in the object memory */
+            buf = srv->Blk.Region;
+            if (len > (uint32_t)(srv->Buf.Cur - buf)) {
+                len = (uint32_t)(srv->Buf.Cur - buf);
+            }
+#if USE_PARA_DIRTY
+            COParaDirtyObj(srv->Node, srv->Obj);
+#endif //USE_PARA_DIRTY
+        }
+        if (srv->Blk.CrcUse != 0) {
+            crc = COCrc16(srv->Blk.Crc, buf, len);
+            if (crc != CO_GET_WORD(srv->Frm, 1)) {
+                COSdoAbort(srv, CO_SDO_ERR_CRC);
+                COSdoAbortReq(srv);
+                return (result);
+            }
+        }
+        if (srv->Blk.Region == 0) {
+            result = COObjWrBufCont(srv->Obj, srv->Node, buf, len);
+            if (result != CO_ERR_NONE) {
+                srv->Node->Error = CO_ERR_SDO_WRITE;
+                COSdoAbort(srv, CO_SDO_ERR_TOS);
+            }
         }
         CO_SET_BYTE(srv->Frm, 0xA1, 0);
         CO_SET_WORD(srv->Frm, 0, 1);
         CO_SET_BYTE(srv->Frm, 0, 3);
         CO_SET_LONG(srv->Frm, 0, 4);
 
-        srv->Blk.State = BLK_IDLE;
-        srv->Buf.Cur   = srv->Buf.Start;
-        srv->Buf.Num   = 0;
-        srv->Obj       = 0;
-        result         = CO_ERR_NONE;
+        srv->Blk.State  = BLK_IDLE;
+        srv->Blk.Region = 0;
+        srv->Buf.Cur    = srv->Buf.Start;
+        srv->Buf.Num    = 0;
+        srv->Obj        = 0;
+        result          = CO_ERR_NONE;
     }
     return (result);
 }
@@ -646,19 +822,27 @@ CO_ERR COSdoDownloadBlock(CO_SDO *srv)
     if ((cmd & 0x7F) == (srv->Blk.SegCnt + 1)) {
         /* check, that we need at least 1 byte out of the payload */
         if (srv->Blk.Len > 0) {
-            for (i = 0; i < 7; i++) {
-                *(srv->Buf.Cur) = CO_GET_BYTE(srv->Frm, 1 + i);
-                srv->Buf.Cur++;
-                srv->Buf.Num++;
-                if (srv->Blk.Len > 0) {
-                    srv->Blk.Len--;
-                }
+            if (srv->Blk.Len > 7) {
+                len = 7;
+            } else {
+                len = srv->Blk.Len;
+            }
+            if (srv->Blk.Region != 0) {
+                /* store only the payload, which fits into the object */
+                (void)memcpy(srv->Buf.Cur, &srv->Frm->Data[1], len);
+                srv->Buf.Cur += len;
+            } else {
+                (void)memcpy(srv->Buf.Cur, &srv->Frm->Data[1], 7);
+                srv->Buf.Cur += 7;
             }
+            srv->Buf.Num += 7;
+            srv->Blk.Len -= len;
         } else {
-            srv->Blk.State = BLK_IDLE;
-            srv->Buf.Cur   = srv->Buf.Start;
-            srv->Buf.Num   = 0;
-            srv->Obj       = 0;
+            srv->Blk.State  = BLK_IDLE;
+            srv->Blk.Region = 0;
+            srv->Buf.Cur    = srv->Buf.Start;
+            srv->Buf.Num    = 0;
+            srv->Obj        = 0;
             COSdoAbort(srv, CO_SDO_ERR_LEN_HIGH);
             result = CO_ERR_SDO_ABORT;
             return (result);
@@ -680,12 +864,24 @@ CO_ERR COSdoDownloadBlock(CO_SDO *srv)
 
         if (result == CO_ERR_NONE) {
             if ((cmd & 0x80) == 0) {
-                len = (uint32_t)srv->Buf.Num;
-                err = COObjWrBufCont(srv->Obj, srv->Node, srv->Buf.Start, len);
-                if (err != CO_ERR_NONE) {
-                    srv->Node->Error = CO_ERR_SDO_WRITE;
+                if (srv->Blk.Region != 0) {
+                    /* block is received in object memory; continue behind */
+                    len = (uint32_t)(srv->Buf.Cur - srv->Blk.Region);
+                    if (srv->Blk.CrcUse != 0) {
+                        srv->Blk.Crc = COCrc16(srv->Blk.Crc, srv->Blk.Region, len);
+                    }
+                    srv->Blk.Region = srv->Buf.Cur;
+                } else {
+                    len = (uint32_t)srv->Buf.Num;
+                    if (srv->Blk.CrcUse != 0) {
+                        srv->Blk.Crc = COCrc16(srv->Blk.Crc, srv->Buf.Start, len);
+                    }
+                    err = COObjWrBufCont(srv->Obj, srv->Node, srv->Buf.Start, len);
+                    if (err != CO_ERR_NONE) {
+                        srv->Node->Error = CO_ERR_SDO_WRITE;
+                    }
+                    srv->Buf.Cur = srv->Buf.Start;
                 }
-                srv->Buf.Cur = srv->Buf.Start;
                 srv->Buf.Num = 0;
             }
         }
@@ -739,18 +935,30 @@ CO_ERR COSdoInitUploadBlock(CO_SDO *srv)
         }
     }
 
+    /* confirm the CRC support (sc), when requested by the client (cc) */
+    srv->Blk.Crc    = CO_CRC16_INIT;
+    srv->Blk.CrcUse = (uint8_t)((CO_GET_BYTE(srv->Frm, 0) >> 2) & 0x01);
+
     size  = srv->Blk.Size;
-    cmd   = 0xC2;
+    cmd   = (uint8_t)(0xC2 | (srv->Blk.CrcUse << 2));
 
     srv->Blk.LastValid = 0xFF;
     srv->Blk.Len       = srv->Blk.Size;
     srv->Blk.SegOk     = 0;
+    srv->Blk.Region    = 0;
+    srv->Buf.Cur       = srv->Buf.Start;
 
     if (size <= 4) {
         /* no action for basic type entry */
         err = CO_ERR_NONE;
     } else {
         err = COObjRdBufStart(srv->Obj, srv->Node, srv->Buf.Cur, 0);
+
+        /* send the segments directly out of the object memory */
+        srv->Blk.Region = COSdoGetRegion(srv, size);
+        if (srv->Blk.Region != 0) {
+            srv->Buf.Cur = srv->Blk.Region;
+        }
     }
     if (err != CO_ERR_NONE) {
         srv->Node->Error = CO_ERR_SDO_READ;
@@ -764,15 +972,13 @@ CO_ERR COSdoUploadBlock(CO_SDO *srv)
 {
     CO_ERR   result = CO_ERR_SDO_SILENT;
     CO_ERR   err;
-    uint32_t size;
     uint32_t num = 0;
-    uint32_t txNum;
     uint32_t byteOk = 0;
-    uint8_t *txBuf;
-    uint8_t  finished =  0;
-    uint8_t  seg;
-    uint8_t  len;
-    uint8_t  i;
+
+    if (srv->Blk.Region != 0) {
+        COSdoUploadRegion(srv);
+        return (result);
+    }
 
     srv->Buf.Cur = srv->Buf.Start;
     srv->Buf.Num = 0u;
@@ -790,15 +996,8 @@ CO_ERR COSdoUploadBlock(CO_SDO *srv)
         }
         if (srv->Blk.SegOk > 0) {
             /* remove successful transfered bytes at the front */
-            srv->Buf.Cur  = srv->Buf.Start;
-            txBuf         = srv->Buf.Start + byteOk;
-            txNum         = num;
-            while(txNum > 0) {
-                *srv->Buf.Cur = *txBuf;
-                srv->Buf.Cur++;
-                txBuf++;
-                txNum--;
-            }
+            (void)memmove(srv->Buf.Start, srv->Buf.Start + byteOk, num);
+            srv->Buf.Cur  = srv->Buf.Start + num;
         } else {
             /* repeat whole buffer (no remaining bytes needed) */
             num = 0u;
@@ -812,6 +1011,9 @@ CO_ERR COSdoUploadBlock(CO_SDO *srv)
             if (err != CO_ERR_NONE) {
                 srv->Node->Error = CO_ERR_SDO_READ;
             }
+            if (srv->Blk.CrcUse != 0) {
+                srv->Blk.Crc = COCrc16(srv->Blk.Crc, srv->Buf.Cur, num);
+            }
             srv->Blk.Size -= num;
         } else {
             /* read remaining data from object entry in buffer */
@@ -823,17 +1025,32 @@ CO_ERR COSdoUploadBlock(CO_SDO *srv)
             if (err != CO_ERR_NONE) {
                 srv->Node->Error = CO_ERR_SDO_READ;
             }
+            if (srv->Blk.CrcUse != 0) {
+                srv->Blk.Crc = COCrc16(srv->Blk.Crc, srv->Buf.Cur, srv->Blk.Size);
+            }
             srv->Blk.Size = 0;
         }
     }
 
-    /* set DLC for block transfers */
-    CO_SET_DLC(srv->Frm, 8u);
-
-    srv->Blk.State  = BLK_UPLOAD;
+    srv->Blk.State  = BLK_SENDING;
     srv->Blk.SegCnt = 1;
     srv->Buf.Cur    = srv->Buf.Start;
-    while ((srv->Blk.SegCnt <= srv->Blk.SegNum) && (finished == 0)) {
+    COSdoSendBlock(srv);
+    return (result);
+}
+
+void COSdoSendBlock(CO_SDO *srv)
+{
+    CO_IF_FRM frm;
+    int16_t   credit;
+    uint32_t  size;
+    uint8_t   seg;
+    uint8_t   len;
+
+    credit = COIfCanTxFree(&srv->Node->If);
+    CO_SET_ID(&frm, srv->TxId);
+    CO_SET_DLC(&frm, 8u);
+    while ((srv->Blk.State == BLK_SENDING) && (credit > 0)) {
         seg  = srv->Blk.SegCnt;
         size = srv->Blk.Len;
         if (size > 7) {
@@ -842,31 +1059,27 @@ CO_ERR COSdoUploadBlock(CO_SDO *srv)
             if (srv->Blk.SegCnt < srv->Blk.SegNum) {
                 srv->Blk.SegCnt++;
             } else {
-                finished = 1;
+                srv->Blk.State = BLK_UPLOAD;
             }
         } else {
-            len          = (uint8_t)size;
-            srv->Blk.Len = 0;
-            finished     = 1;
+            len            = (uint8_t)size;
+            srv->Blk.Len   = 0;
+            srv->Blk.State = BLK_UPLOAD;
         }
-        if (finished == 1) {
+        if (srv->Blk.State == BLK_UPLOAD) {
             if (srv->Blk.Len == 0) {
                 seg |= 0x80;
             }
             srv->Blk.LastValid  = len;
         }
-        CO_SET_BYTE(srv->Frm, seg, 0);
-        for (i = 0; i < len; i++) {
-            CO_SET_BYTE(srv->Frm, *(srv->Buf.Cur), 1+i);
-            srv->Buf.Cur++;
-            srv->Buf.Num--;
-        }
-        for (i = (uint8_t)len; i < 7; i++) {
-            CO_SET_BYTE(srv->Frm, 0, 1 + i);
-        }
-        (void)COIfCanSend(&srv->Node->If, srv->Frm);
+        CO_SET_BYTE(&frm, seg, 0);
+        (void)memcpy(&frm.Data[1], srv->Buf.Cur, len);
+        (void)memset(&frm.Data[1 + len], 0, 7u - len);
+        srv->Buf.Cur += len;
+        srv->Buf.Num -= len;
+        (void)COIfCanSend(&srv->Node->If, &frm);
+        credit--;
     }
-    return (result);
 }
 
 CO_ERR COSdoAckUploadBlock(CO_SDO *srv)
@@ -896,6 +1109,9 @@ CO_ERR COSdoAckUploadBlock(CO_SDO *srv)
             for (i = 1; i <= 7; i++) {
                 CO_SET_BYTE(srv->Frm, 0, i);
             }
+            if (srv->Blk.CrcUse != 0) {
+                CO_SET_WORD(srv->Frm, srv->Blk.Crc, 1);
+            }
             result = CO_ERR_NONE;
         }
     } else {
@@ -915,24 +1131,110 @@ CO_ERR COSdoAckUploadBlock(CO_SDO *srv)
     return (result);
 }
 
+void COSdoUploadRegion(CO_SDO *srv)
+{
+    uint32_t byteOk;
+    uint32_t num;
+
+    if (srv->Blk.State == BLK_REPEAT) {
+        /* restore the unacknowledged bytes and skip the acknowledged */
+        byteOk        = srv->Blk.SegOk * 7u;
+        num           = (srv->Blk.SegCnt * 7u) - byteOk;
+        srv->Blk.Len += num;
+        if (srv->Blk.LastValid < 7) {
+            srv->Blk.Len -= (7u - srv->Blk.LastValid);
+        }
+        srv->Blk.Region += byteOk;
+    } else {
+        /* continue behind the completely acknowledged block */
+        srv->Blk.Region  = srv->Buf.Cur;
+    }
+
+    num = srv->Blk.SegNum * 7u;
+    if (num > srv->Blk.Len) {
+        num = srv->Blk.Len;
+    }
+
+    /* the CRC covers all bytes up to the remaining size of the object */
+    byteOk = srv->Blk.Len - srv->Blk.Size;
+    if (num > byteOk) {
+        if (srv->Blk.CrcUse != 0) {
+            srv->Blk.Crc = COCrc16(srv->Blk.Crc, srv->Blk.Region + byteOk, num - byteOk);
+        }
+        srv->Blk.Size -= (num - byteOk);
+    }
+
+    srv->Blk.State  = BLK_SENDING;
+    srv->Blk.SegCnt = 1;
+    srv->Buf.Cur    = srv->Blk.Region;
+    srv->Buf.Num    = num;
+    COSdoSendBlock(srv);
+}
+
 CO_ERR COSdoEndUploadBlock(CO_SDO *srv)
 {
     CO_ERR result = CO_ERR_SDO_SILENT;
 
-    srv->Blk.State = BLK_IDLE;
-    srv->Obj       = 0;
+    srv->Blk.State  = BLK_IDLE;
+    srv->Blk.Region = 0;
+    srv->Buf.Cur    = srv->Buf.Start;
+    srv->Obj        = 0;
     return (result);
 }
 
 void COSdoAbortReq(CO_SDO *srv)
 {
+#if USE_PARA_DIRTY
+    if ((srv->Blk.State == BLK_DOWNLOAD) && (srv->Blk.Region != 0)) {
+        /* the received segments are already stored in the object memory */
+        COParaDirtyObj(srv->Node, srv->Obj);
+    }
+#endif //USE_PARA_DIRTY
     srv->Obj       =  0;
     srv->Idx       =  0;
     srv->Sub       =  0;
     srv->Buf.Cur   =  srv->Buf.Start;
     srv->Buf.Num   =  0;
     srv->Blk.State =  BLK_IDLE;
+    srv->Blk.Region = 0;
     srv->Seg.Num   =  0;
     srv->Seg.Size  =  0;
     srv->Seg.TBit  =  0;
+    if (srv->Pend != 0) {
+        srv->Pend = 0;
+        if (srv->PendTmr >= 0) {
+            (void)COTmrDelete(&srv->Node->Tmr, srv->PendTmr);
+            srv->PendTmr = -1;
+        }
+    }
+}
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  PENDING OBJECT ACCESS TIMEOUT
+*
+*    This timer callback function aborts the SDO request, when the pending
+*    object access is not completed in time.
+*
+* \param parg
+*    Ptr to SDO server
+*/
+static void COSdoPendTimeout(void *parg)
+{
+    CO_IF_FRM  frm;
+    CO_SDO    *srv = (CO_SDO *)parg;
+
+    if (srv->Pend == 0) {
+        return;
+    }
+    srv->PendTmr = -1;
+    CO_SET_ID(&frm, srv->TxId);
+    CO_SET_DLC(&frm, 8u);
+    srv->Frm = &frm;
+    COSdoAbort(srv, CO_SDO_ERR_TIMEOUT);
+    COSdoAbortReq(srv);
+    (void)COIfCanSend(&srv->Node->If, &frm);
+    srv->Frm = 0;
 }
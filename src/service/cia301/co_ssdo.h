@@ -26,6 +26,8 @@ extern "C" {
 ******************************************************************************/
 
 #include "co_types.h"
+#include "co_cfg.h"
+#include "co_obj.h"
 #include "co_sdo.h"
 #include "co_if.h"
 
@@ -63,7 +65,8 @@ typedef enum CO_SDO_BLK_STATE_T {
     BLK_DOWNLOAD,                /*!< block download active                  */
     BLK_UPLOAD,                  /*!< block upload active                    */
     BLK_REPEAT,                  /*!< block upload repeat request active     */
-    BLK_DNWAIT                   /*!< block download wait for next block/end */
+    BLK_DNWAIT,                  /*!< block download wait for next block/end */
+    BLK_SENDING                  /*!< block upload segments pending for send */
 
 } CO_SDO_BLK_STATE;
 
@@ -80,6 +83,9 @@ typedef struct CO_SDO_BLK_T {
     uint8_t                 SegCnt;     /*!< current segment number          */
     uint8_t                 SegOk;      /*!< last successfull sent segment   */
     uint8_t                 LastValid;  /*!< valid bytes in last segment     */
+    uint16_t                Crc;        /*!< CRC of transfered data          */
+    uint8_t                 CrcUse;     /*!< CRC is used (client supports it)*/
+    uint8_t                *Region;     /*!< block start in object memory    */
 
 } CO_SDO_BLK;
 
@@ -100,9 +106,41 @@ typedef struct CO_SDO_T {
     struct CO_SDO_BUF_T Buf;     /*!< Transfer buffer management structure   */
     struct CO_SDO_SEG_T Seg;     /*!< Segmented transfer control structure   */
     struct CO_SDO_BLK_T Blk;     /*!< Block transfer control structure       */
+    uint8_t             Pend;    /*!< Pending object access (CO_SDO_RD/WR)   */
+    int16_t             PendTmr; /*!< Timer action for pending timeout       */
+#if USE_OBJ_RANGE
+    struct CO_OBJ_T     View;    /*!< Kept element view of range object      */
+#endif //USE_OBJ_RANGE
 
 } CO_SDO;
 
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  COMPLETE PENDING OBJECT ACCESS
+*
+*    This function completes a pending object access of the given SDO
+*    server. An object type function indicates a pending access with the
+*    return value CO_ERR_OBJ_PENDING, and the SDO server holds the response
+*    until this function is called (or until the timeout CO_SSDO_PEND_TMO
+*    is elapsed).
+*
+*    For a pending write access, the given error is the result of the
+*    write. For a pending read access with CO_ERR_NONE, the object type
+*    read function is called again and must provide the value.
+*
+* \param srv
+*    Ptr to SDO server with the pending access (e.g. &node->Sdo[0])
+*
+* \param err
+*    Result of the object access (CO_ERR_NONE on success)
+*
+* \retval  ==CO_ERR_NONE    the SDO response is sent
+* \retval  !=CO_ERR_NONE    no pending object access in this SDO server
+*/
+CO_ERR COSdoComplete(CO_SDO *srv, CO_ERR err);
+
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
@@ -170,6 +208,22 @@ void COSdoEnable(CO_SDO *srv, uint8_t num);
 */
 CO_SDO *COSdoCheck(CO_SDO *srv, CO_IF_FRM *frm);
 
+/*! \brief  MATCH SDO FRAME
+*
+*    This function checks the given frame to be a SDO request for the given
+*    SDO server. The frame is prepared as described in \ref COSdoCheck().
+*
+* \param srv
+*    Ptr to single SDO server
+*
+* \param frm
+*    Frame, received from CAN bus
+*
+* \retval  >0    pointer to given SDO server
+* \retval  =0    not a SDO request for this SDO server
+*/
+CO_SDO *COSdoMatch(CO_SDO *srv, CO_IF_FRM *frm);
+
 /*! \brief  GENERATE SDO RESPONSE
 *
 *    This function interprets the data byte #0 of the SDO request and
@@ -183,6 +237,18 @@ CO_SDO *COSdoCheck(CO_SDO *srv, CO_IF_FRM *frm);
 */
 CO_ERR COSdoResponse(CO_SDO *srv);
 
+/*! \brief  SDO BACKGROUND PROCESSING
+*
+*    This function continues the pending block upload segments of all SDO
+*    servers. The segments are sent as long as the CAN driver reports free
+*    transmit slots (\see COIfCanTxFree()). The function is called within
+*    CONodeProcess() and CONodeProcessBatch().
+*
+* \param srv
+*    Ptr to root element of SDO server array
+*/
+void COSdoProcess(CO_SDO *srv);
+
 /*! \brief  GET ADDRESSED OBJECT
 *
 *    This function looks for the addressed object in the object dictionary
@@ -223,6 +289,24 @@ CO_ERR COSdoGetObject(CO_SDO *srv, uint16_t mode);
 */
 uint32_t COSdoGetSize(CO_SDO *srv, uint32_t width, bool strict);
 
+/*! \brief  GET MEMORY REGION OF OBJECT
+*
+*    This function checks, that the addressed object provides a contiguous
+*    memory region for the given number of bytes. A block transfer with
+*    such an object streams the data directly from and into the object
+*    memory instead of staging it in the SDO transfer buffer.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \param size
+*    Number of bytes of the transfer
+*
+* \retval  =0    Object provides no (or a too small) memory region
+* \retval  >0    Start of the memory region of the object
+*/
+uint8_t *COSdoGetRegion(CO_SDO *srv, uint32_t size);
+
 /*! \brief  EXPEDITED UPLOAD PROTOCOL
 *
 *    This function generates the response for a SDO expedited upload request.
@@ -263,6 +347,36 @@ CO_ERR COSdoDownloadExpedited(CO_SDO *srv);
 */
 void COSdoAbort(CO_SDO *srv, uint32_t err);
 
+/*! \brief  ABORT WRITE ACCESS
+*
+*    This function generates an SDO abort for a failed object write access
+*    and translates the given object error into the SDO abort code.
+*
+* \param srv
+*    Ptr to addressed SDO server
+*
+* \param err
+*    Error of the object write access
+*/
+void COSdoAbortWrite(CO_SDO *srv, CO_ERR err);
+
+/*! \brief  HOLD PENDING OBJECT ACCESS
+*
+*    This function holds the SDO response for a pending object access and
+*    starts the timeout for the completion with COSdoComplete(). If the
+*    timeout can't be started, the request is aborted.
+*
+* \param srv
+*    Ptr to addressed SDO server
+*
+* \param mode
+*    Pending object access (CO_SDO_RD or CO_SDO_WR)
+*
+* \retval  CO_ERR_SDO_SILENT    no response until completion
+* \retval  CO_ERR_SDO_ABORT     abort response (no timer available)
+*/
+CO_ERR COSdoPend(CO_SDO *srv, uint8_t mode);
+
 /*! \brief  INIT SEGMENTED UPLOAD
 *
 *    This function generates the response for 'Initiate SDO Upload Protocol'.
@@ -487,6 +601,31 @@ CO_ERR COSdoInitUploadBlock(struct CO_SDO_T *srv);
 */
 CO_ERR COSdoUploadBlock(struct CO_SDO_T *srv);
 
+/*! \brief  UPLOAD BLOCK FROM MEMORY REGION
+*
+*    This function prepares the next (or repeated) block of a block upload
+*    out of the memory region of the object and starts sending the block
+*    segments. The CRC is calculated once for each byte of the object, even
+*    if the block is repeated.
+*
+* \param srv
+*    Pointer to SDO server object
+*/
+void COSdoUploadRegion(struct CO_SDO_T *srv);
+
+/*! \brief  SEND BLOCK UPLOAD SEGMENTS
+*
+*    This function sends the pending segments of the current block upload.
+*    The sending stops when the CAN driver reports no free transmit slot,
+*    and is continued with the next call of \ref COSdoProcess(). After the
+*    last segment of the block, the server waits for the confirmation of
+*    the client.
+*
+* \param srv
+*    Pointer to SDO server object
+*/
+void COSdoSendBlock(struct CO_SDO_T *srv);
+
 /*! \brief  CONFIRM BLOCK UPLOAD
 *
 *    This function generates the response for 'Upload SDO Block Segment
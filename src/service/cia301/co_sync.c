@@ -36,6 +36,10 @@ void COSyncInit(CO_SYNC *sync, struct CO_NODE_T *node)
     sync->Tmr   = -1;
     sync->Cycle = 0;
     sync->CobId = 0;
+    CODispInvalidate(node);
+#if USE_CAN_TIMESTAMP
+    COSyncStatReset(sync);
+#endif //USE_CAN_TIMESTAMP
 
     for (i = 0; i < CO_TPDO_N; i++) {
         sync->TSync[i] = 0;
@@ -88,7 +92,7 @@ void COSyncRx(CO_SYNC *sync, CO_IF_FRM *frm)
 
     for (i = 0; i < CO_RPDO_N; i++) {
         if (sync->RPdo[i]->Identifier == frm->Identifier) {
-            for (n=0; n < 8; n++) {
+            for (n=0; n < (int16_t)CO_IF_FRM_DATA_N; n++) {
                 sync->RFrm[i].Data[n] = frm->Data[n];
             }
             sync->RFrm[i].DLC = frm->DLC;
@@ -101,8 +105,26 @@ int16_t COSyncUpdate(CO_SYNC *sync, CO_IF_FRM *frm)
 {
     int16_t result = -1;
     uint8_t i;
+#if USE_CAN_TIMESTAMP
+    CO_SYNC_STAT *stat = &sync->Stat;
+    uint32_t      period;
+#endif //USE_CAN_TIMESTAMP
 
     if (frm->Identifier == (sync->CobId & CO_SYNC_COBID_MASK)) {
+#if USE_CAN_TIMESTAMP
+        if (stat->Last != 0) {
+            period       = (uint32_t)(frm->Timestamp - stat->Last);
+            stat->Period = period;
+            if ((stat->Num == 0) || (period < stat->Min)) {
+                stat->Min = period;
+            }
+            if ((stat->Num == 0) || (period > stat->Max)) {
+                stat->Max = period;
+            }
+            stat->Num++;
+        }
+        stat->Last = frm->Timestamp;
+#endif //USE_CAN_TIMESTAMP
         for (i = 0; i < CO_TPDO_N; i++) {
             if (sync->TPdo[i] != 0) {
                 sync->TSync[i]++;
@@ -122,8 +144,34 @@ void COSyncRestart(CO_SYNC *sync)
             sync->TSync[i] = 0;
         }
     }
+#if USE_CAN_TIMESTAMP
+    COSyncStatReset(sync);
+#endif //USE_CAN_TIMESTAMP
+}
+
+#if USE_CAN_TIMESTAMP
+
+uint32_t COSyncJitter(CO_SYNC *sync)
+{
+    uint32_t result = 0;
+
+    if (sync->Stat.Num > 0) {
+        result = sync->Stat.Max - sync->Stat.Min;
+    }
+    return (result);
 }
 
+void COSyncStatReset(CO_SYNC *sync)
+{
+    sync->Stat.Last   = 0;
+    sync->Stat.Num    = 0;
+    sync->Stat.Period = 0;
+    sync->Stat.Min    = 0;
+    sync->Stat.Max    = 0;
+}
+
+#endif //USE_CAN_TIMESTAMP
+
 void COSyncHandler (CO_SYNC *sync)
 {
     uint8_t i;
@@ -41,6 +41,24 @@ extern "C" {
 * PUBLIC TYPES
 ******************************************************************************/
 
+#if USE_CAN_TIMESTAMP
+
+/*! \brief SYNC INTERVAL STATISTICS
+*
+*    This structure holds the intervals between the received SYNC messages,
+*    measured with the receive timestamps of the CAN driver. The intervals
+*    use the unit of the timestamps.
+*/
+typedef struct CO_SYNC_STAT_T {
+    uint64_t          Last;             /*!< receive time of last SYNC (0: -) */
+    uint32_t          Num;              /*!< number of measured intervals    */
+    uint32_t          Period;           /*!< last SYNC interval              */
+    uint32_t          Min;              /*!< minimal SYNC interval           */
+    uint32_t          Max;              /*!< maximal SYNC interval           */
+} CO_SYNC_STAT;
+
+#endif //USE_CAN_TIMESTAMP
+
 /*! \brief SYNCHRONOUS PDO TABLE
 *
 *    This structure contains all needed data to handle synchronous PDOs.
@@ -56,6 +74,9 @@ typedef struct CO_SYNC_T {
     struct CO_TPDO_T *TPdo[CO_TPDO_N];  /*!< Pointer to synchronous TPDO     */
     uint8_t           TNum[CO_TPDO_N];  /*!< SYNCs until PDO shall be sent   */
     uint8_t           TSync[CO_TPDO_N]; /*!< SYNC time when tx must occur    */
+#if USE_CAN_TIMESTAMP
+    CO_SYNC_STAT      Stat;             /*!< SYNC interval statistics        */
+#endif //USE_CAN_TIMESTAMP
 
 } CO_SYNC;
 
@@ -165,6 +186,33 @@ void COSyncRestart(CO_SYNC *sync);
  */
 void COSyncProdSend(void *parg);
 
+#if USE_CAN_TIMESTAMP
+
+/*! \brief GET SYNC JITTER
+*
+*    This function returns the peak-to-peak jitter of the received SYNC
+*    messages, e.g. the difference between the maximal and the minimal
+*    SYNC interval since the last restart of the SYNC timing.
+*
+* \param sync
+*    Pointer to SYNC object
+*
+* \retval  the SYNC jitter (unit of the CAN frame timestamps)
+*/
+uint32_t COSyncJitter(CO_SYNC *sync);
+
+/*! \brief RESET SYNC STATISTICS
+*
+*    This function clears the SYNC interval statistics. The next interval
+*    is measured from the next received SYNC message.
+*
+* \param sync
+*    Pointer to SYNC object
+*/
+void COSyncStatReset(CO_SYNC *sync);
+
+#endif //USE_CAN_TIMESTAMP
+
 /******************************************************************************
 * CALLBACK FUNCTIONS
 ******************************************************************************/
@@ -172,7 +220,9 @@ void COSyncProdSend(void *parg);
 /*! \brief  SYNC UPDATE
 *
 *    This function is called just after the synchronized RPDO is written to
-*    the object dictionary.
+*    the object dictionary. With USE_CAN_TIMESTAMP, the RPDO holds the
+*    receive time of the written frame and the SYNC object holds the
+*    receive time of the SYNC message.
 *
 * \param pdo
 *    Pointer to received RPDO
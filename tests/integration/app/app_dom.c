@@ -38,6 +38,33 @@ static uint32_t MemNext = 0;
 /* index of next domain entry management structure */
 static uint8_t DomIdx = 0;
 
+/* domain type without memory region (staged transfers) */
+static CO_OBJ_TYPE DomStaged;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static CO_OBJ_DOM *DomAdd(uint16_t idx, uint8_t sub, uint8_t access, uint32_t size, const CO_OBJ_TYPE *type)
+{
+    CO_OBJ_DOM *result;
+
+    if (MemNext + size > MEM_BLOCK) {
+        size = MEM_BLOCK - MemNext;
+    }
+    Domain[DomIdx].Offset = 0;
+    Domain[DomIdx].Size   = size;
+    Domain[DomIdx].Start  = &MemBlock[MemNext];
+    MemNext += size;
+
+    DomClear(&Domain[DomIdx]);
+    TS_ODAdd(CO_KEY(idx, sub, access), type, (CO_DATA)(&Domain[DomIdx]));
+    result = &Domain[DomIdx];
+    DomIdx++;
+
+    return (result);
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -67,22 +94,22 @@ void DomInit(void)
 /*---------------------------------------------------------------------------*/
 CO_OBJ_DOM *DomCreate(uint16_t idx, uint8_t sub, uint8_t access, uint32_t size)
 {
-    CO_OBJ_DOM *result;
-
-    if (MemNext + size > MEM_BLOCK) {
-        size = MEM_BLOCK - MemNext;
-    }
-    Domain[DomIdx].Offset = 0;
-    Domain[DomIdx].Size   = size;
-    Domain[DomIdx].Start  = &MemBlock[MemNext];
-    MemNext += size;
-
-    DomClear(&Domain[DomIdx]);
-    TS_ODAdd(CO_KEY(idx, sub, access), CO_TDOMAIN, (CO_DATA)(&Domain[DomIdx]));
-    result = &Domain[DomIdx];
-    DomIdx++;
+    return (DomAdd(idx, sub, access, size, CO_TDOMAIN));
+}
 
-    return (result);
+/*---------------------------------------------------------------------------*/
+/*! \brief REQ-TD-0115
+*
+* \details The staged domain type uses the domain type functions, but
+*          provides no memory region. Transfers with this domain are using
+*          the SDO transfer buffer.
+*/
+/*---------------------------------------------------------------------------*/
+CO_OBJ_DOM *DomCreateStaged(uint16_t idx, uint8_t sub, uint8_t access, uint32_t size)
+{
+    DomStaged        = COTDomain;
+    DomStaged.Region = 0;
+    return (DomAdd(idx, sub, access, size, &DomStaged));
 }
 
 /*---------------------------------------------------------------------------*/
@@ -74,6 +74,17 @@ void DomInit(void);
 /*---------------------------------------------------------------------------*/
 CO_OBJ_DOM *DomCreate(uint16_t idx, uint8_t sub, uint8_t access, uint32_t size);
 
+/*---------------------------------------------------------------------------*/
+/*! \brief CREATE STAGED TEST DOMAIN
+*
+* \details Add an object dictionary entry of a domain type without memory
+*          region with the given index, subindex, access mode and size.
+*
+* \note    The limits of \ref DomCreate() are valid for this function, too.
+*/
+/*---------------------------------------------------------------------------*/
+CO_OBJ_DOM *DomCreateStaged(uint16_t idx, uint8_t sub, uint8_t access, uint32_t size);
+
 /*---------------------------------------------------------------------------*/
 /*! \brief CLEAR TEST DOMAIN
 *
@@ -78,7 +78,11 @@ static uint16_t TS_Obj1017_0;
 static CO_IF_DRV TS_Driver = {
     &SimCanDriver,
     &SwCycleTimerDriver,
-    &SimNvmDriver
+    &SimNvmDriver,
+#if USE_NODE_CTX
+    NULL,                              /* CAN driver without context */
+    NULL
+#endif //USE_NODE_CTX
 };
 
 /******************************************************************************
@@ -178,6 +182,10 @@ void TS_CreateSpec(CO_NODE *node, CO_NODE_SPEC *spec, uint32_t freq)
         spec->TmrFreq = TS_TMR_FREQ;
     }
     spec->SdoBuf   = &SdoBuf[0][0];
+#if USE_NODE_CTX
+    spec->Cb       = NULL;                   /* use the global callbacks */
+    spec->Ctx      = NULL;
+#endif //USE_NODE_CTX
 
     SimCanSetIsr(TS_CanIsr);                /* connect to test can interface */
 }
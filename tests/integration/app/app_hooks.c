@@ -47,6 +47,9 @@ void TS_CallbackInit(TS_CALLBACK *cb)
     cb->IfCanReceive_ArgFrm = 0;
     cb->IfCanReceive_Called = 0;
 
+    cb->IfCanTxConfirm_ArgId = 0;
+    cb->IfCanTxConfirm_Called = 0;
+
     cb->PdoTransmit_ArgFrm = 0;
     cb->PdoTransmit_Called = 0;
 
@@ -144,6 +147,14 @@ void COIfCanReceive(CO_IF_FRM *frm)
     }
 }
 
+void COIfCanTxConfirm(CO_IF_FRM *frm)
+{
+    if (TsCallbacks != 0) {
+        TsCallbacks->IfCanTxConfirm_ArgId = frm->Identifier;
+        TsCallbacks->IfCanTxConfirm_Called++;
+    }
+}
+
 void COPdoTransmit(CO_IF_FRM *frm)
 {
     if (TsCallbacks != 0) {
@@ -33,6 +33,9 @@ extern "C" {
 
 #define CHK_CB_IF_RECEIVE(s,n)        TS_ASSERT((n) == (s)->IfCanReceive_Called)
 
+#define CHK_CB_IF_TX_CONFIRM(s,n)     TS_ASSERT((n) == (s)->IfCanTxConfirm_Called)
+#define CHK_CB_IF_TX_ARG_ID(s,n)      TS_ASSERT((n) == (s)->IfCanTxConfirm_ArgId)
+
 #define CHK_CB_TPDO_TRANSMIT(s,n)     TS_ASSERT((n) == (s)->PdoTransmit_Called)
 
 #define CHK_CB_RPDO_RECEIVE(s,n)      TS_ASSERT((n) == (s)->PdoReceive_Called)
@@ -65,6 +68,9 @@ typedef struct TS_CALLBACK_T {
     CO_IF_FRM  *IfCanReceive_ArgFrm;
     uint32_t    IfCanReceive_Called;
 
+    uint32_t    IfCanTxConfirm_ArgId;
+    uint32_t    IfCanTxConfirm_Called;
+
     CO_IF_FRM  *PdoTransmit_ArgFrm;
     uint32_t    PdoTransmit_Called;
 
@@ -24,32 +24,10 @@
 * PRIVATE DEFINES
 ******************************************************************************/
 
-/* queue length is 128 messages per CAN bus and direction(send/receive) */
-#define SIM_CAN_Q_LEN               128u
-
 #define SIM_CAN_STAT_PASSIVE        (uint32_t)0x00000000
 #define SIM_CAN_STAT_INIT           (uint32_t)0x00000001
 #define SIM_CAN_STAT_ACTIVE         (uint32_t)0x00000002
 
-/******************************************************************************
-* PRIVATE TYPES
-******************************************************************************/
-
-typedef struct SIM_CAN_BUS_T {
-    struct SIM_CAN_BUS_T *Addr;
-    uint32_t              Status;
-    uint32_t              Baudrate;
-    uint32_t              TxOvr;
-    uint32_t              RxOvr;
-    CO_IF_FRM            *RxRd;
-    CO_IF_FRM            *RxWr;
-    CO_IF_FRM            *TxRd;
-    CO_IF_FRM            *TxWr;
-    CO_IF_FRM             RxQ[SIM_CAN_Q_LEN];
-    CO_IF_FRM             TxQ[SIM_CAN_Q_LEN];
-    SIM_CAN_IRQ           Handler;
-} SIM_CAN_BUS;
-
 /******************************************************************************
 * PRIVATE VARIABLES
 ******************************************************************************/
@@ -60,12 +38,40 @@ static SIM_CAN_BUS CanBus = { 0u };
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
+static void    SimBusInit     (SIM_CAN_BUS *bus);
+static void    SimBusEnable   (SIM_CAN_BUS *bus, uint32_t baudrate);
+static int16_t SimBusSend     (SIM_CAN_BUS *bus, CO_IF_FRM *frm);
+static int16_t SimBusRead     (SIM_CAN_BUS *bus, CO_IF_FRM *frm);
+static int16_t SimBusReadBatch(SIM_CAN_BUS *bus, CO_IF_FRM *frm, uint16_t max);
+static void    SimBusReset    (SIM_CAN_BUS *bus);
+static void    SimBusClose    (SIM_CAN_BUS *bus);
+static int16_t SimBusFilter   (SIM_CAN_BUS *bus, const uint32_t *id, uint16_t num);
+static int16_t SimBusTxFree   (SIM_CAN_BUS *bus);
+static int16_t SimBusTxDone   (SIM_CAN_BUS *bus, CO_IF_FRM *frm);
+
 static void    DrvCanInit   (void);
 static void    DrvCanEnable (uint32_t baudrate);
 static int16_t DrvCanSend   (CO_IF_FRM *frm);
 static int16_t DrvCanRead   (CO_IF_FRM *frm);
+static int16_t DrvCanReadBatch(CO_IF_FRM *frm, uint16_t max);
 static void    DrvCanReset  (void);
 static void    DrvCanClose  (void);
+static int16_t DrvCanFilter (const uint32_t *id, uint16_t num);
+static int16_t DrvCanTxFree (void);
+static int16_t DrvCanTxDone (CO_IF_FRM *frm);
+
+#if USE_NODE_CTX
+static void    DrvCanCtxInit     (void *ctx);
+static void    DrvCanCtxEnable   (void *ctx, uint32_t baudrate);
+static int16_t DrvCanCtxSend     (void *ctx, CO_IF_FRM *frm);
+static int16_t DrvCanCtxRead     (void *ctx, CO_IF_FRM *frm);
+static int16_t DrvCanCtxReadBatch(void *ctx, CO_IF_FRM *frm, uint16_t max);
+static void    DrvCanCtxReset    (void *ctx);
+static void    DrvCanCtxClose    (void *ctx);
+static int16_t DrvCanCtxFilter   (void *ctx, const uint32_t *id, uint16_t num);
+static int16_t DrvCanCtxTxFree   (void *ctx);
+static int16_t DrvCanCtxTxDone   (void *ctx, CO_IF_FRM *frm);
+#endif //USE_NODE_CTX
 
 /******************************************************************************
 * PUBLIC VARIABLE
@@ -77,17 +83,34 @@ const CO_IF_CAN_DRV SimCanDriver = {
     DrvCanRead,
     DrvCanSend,
     DrvCanReset,
-    DrvCanClose
+    DrvCanClose,
+    DrvCanReadBatch,
+    DrvCanFilter,
+    DrvCanTxFree,
+    DrvCanTxDone
 };
 
+#if USE_NODE_CTX
+const CO_IF_CAN_CTX_DRV SimCanCtxDriver = {
+    DrvCanCtxInit,
+    DrvCanCtxEnable,
+    DrvCanCtxRead,
+    DrvCanCtxSend,
+    DrvCanCtxReset,
+    DrvCanCtxClose,
+    DrvCanCtxReadBatch,
+    DrvCanCtxFilter,
+    DrvCanCtxTxFree,
+    DrvCanCtxTxDone
+};
+#endif //USE_NODE_CTX
+
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void DrvCanInit(void)
+static void SimBusInit(SIM_CAN_BUS *bus)
 {
-    SIM_CAN_BUS *bus = &CanBus;
-
     if (bus->Addr == bus) {                           /* reset init state    */
         bus->Status = SIM_CAN_STAT_INIT; 
     } else {                                          /* initialize bus      */
@@ -97,24 +120,27 @@ static void DrvCanInit(void)
     bus->Baudrate = 0u;
     bus->TxOvr    = 0u;
     bus->RxOvr    = 0u;
+    bus->CfmOvr   = 0u;
     bus->RxWr     = &bus->RxQ[0u];
     bus->RxRd     = &bus->RxQ[0u];
     bus->TxWr     = &bus->TxQ[0u];
     bus->TxRd     = &bus->TxQ[0u];
+    bus->CfmWr    = &bus->CfmQ[0u];
+    bus->CfmRd    = &bus->CfmQ[0u];
+    bus->FltNum   = 0u;
+    bus->FltOn    = 0u;
+    bus->TxLim    = -1;
 }
 
-static void DrvCanEnable(uint32_t baudrate)
+static void SimBusEnable(SIM_CAN_BUS *bus, uint32_t baudrate)
 {
-    SIM_CAN_BUS *bus = &CanBus;
-
     bus->Status   |= SIM_CAN_STAT_ACTIVE;
     bus->Baudrate  = baudrate;
 }
 
-static int16_t DrvCanSend(CO_IF_FRM *frm)
+static int16_t SimBusSend(SIM_CAN_BUS *bus, CO_IF_FRM *frm)
 {
     int16_t       result = 0u;
-    SIM_CAN_BUS  *bus    = &CanBus;;
     CO_IF_FRM    *tx;
     uint8_t       byte;
     
@@ -133,7 +159,7 @@ static int16_t DrvCanSend(CO_IF_FRM *frm)
     } else {
         tx->Identifier = frm->Identifier;
         tx->DLC        = frm->DLC;
-        for (byte = 0u; byte < 8u; byte++) {
+        for (byte = 0u; byte < CO_IF_FRM_DATA_N; byte++) {
             if (frm->DLC > byte) {
                 tx->Data[byte] = frm->Data[byte] & 0xFFu;
             } else {
@@ -145,10 +171,9 @@ static int16_t DrvCanSend(CO_IF_FRM *frm)
     return (result);
 }
 
-static int16_t DrvCanRead (CO_IF_FRM *frm)
+static int16_t SimBusRead(SIM_CAN_BUS *bus, CO_IF_FRM *frm)
 {
     int16_t       result = 0u;
-    SIM_CAN_BUS  *bus    = &CanBus;
     CO_IF_FRM    *rx;
     uint8_t       byte;
 
@@ -165,7 +190,10 @@ static int16_t DrvCanRead (CO_IF_FRM *frm)
 
         frm->Identifier = rx->Identifier;
         frm->DLC        = rx->DLC;
-        for (byte = 0u; byte < 8u; byte++) {
+#if USE_CAN_TIMESTAMP
+        frm->Timestamp  = rx->Timestamp;
+#endif //USE_CAN_TIMESTAMP
+        for (byte = 0u; byte < CO_IF_FRM_DATA_N; byte++) {
             if (frm->DLC > byte) {
                 frm->Data[byte] = rx->Data[byte] & 0xFFu;
             } else {
@@ -177,32 +205,216 @@ static int16_t DrvCanRead (CO_IF_FRM *frm)
     return (result);
 }
 
-static void DrvCanReset(void)
+static int16_t SimBusReadBatch(SIM_CAN_BUS *bus, CO_IF_FRM *frm, uint16_t max)
 {
-    SIM_CAN_BUS *bus      = &CanBus;
-    uint32_t     baudrate = bus->Baudrate;
+    int16_t       result = 0u;
+    CO_IF_FRM    *rx;
+    uint8_t       byte;
+
+    if ((bus->Status & SIM_CAN_STAT_ACTIVE) == 0u) {   /* CAN bus is passive */
+        return ((int16_t)-1u);
+    }
 
-    DrvCanInit();
-    DrvCanEnable(baudrate);
+    while ((bus->RxRd != bus->RxWr) &&            /* CAN frame is available */
+           ((uint16_t)result < max)) {
+        rx = bus->RxRd;
+        bus->RxRd++;
+        if (bus->RxRd >= &bus->RxQ[SIM_CAN_Q_LEN]) {
+            bus->RxRd = &bus->RxQ[0u];
+        }
+
+        frm->Identifier = rx->Identifier;
+        frm->DLC        = rx->DLC;
+#if USE_CAN_TIMESTAMP
+        frm->Timestamp  = rx->Timestamp;
+#endif //USE_CAN_TIMESTAMP
+        for (byte = 0u; byte < CO_IF_FRM_DATA_N; byte++) {
+            if (frm->DLC > byte) {
+                frm->Data[byte] = rx->Data[byte] & 0xFFu;
+            } else {
+                frm->Data[byte] = 0u;
+            }
+        }
+        frm++;
+        result++;
+    }
+    return (result);
 }
 
-static void DrvCanClose(void)
+static void SimBusReset(SIM_CAN_BUS *bus)
 {
-    SIM_CAN_BUS *bus = &CanBus;
+    uint32_t baudrate = bus->Baudrate;
+
+    SimBusInit(bus);
+    SimBusEnable(bus, baudrate);
+}
+
+static int16_t SimBusFilter(SIM_CAN_BUS *bus, const uint32_t *id, uint16_t num)
+{
+    uint16_t n;
+
+    if (num > SIM_CAN_FLT_LEN) {                      /* receive all frames  */
+        bus->FltOn = 0u;
+    } else {
+        for (n = 0u; n < num; n++) {
+            bus->Flt[n] = id[n];
+        }
+        bus->FltNum = num;
+        bus->FltOn  = 1u;
+    }
+    return (0);
+}
+
+static int16_t SimBusTxFree(SIM_CAN_BUS *bus)
+{
+    int16_t used;
+    int16_t result;
+
+    used = (int16_t)(bus->TxWr - bus->TxRd);
+    if (used < 0) {
+        used += (int16_t)SIM_CAN_Q_LEN;
+    }
+    result = (int16_t)(SIM_CAN_Q_LEN - 1u) - used;
+    if ((bus->TxLim >= 0) && (result > bus->TxLim)) {
+        result = bus->TxLim;
+    }
+    return (result);
+}
+
+static int16_t SimBusTxDone(SIM_CAN_BUS *bus, CO_IF_FRM *frm)
+{
+    int16_t       result = 0u;
+    CO_IF_FRM    *cfm;
+
+    if (bus->CfmRd != bus->CfmWr) {          /* CAN frame left the bus */
+        cfm = bus->CfmRd;
+        bus->CfmRd++;
+        if (bus->CfmRd >= &bus->CfmQ[SIM_CAN_Q_LEN]) {
+            bus->CfmRd = &bus->CfmQ[0u];
+        }
+        *frm   = *cfm;
+        result = sizeof(CO_IF_FRM);
+    }
+    return (result);
+}
 
+static void SimBusClose(SIM_CAN_BUS *bus)
+{
     bus->Status &= ~SIM_CAN_STAT_ACTIVE;
 }
 
+static void DrvCanInit(void)
+{
+    SimBusInit(&CanBus);
+}
+
+static void DrvCanEnable(uint32_t baudrate)
+{
+    SimBusEnable(&CanBus, baudrate);
+}
+
+static int16_t DrvCanSend(CO_IF_FRM *frm)
+{
+    return (SimBusSend(&CanBus, frm));
+}
+
+static int16_t DrvCanRead(CO_IF_FRM *frm)
+{
+    return (SimBusRead(&CanBus, frm));
+}
+
+static int16_t DrvCanReadBatch(CO_IF_FRM *frm, uint16_t max)
+{
+    return (SimBusReadBatch(&CanBus, frm, max));
+}
+
+static void DrvCanReset(void)
+{
+    SimBusReset(&CanBus);
+}
+
+static void DrvCanClose(void)
+{
+    SimBusClose(&CanBus);
+}
+
+static int16_t DrvCanFilter(const uint32_t *id, uint16_t num)
+{
+    return (SimBusFilter(&CanBus, id, num));
+}
+
+static int16_t DrvCanTxFree(void)
+{
+    return (SimBusTxFree(&CanBus));
+}
+
+static int16_t DrvCanTxDone(CO_IF_FRM *frm)
+{
+    return (SimBusTxDone(&CanBus, frm));
+}
+
+#if USE_NODE_CTX
+static void DrvCanCtxInit(void *ctx)
+{
+    SimBusInit((SIM_CAN_BUS *)ctx);
+}
+
+static void DrvCanCtxEnable(void *ctx, uint32_t baudrate)
+{
+    SimBusEnable((SIM_CAN_BUS *)ctx, baudrate);
+}
+
+static int16_t DrvCanCtxSend(void *ctx, CO_IF_FRM *frm)
+{
+    return (SimBusSend((SIM_CAN_BUS *)ctx, frm));
+}
+
+static int16_t DrvCanCtxRead(void *ctx, CO_IF_FRM *frm)
+{
+    return (SimBusRead((SIM_CAN_BUS *)ctx, frm));
+}
+
+static int16_t DrvCanCtxReadBatch(void *ctx, CO_IF_FRM *frm, uint16_t max)
+{
+    return (SimBusReadBatch((SIM_CAN_BUS *)ctx, frm, max));
+}
+
+static void DrvCanCtxReset(void *ctx)
+{
+    SimBusReset((SIM_CAN_BUS *)ctx);
+}
+
+static void DrvCanCtxClose(void *ctx)
+{
+    SimBusClose((SIM_CAN_BUS *)ctx);
+}
+
+static int16_t DrvCanCtxFilter(void *ctx, const uint32_t *id, uint16_t num)
+{
+    return (SimBusFilter((SIM_CAN_BUS *)ctx, id, num));
+}
+
+static int16_t DrvCanCtxTxFree(void *ctx)
+{
+    return (SimBusTxFree((SIM_CAN_BUS *)ctx));
+}
+
+static int16_t DrvCanCtxTxDone(void *ctx, CO_IF_FRM *frm)
+{
+    return (SimBusTxDone((SIM_CAN_BUS *)ctx, frm));
+}
+#endif //USE_NODE_CTX
+
 /******************************************************************************
 * SPECIAL PUBLIC FUNCTIONS
 ******************************************************************************/
 
-int16_t SimCanGetFrm(uint8_t *buf, uint16_t size)
+int16_t SimCanBusGetFrm(SIM_CAN_BUS *bus, uint8_t *buf, uint16_t size)
 {
     int16_t         result = 0u;
-    SIM_CAN_BUS    *bus    = &CanBus;
     CO_IF_FRM      *tx;
     CO_IF_FRM      *frm;
+    CO_IF_FRM      *cfm;
 
     if (bus->TxRd != bus->TxWr) {
         tx = bus->TxRd;
@@ -211,6 +423,21 @@ int16_t SimCanGetFrm(uint8_t *buf, uint16_t size)
             bus->TxRd = &bus->TxQ[0u];
         }
 
+        cfm = bus->CfmWr;                  /* confirm the transmission */
+        bus->CfmWr++;
+        if (bus->CfmWr >= &bus->CfmQ[SIM_CAN_Q_LEN]) {
+            bus->CfmWr = &bus->CfmQ[0u];
+        }
+        if (bus->CfmWr == bus->CfmRd) {
+            bus->CfmOvr++;
+            bus->CfmWr = cfm;
+        } else {
+            *cfm = *tx;
+#if USE_CAN_TIMESTAMP
+            cfm->Timestamp = bus->Time;
+#endif //USE_CAN_TIMESTAMP
+        }
+
         if ((size >= sizeof(CO_IF_FRM)) &&
             (buf  != NULL             )) {
             frm             = (CO_IF_FRM*)buf;
@@ -232,14 +459,16 @@ int16_t SimCanGetFrm(uint8_t *buf, uint16_t size)
     return (result);
 }
 
-int16_t SimCanSetFrm (uint32_t Identifier, uint8_t DLC,
+int16_t SimCanBusSetFrm (SIM_CAN_BUS *bus, uint32_t Identifier, uint8_t DLC,
                   uint8_t Byte0, uint8_t Byte1, uint8_t Byte2, uint8_t Byte3,
                   uint8_t Byte4, uint8_t Byte5, uint8_t Byte6, uint8_t Byte7)
 {
     int16_t       result = 0u;
-    SIM_CAN_BUS  *bus    = &CanBus;
     CO_IF_FRM    *rx;
 
+    if (SimCanBusAccept(bus, Identifier) == 0u) {   /* rejected by filter  */
+        return (result);
+    }
     rx = bus->RxWr;
     bus->RxWr++;
     if (bus->RxWr >= &bus->RxQ[SIM_CAN_Q_LEN]) {
@@ -259,12 +488,49 @@ int16_t SimCanSetFrm (uint32_t Identifier, uint8_t DLC,
         rx->Data[5u]   = Byte5 & 0xFFu;
         rx->Data[6u]   = Byte6 & 0xFFu;
         rx->Data[7u]   = Byte7 & 0xFFu;
+#if USE_CAN_TIMESTAMP
+        rx->Timestamp  = bus->Time;
+#endif //USE_CAN_TIMESTAMP
         result         = sizeof(CO_IF_FRM);
     }
 
     return (result);
 }
 
+uint8_t SimCanBusAccept(SIM_CAN_BUS *bus, uint32_t Identifier)
+{
+    uint16_t n;
+
+    if (bus->FltOn == 0u) {
+        return (1u);
+    }
+    for (n = 0u; n < bus->FltNum; n++) {
+        if (bus->Flt[n] == Identifier) {
+            return (1u);
+        }
+    }
+    return (0u);
+}
+
+int16_t SimCanGetFrm(uint8_t *buf, uint16_t size)
+{
+    return (SimCanBusGetFrm(&CanBus, buf, size));
+}
+
+int16_t SimCanSetFrm (uint32_t Identifier, uint8_t DLC,
+                  uint8_t Byte0, uint8_t Byte1, uint8_t Byte2, uint8_t Byte3,
+                  uint8_t Byte4, uint8_t Byte5, uint8_t Byte6, uint8_t Byte7)
+{
+    return (SimCanBusSetFrm(&CanBus, Identifier, DLC,
+                            Byte0, Byte1, Byte2, Byte3,
+                            Byte4, Byte5, Byte6, Byte7));
+}
+
+uint8_t SimCanAccept(uint32_t Identifier)
+{
+    return (SimCanBusAccept(&CanBus, Identifier));
+}
+
 void SimCanSetIsr(SIM_CAN_IRQ handler)
 {
     SIM_CAN_BUS *bus = &CanBus;
@@ -289,4 +555,22 @@ void SimCanFlush (void)
     bus->RxRd  = &bus->RxQ[0u];
     bus->TxWr  = &bus->TxQ[0u];
     bus->TxRd  = &bus->TxQ[0u];
+    bus->CfmWr = &bus->CfmQ[0u];
+    bus->CfmRd = &bus->CfmQ[0u];
+}
+
+void SimCanSetTxFree (int16_t limit)
+{
+    SIM_CAN_BUS *bus = &CanBus;
+
+    bus->TxLim = limit;
+}
+
+#if USE_CAN_TIMESTAMP
+void SimCanSetTime (uint64_t time)
+{
+    SIM_CAN_BUS *bus = &CanBus;
+
+    bus->Time = time;
 }
+#endif //USE_CAN_TIMESTAMP
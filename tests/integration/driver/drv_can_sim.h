@@ -31,13 +31,51 @@ extern "C" {
 * PUBLIC TYPES
 ******************************************************************************/
 
+/* queue length is 128 messages per CAN bus and direction(send/receive) */
+#define SIM_CAN_Q_LEN               128u
+
+/* acceptance filter holds up to 256 identifiers */
+#define SIM_CAN_FLT_LEN             256u
+
 typedef void (*SIM_CAN_IRQ)(void);
 
+/* Simulated CAN bus: the legacy driver SimCanDriver works on a bus inside
+ * the driver, the context driver SimCanCtxDriver on the bus given as
+ * driver context. Each node gets its own bus this way. */
+typedef struct SIM_CAN_BUS_T {
+    struct SIM_CAN_BUS_T *Addr;
+    uint32_t              Status;
+    uint32_t              Baudrate;
+    uint32_t              TxOvr;
+    uint32_t              RxOvr;
+    uint32_t              CfmOvr;
+    CO_IF_FRM            *RxRd;
+    CO_IF_FRM            *RxWr;
+    CO_IF_FRM            *TxRd;
+    CO_IF_FRM            *TxWr;
+    CO_IF_FRM            *CfmRd;
+    CO_IF_FRM            *CfmWr;
+    CO_IF_FRM             RxQ[SIM_CAN_Q_LEN];
+    CO_IF_FRM             TxQ[SIM_CAN_Q_LEN];
+    CO_IF_FRM             CfmQ[SIM_CAN_Q_LEN];
+    SIM_CAN_IRQ           Handler;
+    uint32_t              Flt[SIM_CAN_FLT_LEN];
+    uint16_t              FltNum;
+    uint8_t               FltOn;
+    int16_t               TxLim;
+#if USE_CAN_TIMESTAMP
+    uint64_t              Time;
+#endif //USE_CAN_TIMESTAMP
+} SIM_CAN_BUS;
+
 /******************************************************************************
 * PUBLIC SYMBOLS
 ******************************************************************************/
 
 extern const CO_IF_CAN_DRV SimCanDriver;
+#if USE_NODE_CTX
+extern const CO_IF_CAN_CTX_DRV SimCanCtxDriver;
+#endif //USE_NODE_CTX
 
 /******************************************************************************
 * SPECIAL PUBLIC DRIVER FUNCTIONS
@@ -49,9 +87,22 @@ int16_t     SimCanSetFrm    (uint32_t Identifier, uint8_t DLC,
                              uint8_t Byte0, uint8_t Byte1, uint8_t Byte2,
                              uint8_t Byte3, uint8_t Byte4, uint8_t Byte5,
                              uint8_t Byte6, uint8_t Byte7);
+uint8_t     SimCanAccept    (uint32_t Identifier);
 void        SimCanSetIsr    (SIM_CAN_IRQ handler);
 void        SimCanRun       (void);
 void        SimCanFlush     (void);
+void        SimCanSetTxFree (int16_t limit);
+#if USE_CAN_TIMESTAMP
+void        SimCanSetTime   (uint64_t time);
+#endif //USE_CAN_TIMESTAMP
+
+/* Same interface for a simulated bus, which is used as driver context */
+int16_t     SimCanBusGetFrm (SIM_CAN_BUS *bus, uint8_t *buf, uint16_t size);
+int16_t     SimCanBusSetFrm (SIM_CAN_BUS *bus, uint32_t Identifier, uint8_t DLC,
+                             uint8_t Byte0, uint8_t Byte1, uint8_t Byte2,
+                             uint8_t Byte3, uint8_t Byte4, uint8_t Byte5,
+                             uint8_t Byte6, uint8_t Byte7);
+uint8_t     SimCanBusAccept (SIM_CAN_BUS *bus, uint32_t Identifier);
 
 #ifdef __cplusplus               /* for compatibility with C++ environments  */
 }
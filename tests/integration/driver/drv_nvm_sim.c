@@ -30,7 +30,8 @@
 * PRIVATE VARIABLES
 ******************************************************************************/
 
-static uint8_t NvmMemory[NVM_SIM_SIZE];
+static uint8_t  NvmMemory[NVM_SIM_SIZE];
+static uint32_t NvmWritten;
 
 /******************************************************************************
 * PRIVATE FUNCTIONS
@@ -51,6 +52,15 @@ const CO_IF_NVM_DRV SimNvmDriver = {
     DrvNvmWrite
 };
 
+/******************************************************************************
+* SPECIAL PUBLIC FUNCTIONS
+******************************************************************************/
+
+uint32_t SimNvmWritten(void)
+{
+    return (NvmWritten);
+}
+
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
@@ -62,6 +72,7 @@ static void DrvNvmInit(void)
     for (idx = 0; idx < NVM_SIM_SIZE; idx++) {
         NvmMemory[idx] = 0xffu;
     }
+    NvmWritten = 0;
 }
 
 static uint32_t DrvNvmRead(uint32_t start, uint8_t *buffer, uint32_t size)
@@ -92,6 +103,7 @@ static uint32_t DrvNvmWrite(uint32_t start, uint8_t *buffer, uint32_t size)
         idx++;
         pos++;
     }
+    NvmWritten += idx;
 
     return (idx);
 }
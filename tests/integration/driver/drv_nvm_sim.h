@@ -33,6 +33,13 @@ extern "C" {
 
 extern const CO_IF_NVM_DRV SimNvmDriver;
 
+/******************************************************************************
+* SPECIAL PUBLIC DRIVER FUNCTIONS
+******************************************************************************/
+
+/* NVM Simulation Interface (for interfacing with automated tests only) */
+uint32_t    SimNvmWritten   (void);
+
 #ifdef __cplusplus               /* for compatibility with C++ environments  */
 }
 #endif
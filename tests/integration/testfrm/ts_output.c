@@ -43,6 +43,6 @@ void TS_PutChar(void *arg, char character)
 *        running on your target, too.
 */
     (void)arg;
-    (void)character;
+    putchar((int)character);
 #endif
 }
@@ -0,0 +1,190 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TS_BatchSdoReq(uint16_t idx, uint8_t sub, uint8_t num)
+{
+    while (num > 0) {
+        SimCanSetFrm(0x601, 8, 0x40, (uint8_t)idx, (uint8_t)(idx >> 8), sub, 0, 0, 0, 0);
+        num--;
+    }
+}
+
+static void TS_BatchSdoRes(uint16_t idx, uint8_t sub, uint8_t val, uint8_t num)
+{
+    CO_IF_FRM frm;
+
+    while (num > 0) {
+        CHK_CAN  (&frm);
+        CHK_SDO0 (frm, 0x4F);
+        CHK_MLTPX(frm, idx, sub);
+        CHK_DATA (frm, val);
+        num--;
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check, that all available frames are processed with a single
+*          call of CONodeProcessBatch().
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Batch_All)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2510;
+    uint8_t   sub  = 1;
+    uint8_t   val  = 0x11;
+    uint16_t  num;
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), CO_TUNSIGNED8, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+
+    TS_BatchSdoReq(idx, sub, CO_RX_BATCH_N + 3);
+    num = CONodeProcessBatch(&node, 0xFFFF);
+
+    TS_ASSERT(num == CO_RX_BATCH_N + 3);
+    TS_BatchSdoRes(idx, sub, val, CO_RX_BATCH_N + 3);
+    CHK_NOCAN(&frm);
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC2
+*
+*          This testcase will check, that CONodeProcessBatch() stops after the given maximum
+*          number of frames and the remaining frames are processed with the next call.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Batch_Max)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2510;
+    uint8_t   sub  = 1;
+    uint8_t   val  = 0x22;
+    uint16_t  num;
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), CO_TUNSIGNED8, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+
+    TS_BatchSdoReq(idx, sub, 3);
+    num = CONodeProcessBatch(&node, 2);
+
+    TS_ASSERT(num == 2);
+    TS_BatchSdoRes(idx, sub, val, 2);
+    CHK_NOCAN(&frm);
+
+    num = CONodeProcessBatch(&node, 2);
+
+    TS_ASSERT(num == 1);
+    TS_BatchSdoRes(idx, sub, val, 1);
+    CHK_NOCAN(&frm);
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC3
+*
+*          This testcase will check, that CONodeProcessBatch() returns without processing when
+*          no frame is available.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Batch_Empty)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  num;
+
+    TS_CreateMandatoryDir();
+    TS_CreateNode(&node,0);
+
+    num = CONodeProcessBatch(&node, 10);
+
+    TS_ASSERT(num == 0);
+    CHK_NOCAN(&frm);
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC4
+*
+*          This testcase will check, that CONodeProcessBatch() reads single frames with the
+*          driver function Read(), when the CAN driver provides no ReadBatch() function.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Batch_NoBatchDrv)
+{
+    CO_IF_FRM     frm;
+    CO_NODE       node;
+    CO_IF_CAN_DRV can;
+    CO_IF_DRV     drv;
+    CO_IF_DRV    *org;
+    uint16_t      idx  = 0x2510;
+    uint8_t       sub  = 1;
+    uint8_t       val  = 0x33;
+    uint16_t      num;
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), CO_TUNSIGNED8, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+
+    can           = SimCanDriver;
+    can.ReadBatch = NULL;
+    org           = node.If.Drv;
+    drv           = *org;
+    drv.Can       = &can;
+    node.If.Drv   = &drv;
+
+    TS_BatchSdoReq(idx, sub, 3);
+    num = CONodeProcessBatch(&node, 10);
+    node.If.Drv = org;
+
+    TS_ASSERT(num == 3);
+    TS_BatchSdoRes(idx, sub, val, 3);
+    CHK_NOCAN(&frm);
+    CHK_NO_ERR(&node);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CORE_BATCH()
+{
+    TS_Begin(__FILE__);
+
+    TS_RUNNER(TS_Batch_All);
+    TS_RUNNER(TS_Batch_Max);
+    TS_RUNNER(TS_Batch_Empty);
+    TS_RUNNER(TS_Batch_NoBatchDrv);
+
+    TS_End();
+}
@@ -0,0 +1,191 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* Number of nodes in the test process */
+#define CTX_NODE_N   2
+
+/* Maximal number of timers per node */
+#define CTX_TMR_N    16
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* simulated CAN bus per node */
+static SIM_CAN_BUS CtxBus[CTX_NODE_N];
+/* driver links per node with the CAN bus as driver context */
+static CO_IF_DRV   CtxDrv[CTX_NODE_N];
+/* allocate memory for highspeed timer per node */
+static CO_TMR_MEM  CtxTmrMem[CTX_NODE_N][CTX_TMR_N];
+/* allocate memory for SDO server buffer per node */
+static uint8_t     CtxSdoBuf[CTX_NODE_N][CO_SSDO_N * CO_SDO_BUF_BYTE];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TS_CtxCreateNode(CO_NODE *node, uint8_t num)
+{
+    CO_NODE_SPEC spec;
+    CO_IF_FRM    frm;
+
+    TS_CreateSpec(node, &spec, 0);
+
+    CtxDrv[num].Can    = NULL;
+    CtxDrv[num].Timer  = &SwCycleTimerDriver;
+    CtxDrv[num].Nvm    = &SimNvmDriver;
+    CtxDrv[num].CanCtx = &SimCanCtxDriver;
+    CtxDrv[num].Ctx    = &CtxBus[num];
+
+    spec.NodeId = num + 1u;
+    spec.Drv    = &CtxDrv[num];
+    spec.TmrMem = &CtxTmrMem[num][0];
+    spec.TmrNum = CTX_TMR_N;
+    spec.SdoBuf = &CtxSdoBuf[num][0];
+
+    CONodeInit(node, &spec);
+    CONodeStart(node);
+
+    TS_ASSERT(1 == SimCanBusGetFrm(&CtxBus[num], (uint8_t *)&frm, sizeof(CO_IF_FRM)));
+    TS_ASSERT((0x701u + num) == frm.Identifier);
+    TS_ASSERT(1 == frm.DLC);
+    TS_ASSERT(0 == frm.Data[0]);
+}
+
+static void TS_CtxRun(CO_NODE *node, uint8_t num)
+{
+    SIM_CAN_BUS *bus = &CtxBus[num];
+
+    while (bus->RxRd != bus->RxWr) {
+        CONodeProcess(node);
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check, that two nodes in one process send the boot-up message on
+*          their own CAN bus only.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Ctx_Bootup)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node[CTX_NODE_N];
+
+    TS_CreateMandatoryDir();
+    TS_CtxCreateNode(&node[0], 0);
+    TS_CtxCreateNode(&node[1], 1);
+
+    TS_ASSERT(0 == SimCanBusGetFrm(&CtxBus[0], (uint8_t *)&frm, sizeof(CO_IF_FRM)));
+    TS_ASSERT(0 == SimCanBusGetFrm(&CtxBus[1], (uint8_t *)&frm, sizeof(CO_IF_FRM)));
+    CHK_NOCAN(&frm);
+
+    CHK_NO_ERR(&node[0]);
+    CHK_NO_ERR(&node[1]);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC2
+*
+*          This testcase will check, that two nodes in one process answer an SDO request on
+*          their own CAN bus with their own node-id.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Ctx_SdoUpload)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node[CTX_NODE_N];
+    uint8_t   num;
+
+    TS_CreateMandatoryDir();
+    TS_CtxCreateNode(&node[0], 0);
+    TS_CtxCreateNode(&node[1], 1);
+
+    for (num = 0; num < CTX_NODE_N; num++) {
+        SimCanBusSetFrm(&CtxBus[num], 0x601u + num, 8, 0x40, 0x00, 0x10, 0x00, 0, 0, 0, 0);
+    }
+    TS_CtxRun(&node[0], 0);
+
+    TS_ASSERT(1 == SimCanBusGetFrm(&CtxBus[0], (uint8_t *)&frm, sizeof(CO_IF_FRM)));
+    TS_ASSERT(0x581 == frm.Identifier);
+    TS_ASSERT(0x43  == frm.Data[0]);
+    TS_ASSERT(0 == SimCanBusGetFrm(&CtxBus[1], (uint8_t *)&frm, sizeof(CO_IF_FRM)));
+
+    TS_CtxRun(&node[1], 1);
+
+    TS_ASSERT(1 == SimCanBusGetFrm(&CtxBus[1], (uint8_t *)&frm, sizeof(CO_IF_FRM)));
+    TS_ASSERT(0x582 == frm.Identifier);
+    TS_ASSERT(0x43  == frm.Data[0]);
+    TS_ASSERT(0 == SimCanBusGetFrm(&CtxBus[0], (uint8_t *)&frm, sizeof(CO_IF_FRM)));
+    CHK_NOCAN(&frm);
+
+    CHK_NO_ERR(&node[0]);
+    CHK_NO_ERR(&node[1]);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC3
+*
+*          This testcase will check, that a request on the bus of one node is not seen by the
+*          other node, even when addressed to the other node-id.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Ctx_Isolated)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node[CTX_NODE_N];
+
+    TS_CreateMandatoryDir();
+    TS_CtxCreateNode(&node[0], 0);
+    TS_CtxCreateNode(&node[1], 1);
+
+    SimCanBusSetFrm(&CtxBus[0], 0x602, 8, 0x40, 0x00, 0x10, 0x00, 0, 0, 0, 0);
+    TS_CtxRun(&node[0], 0);
+    TS_CtxRun(&node[1], 1);
+
+    TS_ASSERT(0 == SimCanBusGetFrm(&CtxBus[0], (uint8_t *)&frm, sizeof(CO_IF_FRM)));
+    TS_ASSERT(0 == SimCanBusGetFrm(&CtxBus[1], (uint8_t *)&frm, sizeof(CO_IF_FRM)));
+
+    CHK_NO_ERR(&node[0]);
+    CHK_NO_ERR(&node[1]);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CORE_CTX()
+{
+    TS_Begin(__FILE__);
+
+    TS_RUNNER(TS_Ctx_Bootup);
+    TS_RUNNER(TS_Ctx_SdoUpload);
+    TS_RUNNER(TS_Ctx_Isolated);
+
+    TS_End();
+}
@@ -0,0 +1,186 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TS_FilterNode(CO_NODE *node, CO_HBCONS *hbc)
+{
+    static uint32_t rpdo_id;
+    static uint8_t  rpdo_type;
+    static uint32_t rpdo_map;
+    static uint8_t  rpdo_len;
+    static uint8_t  data;
+
+    rpdo_id   = 0x40000200;
+    rpdo_type = 254;
+    rpdo_map  = 0x25000108;
+    rpdo_len  = 1;
+    data      = 0;
+    hbc->NodeId = 10;
+    hbc->Time   = 50;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id, &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map, &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x01, CO_OBJ_____RW), CO_TUNSIGNED8, (CO_DATA)(&data));
+    TS_ODAdd(CO_KEY(0x1016, 0, CO_OBJ_D___R_), CO_THB_CONS, (CO_DATA)(1));
+    TS_ODAdd(CO_KEY(0x1016, 1, CO_OBJ_____R_), CO_THB_CONS, (CO_DATA)(hbc));
+    TS_CreateNodeAutoStart(node);
+
+    CONodeProcess(node);                              /* pass filter to driver                    */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check, that the acceptance filter holds the identifiers of all
+*          services in operational mode, and rejects all other identifiers.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Filter_Operational)
+{
+    CO_NODE   node;
+    CO_HBCONS hbc = { 0 };
+
+    TS_FilterNode(&node, &hbc);
+
+    TS_ASSERT(1 == SimCanAccept(0x000));              /* NMT                                      */
+    TS_ASSERT(1 == SimCanAccept(0x080));              /* SYNC                                     */
+    TS_ASSERT(1 == SimCanAccept(0x601));              /* SDO server request                       */
+    TS_ASSERT(1 == SimCanAccept(0x201));              /* RPDO #0                                  */
+    TS_ASSERT(1 == SimCanAccept(0x70A));              /* heartbeat of consumed node 10            */
+#if USE_LSS
+    TS_ASSERT(1 == SimCanAccept(CO_LSS_RX_ID));       /* LSS request                              */
+#endif
+    TS_ASSERT(0 == SimCanAccept(0x123));
+    TS_ASSERT(0 == SimCanAccept(0x181));
+    TS_ASSERT(0 == SimCanAccept(0x70B));
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC2
+*
+*          This testcase will check, that the acceptance filter follows the NMT mode.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Filter_NmtMode)
+{
+    CO_NODE   node;
+    CO_HBCONS hbc = { 0 };
+
+    TS_FilterNode(&node, &hbc);
+
+    TS_NMT_SEND(0x02, 1);                             /* stop node                                */
+    TS_ASSERT(1 == SimCanAccept(0x000));
+    TS_ASSERT(1 == SimCanAccept(0x70A));
+    TS_ASSERT(0 == SimCanAccept(0x080));
+    TS_ASSERT(0 == SimCanAccept(0x601));
+    TS_ASSERT(0 == SimCanAccept(0x201));
+
+    TS_NMT_SEND(0x80, 1);                             /* enter pre-operational                    */
+    TS_ASSERT(1 == SimCanAccept(0x080));
+    TS_ASSERT(1 == SimCanAccept(0x601));
+    TS_ASSERT(0 == SimCanAccept(0x201));
+
+    TS_NMT_SEND(0x01, 1);                             /* start node                               */
+    TS_ASSERT(1 == SimCanAccept(0x201));
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC3
+*
+*          This testcase will check, that the acceptance filter follows the RPDO COB-ID.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Filter_RPdoCobId)
+{
+    CO_NODE   node;
+    CO_HBCONS hbc = { 0 };
+
+    TS_FilterNode(&node, &hbc);
+
+    TS_SDO_SEND(0x23, 0x1400, 1, 0x80000201);         /* disable RPDO #0                          */
+    CHK_SDO0_OK(0x1400, 1);
+    TS_ASSERT(0 == SimCanAccept(0x201));
+
+    TS_SDO_SEND(0x23, 0x1400, 1, 0x00000205);         /* enable RPDO #0 with new identifier       */
+    CHK_SDO0_OK(0x1400, 1);
+    TS_ASSERT(0 == SimCanAccept(0x201));
+    TS_ASSERT(1 == SimCanAccept(0x205));
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC4
+*
+*          This testcase will check the application identifiers in the acceptance filter.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Filter_App)
+{
+    CO_NODE   node;
+    CO_HBCONS hbc = { 0 };
+    uint32_t  id[CO_FILTER_APP_N + 1] = { 0x123, 0x456 };
+    CO_ERR    err;
+
+    TS_FilterNode(&node, &hbc);
+    TS_ASSERT(0 == SimCanAccept(0x123));
+
+    err = COFilterSetApp(&node.Filter, &id[0], 2);
+    TS_ASSERT(CO_ERR_NONE == err);
+    CONodeProcess(&node);
+    TS_ASSERT(1 == SimCanAccept(0x123));
+    TS_ASSERT(1 == SimCanAccept(0x456));
+    TS_ASSERT(1 == SimCanAccept(0x601));
+
+    err = COFilterSetApp(&node.Filter, &id[0], CO_FILTER_APP_N + 1);
+    TS_ASSERT(CO_ERR_BAD_ARG == err);
+    err = COFilterSetApp(&node.Filter, &id[0], 0);
+    TS_ASSERT(CO_ERR_NONE == err);
+    CONodeProcess(&node);
+    TS_ASSERT(0 == SimCanAccept(0x123));
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CORE_FILTER()
+{
+    TS_Begin(__FILE__);
+
+    TS_RUNNER(TS_Filter_Operational);
+    TS_RUNNER(TS_Filter_NmtMode);
+    TS_RUNNER(TS_Filter_RPdoCobId);
+    TS_RUNNER(TS_Filter_App);
+
+    TS_End();
+}
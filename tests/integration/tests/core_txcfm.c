@@ -0,0 +1,178 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static TS_CALLBACK TxCfmCb;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TS_TxCfmSdoReq(uint16_t idx, uint8_t sub, uint8_t num)
+{
+    while (num > 0) {
+        SimCanSetFrm(0x601, 8, 0x40, (uint8_t)idx, (uint8_t)(idx >> 8), sub, 0, 0, 0, 0);
+        num--;
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check, that a transmitted frame is confirmed with the callback
+*          COIfCanTxConfirm() after the frame left the CAN bus, and not earlier.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TxCfm_Confirm)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2510;
+    uint8_t   sub  = 1;
+    uint8_t   val  = 0x11;
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), CO_TUNSIGNED8, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+
+    TS_TxCfmSdoReq(idx, sub, 1);
+    CONodeProcess(&node);                             /* response is waiting in the controller    */
+    CONodeProcess(&node);
+    CHK_CB_IF_TX_CONFIRM(&TxCfmCb, 0);
+
+    CHK_CAN  (&frm);                                  /* response leaves the CAN bus              */
+    CHK_SDO0 (frm, 0x4F);
+    CHK_CB_IF_TX_CONFIRM(&TxCfmCb, 0);
+
+    CONodeProcess(&node);                             /* confirmation is delivered                */
+    CHK_CB_IF_TX_CONFIRM(&TxCfmCb, 1);
+    CHK_CB_IF_TX_ARG_ID(&TxCfmCb, 0x581);
+
+    CONodeProcess(&node);                             /* confirmation is delivered once           */
+    CHK_CB_IF_TX_CONFIRM(&TxCfmCb, 1);
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC2
+*
+*          This testcase will check, that all confirmations are delivered with a single call of
+*          COIfCanTxDone().
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TxCfm_Multiple)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2510;
+    uint8_t   sub  = 1;
+    uint8_t   val  = 0x22;
+    uint16_t  num;
+    int16_t   cfm;
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), CO_TUNSIGNED8, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+
+    TS_TxCfmSdoReq(idx, sub, 3);
+    num = CONodeProcessBatch(&node, 0xFFFF);
+    TS_ASSERT(num == 3);
+
+    CHK_CAN(&frm);
+    CHK_CAN(&frm);
+    CHK_CAN(&frm);
+    CHK_NOCAN(&frm);
+
+    cfm = COIfCanTxDone(&node.If);
+    TS_ASSERT(cfm == 3);
+    CHK_CB_IF_TX_CONFIRM(&TxCfmCb, 3);
+
+    cfm = COIfCanTxDone(&node.If);
+    TS_ASSERT(cfm == 0);
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC3
+*
+*          This testcase will check, that the free transmit slots of the driver are reported by
+*          COIfCanTxFree() and released, when the frame left the CAN bus.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TxCfm_TxFree)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2510;
+    uint8_t   sub  = 1;
+    uint8_t   val  = 0x33;
+    int16_t   free;
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), CO_TUNSIGNED8, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+
+    free = COIfCanTxFree(&node.If);
+    TS_TxCfmSdoReq(idx, sub, 2);
+    CONodeProcess(&node);
+    CONodeProcess(&node);
+    TS_ASSERT(COIfCanTxFree(&node.If) == (free - 2));
+
+    CHK_CAN(&frm);
+    TS_ASSERT(COIfCanTxFree(&node.If) == (free - 1));
+    CHK_CAN(&frm);
+    TS_ASSERT(COIfCanTxFree(&node.If) == free);
+
+    CONodeProcess(&node);
+    CHK_CB_IF_TX_CONFIRM(&TxCfmCb, 2);
+    CHK_NO_ERR(&node);
+}
+
+static void TxCfmSetup(void)
+{
+    TS_CallbackInit(&TxCfmCb);
+}
+
+static void TxCfmCleanup(void)
+{
+    TS_CallbackDeInit();
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CORE_TXCFM()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(TxCfmSetup, TxCfmCleanup);
+
+    TS_RUNNER(TS_TxCfm_Confirm);
+    TS_RUNNER(TS_TxCfm_Multiple);
+    TS_RUNNER(TS_TxCfm_TxFree);
+
+    TS_End();
+}
@@ -44,6 +44,7 @@ typedef enum DEF_TEST_GROUPS_E {                      /*---- Test Groups -------
 
 typedef enum DEF_OD_SUITES_E {                        /*---- Object Dictionary Test Suites -------*/
     DEF_S_OD_API,                                     /*!< Group: Object read/write API           */
+    DEF_S_OD_PARA,                                    /*!< Group: Parameter store                 */
 
     DEF_S_OD_NUM                                      /*!< Number of Suites in Group              */
 } DEF_OD_SUITES;
@@ -51,6 +52,10 @@ typedef enum DEF_OD_SUITES_E {                        /*---- Object Dictionary T
 typedef enum DEF_CORE_SUITES_E {                      /*---- Core Component Test Suites ----------*/
     DEF_S_CORE_TMR,                                   /*!< Suite: Highspeed Timer                 */
     DEF_S_MIN_TIME,                                   /*!< Suite: COTmrGetMinTime()               */
+    DEF_S_CORE_BATCH,                                 /*!< Suite: Batched CAN Receive             */
+    DEF_S_CORE_FILTER,                                /*!< Suite: CAN Acceptance Filter           */
+    DEF_S_CORE_TXCFM,                                 /*!< Suite: CAN Transmit Confirmation       */
+    DEF_S_CORE_CTX,                                   /*!< Suite: Nodes with Driver Context       */
 
     DEF_S_CORE_NUM                                    /*!< Number of Suites in Group              */
 } DEF_CORE_SUITES;
@@ -103,6 +108,8 @@ typedef enum DEF_CSDO_SUITES_E {                      /*---- SDO Client Test Sui
     DEF_S_CSDO_EXP_DOWN,                              /*!< Suite: SDO Download Expedited          */
     DEF_S_CSDO_SEG_UP,                                /*!< Suite: SDO Upload Segmented            */
     DEF_S_CSDO_SEG_DOWN,                              /*!< Suite: SDO Download Segmented          */
+    DEF_S_CSDO_BLK_UP,                                /*!< Suite: SDO Upload Block                */
+    DEF_S_CSDO_BLK_DOWN,                              /*!< Suite: SDO Download Block              */
 
     DEF_S_CSDO_NUM                                    /*!< Number of Suites in Group              */
 } DEF_CSDO_SUITES;
@@ -112,8 +119,13 @@ typedef enum DEF_CSDO_SUITES_E {                      /*---- SDO Client Test Sui
 ******************************************************************************/
 
 #define SUITE_CORE_TMR()   TS_DEF_SUITE(DEF_G_CORE, DEF_S_CORE_TMR)  /*!< \addtogroup core_tmr    Core Timer Test     */
+#define SUITE_CORE_BATCH() TS_DEF_SUITE(DEF_G_CORE, DEF_S_CORE_BATCH) /*!< \addtogroup core_batch Batched CAN Receive Test */
+#define SUITE_CORE_FILTER() TS_DEF_SUITE(DEF_G_CORE, DEF_S_CORE_FILTER) /*!< \addtogroup core_filter CAN Acceptance Filter Test */
+#define SUITE_CORE_TXCFM() TS_DEF_SUITE(DEF_G_CORE, DEF_S_CORE_TXCFM) /*!< \addtogroup core_txcfm CAN Transmit Confirmation Test */
+#define SUITE_CORE_CTX()   TS_DEF_SUITE(DEF_G_CORE, DEF_S_CORE_CTX)  /*!< \addtogroup core_ctx   Nodes with Driver Context Test */
 
 #define SUITE_OD_API()     TS_DEF_SUITE(DEF_G_OD, DEF_S_OD_API)      /*!< \addtogroup od_api  Object Dictionary API Test */
+#define SUITE_OD_PARA()    TS_DEF_SUITE(DEF_G_OD, DEF_S_OD_PARA)     /*!< \addtogroup od_para Parameter Store Test       */
 
 #define SUITE_EXP_UP()     TS_DEF_SUITE(DEF_G_SDOS, DEF_S_EXP_UP)    /*!< \addtogroup sdos_exp_up   SDO Server Test: Expedited Upload   */
 #define SUITE_EXP_DOWN()   TS_DEF_SUITE(DEF_G_SDOS, DEF_S_EXP_DOWN)  /*!< \addtogroup sdos_exp_down SDO Server Test: Expedited Download */
@@ -142,5 +154,7 @@ typedef enum DEF_CSDO_SUITES_E {                      /*---- SDO Client Test Sui
 #define SUITE_CSDO_EXP_DOWN() TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_EXP_DOWN)  /*!< \addtogroup csdo_exp_down  SDO Client Expedited Download Test */
 #define SUITE_CSDO_SEG_UP()   TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_SEG_UP)    /*!< \addtogroup csdo_seg_down  SDO Client Segmented Upload Test   */
 #define SUITE_CSDO_SEG_DOWN() TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_SEG_DOWN)  /*!< \addtogroup csdo_seg_down  SDO Client Segmented Download Test */
+#define SUITE_CSDO_BLK_UP()   TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_BLK_UP)    /*!< \addtogroup csdo_blk_up    SDO Client Block Upload Test       */
+#define SUITE_CSDO_BLK_DOWN() TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_BLK_DOWN)  /*!< \addtogroup csdo_blk_down  SDO Client Block Download Test     */
 
 #endif /* DEF_SUITE_H_ */
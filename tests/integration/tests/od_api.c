@@ -194,7 +194,8 @@ TS_DEF_MAIN(TS_OD_GetDirect)
 const uint8_t DemoString[] = "TestData\0";
 CO_OBJ_STR DemoStringObj = {
     (uint32_t) 0,              /* variable for read position     */
-    (uint8_t *)&DemoString[0]  /* start address of string memory */
+    (uint8_t *)&DemoString[0], /* start address of string memory */
+    (uint32_t) 0               /* string length (0 = unknown)    */
  };
 
 // TS_DEF_MAIN(TS_OD_GetStringReadOnly)
@@ -0,0 +1,297 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define PARA_SIZE     64                              /* size of parameter group in bytes         */
+#define PARA_SIG      0x65766173                      /* store signature 'save'                   */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint32_t      ParaMem[PARA_SIZE / 4];          /* parameter memory block                   */
+static CO_PARA_DIRTY ParaDirty;                       /* dirty tracking of parameter group        */
+static CO_PARA       Para;                            /* parameter group info                     */
+static CO_OBJ_DOM    ParaDom;                         /* domain in parameter memory               */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TS_ParaDir(CO_PARA_DIRTY *dirty)
+{
+    uint8_t *mem = (uint8_t *)&ParaMem[0];
+
+    Para.Offset  = 0;
+    Para.Size    = PARA_SIZE;
+    Para.Start   = mem;
+    Para.Default = NULL;
+    Para.Type    = CO_RESET_NODE;
+    Para.Ident   = NULL;
+    Para.Value   = CO_PARA___E;
+    Para.Dirty   = dirty;
+    ParaDirty.Valid = 0;
+    ParaDirty.Num   = 0;
+
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x1010, 0, CO_OBJ_D___R_), CO_TPARA_STORE, (CO_DATA)(1));
+    TS_ODAdd(CO_KEY(0x1010, 1, CO_OBJ_____RW), CO_TPARA_STORE, (CO_DATA)(&Para));
+    TS_ODAdd(CO_KEY(0x2100, 1, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&mem[ 0]));
+    TS_ODAdd(CO_KEY(0x2100, 2, CO_OBJ_____RW), CO_TUNSIGNED8,  (CO_DATA)(&mem[ 8]));
+    TS_ODAdd(CO_KEY(0x2100, 3, CO_OBJ_____RW), CO_TUNSIGNED8,  (CO_DATA)(&mem[10]));
+    TS_ODAdd(CO_KEY(0x2100, 4, CO_OBJ_____RW), CO_TUNSIGNED8,  (CO_DATA)(&mem[12]));
+    TS_ODAdd(CO_KEY(0x2100, 5, CO_OBJ_____RW), CO_TUNSIGNED8,  (CO_DATA)(&mem[20]));
+    TS_ODAdd(CO_KEY(0x2100, 6, CO_OBJ_____RW), CO_TUNSIGNED8,  (CO_DATA)(&mem[50]));
+}
+
+static void TS_ParaNode(CO_NODE *node, CO_PARA_DIRTY *dirty)
+{
+    TS_ParaDir(dirty);
+    TS_CreateNode(node, 0);
+}
+
+static void TS_ParaCheckNvm(CO_NODE *node)
+{
+    uint8_t  buf[PARA_SIZE];
+    uint8_t *mem = (uint8_t *)&ParaMem[0];
+    uint32_t idx;
+
+    TS_ASSERT(PARA_SIZE == COIfNvmRead(&node->If, 0, &buf[0], PARA_SIZE));
+    for (idx = 0; idx < PARA_SIZE; idx++) {
+        TS_ASSERT(mem[idx] == buf[idx]);
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC1
+*
+*          This testcase will check, that a store of a parameter group without dirty tracking
+*          writes the whole parameter group.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_WholeGroup)
+{
+    CO_NODE node;
+
+    TS_ParaNode(&node, NULL);
+
+    TS_SDO_SEND(0x23, 0x2100, 1, 0x12345678);         /* change parameter                         */
+    CHK_SDO0_OK(0x2100, 1);
+    TS_SDO_SEND(0x2F, 0x2100, 2, 0x9A);
+    CHK_SDO0_OK(0x2100, 2);
+
+    TS_SDO_SEND(0x23, 0x1010, 1, PARA_SIG);           /* store parameter group                    */
+    CHK_SDO0_OK(0x1010, 1);
+    TS_ASSERT(PARA_SIZE == SimNvmWritten());          /* whole parameter group is written         */
+    TS_ParaCheckNvm(&node);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC2
+*
+*          This testcase will check, that a store of a parameter group with dirty tracking
+*          writes only the changed objects.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_DirtyRanges)
+{
+    CO_NODE node;
+
+    TS_ParaNode(&node, &ParaDirty);
+
+    TS_SDO_SEND(0x23, 0x2100, 1, 0x12345678);         /* change parameter                         */
+    CHK_SDO0_OK(0x2100, 1);
+    TS_SDO_SEND(0x2F, 0x2100, 2, 0x9A);
+    CHK_SDO0_OK(0x2100, 2);
+    TS_ASSERT(2 == ParaDirty.Num);
+
+    TS_SDO_SEND(0x23, 0x1010, 1, PARA_SIG);           /* store parameter group                    */
+    CHK_SDO0_OK(0x1010, 1);
+    TS_ASSERT(5 == SimNvmWritten());                  /* only changed bytes are written           */
+    TS_ASSERT(0 == ParaDirty.Num);
+    TS_ParaCheckNvm(&node);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC3
+*
+*          This testcase will check, that the ranges with the smallest gap are merged, when
+*          more ranges are changed than tracked.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_DirtyMerge)
+{
+    CO_NODE node;
+    uint8_t sub;
+
+    TS_ParaNode(&node, &ParaDirty);
+
+    for (sub = 2; sub <= 6; sub++) {                  /* change 5 parameters at 8,10,12,20,50     */
+        TS_SDO_SEND(0x2F, 0x2100, sub, sub);
+        CHK_SDO0_OK(0x2100, sub);
+    }
+    TS_ASSERT(CO_PARA_DIRTY_N >= ParaDirty.Num);
+
+    TS_SDO_SEND(0x23, 0x1010, 1, PARA_SIG);           /* store parameter group                    */
+    CHK_SDO0_OK(0x1010, 1);
+#if CO_PARA_DIRTY_N == 4
+    TS_ASSERT(6 == SimNvmWritten());                  /* ranges 8..10, 12, 20 and 50 are written  */
+#endif
+    TS_ASSERT(PARA_SIZE > SimNvmWritten());
+    TS_ParaCheckNvm(&node);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC4
+*
+*          This testcase will check, that a store without changes writes nothing, and that the
+*          application marks changes in memory with COParaDirtyMark().
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_DirtyMark)
+{
+    CO_NODE  node;
+    uint8_t *mem = (uint8_t *)&ParaMem[0];
+
+    TS_ParaNode(&node, &ParaDirty);
+
+    TS_SDO_SEND(0x23, 0x1010, 1, PARA_SIG);           /* store unchanged parameter group          */
+    CHK_SDO0_OK(0x1010, 1);
+    TS_ASSERT(0 == SimNvmWritten());
+
+    mem[60] = 0x11;                                   /* change parameters in memory              */
+    mem[63] = 0x22;
+    COParaDirtyMark(&Para, 60, 4);
+    COParaDirtyMark(&Para, 62, 8);                    /* range is limited to the parameter group  */
+
+    TS_SDO_SEND(0x23, 0x1010, 1, PARA_SIG);           /* store parameter group                    */
+    CHK_SDO0_OK(0x1010, 1);
+    TS_ASSERT(4 == SimNvmWritten());
+    TS_ParaCheckNvm(&node);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC5
+*
+*          This testcase will check, that the parameters, which are received with a RPDO, are
+*          written with the next store.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_DirtyRPdo)
+{
+    CO_NODE  node;
+    uint8_t *mem         = (uint8_t *)&ParaMem[0];
+    uint32_t rpdo_id     = 0x40000200;
+    uint32_t rpdo_map[2] = { 0x21000120, 0x21000208 };
+    uint8_t  rpdo_type   = 254;
+    uint8_t  rpdo_len    = 2;
+
+    TS_ParaDir(&ParaDirty);
+    TS_CreateRPdoCom(0, &rpdo_id,     &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
+    TS_CreateNodeAutoStart(&node);
+
+    TS_PDO_SEND(0x201, 0x31);                         /* change parameters at 0..3 and 8          */
+    TS_ASSERT(0x31 == mem[0]);
+    TS_ASSERT(0x35 == mem[8]);
+
+    TS_SDO_SEND(0x23, 0x1010, 1, PARA_SIG);           /* store parameter group                    */
+    CHK_SDO0_OK(0x1010, 1);
+    TS_ASSERT(5 == SimNvmWritten());                  /* only received bytes are written          */
+    TS_ParaCheckNvm(&node);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC6
+*
+*          This testcase will check, that a domain, which is received with a SDO block download
+*          directly into the parameter memory, is written with the next store, even when the
+*          parameter group is stored during the transfer.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_Para_DirtyBlock)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint8_t  *mem = (uint8_t *)&ParaMem[0];
+    uint8_t   n;
+
+    ParaDom.Offset = 0;
+    ParaDom.Size   = 16;
+    ParaDom.Start  = &mem[32];
+    TS_ParaDir(&ParaDirty);
+    TS_ODAdd(CO_KEY(0x2100, 7, CO_OBJ_____RW), CO_TDOMAIN, (CO_DATA)(&ParaDom));
+    TS_CreateNode(&node, 0);
+
+    TS_SDO_SEND (0xC2, 0x2100, 7, 16);                /* init block download of 16 bytes          */
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA0);
+    TS_ASSERT(CO_ERR_NONE == COParaStore(&Para, &node));
+    TS_ASSERT(16 == SimNvmWritten());                 /* store during the transfer                */
+    TS_SendBlk(0x00, 3, 1, 0);                        /* transmit segments in (last) block        */
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA2);
+    TS_EBLK_SEND(0xD5, 0x00000000);                   /* end block download, 5 unused bytes       */
+    CHK_CAN     (&frm);
+    CHK_SDO0    (frm, 0xA1);
+    for (n = 0; n < 16; n++) {
+        TS_ASSERT(n == mem[32 + n]);
+    }
+
+    TS_SDO_SEND(0x23, 0x1010, 1, PARA_SIG);           /* store parameter group                    */
+    CHK_SDO0_OK(0x1010, 1);
+    TS_ASSERT(32 == SimNvmWritten());                 /* only the domain is written again         */
+    TS_ParaCheckNvm(&node);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_OD_PARA()
+{
+    TS_Begin(__FILE__);
+
+    TS_RUNNER(TS_Para_WholeGroup);
+    TS_RUNNER(TS_Para_DirtyRanges);
+    TS_RUNNER(TS_Para_DirtyMerge);
+    TS_RUNNER(TS_Para_DirtyMark);
+    TS_RUNNER(TS_Para_DirtyRPdo);
+    TS_RUNNER(TS_Para_DirtyBlock);
+
+    TS_End();
+}
@@ -249,6 +249,48 @@ TS_DEF_MAIN(TS_RPdo_24Bit)
     CHK_NO_ERR(&node);
 }
 
+TS_DEF_MAIN(TS_RPdo_DirectAndAsync)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_OBJ   *obj;
+    uint32_t  rpdo_id      = 0x40000200;
+    uint32_t  rpdo_map[2]  = { 0x25001510, 0x25000B08 };
+    uint8_t   rpdo_type    = 254;
+    uint8_t   rpdo_len     = 2;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map     = 0x25000B08;
+    uint8_t   tpdo_type    = 1;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   data8        = 0x91;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,     &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_OBJ_D___RW), CO_TUNSIGNED16, (CO_DATA)(0x8182));
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ___APRW), CO_TUNSIGNED8,  (CO_DATA)(&data8));
+    TS_CreateNodeAutoStart(&node);
+
+    TS_PDO_SEND(0x201, 0x21);
+
+    /* check signals to be changed */
+    obj = CODictFind(&node.Dict, CO_DEV(0x2500, 0x15));
+    TS_ASSERT(0x2221 == (uint16_t)obj->Data);
+    TS_ASSERT(0x23 == data8);
+
+    /* check asynchronous TPDO, triggered by changed value */
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x181, 1);
+    CHK_BYTE (frm, 0, 0x23);
+
+    /* check error free stack execution */
+    CHK_NO_ERR(&node);
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TC5
 *
@@ -398,6 +440,7 @@ SUITE_PDO_RX()
     TS_RUNNER(TS_RPdo_2x4Byte);
     TS_RUNNER(TS_RPdo_1_2_4Byte);
     TS_RUNNER(TS_RPdo_24Bit);
+    TS_RUNNER(TS_RPdo_DirectAndAsync);
 
     TS_RUNNER(TS_RPdo_NoData);
     TS_RUNNER(TS_RPdo_UpdateAfterSync);
@@ -221,6 +221,37 @@ TS_DEF_MAIN(TS_TPdo_24Bit)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+TS_DEF_MAIN(TS_TPdo_DirectAndNodeId)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map[3]  = { 0x25000B08, 0x25001510, 0x25001F20 };
+    uint8_t   tpdo_type    = 0xfe;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 3;
+    uint8_t   data8        = 0x90;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ__N_PRW), CO_TUNSIGNED8,  (CO_DATA)(&data8));
+    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_OBJ_D___R_|CO_OBJ____P__), CO_TUNSIGNED16, (CO_DATA)(0x8182));
+    TS_ODAdd(CO_KEY(0x2500, 0x1F, CO_OBJ_D___R_|CO_OBJ____P__), CO_TUNSIGNED32, (CO_DATA)(0x71727374));
+    TS_CreateNodeAutoStart(&node);
+
+    COTPdoTrigPdo(node.TPdo, 0);                      /* send PDO #0                              */
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 7);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x91);                          /* object type function adds node-id        */
+    CHK_WORD (frm, 1, 0x8182);
+    CHK_LONG (frm, 3, 0x71727374);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TC5
 *
@@ -1128,6 +1159,91 @@ TS_DEF_MAIN(TS_TPdo_ChangeAsyncProperty)
     CHK_NO_ERR(&node);                                       /* check error free stack execution  */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*
+*          This testcase will check, that a PDO reset via COB-ID does not accumulate the signal
+*          links: a trigger via object reference transmits the PDO exactly once.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdo_ViaObjAfterReset)
+{
+    CO_OBJ   *obj;
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map     = 0x25000B08;
+    uint8_t   tpdo_type    = 254;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   data8        = 0x91;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8));
+    TS_CreateNodeAutoStart(&node);
+
+    TS_SDO_SEND(0x23, 0x1800, 1, 0xC0000181);         /* disable PDO #0                           */
+    CHK_SDO0_OK(0x1800, 1);
+    TS_SDO_SEND(0x23, 0x1800, 1, 0x40000181);         /* enable PDO #0 again                      */
+    CHK_SDO0_OK(0x1800, 1);
+
+    obj = CODictFind(&node.Dict, CO_DEV(0x2500,0x0B));  /* trigger PDO via object reference         */
+    COTPdoTrigObj(node.TPdo, obj);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 1);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x91);
+    CHK_NOCAN(&frm);                                  /* check for no further CAN frame           */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*
+*          This testcase will check the trigger via object reference of an object, which is mapped
+*          into two PDOs (and twice within the second PDO): each PDO is transmitted once.
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdo_ViaObjMultiPdo)
+{
+    CO_OBJ   *obj;
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id[2]   = { 0x40000180, 0x40000280 };
+    uint32_t  tpdo_map0    = 0x25000B08;
+    uint32_t  tpdo_map1[2] = { 0x25000B08, 0x25000B08 };
+    uint8_t   tpdo_type    = 254;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len0    = 1;
+    uint8_t   tpdo_len1    = 2;
+    uint8_t   data8        = 0x91;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id[0], &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map0, &tpdo_len0);
+    TS_CreateTPdoCom(1, &tpdo_id[1], &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(1, &tpdo_map1[0], &tpdo_len1);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8));
+    TS_CreateNodeAutoStart(&node);
+
+    obj = CODictFind(&node.Dict, CO_DEV(0x2500,0x0B));  /* trigger PDOs via object reference        */
+    COTPdoTrigObj(node.TPdo, obj);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x281, 2);                         /* check PDO #1 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x91);
+    CHK_BYTE (frm, 1, 0x91);
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 1);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x91);
+    CHK_NOCAN(&frm);                                  /* check for no further CAN frame           */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -1141,11 +1257,14 @@ SUITE_PDO_TX()
     TS_RUNNER(TS_TPdo_2x4Byte);
     TS_RUNNER(TS_TPdo_1_2_4Byte);
     TS_RUNNER(TS_TPdo_24Bit);
+    TS_RUNNER(TS_TPdo_DirectAndNodeId);
     TS_RUNNER(TS_TPdo_NoData);
     TS_RUNNER(TS_TPdo_After3Sync);
     TS_RUNNER(TS_TPdo_After240Sync);
     TS_RUNNER(TS_TPdo_Type254ViaObj);
     TS_RUNNER(TS_TPdo_Type255ViaObj);
+    TS_RUNNER(TS_TPdo_ViaObjAfterReset);
+    TS_RUNNER(TS_TPdo_ViaObjMultiPdo);
     TS_RUNNER(TS_TPdo_Type254ViaNum);
     TS_RUNNER(TS_TPdo_Type255ViaNum);
     TS_RUNNER(TS_TPdo_Tmr);
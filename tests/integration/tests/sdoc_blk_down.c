@@ -0,0 +1,506 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \addtogroup csdo_blk_down
+* \details    This test suite checks the protocol for SDO block download
+*             (e.g. SDO client writes data to SDO server).
+* @{
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+#if USE_CSDO
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static TS_CALLBACK CSdoBlkDownCb;
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to write a 16 byte domain to SDO server
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to write
+*           16 bytes with CRC to the SDO server #0 on device with Node-Id 5.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_Blk16ByteDomain)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[16] = { 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestDownloadBlock(csdo,
+                                     CO_DEV(idx, sub),
+                                     &val[0], 16,
+                                     TS_AppCSdoCallback,
+                                     timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC6);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_DATA (frm, 16);
+
+    /* -- SERVER INIT RESPONSE: OK, CRC SUPPORTED, 127 SEGMENTS -- */
+    TS_SDO5_SEND (0xA4, idx, sub, 127);
+
+    /* -- CHECK SDO BLOCK: 3 SEGMENTS -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x01);
+    CHK_BYTE (frm, 1, 1);
+    CHK_BYTE (frm, 7, 7);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x02);
+    CHK_BYTE (frm, 1, 8);
+    CHK_BYTE (frm, 7, 14);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x83);
+    CHK_BYTE (frm, 1, 15);
+    CHK_BYTE (frm, 2, 16);
+    CHK_BYTE (frm, 3, 0);
+    CHK_NOCAN(&frm);
+
+    /* -- SERVER BLOCK ACKNOWLEDGE -- */
+    TS_SEG5_SEND (0xA2, 0x00007F03, 0x000000);
+
+    /* -- CHECK END BLOCK REQUEST: 5 UNUSED BYTES, CRC -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xD5);
+    CHK_BYTE (frm, 1, 0xE5);
+    CHK_BYTE (frm, 2, 0x65);
+
+    /* -- SERVER END BLOCK RESPONSE -- */
+    TS_SEG5_SEND (0xA1, 0x00000000, 0x000000);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, 0);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to repeat segments, which are not acknowledged
+*
+*           The SDO server requests blocks of 2 segments and acknowledges
+*           only the first segment of the first block. The SDO client
+*           continues with the second segment.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_BlkSeqError)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[16] = { 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestDownloadBlock(csdo,
+                                     CO_DEV(idx, sub),
+                                     &val[0], 16,
+                                     TS_AppCSdoCallback,
+                                     timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC6);
+
+    /* -- SERVER INIT RESPONSE: OK, NO CRC, 2 SEGMENTS -- */
+    TS_SDO5_SEND (0xA0, idx, sub, 2);
+
+    /* -- CHECK SDO BLOCK #1: 2 SEGMENTS -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x01);
+    CHK_BYTE (frm, 1, 1);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x02);
+    CHK_BYTE (frm, 1, 8);
+    CHK_NOCAN(&frm);
+
+    /* -- SERVER BLOCK ACKNOWLEDGE: ONLY SEGMENT #1 -- */
+    TS_SEG5_SEND (0xA2, 0x00000201, 0x000000);
+
+    /* -- CHECK SDO BLOCK #2: REPEAT SEGMENT #2 -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x01);
+    CHK_BYTE (frm, 1, 8);
+    CHK_BYTE (frm, 7, 14);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x82);
+    CHK_BYTE (frm, 1, 15);
+    CHK_BYTE (frm, 2, 16);
+    CHK_NOCAN(&frm);
+
+    /* -- SERVER BLOCK ACKNOWLEDGE -- */
+    TS_SEG5_SEND (0xA2, 0x00000202, 0x000000);
+
+    /* -- CHECK END BLOCK REQUEST: 5 UNUSED BYTES, NO CRC -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xD5);
+    CHK_BYTE (frm, 1, 0);
+    CHK_BYTE (frm, 2, 0);
+
+    /* -- SERVER END BLOCK RESPONSE -- */
+    TS_SEG5_SEND (0xA1, 0x00000000, 0x000000);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, 0);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to handle an invalid block size
+*
+*           The SDO server responds with a block size of 0 segments, the
+*           SDO client aborts the transfer.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_BlkBadBlkSize)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[16] = { 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestDownloadBlock(csdo,
+                                     CO_DEV(idx, sub),
+                                     &val[0], 16,
+                                     TS_AppCSdoCallback,
+                                     timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC6);
+
+    /* -- SERVER INIT RESPONSE: BAD BLOCK SIZE -- */
+    TS_SDO5_SEND (0xA4, idx, sub, 0);
+
+    /* -- CHECK ABORT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x80);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_DATA (frm, CO_SDO_ERR_BLK_SIZE);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, CO_SDO_ERR_BLK_SIZE);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to handle an abort response
+*
+*           The SDO server aborts the transfer after the first block.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_BlkAbort)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[16] = { 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestDownloadBlock(csdo,
+                                     CO_DEV(idx, sub),
+                                     &val[0], 16,
+                                     TS_AppCSdoCallback,
+                                     timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC6);
+
+    /* -- SERVER INIT RESPONSE: OK, 127 SEGMENTS -- */
+    TS_SDO5_SEND (0xA4, idx, sub, 127);
+    CHK_CAN  (&frm);
+    CHK_CAN  (&frm);
+    CHK_CAN  (&frm);
+
+    /* -- SERVER ABORT -- */
+    TS_SDO5_SEND (0x80, idx, sub, 0x06070010);
+    CHK_NOCAN(&frm);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, 0x06070010);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to write a block with a full transmit queue
+*
+*           The SDO client sends no segment while the CAN driver reports no
+*           free transmit slot. The segments are sent with the next node
+*           processing after the queue is free again.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_BlkTxQueueFull)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[16] = { 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestDownloadBlock(csdo,
+                                     CO_DEV(idx, sub),
+                                     &val[0], 16,
+                                     TS_AppCSdoCallback,
+                                     timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC6);
+
+    /* -- SERVER INIT RESPONSE WITH FULL TRANSMIT QUEUE -- */
+    SimCanSetTxFree(0);
+    TS_SDO5_SEND (0xA4, idx, sub, 127);
+    CHK_NOCAN(&frm);
+    CONodeProcess(&node);
+    CHK_NOCAN(&frm);
+
+    /* -- CHECK SDO BLOCK AFTER QUEUE IS FREE AGAIN: 3 SEGMENTS -- */
+    SimCanSetTxFree(-1);
+    CONodeProcess(&node);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x01);
+    CHK_BYTE (frm, 1, 1);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x02);
+    CHK_BYTE (frm, 1, 8);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x83);
+    CHK_BYTE (frm, 1, 15);
+    CHK_BYTE (frm, 2, 16);
+    CHK_NOCAN(&frm);
+
+    /* -- SERVER BLOCK ACKNOWLEDGE -- */
+    TS_SEG5_SEND (0xA2, 0x00007F03, 0x000000);
+
+    /* -- CHECK END BLOCK REQUEST: 5 UNUSED BYTES, CRC -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xD5);
+    CHK_BYTE (frm, 1, 0xE5);
+    CHK_BYTE (frm, 2, 0x65);
+
+    /* -- SERVER END BLOCK RESPONSE -- */
+    TS_SEG5_SEND (0xA1, 0x00000000, 0x000000);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, 0);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to write a block with limited transmit slots
+*
+*           The SDO client sends 50 bytes in a block of 8 segments, while
+*           the CAN driver reports 3 free transmit slots. Each node
+*           processing sends up to the number of free slots.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_BlkTxCreditPaced)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[50];
+    uint8_t   seg;
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+    for (seg = 0; seg < 50; seg++) {
+        val[seg] = seg;
+    }
+
+    /* -- TEST -- */
+    err = COCSdoRequestDownloadBlock(csdo,
+                                     CO_DEV(idx, sub),
+                                     &val[0], 50,
+                                     TS_AppCSdoCallback,
+                                     timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC6);
+
+    /* -- SERVER INIT RESPONSE: OK, NO CRC, 127 SEGMENTS -- */
+    SimCanSetTxFree(3);
+    TS_SDO5_SEND (0xA0, idx, sub, 127);
+
+    /* -- CHECK SDO BLOCK: 8 SEGMENTS, 3 PER NODE PROCESSING -- */
+    for (seg = 1; seg <= 8; seg++) {
+        if ((seg > 1) && (((seg - 1) % 3) == 0)) {
+            CHK_NOCAN(&frm);
+            CONodeProcess(&node);
+        }
+        CHK_CAN  (&frm);
+        if (seg < 8) {
+            CHK_SDO5 (frm, seg);
+        } else {
+            CHK_SDO5 (frm, 0x88);
+        }
+        CHK_BYTE (frm, 1, (seg - 1) * 7);
+    }
+    CHK_NOCAN(&frm);
+    CONodeProcess(&node);
+    CHK_NOCAN(&frm);
+
+    /* -- SERVER BLOCK ACKNOWLEDGE -- */
+    SimCanSetTxFree(-1);
+    TS_SEG5_SEND (0xA2, 0x00007F08, 0x000000);
+
+    /* -- CHECK END BLOCK REQUEST: 6 UNUSED BYTES, NO CRC -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xD9);
+    CHK_BYTE (frm, 1, 0);
+    CHK_BYTE (frm, 2, 0);
+
+    /* -- SERVER END BLOCK RESPONSE -- */
+    TS_SEG5_SEND (0xA1, 0x00000000, 0x000000);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, 0);
+
+    CHK_NO_ERR(&node);
+}
+
+static void CSdoBlkDownSetup(void)
+{
+    TS_CallbackInit(&CSdoBlkDownCb);
+}
+
+static void CSdoBlkDownCleanup(void)
+{
+    TS_CallbackDeInit();
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CSDO_BLK_DOWN()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(CSdoBlkDownSetup, CSdoBlkDownCleanup);
+
+    TS_RUNNER(TS_CSdoWr_Blk16ByteDomain);
+    TS_RUNNER(TS_CSdoWr_BlkSeqError);
+
+    TS_RUNNER(TS_CSdoWr_BlkBadBlkSize);
+    TS_RUNNER(TS_CSdoWr_BlkAbort);
+    TS_RUNNER(TS_CSdoWr_BlkTxQueueFull);
+    TS_RUNNER(TS_CSdoWr_BlkTxCreditPaced);
+
+    TS_End();
+}
+
+#endif
+
+/*! @} */
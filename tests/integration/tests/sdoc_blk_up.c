@@ -0,0 +1,436 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \addtogroup csdo_blk_up
+* \details    This test suite checks the protocol for SDO block upload
+*             (e.g. SDO client reads data from SDO server).
+* @{
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+#if USE_CSDO
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static TS_CALLBACK CSdoBlkUpCb;
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to read a 16 byte domain from the SDO server
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to read
+*           16 bytes with CRC from the SDO server #0 on device with Node-Id 5.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_Blk16ByteDomain)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[16] = { 0 };
+    uint8_t   n;
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestUploadBlock(csdo,
+                                   CO_DEV(idx, sub),
+                                   &val[0], 16,
+                                   TS_AppCSdoCallback,
+                                   timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA4);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_BYTE (frm, 4, CO_CSDO_BLK_SIZE);
+
+    /* -- SERVER INIT RESPONSE: OK, CRC SUPPORTED -- */
+    TS_SDO5_SEND (0xC6, idx, sub, 16);
+
+    /* -- CHECK SDO START UPLOAD REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA3);
+
+    /* -- SERVER BLOCK: 3 SEGMENTS -- */
+    TS_SEG5_SEND (0x01, 0x04030201, 0x070605);
+    CHK_NOCAN(&frm);
+    TS_SEG5_SEND (0x02, 0x0b0a0908, 0x0e0d0c);
+    CHK_NOCAN(&frm);
+    TS_SEG5_SEND (0x83, 0x0000100f, 0x000000);
+
+    /* -- CHECK BLOCK ACKNOWLEDGE -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA2);
+    CHK_BYTE (frm, 1, 3);
+    CHK_BYTE (frm, 2, CO_CSDO_BLK_SIZE);
+
+    /* -- SERVER END BLOCK: 5 UNUSED BYTES, CRC -- */
+    TS_SEG5_SEND (0xD5, 0x000065e5, 0x000000);
+
+    /* -- CHECK END BLOCK RESPONSE -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA1);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0);
+    for (n = 0; n < 16; n++) {
+        TS_ASSERT(val[n] == (n + 1));
+    }
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to read a domain without CRC
+*
+*           The SDO server does not support CRC, therefore the CRC within
+*           the end block frame is ignored.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_BlkNoCrc)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[9] = { 0 };
+    uint8_t   n;
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestUploadBlock(csdo,
+                                   CO_DEV(idx, sub),
+                                   &val[0], 9,
+                                   TS_AppCSdoCallback,
+                                   timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA4);
+
+    /* -- SERVER INIT RESPONSE: OK, NO CRC -- */
+    TS_SDO5_SEND (0xC2, idx, sub, 9);
+
+    /* -- CHECK SDO START UPLOAD REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA3);
+
+    /* -- SERVER BLOCK: 2 SEGMENTS -- */
+    TS_SEG5_SEND (0x01, 0x04030201, 0x070605);
+    TS_SEG5_SEND (0x82, 0x00000908, 0x000000);
+
+    /* -- CHECK BLOCK ACKNOWLEDGE -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA2);
+    CHK_BYTE (frm, 1, 2);
+
+    /* -- SERVER END BLOCK: 5 UNUSED BYTES, NO CRC -- */
+    TS_SEG5_SEND (0xD5, 0x00000000, 0x000000);
+
+    /* -- CHECK END BLOCK RESPONSE -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA1);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0);
+    for (n = 0; n < 9; n++) {
+        TS_ASSERT(val[n] == (n + 1));
+    }
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to recover from a lost segment
+*
+*           The second segment of the block is lost. The SDO client
+*           acknowledges the first segment and receives the repeated
+*           segments within the next block.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_BlkSeqError)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[16] = { 0 };
+    uint8_t   n;
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestUploadBlock(csdo,
+                                   CO_DEV(idx, sub),
+                                   &val[0], 16,
+                                   TS_AppCSdoCallback,
+                                   timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA4);
+
+    /* -- SERVER INIT RESPONSE: OK, CRC SUPPORTED -- */
+    TS_SDO5_SEND (0xC6, idx, sub, 16);
+
+    /* -- CHECK SDO START UPLOAD REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA3);
+
+    /* -- SERVER BLOCK: SEGMENT #2 IS LOST -- */
+    TS_SEG5_SEND (0x01, 0x04030201, 0x070605);
+    TS_SEG5_SEND (0x83, 0x0000100f, 0x000000);
+
+    /* -- CHECK BLOCK ACKNOWLEDGE: ONLY SEGMENT #1 -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA2);
+    CHK_BYTE (frm, 1, 1);
+
+    /* -- SERVER BLOCK: REPEAT REMAINING SEGMENTS -- */
+    TS_SEG5_SEND (0x01, 0x0b0a0908, 0x0e0d0c);
+    TS_SEG5_SEND (0x82, 0x0000100f, 0x000000);
+
+    /* -- CHECK BLOCK ACKNOWLEDGE -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA2);
+    CHK_BYTE (frm, 1, 2);
+
+    /* -- SERVER END BLOCK: 5 UNUSED BYTES, CRC -- */
+    TS_SEG5_SEND (0xD5, 0x000065e5, 0x000000);
+
+    /* -- CHECK END BLOCK RESPONSE -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA1);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0);
+    for (n = 0; n < 16; n++) {
+        TS_ASSERT(val[n] == (n + 1));
+    }
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to detect a CRC error
+*
+*           The CRC within the end block frame doesn't match the received
+*           data, the SDO client aborts the transfer.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_BlkBadCrc)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[16] = { 0 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestUploadBlock(csdo,
+                                   CO_DEV(idx, sub),
+                                   &val[0], 16,
+                                   TS_AppCSdoCallback,
+                                   timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA4);
+
+    /* -- SERVER INIT RESPONSE: OK, CRC SUPPORTED -- */
+    TS_SDO5_SEND (0xC6, idx, sub, 16);
+
+    /* -- CHECK SDO START UPLOAD REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA3);
+
+    /* -- SERVER BLOCK: 3 SEGMENTS -- */
+    TS_SEG5_SEND (0x01, 0x04030201, 0x070605);
+    TS_SEG5_SEND (0x02, 0x0b0a0908, 0x0e0d0c);
+    TS_SEG5_SEND (0x83, 0x0000100f, 0x000000);
+
+    /* -- CHECK BLOCK ACKNOWLEDGE -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA2);
+
+    /* -- SERVER END BLOCK: BAD CRC -- */
+    TS_SEG5_SEND (0xD5, 0x00001234, 0x000000);
+
+    /* -- CHECK ABORT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x80);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_DATA (frm, CO_SDO_ERR_CRC);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, CO_SDO_ERR_CRC);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to handle a timeout
+*
+*           The SDO server stops sending segments within a block.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_BlkTimeout)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 100;
+    uint8_t   val[16] = { 0 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestUploadBlock(csdo,
+                                   CO_DEV(idx, sub),
+                                   &val[0], 16,
+                                   TS_AppCSdoCallback,
+                                   timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO INIT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA4);
+
+    /* -- SERVER INIT RESPONSE: OK -- */
+    TS_SDO5_SEND (0xC6, idx, sub, 16);
+
+    /* -- CHECK SDO START UPLOAD REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA3);
+
+    /* -- SERVER BLOCK: STOP AFTER FIRST SEGMENT -- */
+    TS_SEG5_SEND (0x01, 0x04030201, 0x070605);
+
+    TS_Wait(&node, 50);
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 0);
+
+    TS_Wait(&node, 100);
+
+    /* -- CHECK ABORT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x80);
+    CHK_DATA (frm, CO_SDO_ERR_TIMEOUT);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, CO_SDO_ERR_TIMEOUT);
+
+    CHK_NO_ERR(&node);
+}
+
+static void CSdoBlkUpSetup(void)
+{
+    TS_CallbackInit(&CSdoBlkUpCb);
+}
+
+static void CSdoBlkUpCleanup(void)
+{
+    TS_CallbackDeInit();
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CSDO_BLK_UP()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(CSdoBlkUpSetup, CSdoBlkUpCleanup);
+
+    TS_RUNNER(TS_CSdoRd_Blk16ByteDomain);
+    TS_RUNNER(TS_CSdoRd_BlkNoCrc);
+    TS_RUNNER(TS_CSdoRd_BlkSeqError);
+
+    TS_RUNNER(TS_CSdoRd_BlkBadCrc);
+    TS_RUNNER(TS_CSdoRd_BlkTimeout);
+
+    TS_End();
+}
+
+#endif
+
+/*! @} */
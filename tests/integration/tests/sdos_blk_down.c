@@ -1413,6 +1413,162 @@ TS_DEF_MAIN(TS_BlkWr_ExpWrAfter43ByteDomain)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block download of an array with size = 994 to the
+*         Domainbuffer with CRC
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkWr_994ByteDomain_Crc)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint32_t    size = 994;
+    uint16_t    idx  = 0x2100;
+    uint8_t     sub  = 1;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT BLOCK DOWNLOAD ================*/
+    TS_SDO_SEND (0xC6, idx, sub, size);               /* ccs=6, cc=1, s=1, cs=0                   */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA4);                          /* check SDO #0 response (sc=1)             */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_BLKSIZE (frm, CO_SDO_BUF_SEG);                /* check block size                         */
+
+                                                      /*===== BLOCK DOWNLOAD =====================*/
+    TS_SendBlk(0x00, 127, 0, 0);                      /* transmit segments in block               */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 127);                           /* check acknowledged sequence number       */
+
+    TS_SendBlk(0x79, 15, 1, 0);                       /* cont. transmit segments to (last) block  */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 15);                            /* check acknowledged sequence number       */
+
+                                                      /*===== END BLOCK DOWNLOAD =================*/
+    TS_EBLK_SEND(0xC1, 0x00001524);                   /* CRC of transfered data                   */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    CHK_DOM_FULL(dom, 0);                             /* check content of domain                  */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block download of an array with size = 994 to the
+*         Domainbuffer with CRC, which is staged in the SDO transfer buffer
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkWr_994ByteStaged_Crc)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint32_t    size = 994;
+    uint16_t    idx  = 0x2100;
+    uint8_t     sub  = 1;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreateStaged(idx, sub, CO_OBJ_____RW, size);
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT BLOCK DOWNLOAD ================*/
+    TS_SDO_SEND (0xC6, idx, sub, size);               /* ccs=6, cc=1, s=1, cs=0                   */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA4);                          /* check SDO #0 response (sc=1)             */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_BLKSIZE (frm, CO_SDO_BUF_SEG);                /* check block size                         */
+
+                                                      /*===== BLOCK DOWNLOAD =====================*/
+    TS_SendBlk(0x00, 127, 0, 0);                      /* transmit segments in block               */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 127);                           /* check acknowledged sequence number       */
+
+    TS_SendBlk(0x79, 15, 1, 0);                       /* cont. transmit segments to (last) block  */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 15);                            /* check acknowledged sequence number       */
+
+                                                      /*===== END BLOCK DOWNLOAD =================*/
+    TS_EBLK_SEND(0xC1, 0x00001524);                   /* CRC of transfered data                   */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    CHK_DOM_FULL(dom, 0);                             /* check content of domain                  */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the abort of a block download with a bad CRC
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkWr_BadCrc)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    uint32_t    size = 42;
+    uint16_t    idx  = 0x2100;
+    uint8_t     sub  = 1;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    DomCreate(idx, sub, CO_OBJ_____RW, size);
+    TS_CreateNode(&node,0);
+                                                      /*===== INIT BLOCK DOWNLOAD ================*/
+    TS_SDO_SEND (0xC6, idx, sub, size);               /* ccs=6, cc=1, s=1, cs=0                   */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA4);                          /* check SDO #0 response (sc=1)             */
+
+                                                      /*===== BLOCK DOWNLOAD =====================*/
+    TS_SendBlk(0x00, 6, 1, 0);                        /* transmit segments in (last) block        */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 6);                             /* check acknowledged sequence number       */
+
+                                                      /*===== END BLOCK DOWNLOAD =================*/
+    TS_EBLK_SEND(0xC1, 0x00001234);                   /* bad CRC                                  */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0x80);                          /* check SDO #0 abort (Id and DLC)          */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, CO_SDO_ERR_CRC);                /* check abort code                         */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -1451,6 +1607,9 @@ SUITE_BLK_DOWN()
     TS_RUNNER(TS_BlkWr_42ByteDomain_49Byte);
     TS_RUNNER(TS_BlkWr_42ByteDomain_49Byte_NoLen);
     TS_RUNNER(TS_BlkWr_ExpWrAfter43ByteDomain);
+    TS_RUNNER(TS_BlkWr_994ByteDomain_Crc);
+    TS_RUNNER(TS_BlkWr_994ByteStaged_Crc);
+    TS_RUNNER(TS_BlkWr_BadCrc);
 
 //    CanDiagnosticOff(0);
 
@@ -617,6 +617,336 @@ TS_DEF_MAIN(TS_BlkRd_LostMiddleSeg)
 }
 
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block upload of an array with size = 994 from Domainbuffer
+*         entry with CRC
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_994ByteDomain_Crc)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom ;
+    uint32_t    size = 994;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 6;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    DomFill(dom, 0);
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA4, idx, sub, CO_SDO_BUF_SEG);     /* ccs=5, cc=1, cs=0                        */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC6);                          /* check SDO #0 response (sc=1, s=1)        */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, size);                          /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+
+                                                      /*===== BLOCK UPLOAD =======================*/
+    TS_ChkBlk  (0x00, 127, 0, 7);                     /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 127, CO_SDO_BUF_SEG);
+
+    TS_ChkBlk  (0x79, 15, 1, 7);                      /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 15, CO_SDO_BUF_SEG);
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC1);                          /* check SDO #0 response (Id and DLC)       */
+    TS_ASSERT(0x1524 == WORD(frm,1));                 /* check CRC of transfered data             */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block upload of an array with size = 994 from Domainbuffer
+*         entry with CRC, which is staged in the SDO transfer buffer
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_994ByteStaged_Crc)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom ;
+    uint32_t    size = 994;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 6;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreateStaged(idx, sub, CO_OBJ_____RW, size);
+    DomFill(dom, 0);
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA4, idx, sub, CO_SDO_BUF_SEG);     /* ccs=5, cc=1, cs=0                        */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC6);                          /* check SDO #0 response (sc=1, s=1)        */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, size);                          /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+
+                                                      /*===== BLOCK UPLOAD =======================*/
+    TS_ChkBlk  (0x00, 127, 0, 7);                     /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 127, CO_SDO_BUF_SEG);
+
+    TS_ChkBlk  (0x79, 15, 1, 7);                      /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 15, CO_SDO_BUF_SEG);
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC1);                          /* check SDO #0 response (Id and DLC)       */
+    TS_ASSERT(0x1524 == WORD(frm,1));                 /* check CRC of transfered data             */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*          This testcase will check the CRC of a block upload of an array with size = 26 Bytes,
+*          where a segment in the middle of the transfer is repeated (Go-Back-N ARQ)
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_LostMiddleSeg_Crc)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom ;
+    uint32_t    size = 26;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 6;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    DomFill(dom, 'a');
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA4, idx, sub, 3);                  /* 3 segments per block (21 bytes), cc=1    */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC6);                          /* check SDO #0 response (sc=1, s=1)        */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, size);                          /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+
+                                                      /*===== BLOCK UPLOAD =======================*/
+    TS_ChkBlk  ('a', 3, 0, 0);                        /* 3 blocks (a-g,h-n,o-u)                   */
+    TS_ACKBLK_SEND(0xA2, 2, 3);                       /* ack for segment 1-2 (segment 3: lost)    */
+
+    TS_ChkBlk  ('o', 2, 1, 5);                        /* 2 blocks (o-u,v-z) (last block: 5 bytes) */
+    TS_ACKBLK_SEND(0xA2, 2, 3);                       /* ack for segment 3-4                      */
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC9);                          /* check SDO #0 response (Id and DLC)       */
+    TS_ASSERT(0x63AC == WORD(frm,1));                 /* check CRC of transfered data             */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block upload with a full transmit queue. The segments are
+*         sent with the next node processing after the queue is free again.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_TxQueueFull)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom ;
+    uint32_t    size = 994;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 6;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    DomFill(dom, 0);
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA0, idx, sub, CO_SDO_BUF_SEG);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, size);                          /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    SimCanSetTxFree(0);                               /* transmit queue is full                   */
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+    CHK_NOCAN   (&frm);                               /* check no segment is sent                 */
+    CONodeProcess(&node);
+    CHK_NOCAN   (&frm);                               /* check no segment is sent                 */
+
+                                                      /*===== BLOCK UPLOAD =======================*/
+    SimCanSetTxFree(-1);                              /* transmit queue is free again             */
+    CONodeProcess(&node);
+    TS_ChkBlk  (0x00, 127, 0, 7);                     /* check received block                     */
+    CHK_NOCAN   (&frm);                               /* check no additional CAN frame            */
+    TS_ACKBLK_SEND(0xA2, 127, CO_SDO_BUF_SEG);
+
+    TS_ChkBlk  (0x79, 15, 1, 7);                      /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 15, CO_SDO_BUF_SEG);
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block upload with a limited number of free transmit slots.
+*         Each node processing sends up to the number of free slots.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_TxCreditPaced)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom ;
+    uint32_t    size = 994;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 6;
+    uint8_t     seg;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    DomFill(dom, 0);
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA0, idx, sub, CO_SDO_BUF_SEG);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, size);                          /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    SimCanSetTxFree(10);                              /* 10 free transmit slots                   */
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+
+                                                      /*===== BLOCK UPLOAD =======================*/
+    for (seg = 1; seg <= 127; seg++) {
+        if ((seg > 1) && (((seg - 1) % 10) == 0)) {
+            CHK_NOCAN    (&frm);                      /* check no segment beyond the credit       */
+            CONodeProcess(&node);                     /* continue with next slots                 */
+        }
+        CHK_CAN  (&frm);                              /* check for a CAN frame                    */
+        CHK_SDO0 (frm, seg);                          /* check SDO #0 response (Id and DLC)       */
+        CHK_SEG  (frm, (uint32_t)(seg - 1) * 7, 7);   /* check SDO response                       */
+    }
+    CHK_NOCAN   (&frm);                               /* check no additional CAN frame            */
+    TS_ACKBLK_SEND(0xA2, 127, CO_SDO_BUF_SEG);
+    CONodeProcess(&node);
+
+    TS_ChkBlk  (0x79, 15, 1, 7);                      /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 15, CO_SDO_BUF_SEG);
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the abort of a block upload with pending segments.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_AbortPending)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom ;
+    uint32_t    size = 994;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 6;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    DomFill(dom, 0);
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA0, idx, sub, CO_SDO_BUF_SEG);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, size);                          /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    SimCanSetTxFree(0);                               /* transmit queue is full                   */
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+    CHK_NOCAN   (&frm);                               /* check no segment is sent                 */
+
+                                                      /*===== CLIENT ABORT =======================*/
+    TS_SDO_SEND (0x80, idx, sub, 0x08000000);
+    SimCanFlush ();                                   /* ignore the server reaction               */
+    SimCanSetTxFree(-1);                              /* transmit queue is free again             */
+    CONodeProcess(&node);
+    CHK_NOCAN   (&frm);                               /* check no pending segment is sent         */
+
+                                                      /*===== EXPEDITED UPLOAD ===================*/
+    TS_SDO_SEND (0x40, 0x1000, 0, 0);
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0x43);                          /* check SDO #0 response (Id and DLC)       */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TESTCASE DESCRIPTION
 *
@@ -1369,6 +1699,12 @@ SUITE_BLK_UP()
     TS_RUNNER(TS_BlkRd_TwoDomains);
     TS_RUNNER(TS_BlkRd_BlkWr_BlkRd);
     TS_RUNNER(TS_BlkRd_Restart_BlkRd);
+    TS_RUNNER(TS_BlkRd_994ByteDomain_Crc);
+    TS_RUNNER(TS_BlkRd_994ByteStaged_Crc);
+    TS_RUNNER(TS_BlkRd_LostMiddleSeg_Crc);
+    TS_RUNNER(TS_BlkRd_TxQueueFull);
+    TS_RUNNER(TS_BlkRd_TxCreditPaced);
+    TS_RUNNER(TS_BlkRd_AbortPending);
 
 //    CanDiagnosticOff(0);
 
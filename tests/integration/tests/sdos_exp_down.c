@@ -93,7 +93,23 @@ static CO_ERR MyTypeWriteErr(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void
 
     return (err);
 }
-static const CO_OBJ_TYPE MyType = { MyTypeSize, 0, 0, MyTypeWriteErr };
+static const CO_OBJ_TYPE MyType = { MyTypeSize, 0, 0, MyTypeWriteErr, 0, 0 };
+
+#define MY_PEND  ((CO_OBJ_TYPE *)&MyPend)
+static CO_ERR MyPendWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buf, uint32_t size)
+{
+    CO_UNUSED(node);
+    CO_UNUSED(size);
+    *((uint8_t *)obj->Data) = *((uint8_t *)buf);
+
+    return (CO_ERR_OBJ_PENDING);
+}
+static const CO_OBJ_TYPE MyPend = { MyTypeSize, 0, 0, MyPendWrite, 0, 0 };
+
+static void MyTmrFunc(void *parg)
+{
+    CO_UNUSED(parg);
+}
 
 /*------------------------------------------------------------------------------------------------*/
 /*!
@@ -706,6 +722,240 @@ TS_DEF_MAIN(TS_ExpWr_UserWriteErr)
     CHK_NO_ERR(&node);
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Pending write with completion
+*
+* \details  This test checks, that the SDO server holds the response of a pending write
+*           access until the completion.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including an entry with a pending write function.
+*
+* ####      Test Steps
+*           1. Send SDO expedited download request
+*           2. Complete the pending write access
+*
+* ####      Test Checks
+*           1. Check, that SDO server holds the response
+*           2. Check, that SDO server response is correct after completion
+*           3. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ExpWr_Pending)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2500;
+    uint8_t   sub  = 1;
+    uint8_t   val  = 0;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), MY_PEND, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+
+    /* -- TEST -- */
+    TS_SDO_SEND (0x2F, idx, sub, 0x42);
+    CHK_NOCAN   (&frm);
+    TS_ASSERT(CO_ERR_NONE == COSdoComplete(&node.Sdo[0], CO_ERR_NONE));
+
+    /* -- CHECK -- */
+    CHK_SDO0_OK(idx, sub);
+    CHK_NOCAN  (&frm);
+
+    TS_ASSERT(0x42 == val);
+    TS_ASSERT(CO_ERR_NONE != COSdoComplete(&node.Sdo[0], CO_ERR_NONE));
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Pending write with error
+*
+* \details  This test checks, that a pending write access, which is completed with an error,
+*           is aborted with the corresponding SDO abort code.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including an entry with a pending write function.
+*
+* ####      Test Steps
+*           1. Send SDO expedited download request
+*           2. Complete the pending write access with a range error
+*
+* ####      Test Checks
+*           1. Check, that SDO server response is an abort with 'range exceeded'
+*           2. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ExpWr_PendingErr)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2500;
+    uint8_t   sub  = 1;
+    uint8_t   val  = 0;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), MY_PEND, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+
+    /* -- TEST -- */
+    TS_SDO_SEND (0x2F, idx, sub, 0x42);
+    CHK_NOCAN   (&frm);
+    TS_ASSERT(CO_ERR_NONE == COSdoComplete(&node.Sdo[0], CO_ERR_OBJ_RANGE));
+
+    /* -- CHECK -- */
+    CHK_SDO0_ERR(idx, sub, CO_SDO_ERR_RANGE);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Pending write with timeout
+*
+* \details  This test checks, that a pending write access, which is not completed in time,
+*           is aborted with a timeout.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including an entry with a pending write function.
+*
+* ####      Test Steps
+*           1. Send SDO expedited download request
+*           2. Wait longer than the pending timeout
+*           3. Send SDO expedited download request
+*
+* ####      Test Checks
+*           1. Check, that SDO server response is an abort with 'timeout'
+*           2. Check, that a late completion is ignored
+*           3. Check, that the next request is held again
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ExpWr_PendingTimeout)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2500;
+    uint8_t   sub  = 1;
+    uint8_t   val  = 0;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), MY_PEND, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+
+    /* -- TEST -- */
+    TS_SDO_SEND (0x2F, idx, sub, 0x42);
+    TS_Wait(&node, CO_SSDO_PEND_TMO / 2);
+    CHK_NOCAN   (&frm);
+    TS_Wait(&node, CO_SSDO_PEND_TMO);
+
+    /* -- CHECK -- */
+    CHK_SDO0_ERR(idx, sub, CO_SDO_ERR_TIMEOUT);
+    TS_ASSERT(CO_ERR_NONE != COSdoComplete(&node.Sdo[0], CO_ERR_NONE));
+    CHK_NOCAN   (&frm);
+
+    TS_SDO_SEND (0x2F, idx, sub, 0x43);
+    CHK_NOCAN   (&frm);
+    TS_ASSERT(CO_ERR_NONE == COSdoComplete(&node.Sdo[0], CO_ERR_NONE));
+    CHK_SDO0_OK(idx, sub);
+    TS_ASSERT(0x43 == val);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Request during pending write
+*
+* \details  This test checks, that a new request during a pending write access aborts the
+*           pending access.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including an entry with a pending write function.
+*
+* ####      Test Steps
+*           1. Send SDO expedited download request
+*           2. Send SDO expedited download request
+*
+* ####      Test Checks
+*           1. Check, that SDO server response is an abort with 'invalid command'
+*           2. Check, that a late completion is ignored
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ExpWr_PendingBusy)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2500;
+    uint8_t   sub  = 1;
+    uint8_t   val  = 0;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), MY_PEND, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+
+    /* -- TEST -- */
+    TS_SDO_SEND (0x2F, idx, sub, 0x42);
+    CHK_NOCAN   (&frm);
+    TS_SDO_SEND (0x2F, idx, sub, 0x43);
+
+    /* -- CHECK -- */
+    CHK_SDO0_ERR(idx, sub, CO_SDO_ERR_CMD);
+    TS_ASSERT(CO_ERR_NONE != COSdoComplete(&node.Sdo[0], CO_ERR_NONE));
+    CHK_NOCAN   (&frm);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Pending write without free timer
+*
+* \details  This test checks, that a pending write access is aborted, when the timeout for
+*           the completion can't be started.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including an entry with a pending write function.
+*           2. Use all free timers
+*
+* ####      Test Steps
+*           1. Send SDO expedited download request
+*
+* ####      Test Checks
+*           1. Check, that SDO server response is an abort with 'can't be stored'
+*           2. Check, that a late completion is ignored
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ExpWr_PendingNoTmr)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2500;
+    uint8_t   sub  = 1;
+    uint8_t   val  = 0;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), MY_PEND, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+    while (COTmrCreate(&node.Tmr, 1000, 0, MyTmrFunc, 0) >= 0) { }
+
+    /* -- TEST -- */
+    TS_SDO_SEND (0x2F, idx, sub, 0x42);
+
+    /* -- CHECK -- */
+    CHK_SDO0_ERR(idx, sub, CO_SDO_ERR_TOS);
+    TS_ASSERT(CO_ERR_NONE != COSdoComplete(&node.Sdo[0], CO_ERR_NONE));
+    CHK_NOCAN   (&frm);
+
+    CHK_ERR(&node, CO_ERR_TMR_NO_ACT);
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -734,6 +984,12 @@ SUITE_EXP_DOWN()
 
     TS_RUNNER(TS_ExpWr_UserWriteErr);
 
+    TS_RUNNER(TS_ExpWr_Pending);
+    TS_RUNNER(TS_ExpWr_PendingErr);
+    TS_RUNNER(TS_ExpWr_PendingTimeout);
+    TS_RUNNER(TS_ExpWr_PendingBusy);
+    TS_RUNNER(TS_ExpWr_PendingNoTmr);
+
 //    CanDiagnosticOff(0);
 
     TS_End();
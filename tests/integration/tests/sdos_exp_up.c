@@ -92,7 +92,22 @@ static CO_ERR MyTypeReadErr(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *
 
     return (err);
 }
-static const CO_OBJ_TYPE MyType = { MyTypeSize, 0, MyTypeReadErr, 0 };
+static const CO_OBJ_TYPE MyType = { MyTypeSize, 0, MyTypeReadErr, 0, 0, 0 };
+
+#define MY_PEND  ((CO_OBJ_TYPE *)&MyPend)
+static uint8_t MyPendReady;
+static CO_ERR MyPendRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buf, uint32_t size)
+{
+    CO_UNUSED(node);
+    CO_UNUSED(size);
+    if (MyPendReady == 0) {
+        return (CO_ERR_OBJ_PENDING);
+    }
+    *((uint8_t *)buf) = *((uint8_t *)obj->Data);
+
+    return (CO_ERR_NONE);
+}
+static const CO_OBJ_TYPE MyPend = { MyTypeSize, 0, MyPendRead, 0, 0, 0 };
 
 /*------------------------------------------------------------------------------------------------*/
 /*!
@@ -768,6 +783,100 @@ TS_DEF_MAIN(TS_ExpRd_UserReadErr)
     CHK_NO_ERR(&node);
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Pending read with completion
+*
+* \details  This test checks, that the SDO server holds the response of a pending read
+*           access and reads the value again after the completion.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including an entry with a pending read function.
+*
+* ####      Test Steps
+*           1. Send SDO expedited upload request
+*           2. Complete the pending read access
+*
+* ####      Test Checks
+*           1. Check, that SDO server holds the response
+*           2. Check, that SDO server response is correct after completion
+*           3. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ExpRd_Pending)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2510;
+    uint8_t   sub  = 1;
+    uint8_t   val  = 0x11;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), MY_PEND, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+    MyPendReady = 0;
+
+    /* -- TEST -- */
+    TS_SDO_SEND (0x40, idx, sub, 0x00000000);
+    CHK_NOCAN   (&frm);
+    MyPendReady = 1;
+    TS_ASSERT(CO_ERR_NONE == COSdoComplete(&node.Sdo[0], CO_ERR_NONE));
+
+    /* -- CHECK -- */
+    CHK_CAN  (&frm);
+
+    CHK_SDO0 (frm, 0x4F);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_DATA (frm, val);
+
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Pending read with error
+*
+* \details  This test checks, that a pending read access, which is completed with an error,
+*           is aborted.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including an entry with a pending read function.
+*
+* ####      Test Steps
+*           1. Send SDO expedited upload request
+*           2. Complete the pending read access with an error
+*
+* ####      Test Checks
+*           1. Check, that SDO server response is an abort
+*           2. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ExpRd_PendingErr)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2510;
+    uint8_t   sub  = 1;
+    uint8_t   val  = 0x11;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), MY_PEND, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+    MyPendReady = 0;
+
+    /* -- TEST -- */
+    TS_SDO_SEND (0x40, idx, sub, 0x00000000);
+    CHK_NOCAN   (&frm);
+    TS_ASSERT(CO_ERR_NONE == COSdoComplete(&node.Sdo[0], CO_ERR_OBJ_READ));
+
+    /* -- CHECK -- */
+    CHK_SDO0_ERR(idx, sub, CO_SDO_ERR_TOS);
+
+    CHK_NO_ERR(&node);
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -796,6 +905,9 @@ SUITE_EXP_UP()
 
     TS_RUNNER(TS_ExpRd_UserReadErr);
 
+    TS_RUNNER(TS_ExpRd_Pending);
+    TS_RUNNER(TS_ExpRd_PendingErr);
+
 //    CanDiagnosticOff(0);
 
     TS_End();
@@ -0,0 +1,175 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TEST_BUF_SIZE  (CO_SDO_BUF_BYTE)
+#define BENCH_LOOPS    2000u
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint8_t TestBuf[TEST_BUF_SIZE];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TestSetup(void)
+{
+    uint32_t n;
+    uint32_t val = 0x12345678u;
+
+    for (n = 0; n < TEST_BUF_SIZE; n++) {
+        val = (val * 1103515245u) + 12345u;
+        TestBuf[n] = (uint8_t)(val >> 16);
+    }
+}
+
+/* bitwise calculation as reference */
+static uint16_t TestCrcBitwise(uint16_t crc, const uint8_t *buf, uint32_t size)
+{
+    uint32_t n;
+    uint8_t  b;
+
+    for (n = 0; n < size; n++) {
+        crc ^= (uint16_t)((uint16_t)buf[n] << 8);
+        for (b = 0; b < 8; b++) {
+            if ((crc & 0x8000u) != 0) {
+                crc = (uint16_t)((uint16_t)(crc << 1) ^ 0x1021u);
+            } else {
+                crc = (uint16_t)(crc << 1);
+            }
+        }
+    }
+    return (crc);
+}
+
+/******************************************************************************
+* TEST CASES - CALCULATION
+******************************************************************************/
+
+void test_empty(void)
+{
+    uint16_t crc;
+
+    crc = COCrc16(CO_CRC16_INIT, TestBuf, 0);
+
+    TEST_CHECK(crc == CO_CRC16_INIT);
+}
+
+void test_check(void)
+{
+    const uint8_t data[] = { '1','2','3','4','5','6','7','8','9' };
+    uint16_t      crc;
+
+    crc = COCrc16(CO_CRC16_INIT, data, sizeof(data));
+
+    TEST_CHECK(crc == 0x31C3);
+}
+
+void test_reference(void)
+{
+    uint32_t size;
+    uint32_t ofs;
+    uint16_t crc;
+    uint16_t ref;
+
+    TestSetup();
+    for (ofs = 0; ofs < 4; ofs++) {
+        for (size = 0; size < 64; size++) {
+            crc = COCrc16(CO_CRC16_INIT, &TestBuf[ofs], size);
+            ref = TestCrcBitwise(CO_CRC16_INIT, &TestBuf[ofs], size);
+            TEST_CHECK(crc == ref);
+            TEST_MSG("offset %u, size %u: 0x%04x != 0x%04x", ofs, size, crc, ref);
+        }
+    }
+}
+
+void test_chunks(void)
+{
+    uint32_t split;
+    uint16_t crc;
+    uint16_t ref;
+
+    TestSetup();
+    ref = TestCrcBitwise(CO_CRC16_INIT, TestBuf, 100);
+    for (split = 0; split <= 100; split++) {
+        crc = COCrc16(CO_CRC16_INIT, TestBuf, split);
+        crc = COCrc16(crc, &TestBuf[split], 100 - split);
+        TEST_CHECK(crc == ref);
+        TEST_MSG("split %u: 0x%04x != 0x%04x", split, crc, ref);
+    }
+}
+
+/******************************************************************************
+* TEST CASES - BENCHMARK
+******************************************************************************/
+
+void test_bench(void)
+{
+    clock_t  start;
+    double   bitwise;
+    double   table;
+    uint32_t loop;
+    uint16_t crc;
+    uint16_t ref;
+
+    TestSetup();
+
+    ref   = CO_CRC16_INIT;
+    start = clock();
+    for (loop = 0; loop < BENCH_LOOPS; loop++) {
+        ref = TestCrcBitwise(ref, TestBuf, TEST_BUF_SIZE);
+    }
+    bitwise = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    crc   = CO_CRC16_INIT;
+    start = clock();
+    for (loop = 0; loop < BENCH_LOOPS; loop++) {
+        crc = COCrc16(crc, TestBuf, TEST_BUF_SIZE);
+    }
+    table = (double)(clock() - start) / CLOCKS_PER_SEC;
+    TEST_CHECK(crc == ref);
+
+    printf("\n  CO_CRC_SLICE=%d, %u blocks of %u bytes: bitwise %.2f ns/byte, table %.2f ns/byte\n",
+        CO_CRC_SLICE, BENCH_LOOPS, TEST_BUF_SIZE,
+        bitwise * 1.0e9 / ((double)BENCH_LOOPS * TEST_BUF_SIZE),
+        table * 1.0e9 / ((double)BENCH_LOOPS * TEST_BUF_SIZE));
+}
+
+TEST_LIST = {
+    { "empty",      test_empty      },
+    { "check",      test_check      },
+    { "reference",  test_reference  },
+    { "chunks",     test_chunks     },
+    { "bench",      test_bench      },
+    { NULL, NULL }
+};
@@ -0,0 +1,187 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TEST_LARGE_N    70000u
+#define BENCH_LOOKUPS   2000000u
+
+#if USE_DICT_INDEX
+#define TEST_LOOKUP     "index"
+#else
+#define TEST_LOOKUP     "search"
+#endif
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE   TestNode;
+static CO_OBJ   *TestObj;
+static uint32_t *TestIdx;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* object key of the n-th entry of a generated dictionary */
+static uint32_t TestKey(uint32_t n)
+{
+    return (CO_DEV(0x2000 + (n / 200), (n % 200) + 1));
+}
+
+static int32_t TestSetup(uint32_t num)
+{
+    uint32_t n;
+
+    memset(&TestNode, 0, sizeof(TestNode));
+    free(TestObj);
+    free(TestIdx);
+    TestObj = calloc(num + 1, sizeof(CO_OBJ));
+    TestIdx = calloc(num + 1, sizeof(uint32_t));
+    for (n = 0; n < num; n++) {
+        TestObj[n].Key  = CO_KEY(0x2000 + (n / 200), (n % 200) + 1, CO_OBJ_D___R_);
+        TestObj[n].Type = CO_TUNSIGNED32;
+        TestObj[n].Data = (CO_DATA)n;
+    }
+#if USE_DICT_INDEX
+    TestNode.Dict.Index = TestIdx;
+#endif
+    return (CODictInit(&TestNode.Dict, &TestNode, TestObj, num + 1));
+}
+
+/******************************************************************************
+* TEST CASES - VALIDATION
+******************************************************************************/
+
+void test_unsorted(void)
+{
+    CO_OBJ tmp;
+
+    TEST_CHECK(TestSetup(10) == 10);
+    tmp        = TestObj[4];
+    TestObj[4] = TestObj[5];
+    TestObj[5] = tmp;
+
+    TEST_CHECK(CODictInit(&TestNode.Dict, &TestNode, TestObj, 11) < 0);
+}
+
+void test_duplicate(void)
+{
+    TEST_CHECK(TestSetup(10) == 10);
+    TestObj[5].Key = TestObj[4].Key;
+
+    TEST_CHECK(CODictInit(&TestNode.Dict, &TestNode, TestObj, 11) < 0);
+}
+
+/******************************************************************************
+* TEST CASES - LOOKUP
+******************************************************************************/
+
+void test_large(void)
+{
+    uint32_t n;
+    uint32_t miss = 0;
+
+    TEST_CHECK(TestSetup(TEST_LARGE_N) == (int32_t)TEST_LARGE_N);
+    TEST_CHECK(TestNode.Dict.Num == TEST_LARGE_N);
+
+    for (n = 0; n < TEST_LARGE_N; n++) {
+        if (CODictFind(&TestNode.Dict, TestKey(n)) != &TestObj[n]) {
+            miss++;
+        }
+    }
+    TEST_CHECK(miss == 0);
+    TEST_MSG("%u keys not found", miss);
+
+    TEST_CHECK(CODictFind(&TestNode.Dict, CO_DEV(0x1000, 0)) == NULL);
+    TEST_CHECK(CODictFind(&TestNode.Dict, CO_DEV(0x2000, 0)) == NULL);
+    TEST_CHECK(CODictFind(&TestNode.Dict, CO_DEV(0xFFFF, 0xFF)) == NULL);
+}
+
+void test_update(void)
+{
+    TEST_CHECK(TestSetup(10) == 10);
+    TEST_CHECK(CODictFind(&TestNode.Dict, CO_DEV(0x2000, 0x0B)) == NULL);
+
+    /* append an entry to the dynamic dictionary */
+    TestSetup(11);
+    TestObj[10].Key = 0;
+    TEST_CHECK(CODictInit(&TestNode.Dict, &TestNode, TestObj, 12) == 10);
+    TestObj[10].Key = CO_KEY(0x2000, 0x0B, CO_OBJ_D___R_);
+    TestNode.Dict.Num++;
+    CODictUpdate(&TestNode.Dict);
+
+    TEST_CHECK(CODictFind(&TestNode.Dict, CO_DEV(0x2000, 0x0B)) == &TestObj[10]);
+}
+
+/******************************************************************************
+* TEST CASES - BENCHMARK
+******************************************************************************/
+
+void test_bench(void)
+{
+    const uint32_t size[] = { 64, 1024, 16384, TEST_LARGE_N };
+    clock_t  start;
+    double   time;
+    uint32_t s;
+    uint32_t n;
+    uint32_t pos = 0;
+    uint32_t miss = 0;
+
+    printf("\n");
+    for (s = 0; s < sizeof(size) / sizeof(size[0]); s++) {
+        TEST_CHECK(TestSetup(size[s]) == (int32_t)size[s]);
+
+        start = clock();
+        for (n = 0; n < BENCH_LOOKUPS; n++) {
+            /* pseudo random order of lookups */
+            pos = (pos + 7919u) % size[s];
+            if (CODictFind(&TestNode.Dict, TestKey(pos)) == NULL) {
+                miss++;
+            }
+        }
+        time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        printf("  %-6s %6u entries: %.1f ns/lookup\n",
+            TEST_LOOKUP, size[s], time * 1.0e9 / (double)BENCH_LOOKUPS);
+    }
+    TEST_CHECK(miss == 0);
+}
+
+TEST_LIST = {
+    { "unsorted",   test_unsorted  },
+    { "duplicate",  test_duplicate },
+    { "large",      test_large     },
+    { "update",     test_update    },
+    { "bench",      test_bench     },
+    { NULL, NULL }
+};
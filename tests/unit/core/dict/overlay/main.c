@@ -0,0 +1,190 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TEST_NODE_N     3u
+#define TEST_OVL_N      5u
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint32_t TestShared = 0x11223344;
+
+/* constant template of all nodes; placed in read-only memory */
+static const CO_OBJ TestTmpl[] = {
+    { CO_KEY(0x1000, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0x00000191) },
+    { CO_KEY(0x1017, 0, CO_OBJ_D___RW), CO_TUNSIGNED16, (CO_DATA)(100)        },
+    { CO_KEY(0x2000, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(2)          },
+    { CO_KEY(0x2000, 1, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(0x11)       },
+    { CO_KEY(0x2000, 2, CO_OBJ_D___RW), CO_TUNSIGNED32, (CO_DATA)(0x22)       },
+    { CO_KEY(0x2001, 0, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&TestShared)},
+    CO_OBJ_DICT_ENDMARK
+};
+
+static CO_NODE TestNode[TEST_NODE_N];
+static CO_OBJ  TestOvl[TEST_NODE_N][TEST_OVL_N];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static int32_t TestSetup(uint8_t n, uint32_t len)
+{
+    CO_DICT *cod = &TestNode[n].Dict;
+
+    memset(&TestNode[n], 0, sizeof(CO_NODE));
+    memset(&TestOvl[n], 0, sizeof(TestOvl[n]));
+    cod->Ovl    = &TestOvl[n][0];
+    cod->OvlMax = len;
+    return (CODictInit(cod, &TestNode[n], (CO_OBJ *)TestTmpl, 7));
+}
+
+/******************************************************************************
+* TEST CASES - INITIALIZATION
+******************************************************************************/
+
+void test_init(void)
+{
+    TEST_CHECK(TestSetup(0, TEST_OVL_N) == 6);
+    TEST_CHECK(TestNode[0].Dict.OvlNum == 5);
+    TEST_CHECK(TestOvl[0][0].Key == TestTmpl[0].Key);
+    TEST_CHECK(TestOvl[0][1].Key == TestTmpl[1].Key);
+    TEST_CHECK(TestOvl[0][2].Key == TestTmpl[2].Key);
+    TEST_CHECK(TestOvl[0][3].Key == TestTmpl[3].Key);
+    TEST_CHECK(TestOvl[0][4].Key == TestTmpl[4].Key);
+}
+
+void test_too_small(void)
+{
+    TEST_CHECK(TestSetup(0, TEST_OVL_N - 1) < 0);
+}
+
+void test_no_overlay(void)
+{
+    memset(&TestNode[0], 0, sizeof(CO_NODE));
+    TEST_CHECK(CODictInit(&TestNode[0].Dict, &TestNode[0], (CO_OBJ *)TestTmpl, 7) == 6);
+    TEST_CHECK(CODictFind(&TestNode[0].Dict, CO_DEV(0x1017, 0)) == &TestTmpl[1]);
+}
+
+/******************************************************************************
+* TEST CASES - ACCESS
+******************************************************************************/
+
+void test_find(void)
+{
+    CO_DICT *cod = &TestNode[0].Dict;
+
+    TestSetup(0, TEST_OVL_N);
+
+    /* direct entries are located in the overlay */
+    TEST_CHECK(CODictFind(cod, CO_DEV(0x1000, 0)) == &TestOvl[0][0]);
+    TEST_CHECK(CODictFind(cod, CO_DEV(0x1017, 0)) == &TestOvl[0][1]);
+    TEST_CHECK(CODictFind(cod, CO_DEV(0x2000, 0)) == &TestOvl[0][2]);
+    TEST_CHECK(CODictFind(cod, CO_DEV(0x2000, 1)) == &TestOvl[0][3]);
+    TEST_CHECK(CODictFind(cod, CO_DEV(0x2000, 2)) == &TestOvl[0][4]);
+
+    /* entries, which refer to data, are located in the template */
+    TEST_CHECK(CODictFind(cod, CO_DEV(0x2001, 0)) == &TestTmpl[5]);
+    TEST_CHECK(CODictFind(cod, CO_DEV(0x2002, 0)) == NULL);
+}
+
+void test_nodes(void)
+{
+    uint32_t val32;
+    uint16_t val16;
+    uint8_t  n;
+
+    for (n = 0; n < TEST_NODE_N; n++) {
+        TEST_CHECK(TestSetup(n, TEST_OVL_N) == 6);
+    }
+    for (n = 0; n < TEST_NODE_N; n++) {
+        TEST_CHECK(CODictWrWord(&TestNode[n].Dict, CO_DEV(0x1017, 0), 1000 + n) == CO_ERR_NONE);
+        TEST_CHECK(CODictWrLong(&TestNode[n].Dict, CO_DEV(0x2000, 2), 0xA0 + n) == CO_ERR_NONE);
+    }
+
+    /* each node holds own values, the template is unchanged */
+    for (n = 0; n < TEST_NODE_N; n++) {
+        TEST_CHECK(CODictRdWord(&TestNode[n].Dict, CO_DEV(0x1017, 0), &val16) == CO_ERR_NONE);
+        TEST_CHECK(val16 == 1000 + n);
+        TEST_CHECK(CODictRdLong(&TestNode[n].Dict, CO_DEV(0x2000, 2), &val32) == CO_ERR_NONE);
+        TEST_CHECK(val32 == 0xA0u + n);
+        TEST_CHECK(CODictRdLong(&TestNode[n].Dict, CO_DEV(0x1000, 0), &val32) == CO_ERR_NONE);
+        TEST_CHECK(val32 == 0x191);
+    }
+    TEST_CHECK(TestTmpl[1].Data == (CO_DATA)100);
+    TEST_CHECK(TestTmpl[4].Data == (CO_DATA)0x22);
+}
+
+void test_ref(void)
+{
+    CO_DICT_REF ref;
+    uint16_t    val = 0;
+
+    TestSetup(0, TEST_OVL_N);
+    TestSetup(1, TEST_OVL_N);
+
+    TEST_CHECK(CODictRef(&TestNode[1].Dict, CO_DEV(0x1017, 0), &ref) == &TestOvl[1][1]);
+    TEST_CHECK(CODictRefWrWord(&TestNode[1].Dict, &ref, 250) == CO_ERR_NONE);
+    TEST_CHECK(CODictRdWord(&TestNode[0].Dict, CO_DEV(0x1017, 0), &val) == CO_ERR_NONE);
+    TEST_CHECK(val == 100);
+    TEST_CHECK(CODictRdWord(&TestNode[1].Dict, CO_DEV(0x1017, 0), &val) == CO_ERR_NONE);
+    TEST_CHECK(val == 250);
+}
+
+void test_read_only(void)
+{
+    CO_OBJ *obj;
+    uint8_t val = 5;
+
+    TestSetup(0, TEST_OVL_N);
+    TestSetup(1, TEST_OVL_N);
+
+    /* the stack writes read-only entries with the type functions */
+    obj = CODictFind(&TestNode[1].Dict, CO_DEV(0x2000, 0));
+    TEST_CHECK(obj == &TestOvl[1][2]);
+    TEST_CHECK(COObjWrValue(obj, &TestNode[1], &val, 1) == CO_ERR_NONE);
+
+    TEST_CHECK(CODictRdByte(&TestNode[0].Dict, CO_DEV(0x2000, 0), &val) == CO_ERR_NONE);
+    TEST_CHECK(val == 2);
+    TEST_CHECK(CODictRdByte(&TestNode[1].Dict, CO_DEV(0x2000, 0), &val) == CO_ERR_NONE);
+    TEST_CHECK(val == 5);
+    TEST_CHECK(TestTmpl[2].Data == (CO_DATA)2);
+}
+
+TEST_LIST = {
+    { "init",        test_init       },
+    { "too_small",   test_too_small  },
+    { "no_overlay",  test_no_overlay },
+    { "find",        test_find       },
+    { "nodes",       test_nodes      },
+    { "ref",         test_ref        },
+    { "read_only",   test_read_only  },
+    { NULL, NULL }
+};
@@ -0,0 +1,240 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TEST_ELEM_N     254u
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+typedef struct TEST_ELEM_T {
+    uint16_t Value;
+    uint8_t  Flags;
+} TEST_ELEM;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE      TestNode;
+static TEST_ELEM    TestElem[TEST_ELEM_N];
+static uint32_t     TestInit;
+static uint8_t      TestNum = TEST_ELEM_N;
+static CO_OBJ_RANGE TestRange;
+static CO_OBJ       TestObj[5];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static CO_ERR TestElemInit(struct CO_OBJ_T *obj, struct CO_NODE_T *node)
+{
+    CO_UNUSED(node);
+
+    /* the element view holds the address of the element */
+    if (obj->Data == (CO_DATA)&TestElem[CO_GET_SUB(obj->Key) - 1].Value) {
+        TestInit++;
+    }
+    return (CO_ERR_NONE);
+}
+
+static const CO_OBJ_TYPE TestElemType = {
+    0, TestElemInit, 0, 0, 0, 0
+};
+
+static int32_t TestSetup(const CO_OBJ_TYPE *type)
+{
+    uint32_t n;
+
+    memset(&TestNode, 0, sizeof(TestNode));
+    memset(&TestObj, 0, sizeof(TestObj));
+    for (n = 0; n < TEST_ELEM_N; n++) {
+        TestElem[n].Value = (uint16_t)(n + 1);
+    }
+    TestInit         = 0;
+    TestRange.Type   = type;
+    TestRange.Base   = (uint8_t *)&TestElem[0].Value;
+    TestRange.Stride = sizeof(TEST_ELEM);
+    TestRange.Num    = TEST_ELEM_N;
+
+    TestObj[0].Key  = CO_KEY(0x1000, 0, CO_OBJ_D___R_);
+    TestObj[0].Type = CO_TUNSIGNED32;
+    TestObj[1].Key  = CO_KEY(0x2100, 0, CO_OBJ_____R_);
+    TestObj[1].Type = CO_TUNSIGNED8;
+    TestObj[1].Data = (CO_DATA)&TestNum;
+    TestObj[2].Key  = CO_KEY(0x2100, 1, CO_OBJ____PRW);
+    TestObj[2].Type = CO_TRANGE;
+    TestObj[2].Data = (CO_DATA)&TestRange;
+    TestObj[3].Key  = CO_KEY(0x2101, 0, CO_OBJ_D___R_);
+    TestObj[3].Type = CO_TUNSIGNED8;
+    return (CODictInit(&TestNode.Dict, &TestNode, TestObj, 5));
+}
+
+/******************************************************************************
+* TEST CASES - VALIDATION
+******************************************************************************/
+
+void test_init(void)
+{
+    TEST_CHECK(TestSetup(CO_TUNSIGNED16) == 4);
+}
+
+void test_overlap(void)
+{
+    /* next entry within the range subindices */
+    TestSetup(CO_TUNSIGNED16);
+    TestRange.Num = 2;
+    TestObj[3].Key = CO_KEY(0x2100, 3, CO_OBJ_D___R_);
+    TEST_CHECK(CODictInit(&TestNode.Dict, &TestNode, TestObj, 5) == 4);
+    TestObj[3].Key = CO_KEY(0x2100, 2, CO_OBJ_D___R_);
+    TEST_CHECK(CODictInit(&TestNode.Dict, &TestNode, TestObj, 5) < 0);
+}
+
+void test_bad_range(void)
+{
+    TestSetup(CO_TUNSIGNED16);
+    TestRange.Num = 0;
+    TEST_CHECK(CODictInit(&TestNode.Dict, &TestNode, TestObj, 5) < 0);
+
+    /* subindex 1..255 fits, 1..256 does not */
+    TestRange.Num = 255;
+    TEST_CHECK(CODictInit(&TestNode.Dict, &TestNode, TestObj, 5) == 4);
+    TestObj[2].Key = CO_KEY(0x2100, 2, CO_OBJ____PRW);
+    TEST_CHECK(CODictInit(&TestNode.Dict, &TestNode, TestObj, 5) < 0);
+}
+
+/******************************************************************************
+* TEST CASES - ELEMENT VIEWS
+******************************************************************************/
+
+void test_find(void)
+{
+    CO_OBJ  *obj;
+    uint32_t n;
+    uint32_t miss = 0;
+
+    TestSetup(CO_TUNSIGNED16);
+
+    for (n = 1; n <= TEST_ELEM_N; n++) {
+        obj = CODictFind(&TestNode.Dict, CO_DEV(0x2100, n));
+        if ((obj == NULL) ||
+            (obj->Key  != CO_KEY(0x2100, n, CO_OBJ____PRW)) ||
+            (obj->Type != CO_TUNSIGNED16) ||
+            (obj->Data != (CO_DATA)&TestElem[n - 1].Value)) {
+            miss++;
+        }
+    }
+    TEST_CHECK(miss == 0);
+    TEST_MSG("%u elements not found", miss);
+
+    /* entries around the range are not affected */
+    TEST_CHECK(CODictFind(&TestNode.Dict, CO_DEV(0x2100, 0)) == &TestObj[1]);
+    TEST_CHECK(CODictFind(&TestNode.Dict, CO_DEV(0x2101, 0)) == &TestObj[3]);
+    TEST_CHECK(CODictFind(&TestNode.Dict, CO_DEV(0x2100, 255)) == NULL);
+    TEST_CHECK(CODictFind(&TestNode.Dict, CO_DEV(0x2101, 1)) == NULL);
+    TEST_CHECK(CODictFind(&TestNode.Dict, CO_DEV(0x20FF, 1)) == NULL);
+}
+
+void test_access(void)
+{
+    uint16_t val = 0;
+
+    TestSetup(CO_TUNSIGNED16);
+
+    TEST_CHECK(CODictRdWord(&TestNode.Dict, CO_DEV(0x2100, 10), &val) == CO_ERR_NONE);
+    TEST_CHECK(val == 10);
+    TEST_CHECK(CODictWrWord(&TestNode.Dict, CO_DEV(0x2100, 200), 0x1234) == CO_ERR_NONE);
+    TEST_CHECK(TestElem[199].Value == 0x1234);
+    TEST_CHECK(TestElem[199].Flags == 0);
+    TEST_CHECK(TestElem[200].Value == 201);
+}
+
+void test_keep(void)
+{
+    CO_OBJ  keep;
+    CO_OBJ *obj;
+    CO_OBJ *held;
+    uint8_t n;
+
+    TestSetup(CO_TUNSIGNED16);
+
+    obj  = CODictFind(&TestNode.Dict, CO_DEV(0x2100, 7));
+    held = CODictKeep(&TestNode.Dict, obj, &keep);
+    TEST_CHECK(held == &keep);
+
+    /* further searches reuse the element views */
+    for (n = 1; n <= CO_DICT_VIEW_N; n++) {
+        (void)CODictFind(&TestNode.Dict, CO_DEV(0x2100, n));
+    }
+    TEST_CHECK(obj->Data != (CO_DATA)&TestElem[6].Value);
+    TEST_CHECK(held->Data == (CO_DATA)&TestElem[6].Value);
+    TEST_CHECK(held->Key == CO_KEY(0x2100, 7, CO_OBJ____PRW));
+
+    /* object entries are held without copy */
+    obj = CODictFind(&TestNode.Dict, CO_DEV(0x2100, 0));
+    TEST_CHECK(CODictKeep(&TestNode.Dict, obj, &keep) == &TestObj[1]);
+    TEST_CHECK(CODictKeep(&TestNode.Dict, NULL, &keep) == NULL);
+}
+
+void test_ref(void)
+{
+    CO_DICT_REF ref;
+    uint16_t    val = 0;
+    uint8_t     n;
+
+    TestSetup(CO_TUNSIGNED16);
+
+    TEST_CHECK(CODictRef(&TestNode.Dict, CO_DEV(0x2100, 3), &ref) != NULL);
+    for (n = 1; n <= CO_DICT_VIEW_N; n++) {
+        (void)CODictFind(&TestNode.Dict, CO_DEV(0x2100, 100 + n));
+    }
+    TEST_CHECK(CODictRefRdWord(&TestNode.Dict, &ref, &val) == CO_ERR_NONE);
+    TEST_CHECK(val == 3);
+}
+
+void test_elem_init(void)
+{
+    TestSetup(&TestElemType);
+
+    TEST_CHECK(CODictObjInit(&TestNode.Dict, &TestNode) == CO_ERR_NONE);
+    TEST_CHECK(TestInit == TEST_ELEM_N);
+}
+
+TEST_LIST = {
+    { "init",       test_init      },
+    { "overlap",    test_overlap   },
+    { "bad_range",  test_bad_range },
+    { "find",       test_find      },
+    { "access",     test_access    },
+    { "keep",       test_keep      },
+    { "ref",        test_ref       },
+    { "elem_init",  test_elem_init },
+    { NULL, NULL }
+};
@@ -0,0 +1,209 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASES - RESOLVE
+******************************************************************************/
+
+void test_resolve(void)
+{
+    CO_NODE      node = { 0 };
+    CO_DICT_REF  ref;
+    CO_OBJ      *result;
+    uint32_t     val = 0;
+    CO_OBJ       obj[3] = {
+        { CO_KEY(0x1001, 0x00, CO_OBJ_____RW), CO_TUNSIGNED8,  (CO_DATA)(0)    },
+        { CO_KEY(0x1014, 0x00, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&val) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 3);
+
+    result = CODictRef(&node.Dict, CO_DEV(0x1014, 0x00), &ref);
+
+    TEST_CHECK(result == &obj[1]);
+    TEST_CHECK(ref.Obj == &obj[1]);
+    TEST_CHECK(ref.Type == CO_TUNSIGNED32);
+    TEST_CHECK(ref.Size == 4);
+    TEST_CHECK(CODictRefObj(&node.Dict, &ref) == &obj[1]);
+}
+
+void test_not_found(void)
+{
+    CO_NODE      node = { 0 };
+    CO_DICT_REF  ref;
+    CO_OBJ      *result;
+    uint8_t      val = 0x12;
+    CO_ERR       err;
+    CO_OBJ       obj[2] = {
+        { CO_KEY(0x1001, 0x00, CO_OBJ_____RW), CO_TUNSIGNED8,  (CO_DATA)(0)    },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 2);
+
+    result = CODictRef(&node.Dict, CO_DEV(0x1014, 0x00), &ref);
+    err    = CODictRefRdByte(&node.Dict, &ref, &val);
+
+    TEST_CHECK(result == NULL);
+    TEST_CHECK(err == CO_ERR_OBJ_NOT_FOUND);
+    TEST_CHECK(val == 0x12);
+}
+
+/******************************************************************************
+* TEST CASES - ACCESS
+******************************************************************************/
+
+void test_read(void)
+{
+    CO_NODE      node = { 0 };
+    CO_DICT_REF  ref[3];
+    uint8_t      val08 = 0;
+    uint16_t     val16 = 0;
+    uint32_t     val32 = 0;
+    CO_OBJ       obj[4] = {
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(0x12)       },
+        { CO_KEY(0x2000, 0x02, CO_OBJ_D___R_), CO_TUNSIGNED16, (CO_DATA)(0x1234)     },
+        { CO_KEY(0x2000, 0x03, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0x12345678) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 4);
+    (void)CODictRef(&node.Dict, CO_DEV(0x2000, 0x01), &ref[0]);
+    (void)CODictRef(&node.Dict, CO_DEV(0x2000, 0x02), &ref[1]);
+    (void)CODictRef(&node.Dict, CO_DEV(0x2000, 0x03), &ref[2]);
+
+    TEST_CHECK(CODictRefRdByte(&node.Dict, &ref[0], &val08) == CO_ERR_NONE);
+    TEST_CHECK(CODictRefRdWord(&node.Dict, &ref[1], &val16) == CO_ERR_NONE);
+    TEST_CHECK(CODictRefRdLong(&node.Dict, &ref[2], &val32) == CO_ERR_NONE);
+
+    TEST_CHECK(val08 == 0x12);
+    TEST_CHECK(val16 == 0x1234);
+    TEST_CHECK(val32 == 0x12345678);
+}
+
+void test_write(void)
+{
+    CO_NODE      node = { 0 };
+    CO_DICT_REF  ref[3];
+    uint8_t      val08 = 0;
+    uint16_t     val16 = 0;
+    uint32_t     val32 = 0;
+    CO_OBJ       obj[4] = {
+        { CO_KEY(0x2000, 0x01, CO_OBJ_____RW), CO_TUNSIGNED8,  (CO_DATA)(&val08) },
+        { CO_KEY(0x2000, 0x02, CO_OBJ_____RW), CO_TUNSIGNED16, (CO_DATA)(&val16) },
+        { CO_KEY(0x2000, 0x03, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&val32) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 4);
+    (void)CODictRef(&node.Dict, CO_DEV(0x2000, 0x01), &ref[0]);
+    (void)CODictRef(&node.Dict, CO_DEV(0x2000, 0x02), &ref[1]);
+    (void)CODictRef(&node.Dict, CO_DEV(0x2000, 0x03), &ref[2]);
+
+    TEST_CHECK(CODictRefWrByte(&node.Dict, &ref[0], 0x21) == CO_ERR_NONE);
+    TEST_CHECK(CODictRefWrWord(&node.Dict, &ref[1], 0x4321) == CO_ERR_NONE);
+    TEST_CHECK(CODictRefWrLong(&node.Dict, &ref[2], 0x87654321) == CO_ERR_NONE);
+
+    TEST_CHECK(val08 == 0x21);
+    TEST_CHECK(val16 == 0x4321);
+    TEST_CHECK(val32 == 0x87654321);
+}
+
+void test_bad_size(void)
+{
+    CO_NODE      node = { 0 };
+    CO_DICT_REF  ref;
+    uint32_t     val32 = 0;
+    uint8_t      val08 = 0;
+    CO_OBJ       obj[2] = {
+        { CO_KEY(0x2000, 0x01, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&val32) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 2);
+    (void)CODictRef(&node.Dict, CO_DEV(0x2000, 0x01), &ref);
+
+    TEST_CHECK(CODictRefRdByte(&node.Dict, &ref, &val08) == CO_ERR_OBJ_SIZE);
+    TEST_CHECK(CODictRefWrByte(&node.Dict, &ref, 0x12) == CO_ERR_OBJ_SIZE);
+    TEST_CHECK(val32 == 0);
+}
+
+/******************************************************************************
+* TEST CASES - INVALIDATION
+******************************************************************************/
+
+void test_reinit(void)
+{
+    CO_NODE      node = { 0 };
+    CO_DICT_REF  ref;
+    uint8_t      val = 0;
+    CO_OBJ       obj_a[2] = {
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___R_), CO_TUNSIGNED8, (CO_DATA)(0x11) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CO_OBJ       obj_b[3] = {
+        { CO_KEY(0x1000, 0x00, CO_OBJ_D___R_), CO_TUNSIGNED8, (CO_DATA)(0x00) },
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___R_), CO_TUNSIGNED8, (CO_DATA)(0x22) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj_a[0], 2);
+    (void)CODictRef(&node.Dict, CO_DEV(0x2000, 0x01), &ref);
+
+    CODictInit(&node.Dict, &node, &obj_b[0], 3);
+
+    TEST_CHECK(CODictRefRdByte(&node.Dict, &ref, &val) == CO_ERR_NONE);
+    TEST_CHECK(val == 0x22);
+    TEST_CHECK(ref.Obj == &obj_b[1]);
+}
+
+void test_update(void)
+{
+    CO_NODE      node = { 0 };
+    CO_DICT_REF  ref;
+    uint8_t      val = 0;
+    CO_OBJ       obj[3] = {
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___R_), CO_TUNSIGNED8, (CO_DATA)(0x11) },
+        CO_OBJ_DICT_ENDMARK,
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 3);
+    (void)CODictRef(&node.Dict, CO_DEV(0x2000, 0x01), &ref);
+
+    /* insert an entry in front of the referenced entry */
+    obj[1]      = obj[0];
+    obj[1].Data = (CO_DATA)(0x22);
+    obj[0].Key  = CO_KEY(0x1000, 0x00, CO_OBJ_D___R_);
+    node.Dict.Num++;
+    CODictUpdate(&node.Dict);
+
+    TEST_CHECK(CODictRefRdByte(&node.Dict, &ref, &val) == CO_ERR_NONE);
+    TEST_CHECK(val == 0x22);
+    TEST_CHECK(ref.Obj == &obj[1]);
+}
+
+TEST_LIST = {
+    { "resolve",   test_resolve   },
+    { "not_found", test_not_found },
+    { "read",      test_read      },
+    { "write",     test_write     },
+    { "bad_size",  test_bad_size  },
+    { "reinit",    test_reinit    },
+    { "update",    test_update    },
+    { NULL, NULL }
+};
@@ -0,0 +1,292 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BENCH_LOOPS  1000000u
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE TestNode;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TestSetup(void)
+{
+    uint16_t n;
+
+    memset(&TestNode, 0, sizeof(TestNode));
+    TestNode.Nmt.Node = &TestNode;
+    TestNode.Sync.CobId = 0x80;
+    for (n = 0; n < CO_SSDO_N; n++) {
+        TestNode.Sdo[n].Node = &TestNode;
+        TestNode.Sdo[n].RxId = CO_SDO_ID_OFF;
+        TestNode.Sdo[n].TxId = CO_SDO_ID_OFF;
+    }
+    for (n = 0; n < CO_CSDO_N; n++) {
+        TestNode.CSdo[n].Node = &TestNode;
+        TestNode.CSdo[n].RxId = CO_SDO_ID_OFF;
+        TestNode.CSdo[n].TxId = CO_SDO_ID_OFF;
+    }
+    for (n = 0; n < CO_RPDO_N; n++) {
+        TestNode.RPdo[n].Node = &TestNode;
+    }
+    CODispInit(&TestNode.Disp, &TestNode);
+}
+
+static uint16_t TestEntry(uint8_t kind, uint16_t num)
+{
+    return (uint16_t)(((uint16_t)kind << 12) | num);
+}
+
+/******************************************************************************
+* TEST CASES - LOOKUP
+******************************************************************************/
+
+void test_none(void)
+{
+    uint16_t result;
+    TestSetup();
+
+    result = CODispFind(&TestNode.Disp, 0x123);
+
+    TEST_CHECK(result == TestEntry(CO_DISP_NONE, 0));
+}
+
+void test_nmt(void)
+{
+    uint16_t result;
+    TestSetup();
+
+    result = CODispFind(&TestNode.Disp, 0x000);
+
+    TEST_CHECK(result == TestEntry(CO_DISP_NMT, 0));
+}
+
+void test_ssdo(void)
+{
+    uint16_t result;
+    TestSetup();
+    TestNode.Sdo[0].RxId = 0x601;
+
+    result = CODispFind(&TestNode.Disp, 0x601);
+
+    TEST_CHECK(result == TestEntry(CO_DISP_SSDO, 0));
+}
+
+void test_csdo(void)
+{
+    uint16_t result;
+    TestSetup();
+    TestNode.CSdo[0].RxId = 0x585;
+
+    result = CODispFind(&TestNode.Disp, 0x585);
+
+    TEST_CHECK(result == TestEntry(CO_DISP_CSDO, 0));
+}
+
+void test_hbc(void)
+{
+    CO_HBCONS hbc = { 0 };
+    uint16_t  result;
+    TestSetup();
+    hbc.NodeId = 5;
+    TestNode.Nmt.HbCons = &hbc;
+
+    result = CODispFind(&TestNode.Disp, 0x705);
+
+    TEST_CHECK(result == TestEntry(CO_DISP_HBC, 5));
+}
+
+void test_rpdo(void)
+{
+    uint16_t result;
+    TestSetup();
+    TestNode.RPdo[CO_RPDO_N - 1].Identifier = 0x203;
+    TestNode.RPdo[CO_RPDO_N - 1].Flag       = CO_RPDO_FLG__E;
+
+    result = CODispFind(&TestNode.Disp, 0x203);
+
+    TEST_CHECK(result == TestEntry(CO_DISP_RPDO, CO_RPDO_N - 1));
+}
+
+void test_rpdo_off(void)
+{
+    uint16_t result;
+    TestSetup();
+    TestNode.RPdo[0].Identifier = 0x203;
+    TestNode.RPdo[0].Flag       = 0;
+
+    result = CODispFind(&TestNode.Disp, 0x203);
+
+    TEST_CHECK(result == TestEntry(CO_DISP_NONE, 0));
+}
+
+void test_sync(void)
+{
+    uint16_t result;
+    TestSetup();
+    TestNode.Sync.CobId = CO_SYNC_COBID_ON | 0x81;
+
+    result = CODispFind(&TestNode.Disp, 0x81);
+
+    TEST_CHECK(result == TestEntry(CO_DISP_SYNC, 0));
+}
+
+void test_shared(void)
+{
+    uint16_t result;
+    TestSetup();
+    TestNode.RPdo[0].Identifier = 0x80;
+    TestNode.RPdo[0].Flag       = CO_RPDO_FLG__E;
+
+    result = CODispFind(&TestNode.Disp, 0x80);
+
+    TEST_CHECK(CO_DISP_KIND(result) == CO_DISP_MULTI);
+}
+
+void test_extended(void)
+{
+    uint16_t result;
+    TestSetup();
+
+    result = CODispFind(&TestNode.Disp, 0x12345678);
+
+    TEST_CHECK(CO_DISP_KIND(result) == CO_DISP_MULTI);
+}
+
+void test_invalidate(void)
+{
+    uint16_t result;
+    TestSetup();
+    TestNode.RPdo[0].Identifier = 0x201;
+    TestNode.RPdo[0].Flag       = CO_RPDO_FLG__E;
+    (void)CODispFind(&TestNode.Disp, 0x201);
+
+    TestNode.RPdo[0].Identifier = 0x202;
+    CODispInvalidate(&TestNode);
+
+    result = CODispFind(&TestNode.Disp, 0x201);
+    TEST_CHECK(result == TestEntry(CO_DISP_NONE, 0));
+    result = CODispFind(&TestNode.Disp, 0x202);
+    TEST_CHECK(result == TestEntry(CO_DISP_RPDO, 0));
+}
+
+/******************************************************************************
+* TEST CASES - BENCHMARK
+******************************************************************************/
+
+/*
+* Compares the frame lookup for the last configured RPDO: the service chain
+* of CONodeProcess() without table versus a single table lookup.
+*/
+void test_bench(void)
+{
+    CO_IF_FRM  frm = { 0 };
+    CO_RPDO   *rpdo;
+    clock_t    start;
+    double     chain;
+    double     table;
+    uint32_t   loop;
+    uint32_t   hits;
+    uint16_t   n;
+
+    TestSetup();
+    TestNode.Sdo[0].RxId = 0x601;
+    TestNode.Sdo[0].TxId = 0x581;
+    for (n = 0; n < CO_RPDO_N; n++) {
+        TestNode.RPdo[n].Identifier = 0x200 + n;
+        TestNode.RPdo[n].Flag       = CO_RPDO_FLG__E;
+    }
+    frm.Identifier = 0x200 + (CO_RPDO_N - 1);
+
+    hits  = 0;
+    start = clock();
+    for (loop = 0; loop < BENCH_LOOPS; loop++) {
+        if (COSdoCheck(TestNode.Sdo, &frm) != NULL) {
+            continue;
+        }
+        if (COCSdoCheck(TestNode.CSdo, &frm) != NULL) {
+            continue;
+        }
+        if (CONmtCheck(&TestNode.Nmt, &frm) >= 0) {
+            continue;
+        }
+        if (CONmtHbConsCheck(&TestNode.Nmt, &frm) >= 0) {
+            continue;
+        }
+        rpdo = CORPdoCheck(TestNode.RPdo, &frm);
+        if (rpdo != NULL) {
+            hits++;
+            continue;
+        }
+        (void)COSyncUpdate(&TestNode.Sync, &frm);
+    }
+    chain = (double)(clock() - start) / CLOCKS_PER_SEC;
+    TEST_CHECK(hits == BENCH_LOOPS);
+
+    hits  = 0;
+    start = clock();
+    for (loop = 0; loop < BENCH_LOOPS; loop++) {
+        n = CODispFind(&TestNode.Disp, frm.Identifier);
+        if (CO_DISP_KIND(n) == CO_DISP_RPDO) {
+            rpdo = CORPdoMatch(&TestNode.RPdo[CO_DISP_NUM(n)], &frm);
+            if (rpdo != NULL) {
+                hits++;
+            }
+        }
+    }
+    table = (double)(clock() - start) / CLOCKS_PER_SEC;
+    TEST_CHECK(hits == BENCH_LOOPS);
+
+    printf("\n  CO_RPDO_N=%d, %u frames: chain %.1f ns/frame, table %.1f ns/frame\n",
+        CO_RPDO_N, BENCH_LOOPS,
+        chain * 1.0e9 / BENCH_LOOPS,
+        table * 1.0e9 / BENCH_LOOPS);
+}
+
+TEST_LIST = {
+    { "none",       test_none       },
+    { "nmt",        test_nmt        },
+    { "ssdo",       test_ssdo       },
+    { "csdo",       test_csdo       },
+    { "hbc",        test_hbc        },
+    { "rpdo",       test_rpdo       },
+    { "rpdo_off",   test_rpdo_off   },
+    { "sync",       test_sync       },
+    { "shared",     test_shared     },
+    { "extended",   test_extended   },
+    { "invalidate", test_invalidate },
+    { "bench",      test_bench      },
+    { NULL, NULL }
+};
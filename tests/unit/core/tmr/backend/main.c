@@ -0,0 +1,289 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TEST_TMR_N      1024
+#define TEST_LOG_N      16
+
+#if USE_TMR_WHEEL
+#define TEST_BACKEND    "wheel"
+#else
+#define TEST_BACKEND    "list"
+#endif
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint32_t   TestCounter;
+static uint32_t   TestTicks;
+static uint32_t   TestLog[TEST_LOG_N];
+static uint32_t   TestLogNum;
+static uint32_t   TestSeed;
+static CO_TMR_MEM TestMem[TEST_TMR_N];
+static CO_NODE    TestNode;
+
+/******************************************************************************
+* TEST TIMER DRIVER
+******************************************************************************/
+
+static void     TestTmrInit   (uint32_t freq) { (void)freq; TestCounter = 0; }
+static void     TestTmrStart  (void)          { }
+static uint32_t TestTmrDelay  (void)          { return (TestCounter); }
+static void     TestTmrReload (uint32_t val)  { TestCounter = val; }
+static void     TestTmrStop   (void)          { TestCounter = 0; }
+
+static uint8_t TestTmrUpdate(void)
+{
+    uint8_t result = 0;
+
+    if (TestCounter > 0) {
+        TestCounter--;
+        if (TestCounter == 0) {
+            result = 1;
+        }
+    }
+    return (result);
+}
+
+static const CO_IF_TIMER_DRV TestTmrDriver = {
+    TestTmrInit,
+    TestTmrReload,
+    TestTmrDelay,
+    TestTmrStop,
+    TestTmrStart,
+    TestTmrUpdate
+};
+
+static CO_IF_DRV TestDriver = { NULL, &TestTmrDriver, NULL };
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TestSetup(uint16_t num)
+{
+    memset(&TestNode, 0, sizeof(TestNode));
+    TestNode.If.Drv = &TestDriver;
+    TestTmrInit(1000);
+    COTmrInit(&TestNode.Tmr, &TestNode, TestMem, num, 1000);
+    TestTicks  = 0;
+    TestLogNum = 0;
+    TestSeed   = 12345;
+}
+
+static void TestRun(uint32_t ticks)
+{
+    while (ticks > 0) {
+        TestTicks++;
+        if (COTmrService(&TestNode.Tmr) > 0) {
+            COTmrProcess(&TestNode.Tmr);
+        }
+        ticks--;
+    }
+}
+
+static uint32_t TestRandom(uint32_t max)
+{
+    TestSeed = TestSeed * 1103515245u + 12345u;
+    return (((TestSeed >> 8) % max) + 1);
+}
+
+static void TestLogAction(void *arg)
+{
+    uint32_t tag = (uint32_t)(uintptr_t)arg;
+
+    if (TestLogNum < TEST_LOG_N) {
+        TestLog[TestLogNum] = (tag << 16) | TestTicks;
+        TestLogNum++;
+    }
+}
+
+static void TestCountAction(void *arg)
+{
+    uint32_t *cnt = (uint32_t *)arg;
+    (*cnt)++;
+}
+
+/******************************************************************************
+* TEST CASES - FUNCTION
+******************************************************************************/
+
+void test_order(void)
+{
+    TestSetup(8);
+
+    TEST_CHECK(COTmrCreate(&TestNode.Tmr, 30, 0, TestLogAction, (void *)1) >= 0);
+    TEST_CHECK(COTmrCreate(&TestNode.Tmr, 10, 0, TestLogAction, (void *)2) >= 0);
+    TEST_CHECK(COTmrCreate(&TestNode.Tmr, 20, 0, TestLogAction, (void *)3) >= 0);
+    TEST_CHECK(COTmrCreate(&TestNode.Tmr, 10, 0, TestLogAction, (void *)4) >= 0);
+    TestRun(40);
+
+    TEST_CHECK(TestLogNum == 4);
+    TEST_CHECK(TestLog[0] == ((2u << 16) | 10u));
+    TEST_CHECK(TestLog[1] == ((4u << 16) | 10u));
+    TEST_CHECK(TestLog[2] == ((3u << 16) | 20u));
+    TEST_CHECK(TestLog[3] == ((1u << 16) | 30u));
+}
+
+void test_delete(void)
+{
+    int16_t id;
+
+    TestSetup(8);
+
+    id = COTmrCreate(&TestNode.Tmr, 10, 0, TestLogAction, (void *)1);
+    TEST_CHECK(COTmrCreate(&TestNode.Tmr, 20, 0, TestLogAction, (void *)2) >= 0);
+    TestRun(5);
+    TEST_CHECK(COTmrDelete(&TestNode.Tmr, id) == 0);
+    TEST_CHECK(COTmrDelete(&TestNode.Tmr, id) < 0);
+    TestRun(20);
+
+    TEST_CHECK(TestLogNum == 1);
+    TEST_CHECK(TestLog[0] == ((2u << 16) | 20u));
+}
+
+void test_cycle(void)
+{
+    int16_t id;
+
+    TestSetup(8);
+
+    id = COTmrCreate(&TestNode.Tmr, 3, 5, TestLogAction, (void *)1);
+    TestRun(13);
+    TEST_CHECK(COTmrDelete(&TestNode.Tmr, id) == 0);
+    TestRun(20);
+
+    TEST_CHECK(TestLogNum == 3);
+    TEST_CHECK(TestLog[0] == ((1u << 16) |  3u));
+    TEST_CHECK(TestLog[1] == ((1u << 16) |  8u));
+    TEST_CHECK(TestLog[2] == ((1u << 16) | 13u));
+}
+
+void test_long(void)
+{
+    TestSetup(8);
+
+    TEST_CHECK(COTmrCreate(&TestNode.Tmr, 1000, 0, TestLogAction, (void *)1) >= 0);
+    TestRun(500);
+    TEST_CHECK(COTmrCreate(&TestNode.Tmr,    3, 0, TestLogAction, (void *)2) >= 0);
+    TestRun(600);
+
+    TEST_CHECK(TestLogNum == 2);
+    TEST_CHECK(TestLog[0] == ((2u << 16) |  503u));
+    TEST_CHECK(TestLog[1] == ((1u << 16) | 1000u));
+}
+
+void test_pool(void)
+{
+    uint32_t cnt = 0;
+    uint16_t n;
+
+    TestSetup(4);
+
+    for (n = 0; n < 4; n++) {
+        TEST_CHECK(COTmrCreate(&TestNode.Tmr, 1 + n, 0, TestCountAction, &cnt) >= 0);
+    }
+    TEST_CHECK(COTmrCreate(&TestNode.Tmr, 1, 0, TestCountAction, &cnt) < 0);
+    TEST_CHECK(TestNode.Error == CO_ERR_TMR_NO_ACT);
+    TestRun(4);
+    TEST_CHECK(cnt == 4);
+    TEST_CHECK(COTmrCreate(&TestNode.Tmr, 1, 0, TestCountAction, &cnt) >= 0);
+}
+
+/******************************************************************************
+* TEST CASES - BENCHMARK
+******************************************************************************/
+
+/*
+* Measures create, delete and expire of a growing number of timers with
+* random delays. Build with and without USE_TMR_WHEEL to compare the
+* timer management backends.
+*/
+void test_bench(void)
+{
+    static int16_t id[TEST_TMR_N];
+    uint32_t       cnt;
+    uint32_t       num;
+    uint32_t       n;
+    uint32_t       k;
+    int16_t        tmp;
+    clock_t        start;
+    double         tc;
+    double         td;
+    double         te;
+
+    for (num = 16; num <= TEST_TMR_N; num *= 4) {
+        TestSetup((uint16_t)num);
+
+        start = clock();
+        for (n = 0; n < num; n++) {
+            id[n] = COTmrCreate(&TestNode.Tmr, TestRandom(10000), 0, TestCountAction, &cnt);
+        }
+        tc = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        /* delete in random order */
+        for (n = num - 1; n > 0; n--) {
+            k      = TestRandom(n + 1) - 1;
+            tmp    = id[n];
+            id[n]  = id[k];
+            id[k]  = tmp;
+        }
+        start = clock();
+        for (n = 0; n < num; n++) {
+            TEST_CHECK(COTmrDelete(&TestNode.Tmr, id[n]) == 0);
+        }
+        td = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        cnt = 0;
+        for (n = 0; n < num; n++) {
+            (void)COTmrCreate(&TestNode.Tmr, TestRandom(10000), 0, TestCountAction, &cnt);
+        }
+        start = clock();
+        TestRun(10000);
+        te = (double)(clock() - start) / CLOCKS_PER_SEC;
+        TEST_CHECK(cnt == num);
+
+        printf("\n  %s: %4u timers: create %7.1f ns, delete %7.1f ns, expire %7.1f ns",
+            TEST_BACKEND, (unsigned)num,
+            tc * 1.0e9 / num, td * 1.0e9 / num, te * 1.0e9 / num);
+    }
+    printf("\n");
+}
+
+TEST_LIST = {
+    { "order",  test_order  },
+    { "delete", test_delete },
+    { "cycle",  test_cycle  },
+    { "long",   test_long   },
+    { "pool",   test_pool   },
+    { "bench",  test_bench  },
+    { NULL, NULL }
+};
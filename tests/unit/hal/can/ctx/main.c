@@ -0,0 +1,293 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+typedef struct TEST_CAN_T {           /* instance data of a CAN controller    */
+    CO_IF_FRM  Rx;                    /* next received frame                  */
+    CO_IF_FRM  Tx;                    /* last transmitted frame               */
+    uint16_t   Done;                  /* pending transmit confirmations       */
+} TEST_CAN;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE    TestNode[2];
+static TEST_CAN   TestCan[2];
+static CO_NODE   *TestCbNode;
+static CO_IF_FRM  TestCbFrm;
+static uint16_t   TestCbGlobal;
+
+/******************************************************************************
+* TEST CAN DRIVER WITH CONTEXT
+******************************************************************************/
+
+static void    TestCanInit  (void *ctx)                   { (void)ctx; }
+static void    TestCanEnable(void *ctx, uint32_t baudrate) { (void)ctx; (void)baudrate; }
+static void    TestCanReset (void *ctx)                   { (void)ctx; }
+static void    TestCanClose (void *ctx)                   { (void)ctx; }
+
+static int16_t TestCanRead(void *ctx, CO_IF_FRM *frm)
+{
+    TEST_CAN *can = (TEST_CAN *)ctx;
+
+    *frm = can->Rx;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t TestCanSend(void *ctx, CO_IF_FRM *frm)
+{
+    TEST_CAN *can = (TEST_CAN *)ctx;
+
+    can->Tx = *frm;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t TestCanTxDone(void *ctx, CO_IF_FRM *frm)
+{
+    TEST_CAN *can = (TEST_CAN *)ctx;
+
+    if (can->Done == 0) {
+        return (0);
+    }
+    can->Done--;
+    *frm = can->Tx;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static const CO_IF_CAN_CTX_DRV TestCanDriver = {
+    TestCanInit,
+    TestCanEnable,
+    TestCanRead,
+    TestCanSend,
+    TestCanReset,
+    TestCanClose,
+    NULL,
+    NULL,
+    NULL,
+    TestCanTxDone
+};
+
+static CO_IF_DRV TestDriver[2] = {
+    { NULL, NULL, NULL, &TestCanDriver, &TestCan[0] },
+    { NULL, NULL, NULL, &TestCanDriver, &TestCan[1] }
+};
+
+/******************************************************************************
+* TEST CAN DRIVER WITHOUT CONTEXT
+******************************************************************************/
+
+static CO_IF_FRM TestLegacyTx;
+
+static void    TestLegacyInit  (void)              { }
+static void    TestLegacyEnable(uint32_t baudrate) { (void)baudrate; }
+static int16_t TestLegacyRead  (CO_IF_FRM *frm)    { (void)frm; return (0); }
+static void    TestLegacyReset (void)              { }
+static void    TestLegacyClose (void)              { }
+
+static int16_t TestLegacySend(CO_IF_FRM *frm)
+{
+    TestLegacyTx = *frm;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static const CO_IF_CAN_DRV TestLegacyDriver = {
+    TestLegacyInit,
+    TestLegacyEnable,
+    TestLegacyRead,
+    TestLegacySend,
+    TestLegacyReset,
+    TestLegacyClose,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
+static CO_IF_DRV TestLegacy = { &TestLegacyDriver, NULL, NULL, NULL, NULL };
+
+/******************************************************************************
+* NODE CALLBACKS
+******************************************************************************/
+
+static void TestCbTxConfirm(CO_NODE *node, CO_IF_FRM *frm)
+{
+    TestCbNode = node;
+    TestCbFrm  = *frm;
+}
+
+static int16_t TestCbPdoReceive(CO_NODE *node, CO_IF_FRM *frm)
+{
+    TestCbNode = node;
+    TestCbFrm  = *frm;
+    return (1);
+}
+
+static const CO_NODE_CB TestCb = {
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    TestCbTxConfirm,
+    NULL,
+    TestCbPdoReceive,
+    NULL
+};
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TestSetup(void)
+{
+    uint8_t n;
+
+    memset(&TestCan, 0, sizeof(TestCan));
+    memset(&TestCbFrm, 0, sizeof(TestCbFrm));
+    TestCbNode   = NULL;
+    TestCbGlobal = 0;
+    for (n = 0; n < 2; n++) {
+        TestNode[n].Error   = CO_ERR_NONE;
+        TestNode[n].Cb      = &TestCb;
+        TestNode[n].Ctx     = NULL;
+        TestNode[n].If.Drv  = &TestDriver[n];
+        TestNode[n].If.Node = &TestNode[n];
+        COIfCanInit(&TestNode[n].If, &TestNode[n]);
+    }
+}
+
+/******************************************************************************
+* CALLBACK FUNCTIONS
+******************************************************************************/
+
+void COIfCanTxConfirm(CO_IF_FRM *frm)
+{
+    (void)frm;
+    TestCbGlobal++;
+}
+
+/******************************************************************************
+* TEST CASES - DRIVER CONTEXT
+******************************************************************************/
+
+void test_route(void)
+{
+    CO_IF_FRM frm = { 0 };
+
+    TestSetup();
+    CO_SET_ID(&TestCan[0].Rx, 0x201);
+    CO_SET_ID(&TestCan[1].Rx, 0x202);
+
+    TEST_CHECK(COIfCanRead(&TestNode[1].If, &frm) == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(CO_GET_ID(&frm) == 0x202);
+    TEST_CHECK(COIfCanRead(&TestNode[0].If, &frm) == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(CO_GET_ID(&frm) == 0x201);
+
+    CO_SET_ID(&frm, 0x181);
+    TEST_CHECK(COIfCanSend(&TestNode[0].If, &frm) == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(CO_GET_ID(&TestCan[0].Tx) == 0x181);
+    TEST_CHECK(CO_GET_ID(&TestCan[1].Tx) == 0);
+}
+
+void test_compat(void)
+{
+    CO_IF_FRM frm = { 0 };
+
+    TestSetup();
+    TestNode[0].If.Drv = &TestLegacy;
+    COIfCanInit(&TestNode[0].If, &TestNode[0]);
+    CO_SET_ID(&frm, 0x701);
+
+    TEST_CHECK(COIfCanSend(&TestNode[0].If, &frm) == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(CO_GET_ID(&TestLegacyTx) == 0x701);
+    TEST_CHECK(TestNode[0].If.Can.TxFree == NULL);
+    TEST_CHECK(TestNode[0].If.Can.TxDone == NULL);
+    TEST_CHECK(COIfCanTxFree(&TestNode[0].If) == CO_IF_CAN_TX_FREE_MAX);
+    TEST_CHECK(COIfCanTxDone(&TestNode[0].If) == 0);
+}
+
+/******************************************************************************
+* TEST CASES - NODE CALLBACKS
+******************************************************************************/
+
+void test_tx_confirm(void)
+{
+    CO_IF_FRM frm = { 0 };
+
+    TestSetup();
+    CO_SET_ID(&frm, 0x182);
+    (void)COIfCanSend(&TestNode[1].If, &frm);
+    TestCan[1].Done = 1;
+
+    TEST_CHECK(COIfCanTxDone(&TestNode[0].If) == 0);
+    TEST_CHECK(COIfCanTxDone(&TestNode[1].If) == 1);
+    TEST_CHECK(TestCbNode == &TestNode[1]);
+    TEST_CHECK(CO_GET_ID(&TestCbFrm) == 0x182);
+    TEST_CHECK(TestCbGlobal == 0);
+}
+
+void test_tx_global(void)
+{
+    CO_IF_FRM frm = { 0 };
+
+    TestSetup();
+    TestNode[0].Cb = NULL;
+    CO_SET_ID(&frm, 0x181);
+    (void)COIfCanSend(&TestNode[0].If, &frm);
+    TestCan[0].Done = 1;
+
+    TEST_CHECK(COIfCanTxDone(&TestNode[0].If) == 1);
+    TEST_CHECK(TestCbNode == NULL);
+    TEST_CHECK(TestCbGlobal == 1);
+}
+
+void test_pdo_receive(void)
+{
+    CO_RPDO   pdo = { 0 };
+    CO_IF_FRM frm = { 0 };
+
+    TestSetup();
+    pdo.Node       = &TestNode[1];
+    pdo.Identifier = 0x202;
+    pdo.Flag       = CO_RPDO_FLG__E;
+    CO_SET_ID(&frm, 0x202);
+
+    CORPdoRx(&pdo, &frm);
+
+    TEST_CHECK(TestCbNode == &TestNode[1]);
+    TEST_CHECK(CO_GET_ID(&TestCbFrm) == 0x202);
+}
+
+TEST_LIST = {
+    { "route",       test_route       },
+    { "compat",      test_compat      },
+    { "tx_confirm",  test_tx_confirm  },
+    { "tx_global",   test_tx_global   },
+    { "pdo_receive", test_pdo_receive },
+    { NULL, NULL }
+};
@@ -0,0 +1,680 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TEST_CLI        0                     /* node with SDO client, TPDO */
+#define TEST_SRV        1                     /* node with SDO server, RPDO */
+#define TEST_NODE_N     2
+#define TEST_Q_LEN      64
+#define TEST_OBJ_N      64
+#define TEST_TMR_N      16
+#define TEST_DOM_N      4096
+#define TEST_MAP_N      (CO_IF_FRM_DATA_N / 4u)
+#define TEST_BENCH_N    2000
+
+#if USE_CAN_FD
+#define TEST_MODE       "fd"
+#else
+#define TEST_MODE       "classic"
+#endif
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE    TestNode[TEST_NODE_N];
+static CO_OBJ     TestDict[TEST_NODE_N][TEST_OBJ_N];
+static CO_TMR_MEM TestMem[TEST_NODE_N][TEST_TMR_N];
+static uint8_t    TestSdoBuf[CO_SSDO_N * CO_SDO_BUF_BYTE];
+
+static CO_IF_FRM  TestQ[TEST_NODE_N][TEST_Q_LEN];
+static uint16_t   TestRd[TEST_NODE_N];
+static uint16_t   TestWr[TEST_NODE_N];
+static uint8_t    TestCur;
+static uint32_t   TestFrames;
+static uint32_t   TestBadLen;
+
+static uint8_t    TestErrReg[TEST_NODE_N];
+static uint16_t   TestHbTime[TEST_NODE_N];
+static uint32_t   TestSdoRx;
+static uint32_t   TestSdoTx;
+static uint32_t   TestCSdoTx;
+static uint32_t   TestCSdoRx;
+static uint8_t    TestCSdoNode;
+static uint32_t   TestPdoId[TEST_NODE_N];
+static uint8_t    TestPdoType[TEST_NODE_N];
+static uint16_t   TestPdoInhibit;
+static uint16_t   TestPdoEvent;
+static uint8_t    TestMapNum[TEST_NODE_N];
+static uint32_t   TestMap[TEST_NODE_N][TEST_MAP_N];
+static uint32_t   TestVal[TEST_NODE_N][TEST_MAP_N];
+
+static uint8_t    TestDomMem[TEST_DOM_N];
+static CO_OBJ_DOM TestDom;
+static uint8_t    TestBuf[TEST_DOM_N];
+static uint32_t   TestCode;
+static uint8_t    TestDone;
+
+/******************************************************************************
+* TEST CAN DRIVER (two nodes on a simulated bus)
+******************************************************************************/
+
+static void TestCanInit  (void)              { }
+static void TestCanEnable(uint32_t baudrate) { (void)baudrate; }
+static void TestCanReset (void)              { }
+static void TestCanClose (void)              { }
+
+static int16_t TestCanSend(CO_IF_FRM *frm)
+{
+    uint8_t  dst = (uint8_t)(TestCur ^ 1u);
+    uint16_t nxt = (uint16_t)((TestWr[dst] + 1u) % TEST_Q_LEN);
+
+    if (nxt == TestRd[dst]) {
+        return (-1);
+    }
+    if (COIfCanDlcToLen(COIfCanLenToDlc(frm->DLC)) != frm->DLC) {
+        TestBadLen++;
+    }
+    TestQ[dst][TestWr[dst]] = *frm;
+    TestWr[dst] = nxt;
+    TestFrames++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t TestCanRead(CO_IF_FRM *frm)
+{
+    uint8_t src = TestCur;
+
+    if (TestRd[src] == TestWr[src]) {
+        return (0);
+    }
+    *frm = TestQ[src][TestRd[src]];
+    TestRd[src] = (uint16_t)((TestRd[src] + 1u) % TEST_Q_LEN);
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static const CO_IF_CAN_DRV TestCanDriver = {
+    TestCanInit,
+    TestCanEnable,
+    TestCanRead,
+    TestCanSend,
+    TestCanReset,
+    TestCanClose,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
+/******************************************************************************
+* TEST TIMER AND NVM DRIVER (no timeouts within the tests)
+******************************************************************************/
+
+static void     TestTmrInit   (uint32_t freq) { (void)freq; }
+static void     TestTmrStart  (void)          { }
+static uint32_t TestTmrDelay  (void)          { return (0); }
+static void     TestTmrReload (uint32_t val)  { (void)val; }
+static void     TestTmrStop   (void)          { }
+static uint8_t  TestTmrUpdate (void)          { return (0); }
+
+static const CO_IF_TIMER_DRV TestTmrDriver = {
+    TestTmrInit,
+    TestTmrReload,
+    TestTmrDelay,
+    TestTmrStop,
+    TestTmrStart,
+    TestTmrUpdate
+};
+
+static void     TestNvmInit (void) { }
+static uint32_t TestNvmRead (uint32_t start, uint8_t *buf, uint32_t size) { (void)start; (void)buf; return (size); }
+static uint32_t TestNvmWrite(uint32_t start, uint8_t *buf, uint32_t size) { (void)start; (void)buf; return (size); }
+
+static const CO_IF_NVM_DRV TestNvmDriver = {
+    TestNvmInit,
+    TestNvmRead,
+    TestNvmWrite
+};
+
+static CO_IF_DRV TestDriver = { &TestCanDriver, &TestTmrDriver, &TestNvmDriver };
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TestObj(uint8_t node, uint16_t *n, uint32_t key, const CO_OBJ_TYPE *type, CO_DATA data)
+{
+    TestDict[node][*n].Key  = key;
+    TestDict[node][*n].Type = type;
+    TestDict[node][*n].Data = data;
+    (*n)++;
+}
+
+static uint16_t TestDictCommon(uint8_t node)
+{
+    uint16_t n = 0;
+
+    memset(&TestDict[node][0], 0, sizeof(TestDict[node]));
+    TestObj(node, &n, CO_KEY(0x1000, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0));
+    TestObj(node, &n, CO_KEY(0x1001, 0, CO_OBJ____PR_), CO_TUNSIGNED8,  (CO_DATA)(&TestErrReg[node]));
+    TestObj(node, &n, CO_KEY(0x1017, 0, CO_OBJ_____RW), CO_THB_PROD,    (CO_DATA)(&TestHbTime[node]));
+    TestObj(node, &n, CO_KEY(0x1018, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(4));
+    TestObj(node, &n, CO_KEY(0x1018, 1, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0));
+    TestObj(node, &n, CO_KEY(0x1018, 2, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0));
+    TestObj(node, &n, CO_KEY(0x1018, 3, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0));
+    TestObj(node, &n, CO_KEY(0x1018, 4, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0));
+    return (n);
+}
+
+static void TestDictClient(void)
+{
+    uint16_t n;
+    uint8_t  i;
+
+    n = TestDictCommon(TEST_CLI);
+    TestObj(TEST_CLI, &n, CO_KEY(0x1280, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(3));
+    TestObj(TEST_CLI, &n, CO_KEY(0x1280, 1, CO_OBJ_____RW), CO_TSDO_ID,     (CO_DATA)(&TestCSdoTx));
+    TestObj(TEST_CLI, &n, CO_KEY(0x1280, 2, CO_OBJ_____RW), CO_TSDO_ID,     (CO_DATA)(&TestCSdoRx));
+    TestObj(TEST_CLI, &n, CO_KEY(0x1280, 3, CO_OBJ_____RW), CO_TUNSIGNED8,  (CO_DATA)(&TestCSdoNode));
+    TestObj(TEST_CLI, &n, CO_KEY(0x1800, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(5));
+    TestObj(TEST_CLI, &n, CO_KEY(0x1800, 1, CO_OBJ_____RW), CO_TPDO_ID,     (CO_DATA)(&TestPdoId[TEST_CLI]));
+    TestObj(TEST_CLI, &n, CO_KEY(0x1800, 2, CO_OBJ_____RW), CO_TPDO_TYPE,   (CO_DATA)(&TestPdoType[TEST_CLI]));
+    TestObj(TEST_CLI, &n, CO_KEY(0x1800, 3, CO_OBJ_____RW), CO_TUNSIGNED16, (CO_DATA)(&TestPdoInhibit));
+    TestObj(TEST_CLI, &n, CO_KEY(0x1800, 5, CO_OBJ_____RW), CO_TPDO_EVENT,  (CO_DATA)(&TestPdoEvent));
+    TestObj(TEST_CLI, &n, CO_KEY(0x1A00, 0, CO_OBJ_____RW), CO_TPDO_NUM,    (CO_DATA)(&TestMapNum[TEST_CLI]));
+    for (i = 0; i < TEST_MAP_N; i++) {
+        TestObj(TEST_CLI, &n, CO_KEY(0x1A00, 1 + i, CO_OBJ_____RW), CO_TPDO_MAP, (CO_DATA)(&TestMap[TEST_CLI][i]));
+    }
+    for (i = 0; i < TEST_MAP_N; i++) {
+        TestObj(TEST_CLI, &n, CO_KEY(0x2100, 1 + i, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&TestVal[TEST_CLI][i]));
+    }
+    TestCSdoTx   = 0x600;
+    TestCSdoRx   = 0x580;
+    TestCSdoNode = 2;
+}
+
+static void TestDictServer(void)
+{
+    uint16_t n;
+    uint8_t  i;
+
+    n = TestDictCommon(TEST_SRV);
+    TestObj(TEST_SRV, &n, CO_KEY(0x1200, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(2));
+    TestObj(TEST_SRV, &n, CO_KEY(0x1200, 1, CO_OBJ__N__RW), CO_TSDO_ID,     (CO_DATA)(&TestSdoRx));
+    TestObj(TEST_SRV, &n, CO_KEY(0x1200, 2, CO_OBJ__N__RW), CO_TSDO_ID,     (CO_DATA)(&TestSdoTx));
+    TestObj(TEST_SRV, &n, CO_KEY(0x1400, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(2));
+    TestObj(TEST_SRV, &n, CO_KEY(0x1400, 1, CO_OBJ_____RW), CO_TPDO_ID,     (CO_DATA)(&TestPdoId[TEST_SRV]));
+    TestObj(TEST_SRV, &n, CO_KEY(0x1400, 2, CO_OBJ_____RW), CO_TPDO_TYPE,   (CO_DATA)(&TestPdoType[TEST_SRV]));
+    TestObj(TEST_SRV, &n, CO_KEY(0x1600, 0, CO_OBJ_____RW), CO_TPDO_NUM,    (CO_DATA)(&TestMapNum[TEST_SRV]));
+    for (i = 0; i < TEST_MAP_N; i++) {
+        TestObj(TEST_SRV, &n, CO_KEY(0x1600, 1 + i, CO_OBJ_____RW), CO_TPDO_MAP, (CO_DATA)(&TestMap[TEST_SRV][i]));
+    }
+    TestObj(TEST_SRV, &n, CO_KEY(0x2000, 0, CO_OBJ_____RW), CO_TDOMAIN, (CO_DATA)(&TestDom));
+    for (i = 0; i < TEST_MAP_N; i++) {
+        TestObj(TEST_SRV, &n, CO_KEY(0x2100, 1 + i, CO_OBJ____PRW), CO_TUNSIGNED32, (CO_DATA)(&TestVal[TEST_SRV][i]));
+    }
+    TestSdoRx = 0x600;
+    TestSdoTx = 0x580;
+}
+
+static void TestSetup(void)
+{
+    CO_NODE_SPEC spec;
+    uint8_t      node;
+    uint8_t      i;
+
+    memset(&TestNode, 0, sizeof(TestNode));
+    memset(&TestRd, 0, sizeof(TestRd));
+    memset(&TestWr, 0, sizeof(TestWr));
+    memset(&TestVal, 0, sizeof(TestVal));
+    memset(&TestDomMem, 0, sizeof(TestDomMem));
+    TestDom.Offset = 0;
+    TestDom.Size   = TEST_DOM_N;
+    TestDom.Start  = &TestDomMem[0];
+    for (node = 0; node < TEST_NODE_N; node++) {
+        TestErrReg[node]  = 0;
+        TestHbTime[node]  = 0;
+        TestPdoId[node]   = CO_COBID_TPDO_STD(1u, 0x181);
+        TestPdoType[node] = 254;
+        TestMapNum[node]  = TEST_MAP_N;
+        for (i = 0; i < TEST_MAP_N; i++) {
+            TestMap[node][i] = CO_LINK(0x2100, 1 + i, 32);
+        }
+    }
+    TestPdoInhibit = 0;
+    TestPdoEvent   = 0;
+    TestDictClient();
+    TestDictServer();
+
+    for (node = 0; node < TEST_NODE_N; node++) {
+        TestCur       = node;
+        spec.NodeId   = (uint8_t)(1 + node);
+        spec.Baudrate = 1000000;
+        spec.Dict     = &TestDict[node][0];
+        spec.DictLen  = TEST_OBJ_N;
+        spec.EmcyCode = NULL;
+        spec.TmrMem   = &TestMem[node][0];
+        spec.TmrNum   = TEST_TMR_N;
+        spec.TmrFreq  = 1000;
+        spec.Drv      = &TestDriver;
+        spec.SdoBuf   = &TestSdoBuf[0];
+        CONodeInit(&TestNode[node], &spec);
+        TEST_CHECK(TestNode[node].Error == CO_ERR_NONE);
+        TEST_MSG("node %u: error %d", node, TestNode[node].Error);
+        CONodeStart(&TestNode[node]);
+        CONmtSetMode(&TestNode[node].Nmt, CO_OPERATIONAL);
+    }
+    TestRd[TEST_CLI] = TestWr[TEST_CLI];              /* drop the bootup messages */
+    TestRd[TEST_SRV] = TestWr[TEST_SRV];
+    TestFrames = 0;
+    TestBadLen = 0;
+}
+
+static void TestRun(void)
+{
+    uint8_t busy;
+    uint8_t node;
+
+    do {
+        busy = 0;
+        for (node = 0; node < TEST_NODE_N; node++) {
+            TestCur = node;
+            while (TestRd[node] != TestWr[node]) {
+                CONodeProcess(&TestNode[node]);
+                busy = 1;
+            }
+        }
+    } while (busy != 0);
+    TestCur = TEST_CLI;
+}
+
+static void TestFinished(CO_CSDO *csdo, uint16_t index, uint8_t sub, uint32_t code)
+{
+    (void)csdo;
+    (void)index;
+    (void)sub;
+    TestCode = code;
+    TestDone = 1;
+}
+
+static void TestPattern(uint8_t *buf, uint32_t size, uint8_t seed)
+{
+    uint32_t n;
+
+    for (n = 0; n < size; n++) {
+        buf[n] = (uint8_t)(seed + (n * 7u) + (n >> 8));
+    }
+}
+
+static CO_ERR TestDownload(uint32_t size)
+{
+    CO_CSDO *csdo;
+    CO_ERR   err;
+
+    TestCur  = TEST_CLI;
+    TestDone = 0;
+    TestCode = 0xFFFFFFFF;
+    csdo = COCSdoFind(&TestNode[TEST_CLI], 0);
+    err  = COCSdoRequestDownload(csdo, CO_DEV(0x2000, 0), &TestBuf[0], size, TestFinished, 1000);
+    if (err == CO_ERR_NONE) {
+        TestRun();
+    }
+    return (err);
+}
+
+static CO_ERR TestUpload(uint32_t size)
+{
+    CO_CSDO *csdo;
+    CO_ERR   err;
+
+    TestCur  = TEST_CLI;
+    TestDone = 0;
+    TestCode = 0xFFFFFFFF;
+    csdo = COCSdoFind(&TestNode[TEST_CLI], 0);
+    err  = COCSdoRequestUpload(csdo, CO_DEV(0x2000, 0), &TestBuf[0], size, TestFinished, 1000);
+    if (err == CO_ERR_NONE) {
+        TestRun();
+    }
+    return (err);
+}
+
+static void TestSrvRequest(uint8_t dlc, const uint8_t *data)
+{
+    CO_IF_FRM frm;
+
+    memset(&frm, 0, sizeof(frm));
+    CO_SET_ID(&frm, 0x602);
+    CO_SET_DLC(&frm, dlc);
+    memcpy(&frm.Data[0], data, dlc);
+    TestCur = TEST_CLI;
+    (void)TestCanSend(&frm);
+    TestCur = TEST_SRV;
+    while (TestRd[TEST_SRV] != TestWr[TEST_SRV]) {
+        CONodeProcess(&TestNode[TEST_SRV]);
+    }
+    TestCur = TEST_CLI;
+}
+
+static uint8_t TestSrvResponse(void)
+{
+    uint8_t cmd = 0xFF;
+
+    if (TestRd[TEST_CLI] != TestWr[TEST_CLI]) {
+        cmd = CO_GET_BYTE(&TestQ[TEST_CLI][TestRd[TEST_CLI]], 0);
+        TestRd[TEST_CLI] = TestWr[TEST_CLI];
+    }
+    return (cmd);
+}
+
+static void TestCliResponse(uint8_t dlc, const uint8_t *data)
+{
+    CO_IF_FRM frm;
+
+    memset(&frm, 0xEE, sizeof(frm));                  /* stale bytes behind the payload */
+    CO_SET_ID(&frm, COCSdoFind(&TestNode[TEST_CLI], 0)->RxId);
+    CO_SET_DLC(&frm, dlc);
+    memcpy(&frm.Data[0], data, dlc);
+    TestCur = TEST_SRV;
+    (void)TestCanSend(&frm);
+    TestCur = TEST_CLI;
+    while (TestRd[TEST_CLI] != TestWr[TEST_CLI]) {
+        CONodeProcess(&TestNode[TEST_CLI]);
+    }
+    TestRd[TEST_SRV] = TestWr[TEST_SRV];              /* drop the client requests */
+}
+
+static void TestCliUpload(uint32_t size)
+{
+    CO_CSDO *csdo;
+
+    TestCur  = TEST_CLI;
+    TestDone = 0;
+    TestCode = 0xFFFFFFFF;
+    memset(&TestBuf[0], 0, sizeof(TestBuf));
+    csdo = COCSdoFind(&TestNode[TEST_CLI], 0);
+    TEST_CHECK(COCSdoRequestUpload(csdo, CO_DEV(0x2000, 0), &TestBuf[0], size, TestFinished, 1000) == CO_ERR_NONE);
+    TestRd[TEST_SRV] = TestWr[TEST_SRV];              /* drop the client request  */
+}
+
+/******************************************************************************
+* TEST CASES - FUNCTION
+******************************************************************************/
+
+void test_dlc(void)
+{
+    uint8_t len;
+
+    for (len = 0; len <= 8; len++) {
+        TEST_CHECK(COIfCanLenToDlc(len) == len);
+        TEST_CHECK(COIfCanDlcToLen(len) == len);
+    }
+#if USE_CAN_FD
+    TEST_CHECK(COIfCanLenToDlc( 9) ==  9);
+    TEST_CHECK(COIfCanLenToDlc(12) ==  9);
+    TEST_CHECK(COIfCanLenToDlc(13) == 10);
+    TEST_CHECK(COIfCanLenToDlc(24) == 12);
+    TEST_CHECK(COIfCanLenToDlc(25) == 13);
+    TEST_CHECK(COIfCanLenToDlc(33) == 14);
+    TEST_CHECK(COIfCanLenToDlc(49) == 15);
+    TEST_CHECK(COIfCanLenToDlc(64) == 15);
+    TEST_CHECK(COIfCanDlcToLen( 9) == 12);
+    TEST_CHECK(COIfCanDlcToLen(13) == 32);
+    TEST_CHECK(COIfCanDlcToLen(15) == 64);
+#else
+    TEST_CHECK(COIfCanLenToDlc(12) ==  8);
+    TEST_CHECK(COIfCanLenToDlc(64) ==  8);
+    TEST_CHECK(COIfCanDlcToLen( 9) ==  8);
+    TEST_CHECK(COIfCanDlcToLen(15) ==  8);
+#endif
+}
+
+void test_sdo_download(void)
+{
+    uint32_t segs;
+    uint32_t size;
+
+    TestSetup();
+    for (size = TEST_DOM_N - 100; size <= TEST_DOM_N; size += 50) {
+        TestDom.Size = size;
+        TestFrames   = 0;
+        TestPattern(&TestBuf[0], size, (uint8_t)size);
+
+        TEST_CHECK(TestDownload(size) == CO_ERR_NONE);
+        TEST_CHECK(TestDone == 1);
+        TEST_CHECK(TestCode == 0);
+        TEST_CHECK(memcmp(&TestDomMem[0], &TestBuf[0], size) == 0);
+
+        segs = (size + CO_SDO_SEG_DATA - 1) / CO_SDO_SEG_DATA;
+        TEST_CHECK(TestFrames == 2 * (1 + segs));
+        TEST_MSG("size %u: frames %u, expected %u", size, TestFrames, 2 * (1 + segs));
+    }
+    TEST_CHECK(TestBadLen == 0);
+}
+
+void test_sdo_classic_seg(void)
+{
+    const uint8_t init[8] = { 0x21, 0x00, 0x20, 0x00, 10, 0, 0, 0 };
+    const uint8_t seg1[8] = { 0x00, 1, 2, 3, 4, 5, 6, 7 };
+    const uint8_t seg2[8] = { 0x19, 8, 9, 10, 0, 0, 0, 0 };
+    uint8_t       n;
+
+    TestSetup();
+    TestDom.Size = 10;
+
+    TestSrvRequest(8, &init[0]);
+    TEST_CHECK(TestSrvResponse() == 0x60);
+    TestSrvRequest(8, &seg1[0]);                      /* n=0: 7 bytes in DLC 8 */
+    TEST_CHECK(TestSrvResponse() == 0x20);
+    TestSrvRequest(8, &seg2[0]);
+    TEST_CHECK(TestSrvResponse() == 0x30);
+
+    for (n = 0; n < 10; n++) {
+        TEST_CHECK(TestDomMem[n] == (uint8_t)(n + 1));
+        TEST_MSG("byte %u: 0x%02x", n, TestDomMem[n]);
+    }
+}
+
+void test_sdo_short_seg(void)
+{
+    const uint8_t init[8] = { 0x21, 0x00, 0x20, 0x00, 10, 0, 0, 0 };
+    const uint8_t seg1[8] = { 0x00, 1, 2, 3, 4, 5, 6, 7 };
+
+    TestSetup();
+    TestDom.Size = 10;
+
+    TestSrvRequest(8, &init[0]);
+    TEST_CHECK(TestSrvResponse() == 0x60);
+    TestSrvRequest(1, &seg1[0]);                      /* no data byte          */
+    TEST_CHECK(TestSrvResponse() == 0x80);
+}
+
+void test_csdo_classic_seg(void)
+{
+    const uint8_t init[8] = { 0x41, 0x00, 0x20, 0x00, 10, 0, 0, 0 };
+    const uint8_t seg1[8] = { 0x00, 1, 2, 3, 4, 5, 6, 7 };
+    const uint8_t seg2[8] = { 0x19, 8, 9, 10, 0, 0, 0, 0 };
+    uint8_t       n;
+
+    TestSetup();
+    TestCliUpload(10);
+
+    TestCliResponse(8, &init[0]);
+    TestCliResponse(8, &seg1[0]);                     /* n=0: 7 bytes in DLC 8 */
+    TestCliResponse(8, &seg2[0]);                     /* n=4: 3 bytes          */
+    TEST_CHECK(TestDone == 1);
+    TEST_CHECK(TestCode == 0);
+
+    for (n = 0; n < 10; n++) {
+        TEST_CHECK(TestBuf[n] == (uint8_t)(n + 1));
+        TEST_MSG("byte %u: 0x%02x", n, TestBuf[n]);
+    }
+    TEST_CHECK(TestBuf[10] == 0);
+}
+
+void test_csdo_short_seg(void)
+{
+    const uint8_t init[8] = { 0x41, 0x00, 0x20, 0x00, 10, 0, 0, 0 };
+    const uint8_t seg1[8] = { 0x00, 1, 2, 3, 4, 5, 6, 7 };
+
+    TestSetup();
+    TestCliUpload(10);
+
+    TestCliResponse(8, &init[0]);
+    TestCliResponse(1, &seg1[0]);                     /* no data byte          */
+    TEST_CHECK(TestDone == 1);
+    TEST_CHECK(TestCode == CO_SDO_ERR_CMD);
+}
+
+void test_sdo_upload(void)
+{
+    uint32_t segs;
+    uint32_t size;
+
+    TestSetup();
+    for (size = TEST_DOM_N - 100; size <= TEST_DOM_N; size += 50) {
+        TestDom.Size = size;
+        TestFrames   = 0;
+        TestPattern(&TestDomMem[0], size, (uint8_t)size);
+        memset(&TestBuf[0], 0, sizeof(TestBuf));
+
+        TEST_CHECK(TestUpload(size) == CO_ERR_NONE);
+        TEST_CHECK(TestDone == 1);
+        TEST_CHECK(TestCode == 0);
+        TEST_CHECK(memcmp(&TestDomMem[0], &TestBuf[0], size) == 0);
+
+        segs = (size + CO_SDO_SEG_DATA - 1) / CO_SDO_SEG_DATA;
+        TEST_CHECK(TestFrames == 2 * (1 + segs));
+        TEST_MSG("size %u: frames %u, expected %u", size, TestFrames, 2 * (1 + segs));
+    }
+    TEST_CHECK(TestBadLen == 0);
+}
+
+void test_pdo(void)
+{
+    uint8_t i;
+
+    TestSetup();
+    for (i = 0; i < TEST_MAP_N; i++) {
+        TestVal[TEST_CLI][i] = 0x11223344u * (i + 1u);
+    }
+    TestCur = TEST_CLI;
+    COTPdoTrigPdo(TestNode[TEST_CLI].TPdo, 0);
+    TEST_CHECK(TestFrames == 1);
+    TEST_CHECK(TestQ[TEST_SRV][TestRd[TEST_SRV]].DLC == CO_IF_FRM_DATA_N);
+    TestRun();
+
+    TEST_CHECK(memcmp(&TestVal[TEST_SRV][0], &TestVal[TEST_CLI][0], sizeof(TestVal[0])) == 0);
+    TEST_CHECK(CONodeGetErr(&TestNode[TEST_CLI]) == CO_ERR_NONE);
+    TEST_CHECK(CONodeGetErr(&TestNode[TEST_SRV]) == CO_ERR_NONE);
+}
+
+void test_pdo_map_len(void)
+{
+    TestSetup();
+    TestMap[TEST_CLI][0] = CO_LINK(0x2100, 1, 64);   /* exceeds payload  */
+    TEST_CHECK(COTPdoGetMap(TestNode[TEST_CLI].TPdo, 0) == CO_ERR_TPDO_MAP_OBJ);
+}
+
+/******************************************************************************
+* TEST CASES - BENCHMARK
+******************************************************************************/
+
+void test_bench_sdo(void)
+{
+    clock_t  start;
+    uint32_t frames = 0;
+    uint32_t n;
+    double   t;
+
+    TestSetup();
+    TestPattern(&TestBuf[0], TEST_DOM_N, 0x5A);
+
+    start = clock();
+    for (n = 0; n < TEST_BENCH_N / 10; n++) {
+        TestFrames = 0;
+        TEST_CHECK(TestDownload(TEST_DOM_N) == CO_ERR_NONE);
+        TEST_CHECK(TestCode == 0);
+        frames += TestFrames;
+    }
+    t = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("\n  %-7s: SDO download %u bytes: %5.1f frames, %5.1f ns/byte, %4.1f byte/frame\n",
+           TEST_MODE,
+           (unsigned)TEST_DOM_N,
+           (double)frames / (TEST_BENCH_N / 10),
+           t * 1e9 / ((double)(TEST_BENCH_N / 10) * TEST_DOM_N),
+           (double)TEST_DOM_N * (TEST_BENCH_N / 10) / frames);
+}
+
+void test_bench_pdo(void)
+{
+    clock_t  start;
+    uint32_t n;
+    uint8_t  i;
+    double   t;
+
+    TestSetup();
+
+    start = clock();
+    for (n = 0; n < TEST_BENCH_N * 100; n++) {
+        for (i = 0; i < TEST_MAP_N; i++) {
+            TestVal[TEST_CLI][i] = n + i;
+        }
+        TestCur = TEST_CLI;
+        COTPdoTrigPdo(TestNode[TEST_CLI].TPdo, 0);
+        TestRun();
+    }
+    t = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    TEST_CHECK(TestVal[TEST_SRV][TEST_MAP_N - 1] == (n - 1) + (TEST_MAP_N - 1));
+    printf("\n  %-7s: PDO process image %2u bytes/frame: %5.1f ns/byte\n",
+           TEST_MODE,
+           (unsigned)(TEST_MAP_N * 4u),
+           t * 1e9 / ((double)n * TEST_MAP_N * 4u));
+}
+
+/******************************************************************************
+* TEST LIST
+******************************************************************************/
+
+TEST_LIST = {
+    { "dlc",              test_dlc              },
+    { "sdo_download",     test_sdo_download     },
+    { "sdo_classic_seg",  test_sdo_classic_seg  },
+    { "sdo_short_seg",    test_sdo_short_seg    },
+    { "csdo_classic_seg", test_csdo_classic_seg },
+    { "csdo_short_seg",   test_csdo_short_seg   },
+    { "sdo_upload",       test_sdo_upload       },
+    { "pdo",              test_pdo              },
+    { "pdo_map_len",      test_pdo_map_len      },
+    { "bench_sdo",        test_bench_sdo        },
+    { "bench_pdo",        test_bench_pdo        },
+    { NULL, NULL }
+};
@@ -0,0 +1,402 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#if TEST_PTHREAD
+#define _POSIX_C_SOURCE 200112L
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <time.h>
+#endif
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TEST_RING_N    8u
+#define BENCH_RING_N   256u
+#define BENCH_FRAMES   4000000u
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_IF_RING     TestRing;
+static CO_IF_FRM      TestBuf[TEST_RING_N];
+static CO_NODE        TestNode;
+static CO_IF_CAN_RING TestCan;
+static CO_IF_FRM      TestRx[TEST_RING_N];
+static CO_IF_FRM      TestTx[TEST_RING_N];
+static CO_IF_FRM      TestHwRx;
+static CO_IF_FRM      TestHwTx;
+static uint16_t       TestHwSent;
+static int16_t        TestHwErr;
+
+/******************************************************************************
+* TEST CAN HARDWARE DRIVER
+******************************************************************************/
+
+static void    TestHwInit  (void)              { }
+static void    TestHwEnable(uint32_t baudrate) { (void)baudrate; }
+static void    TestHwReset (void)              { }
+static void    TestHwClose (void)              { }
+
+static int16_t TestHwRead(CO_IF_FRM *frm)
+{
+    *frm = TestHwRx;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t TestHwSend(CO_IF_FRM *frm)
+{
+    if (TestHwErr != 0) {
+        return (TestHwErr);
+    }
+    TestHwTx = *frm;
+    TestHwSent++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static const CO_IF_CAN_DRV TestHwDriver = {
+    TestHwInit,
+    TestHwEnable,
+    TestHwRead,
+    TestHwSend,
+    TestHwReset,
+    TestHwClose,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
+static CO_IF_DRV TestDriver = { NULL, NULL, NULL, &COIfCanRingCtxDriver, &TestCan };
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TestSetup(void)
+{
+    TEST_CHECK(COIfRingInit(&TestRing, TestBuf, TEST_RING_N) == 0);
+}
+
+static void TestSetupDriver(void)
+{
+    TestHwSent = 0;
+    TestHwErr  = 0;
+    memset(&TestHwRx, 0, sizeof(TestHwRx));
+    memset(&TestHwTx, 0, sizeof(TestHwTx));
+    TEST_CHECK(COIfCanRingInit(&TestCan, &TestHwDriver,
+        TestRx, TEST_RING_N, TestTx, TEST_RING_N) == 0);
+    TestNode.Error   = CO_ERR_NONE;
+    TestNode.If.Drv  = &TestDriver;
+    TestNode.If.Node = &TestNode;
+    COIfCanInit(&TestNode.If, &TestNode);
+}
+
+static void TestFill(CO_IF_FRM *frm, uint32_t num, uint32_t id)
+{
+    uint32_t n;
+
+    for (n = 0; n < num; n++) {
+        memset(&frm[n], 0, sizeof(CO_IF_FRM));
+        CO_SET_ID(&frm[n], id + n);
+    }
+}
+
+/******************************************************************************
+* TEST CASES - FRAME RING
+******************************************************************************/
+
+void test_init(void)
+{
+    TEST_CHECK(COIfRingInit(&TestRing, NULL, 4) < 0);
+    TEST_CHECK(COIfRingInit(&TestRing, TestBuf, 0) < 0);
+    TEST_CHECK(COIfRingInit(&TestRing, TestBuf, 1) < 0);
+    TEST_CHECK(COIfRingInit(&TestRing, TestBuf, 6) < 0);
+    TEST_CHECK(COIfRingInit(&TestRing, TestBuf, 4) == 0);
+
+    TEST_CHECK(COIfRingUsed(&TestRing) == 0);
+    TEST_CHECK(COIfRingFree(&TestRing) == 4);
+}
+
+void test_push_pop(void)
+{
+    CO_IF_FRM in[3];
+    CO_IF_FRM out[TEST_RING_N];
+    uint32_t  num;
+
+    TestSetup();
+    TestFill(in, 3, 0x100);
+
+    num = COIfRingPush(&TestRing, in, 3);
+    TEST_CHECK(num == 3);
+    TEST_CHECK(COIfRingUsed(&TestRing) == 3);
+
+    num = COIfRingPop(&TestRing, out, TEST_RING_N);
+    TEST_CHECK(num == 3);
+    TEST_CHECK(CO_GET_ID(&out[0]) == 0x100);
+    TEST_CHECK(CO_GET_ID(&out[2]) == 0x102);
+    TEST_CHECK(COIfRingUsed(&TestRing) == 0);
+    TEST_CHECK(COIfRingPop(&TestRing, out, TEST_RING_N) == 0);
+}
+
+void test_wrap(void)
+{
+    CO_IF_FRM in[5];
+    CO_IF_FRM out[5];
+    uint32_t  loop;
+    uint32_t  n;
+
+    TestSetup();
+    for (loop = 0; loop < 10; loop++) {
+        TestFill(in, 5, loop * 5);
+        TEST_CHECK(COIfRingPush(&TestRing, in, 5) == 5);
+        TEST_CHECK(COIfRingPop(&TestRing, out, 5) == 5);
+        for (n = 0; n < 5; n++) {
+            TEST_CHECK(CO_GET_ID(&out[n]) == (loop * 5) + n);
+        }
+    }
+    TEST_CHECK(TestRing.Drop == 0);
+}
+
+void test_full(void)
+{
+    CO_IF_FRM in[TEST_RING_N + 2];
+    CO_IF_FRM out;
+
+    TestSetup();
+    TestFill(in, TEST_RING_N + 2, 0x200);
+
+    TEST_CHECK(COIfRingPush(&TestRing, in, TEST_RING_N + 2) == TEST_RING_N);
+    TEST_CHECK(TestRing.Drop == 2);
+    TEST_CHECK(COIfRingFree(&TestRing) == 0);
+    TEST_CHECK(COIfRingPush(&TestRing, in, 1) == 0);
+    TEST_CHECK(TestRing.Drop == 3);
+
+    TEST_CHECK(COIfRingPop(&TestRing, &out, 1) == 1);
+    TEST_CHECK(CO_GET_ID(&out) == 0x200);
+    TEST_CHECK(COIfRingFree(&TestRing) == 1);
+}
+
+void test_peek_skip(void)
+{
+    CO_IF_FRM in[2];
+    CO_IF_FRM out;
+
+    TestSetup();
+    TestFill(in, 2, 0x300);
+    (void)COIfRingPush(&TestRing, in, 2);
+
+    TEST_CHECK(COIfRingPeek(&TestRing, &out, 1) == 1);
+    TEST_CHECK(CO_GET_ID(&out) == 0x300);
+    TEST_CHECK(COIfRingPeek(&TestRing, &out, 1) == 1);
+    TEST_CHECK(CO_GET_ID(&out) == 0x300);
+
+    COIfRingSkip(&TestRing, 1);
+    TEST_CHECK(COIfRingPeek(&TestRing, &out, 1) == 1);
+    TEST_CHECK(CO_GET_ID(&out) == 0x301);
+
+    COIfRingClear(&TestRing);
+    TEST_CHECK(COIfRingUsed(&TestRing) == 0);
+}
+
+/******************************************************************************
+* TEST CASES - RING CAN DRIVER
+******************************************************************************/
+
+void test_drv_read(void)
+{
+    CO_IF_FRM frm;
+
+    TestSetupDriver();
+    TEST_CHECK(COIfCanRead(&TestNode.If, &frm) == 0);
+
+    CO_SET_ID(&TestHwRx, 0x201);
+    TEST_CHECK(COIfCanRingRxPoll(&TestCan) == (int16_t)sizeof(CO_IF_FRM));
+    CO_SET_ID(&TestHwRx, 0x202);
+    TEST_CHECK(COIfCanRingRxPoll(&TestCan) == (int16_t)sizeof(CO_IF_FRM));
+
+    TEST_CHECK(COIfCanRead(&TestNode.If, &frm) == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(CO_GET_ID(&frm) == 0x201);
+    TEST_CHECK(COIfCanRead(&TestNode.If, &frm) == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(CO_GET_ID(&frm) == 0x202);
+    TEST_CHECK(COIfCanRead(&TestNode.If, &frm) == 0);
+    TEST_CHECK(TestNode.Error == CO_ERR_NONE);
+}
+
+void test_drv_send(void)
+{
+    CO_IF_FRM frm = { 0 };
+
+    TestSetupDriver();
+    CO_SET_ID(&frm, 0x181);
+
+    TEST_CHECK(COIfCanTxFree(&TestNode.If) == (int16_t)TEST_RING_N);
+    TEST_CHECK(COIfCanSend(&TestNode.If, &frm) == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(COIfCanTxFree(&TestNode.If) == (int16_t)(TEST_RING_N - 1));
+    TEST_CHECK(TestHwSent == 0);
+
+    TEST_CHECK(COIfCanRingTxPoll(&TestCan) == 1);
+    TEST_CHECK(TestHwSent == 1);
+    TEST_CHECK(CO_GET_ID(&TestHwTx) == 0x181);
+    TEST_CHECK(COIfCanTxFree(&TestNode.If) == (int16_t)TEST_RING_N);
+}
+
+void test_drv_reject(void)
+{
+    CO_IF_FRM frm = { 0 };
+
+    TestSetupDriver();
+    CO_SET_ID(&frm, 0x281);
+    (void)COIfCanSend(&TestNode.If, &frm);
+    TestHwErr = -1;
+
+    TEST_CHECK(COIfCanRingTxPoll(&TestCan) == -1);
+    TEST_CHECK(COIfRingUsed(&TestCan.Tx) == 1);
+
+    TestHwErr = 0;
+    TEST_CHECK(COIfCanRingTxPoll(&TestCan) == 1);
+    TEST_CHECK(CO_GET_ID(&TestHwTx) == 0x281);
+}
+
+/******************************************************************************
+* TEST CASES - BENCHMARK
+******************************************************************************/
+
+#if TEST_PTHREAD
+
+typedef struct BENCH_T {
+    CO_IF_RING Ring;
+    uint32_t   Batch;
+    uint32_t   Error;
+} BENCH;
+
+static CO_IF_FRM BenchBuf[BENCH_RING_N];
+
+static void *BenchProducer(void *arg)
+{
+    BENCH    *bench = (BENCH *)arg;
+    CO_IF_FRM frm[BENCH_RING_N];
+    uint32_t  seq = 0;
+    uint32_t  num;
+
+    while (seq < BENCH_FRAMES) {
+        num = COIfRingFree(&bench->Ring);
+        if (num > bench->Batch) {
+            num = bench->Batch;
+        }
+        if (num > (BENCH_FRAMES - seq)) {
+            num = BENCH_FRAMES - seq;
+        }
+        if (num == 0) {
+            sched_yield();
+            continue;
+        }
+        TestFill(frm, num, seq);
+        seq += COIfRingPush(&bench->Ring, frm, num);
+    }
+    return (NULL);
+}
+
+static void *BenchConsumer(void *arg)
+{
+    BENCH    *bench = (BENCH *)arg;
+    CO_IF_FRM frm[BENCH_RING_N];
+    uint32_t  seq = 0;
+    uint32_t  num;
+    uint32_t  n;
+
+    while (seq < BENCH_FRAMES) {
+        num = COIfRingPop(&bench->Ring, frm, bench->Batch);
+        if (num == 0) {
+            sched_yield();
+            continue;
+        }
+        for (n = 0; n < num; n++) {
+            if (CO_GET_ID(&frm[n]) != seq) {
+                bench->Error++;
+            }
+            seq++;
+        }
+    }
+    return (NULL);
+}
+
+static double BenchRun(uint32_t batch, BENCH *bench)
+{
+    struct timespec start;
+    struct timespec stop;
+    pthread_t       prod;
+    pthread_t       cons;
+
+    TEST_CHECK(COIfRingInit(&bench->Ring, BenchBuf, BENCH_RING_N) == 0);
+    bench->Batch = batch;
+    bench->Error = 0;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    TEST_CHECK(pthread_create(&cons, NULL, BenchConsumer, bench) == 0);
+    TEST_CHECK(pthread_create(&prod, NULL, BenchProducer, bench) == 0);
+    (void)pthread_join(prod, NULL);
+    (void)pthread_join(cons, NULL);
+    (void)clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    TEST_CHECK(bench->Error == 0);
+    TEST_CHECK(bench->Ring.Drop == 0);
+    return ((double)(stop.tv_sec - start.tv_sec) +
+            ((double)(stop.tv_nsec - start.tv_nsec) * 1.0e-9));
+}
+
+void test_bench(void)
+{
+    static BENCH bench;
+    double       single;
+    double       batch;
+
+    single = BenchRun(1, &bench);
+    batch  = BenchRun(32, &bench);
+
+    printf("\n  CO_IF_RING_LINE=%d, %u frames through %u slots: single %.1f Mframes/s, batch(32) %.1f Mframes/s\n",
+        CO_IF_RING_LINE, BENCH_FRAMES, BENCH_RING_N,
+        (double)BENCH_FRAMES * 1.0e-6 / single,
+        (double)BENCH_FRAMES * 1.0e-6 / batch);
+}
+
+#endif //TEST_PTHREAD
+
+TEST_LIST = {
+    { "init",       test_init       },
+    { "push_pop",   test_push_pop   },
+    { "wrap",       test_wrap       },
+    { "full",       test_full       },
+    { "peek_skip",  test_peek_skip  },
+    { "drv_read",   test_drv_read   },
+    { "drv_send",   test_drv_send   },
+    { "drv_reject", test_drv_reject },
+#if TEST_PTHREAD
+    { "bench",      test_bench      },
+#endif
+    { NULL, NULL }
+};
@@ -0,0 +1,221 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE    TestNode;
+static CO_IF_FRM  TestRx;
+static CO_IF_FRM  TestCfm;
+static uint16_t   TestDone;
+static uint64_t   TestStamp;
+
+/******************************************************************************
+* TEST CAN DRIVER (stamps each frame with the test time)
+******************************************************************************/
+
+static void    TestCanInit  (void)              { }
+static void    TestCanEnable(uint32_t baudrate) { (void)baudrate; }
+static int16_t TestCanSend  (CO_IF_FRM *frm)    { (void)frm; return ((int16_t)sizeof(CO_IF_FRM)); }
+static void    TestCanReset (void)              { }
+static void    TestCanClose (void)              { }
+
+static int16_t TestCanRead(CO_IF_FRM *frm)
+{
+    *frm = TestRx;
+    CO_SET_STAMP(frm, TestStamp);
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t TestCanTxDone(CO_IF_FRM *frm)
+{
+    if (TestDone == 0) {
+        return (0);
+    }
+    TestDone--;
+    CO_SET_ID(frm, 0x181);
+    CO_SET_DLC(frm, 0);
+    CO_SET_STAMP(frm, TestStamp);
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static const CO_IF_CAN_DRV TestCanDriver = {
+    TestCanInit,
+    TestCanEnable,
+    TestCanRead,
+    TestCanSend,
+    TestCanReset,
+    TestCanClose,
+    NULL,
+    NULL,
+    NULL,
+    TestCanTxDone
+};
+
+static CO_IF_DRV TestDriver = { &TestCanDriver, NULL, NULL };
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TestSetup(void)
+{
+    TestDone         = 0;
+    TestStamp        = 0;
+    TestNode.Error   = CO_ERR_NONE;
+    TestNode.If.Drv  = &TestDriver;
+    TestNode.If.Node = &TestNode;
+    COIfCanInit(&TestNode.If, &TestNode);
+
+    TestNode.Sync.CobId = 0x80;
+    COSyncRestart(&TestNode.Sync);
+}
+
+static void TestSync(uint64_t stamp)
+{
+    CO_IF_FRM frm = { 0 };
+
+    CO_SET_ID(&frm, 0x80);
+    CO_SET_STAMP(&frm, stamp);
+    TEST_CHECK(COSyncUpdate(&TestNode.Sync, &frm) == 0);
+}
+
+/******************************************************************************
+* CALLBACK FUNCTIONS
+******************************************************************************/
+
+void COIfCanTxConfirm(CO_IF_FRM *frm)
+{
+    TestCfm = *frm;
+}
+
+/******************************************************************************
+* TEST CASES - FRAMES
+******************************************************************************/
+
+void test_read(void)
+{
+    CO_IF_FRM frm;
+    int16_t   err;
+
+    TestSetup();
+    CO_SET_ID(&TestRx, 0x201);
+    TestStamp = 0x123456789ull;
+
+    err = COIfCanRead(&TestNode.If, &frm);
+
+    TEST_CHECK(err == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(CO_GET_ID(&frm) == 0x201);
+    TEST_CHECK(CO_GET_STAMP(&frm) == 0x123456789ull);
+}
+
+void test_tx_done(void)
+{
+    int16_t num;
+
+    TestSetup();
+    TestDone  = 1;
+    TestStamp = 4711;
+
+    num = COIfCanTxDone(&TestNode.If);
+
+    TEST_CHECK(num == 1);
+    TEST_CHECK(CO_GET_ID(&TestCfm) == 0x181);
+    TEST_CHECK(CO_GET_STAMP(&TestCfm) == 4711);
+}
+
+void test_rpdo(void)
+{
+    CO_RPDO   pdo = { 0 };
+    CO_IF_FRM frm = { 0 };
+
+    TestSetup();
+    pdo.Node       = &TestNode;
+    pdo.Identifier = 0x201;
+    pdo.Flag       = CO_RPDO_FLG__E;
+    CO_SET_ID(&frm, 0x201);
+    CO_SET_STAMP(&frm, 1000);
+
+    CORPdoRx(&pdo, &frm);
+
+    TEST_CHECK(pdo.Timestamp == 1000);
+}
+
+/******************************************************************************
+* TEST CASES - SYNC STATISTICS
+******************************************************************************/
+
+void test_sync_first(void)
+{
+    TestSetup();
+
+    TestSync(1000);
+
+    TEST_CHECK(TestNode.Sync.Stat.Last == 1000);
+    TEST_CHECK(TestNode.Sync.Stat.Num == 0);
+    TEST_CHECK(COSyncJitter(&TestNode.Sync) == 0);
+}
+
+void test_sync_jitter(void)
+{
+    TestSetup();
+
+    TestSync(1000);
+    TestSync(2000);
+    TestSync(3010);
+    TestSync(3990);
+
+    TEST_CHECK(TestNode.Sync.Stat.Num == 3);
+    TEST_CHECK(TestNode.Sync.Stat.Period == 980);
+    TEST_CHECK(TestNode.Sync.Stat.Min == 980);
+    TEST_CHECK(TestNode.Sync.Stat.Max == 1010);
+    TEST_CHECK(COSyncJitter(&TestNode.Sync) == 30);
+}
+
+void test_sync_restart(void)
+{
+    TestSetup();
+    TestSync(1000);
+    TestSync(2000);
+
+    COSyncRestart(&TestNode.Sync);
+    TEST_CHECK(TestNode.Sync.Stat.Num == 0);
+    TEST_CHECK(COSyncJitter(&TestNode.Sync) == 0);
+
+    TestSync(9000);
+    TestSync(9500);
+    TEST_CHECK(TestNode.Sync.Stat.Num == 1);
+    TEST_CHECK(TestNode.Sync.Stat.Period == 500);
+}
+
+TEST_LIST = {
+    { "read",         test_read         },
+    { "tx_done",      test_tx_done      },
+    { "rpdo",         test_rpdo         },
+    { "sync_first",   test_sync_first   },
+    { "sync_jitter",  test_sync_jitter  },
+    { "sync_restart", test_sync_restart },
+    { NULL, NULL }
+};
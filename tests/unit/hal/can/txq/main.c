@@ -0,0 +1,399 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TEST_TX_N       64
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE    TestNode;
+static CO_IF_FRM  TestTx[TEST_TX_N];
+static uint16_t   TestTxNum;
+static int16_t    TestFree;
+static uint8_t    TestFail;
+static uint16_t   TestDone;
+
+/******************************************************************************
+* TEST CAN DRIVER (records sent frames, limited transmit slots)
+******************************************************************************/
+
+static void    TestCanInit  (void)              { }
+static void    TestCanEnable(uint32_t baudrate) { (void)baudrate; }
+static int16_t TestCanRead  (CO_IF_FRM *frm)    { (void)frm; return (0); }
+static void    TestCanReset (void)              { }
+static void    TestCanClose (void)              { }
+
+static int16_t TestCanSend(CO_IF_FRM *frm)
+{
+    if ((TestFail != 0) || (TestFree == 0) || (TestTxNum >= TEST_TX_N)) {
+        return (-1);
+    }
+    if (TestFree > 0) {
+        TestFree--;
+    }
+    TestTx[TestTxNum] = *frm;
+    TestTxNum++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t TestCanTxFree(void)
+{
+    if (TestFree < 0) {
+        return (CO_IF_CAN_TX_FREE_MAX);
+    }
+    return (TestFree);
+}
+
+static int16_t TestCanTxDone(CO_IF_FRM *frm)
+{
+    if (TestDone == 0) {
+        return (0);
+    }
+    *frm = TestTx[TestTxNum - TestDone];
+    TestDone--;
+    TestFree++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static const CO_IF_CAN_DRV TestCanDriver = {
+    TestCanInit,
+    TestCanEnable,
+    TestCanRead,
+    TestCanSend,
+    TestCanReset,
+    TestCanClose,
+    NULL,
+    NULL,
+    TestCanTxFree,
+    TestCanTxDone
+};
+
+static CO_IF_DRV TestDriver = { &TestCanDriver, NULL, NULL };
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TestSetup(int16_t free)
+{
+    TestTxNum        = 0;
+    TestFree         = free;
+    TestFail         = 0;
+    TestDone         = 0;
+    TestNode.Error   = CO_ERR_NONE;
+    TestNode.If.Drv  = &TestDriver;
+    TestNode.If.Node = &TestNode;
+    COIfCanInit(&TestNode.If, &TestNode);
+}
+
+static int16_t TestSend(uint32_t id, uint8_t seq)
+{
+    CO_IF_FRM frm = { 0 };
+
+    CO_SET_ID(&frm, id);
+    CO_SET_DLC(&frm, 8u);
+    CO_SET_BYTE(&frm, seq, 0);
+    return (COIfCanSend(&TestNode.If, &frm));
+}
+
+static void TestCheckTx(uint16_t n, uint32_t id, uint8_t seq)
+{
+    TEST_CHECK(CO_GET_ID(&TestTx[n]) == id);
+    TEST_MSG("frame %u: id 0x%03x != 0x%03x", n, CO_GET_ID(&TestTx[n]), id);
+    TEST_CHECK(CO_GET_BYTE(&TestTx[n], 0) == seq);
+    TEST_MSG("frame %u: seq %u != %u", n, CO_GET_BYTE(&TestTx[n], 0), seq);
+}
+
+/******************************************************************************
+* TEST CASES - SEND
+******************************************************************************/
+
+void test_bypass(void)
+{
+    int16_t err;
+
+    TestSetup(-1);
+
+    err = TestSend(0x581, 1);
+
+    TEST_CHECK(err == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(TestTxNum == 1);
+    TEST_CHECK(TestNode.If.Txq.Used == 0);
+    TEST_CHECK(TestNode.If.Txq.Stat[CO_TXQ_SDO].Queued == 0);
+}
+
+void test_queue(void)
+{
+    int16_t err;
+
+    TestSetup(0);
+
+    err = TestSend(0x581, 1);
+
+    TEST_CHECK(err == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(TestTxNum == 0);
+    TEST_CHECK(TestNode.If.Txq.Used == 1);
+    TEST_CHECK(TestNode.If.Txq.Num[CO_TXQ_SDO] == 1);
+    TEST_CHECK(TestNode.If.Txq.Stat[CO_TXQ_SDO].Queued == 1);
+    TEST_CHECK(TestNode.If.Txq.Stat[CO_TXQ_SDO].Peak == 1);
+}
+
+void test_behind(void)
+{
+    TestSetup(0);
+    (void)TestSend(0x181, 1);
+    TestFree = -1;
+
+    /* a free driver must not overtake the waiting frame */
+    (void)TestSend(0x581, 2);
+
+    TEST_CHECK(TestTxNum == 2);
+    TestCheckTx(0, 0x181, 1);
+    TestCheckTx(1, 0x581, 2);
+    TEST_CHECK(TestNode.If.Txq.Used == 0);
+}
+
+/******************************************************************************
+* TEST CASES - DRAIN
+******************************************************************************/
+
+void test_arbitration(void)
+{
+    int16_t num;
+
+    TestSetup(0);
+    (void)TestSend(0x581, 1);                 /* SDO response               */
+    (void)TestSend(0x701, 2);                 /* heartbeat                  */
+    (void)TestSend(0x182, 3);                 /* TPDO of node 2             */
+    (void)TestSend(0x181, 4);                 /* TPDO of node 1             */
+    (void)TestSend(0x081, 5);                 /* EMCY                       */
+    (void)TestSend(0x181, 6);                 /* TPDO of node 1 (again)     */
+    TestFree = -1;
+
+    num = COIfCanTxDrain(&TestNode.If);
+
+    TEST_CHECK(num == 6);
+    TEST_CHECK(TestTxNum == 6);
+    TestCheckTx(0, 0x081, 5);
+    TestCheckTx(1, 0x181, 4);
+    TestCheckTx(2, 0x181, 6);
+    TestCheckTx(3, 0x182, 3);
+    TestCheckTx(4, 0x581, 1);
+    TestCheckTx(5, 0x701, 2);
+    TEST_CHECK(TestNode.If.Txq.Used == 0);
+}
+
+void test_sequence(void)
+{
+    uint8_t n;
+
+    TestSetup(0);
+    for (n = 0; n < 10; n++) {
+        (void)TestSend(0x581, n);
+    }
+    TestFree = -1;
+
+    (void)COIfCanTxDrain(&TestNode.If);
+
+    TEST_CHECK(TestTxNum == 10);
+    for (n = 0; n < 10; n++) {
+        TestCheckTx(n, 0x581, n);
+    }
+}
+
+void test_credit(void)
+{
+    int16_t num;
+    uint8_t n;
+
+    TestSetup(0);
+    for (n = 0; n < 8; n++) {
+        (void)TestSend(0x581, n);
+    }
+    TestFree = 3;
+
+    num = COIfCanTxDrain(&TestNode.If);
+    TEST_CHECK(num == 3);
+    TEST_CHECK(TestNode.If.Txq.Used == 5);
+
+    /* the PDO overtakes the remaining SDO segments */
+    (void)TestSend(0x181, 0x80);
+    TestFree = 1;
+
+    num = COIfCanTxDrain(&TestNode.If);
+    TEST_CHECK(num == 1);
+    TestCheckTx(3, 0x181, 0x80);
+}
+
+void test_send_error(void)
+{
+    int16_t num;
+
+    TestSetup(0);
+    (void)TestSend(0x181, 1);
+    TestFree = -1;
+    TestFail = 1;
+
+    num = COIfCanTxDrain(&TestNode.If);
+
+    TEST_CHECK(num == 0);
+    TEST_CHECK(TestNode.If.Txq.Used == 1);
+
+    TestFail = 0;
+    num = COIfCanTxDrain(&TestNode.If);
+
+    TEST_CHECK(num == 1);
+    TestCheckTx(0, 0x181, 1);
+}
+
+/******************************************************************************
+* TEST CASES - OVERFLOW
+******************************************************************************/
+
+void test_evict(void)
+{
+    int16_t err;
+    uint8_t n;
+
+    TestSetup(0);
+    for (n = 0; n < CO_TXQ_N; n++) {
+        (void)TestSend(0x581, n);
+    }
+
+    err = TestSend(0x181, 0x80);
+
+    TEST_CHECK(err == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(TestNode.Error == CO_ERR_IF_CAN_TX_DROP);
+    TEST_CHECK(TestNode.If.Txq.Stat[CO_TXQ_SDO].Drop == 1);
+    TEST_CHECK(TestNode.If.Txq.Stat[CO_TXQ_PDO].Drop == 0);
+    TEST_CHECK(TestNode.If.Txq.Num[CO_TXQ_SDO] == CO_TXQ_N - 1);
+    TEST_CHECK(TestNode.If.Txq.Num[CO_TXQ_PDO] == 1);
+
+    /* the newest SDO segment is dropped, the older keep their order */
+    TestFree = -1;
+    (void)COIfCanTxDrain(&TestNode.If);
+    TEST_CHECK(TestTxNum == CO_TXQ_N);
+    TestCheckTx(0, 0x181, 0x80);
+    for (n = 0; n < CO_TXQ_N - 1; n++) {
+        TestCheckTx((uint16_t)(n + 1), 0x581, n);
+    }
+}
+
+void test_drop(void)
+{
+    int16_t err;
+    uint8_t n;
+
+    TestSetup(0);
+    for (n = 0; n < CO_TXQ_N; n++) {
+        (void)TestSend(0x181, n);
+    }
+
+    err = TestSend(0x581, 0x80);
+
+    TEST_CHECK(err < 0);
+    TEST_CHECK(TestNode.Error == CO_ERR_IF_CAN_TX_DROP);
+    TEST_CHECK(TestNode.If.Txq.Stat[CO_TXQ_SDO].Drop == 1);
+    TEST_CHECK(TestNode.If.Txq.Stat[CO_TXQ_PDO].Drop == 0);
+    TEST_CHECK(TestNode.If.Txq.Stat[CO_TXQ_PDO].Peak == CO_TXQ_N);
+    TEST_CHECK(TestNode.If.Txq.Used == CO_TXQ_N);
+}
+
+void test_tx_free(void)
+{
+    int16_t num;
+
+    TestSetup(2);
+    num = COIfCanTxFree(&TestNode.If);
+    TEST_CHECK(num == 2 + CO_TXQ_N);
+
+    TestFree = 0;
+    (void)TestSend(0x181, 1);
+    num = COIfCanTxFree(&TestNode.If);
+    TEST_CHECK(num == CO_TXQ_N - 1);
+
+    TestFree = -1;
+    num = COIfCanTxFree(&TestNode.If);
+    TEST_CHECK(num == CO_IF_CAN_TX_FREE_MAX);
+}
+
+void test_reset(void)
+{
+    TestSetup(0);
+    (void)TestSend(0x181, 1);
+    (void)TestSend(0x581, 2);
+
+    COIfCanReset(&TestNode.If);
+
+    TEST_CHECK(TestNode.If.Txq.Used == 0);
+    TEST_CHECK(TestNode.If.Txq.Head[CO_TXQ_PDO] == CO_TXQ_END);
+    TEST_CHECK(TestNode.If.Txq.Stat[CO_TXQ_PDO].Queued == 1);
+    TestFree = -1;
+    TEST_CHECK(COIfCanTxDrain(&TestNode.If) == 0);
+    TEST_CHECK(TestTxNum == 0);
+}
+
+void test_tx_done(void)
+{
+    int16_t num;
+
+    TestSetup(1);
+    (void)TestSend(0x181, 1);
+    (void)TestSend(0x182, 2);
+    (void)TestSend(0x183, 3);
+    TEST_CHECK(TestTxNum == 1);
+
+    num = COIfCanTxDone(&TestNode.If);
+    TEST_CHECK(num == 0);
+    TEST_CHECK(TestTxNum == 1);
+
+    TestDone = 1;
+    num = COIfCanTxDone(&TestNode.If);
+    TEST_CHECK(num == 1);
+    TEST_CHECK(TestTxNum == 2);
+    TestCheckTx(1, 0x182, 2);
+    TEST_CHECK(TestNode.If.Txq.Used == 1);
+    TEST_CHECK(TestNode.Error == CO_ERR_NONE);
+}
+
+TEST_LIST = {
+    { "bypass",      test_bypass      },
+    { "queue",       test_queue       },
+    { "behind",      test_behind      },
+    { "arbitration", test_arbitration },
+    { "sequence",    test_sequence    },
+    { "credit",      test_credit      },
+    { "send_error",  test_send_error  },
+    { "evict",       test_evict       },
+    { "drop",        test_drop        },
+    { "tx_free",     test_tx_free     },
+    { "reset",       test_reset       },
+    { "tx_done",     test_tx_done     },
+    { NULL, NULL }
+};
@@ -18,9 +18,74 @@
 * INCLUDES
 ******************************************************************************/
 
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
 #include "co_core.h"
 #include "acutest.h"
 
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BENCH_DOMAIN    (64u * 1024u)
+#define BENCH_LOOPS     100u
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint8_t BenchDom[BENCH_DOMAIN];
+static uint8_t BenchBuf[CO_SDO_BUF_BYTE];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* bytewise copy as reference */
+static void BenchCopyBytewise(uint8_t *dst, uint8_t *src, uint32_t len)
+{
+    while (len > 0) {
+        *dst = *src;
+        src++;
+        dst++;
+        len--;
+    }
+}
+
+/* read the whole domain in chunks; returns throughput in MByte/s */
+static double BenchRead(CO_OBJ *obj, CO_NODE *node, uint32_t chunk, uint8_t ref)
+{
+    CO_OBJ_DOM *dom = (CO_OBJ_DOM *)obj->Data;
+    clock_t     start;
+    double      sec;
+    uint32_t    loop;
+    uint32_t    ofs;
+    uint32_t    len;
+
+    start = clock();
+    for (loop = 0; loop < BENCH_LOOPS; loop++) {
+        (void)COObjRdBufStart(obj, node, BenchBuf, 0);
+        for (ofs = 0; ofs < BENCH_DOMAIN; ofs += chunk) {
+            len = BENCH_DOMAIN - ofs;
+            if (len > chunk) {
+                len = chunk;
+            }
+            if (ref != 0) {
+                BenchCopyBytewise(BenchBuf, &dom->Start[ofs], len);
+            } else {
+                (void)COObjRdBufCont(obj, node, BenchBuf, len);
+            }
+        }
+    }
+    sec = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (sec <= 0.0) {
+        sec = 1.0 / CLOCKS_PER_SEC;
+    }
+    return (((double)BENCH_LOOPS * BENCH_DOMAIN) / (sec * 1.0e6));
+}
+
 /******************************************************************************
 * TEST CASES - SIZE
 ******************************************************************************/
@@ -228,7 +293,6 @@ void test_reset_offset(void)
 {
     CO_NODE    AppNode = { 0 };
     uint8_t    mem[8] = { 0 };
-    uint8_t    var[8] = { 1,2,3,4,5,6,7,8 };
     CO_OBJ_DOM data = { 4, sizeof(mem), (uint8_t *)&mem[0] };
     CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TDOMAIN, (CO_DATA)(&data)};
     CO_ERR     err;
@@ -239,6 +303,102 @@ void test_reset_offset(void)
     TEST_CHECK(data.Offset == 7);
 }
 
+/******************************************************************************
+* TEST CASES - REGION
+******************************************************************************/
+
+void test_region_start(void)
+{
+    CO_NODE    AppNode = { 0 };
+    uint8_t    mem[8] = { 1,2,3,4,5,6,7,8 };
+    CO_OBJ_DOM data = { 4, sizeof(mem), (uint8_t *)&mem[0] };
+    CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TDOMAIN, (CO_DATA)(&data)};
+    uint8_t   *reg;
+    uint32_t   size = 0;
+
+    reg = COObjRegion(&Obj, &AppNode, 0, &size);
+
+    TEST_CHECK(reg == &mem[0]);
+    TEST_CHECK(size == 8);
+    TEST_CHECK(data.Offset == 4);
+}
+
+void test_region_offset(void)
+{
+    CO_NODE    AppNode = { 0 };
+    uint8_t    mem[8] = { 1,2,3,4,5,6,7,8 };
+    CO_OBJ_DOM data = { 0, sizeof(mem), (uint8_t *)&mem[0] };
+    CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TDOMAIN, (CO_DATA)(&data)};
+    uint8_t   *reg;
+    uint32_t   size = 0;
+
+    reg = COObjRegion(&Obj, &AppNode, 5, &size);
+
+    TEST_CHECK(reg == &mem[5]);
+    TEST_CHECK(size == 3);
+    TEST_CHECK(data.Offset == 0);
+}
+
+void test_region_end(void)
+{
+    CO_NODE    AppNode = { 0 };
+    uint8_t    mem[8] = { 1,2,3,4,5,6,7,8 };
+    CO_OBJ_DOM data = { 0, sizeof(mem), (uint8_t *)&mem[0] };
+    CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TDOMAIN, (CO_DATA)(&data)};
+    uint8_t   *reg;
+    uint32_t   size = 1;
+
+    reg = COObjRegion(&Obj, &AppNode, 8, &size);
+
+    TEST_CHECK(reg == NULL);
+    TEST_CHECK(size == 0);
+}
+
+void test_region_none(void)
+{
+    CO_NODE     AppNode = { 0 };
+    char        str[]   = "hello";
+    CO_OBJ_STR  data    = { 0, (uint8_t *)&str[0], 0 };
+    CO_OBJ      Obj     = { CO_KEY(0, 0, CO_OBJ_____R_), CO_TSTRING, (CO_DATA)(&data)};
+    uint8_t    *reg;
+    uint32_t    size = 1;
+
+    reg = COObjRegion(&Obj, &AppNode, 0, &size);
+
+    TEST_CHECK(reg == NULL);
+    TEST_CHECK(size == 0);
+}
+
+/******************************************************************************
+* TEST CASES - BENCHMARK
+******************************************************************************/
+
+void test_bench(void)
+{
+    CO_NODE    AppNode = { 0 };
+    CO_OBJ_DOM data = { 0, sizeof(BenchDom), &BenchDom[0] };
+    CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TDOMAIN, (CO_DATA)(&data)};
+    uint32_t   n;
+
+    for (n = 0; n < BENCH_DOMAIN; n++) {
+        BenchDom[n] = (uint8_t)(n * 7u);
+    }
+
+    /* last chunk of the block transfer contains the end of the domain */
+    (void)BenchRead(&Obj, &AppNode, CO_SDO_BUF_BYTE, 0);
+    n = BENCH_DOMAIN % CO_SDO_BUF_BYTE;
+    TEST_CHECK(data.Offset == BENCH_DOMAIN);
+    TEST_CHECK(memcmp(BenchBuf, &BenchDom[BENCH_DOMAIN - n], n) == 0);
+
+    printf("\n  %u kByte domain: segment (%u byte) bytewise %.1f MB/s, bulk %.1f MB/s"
+           "\n  %u kByte domain: block (%u byte) bytewise %.1f MB/s, bulk %.1f MB/s\n",
+        BENCH_DOMAIN / 1024u, CO_SDO_SEG_DATA,
+        BenchRead(&Obj, &AppNode, CO_SDO_SEG_DATA, 1),
+        BenchRead(&Obj, &AppNode, CO_SDO_SEG_DATA, 0),
+        BENCH_DOMAIN / 1024u, CO_SDO_BUF_BYTE,
+        BenchRead(&Obj, &AppNode, CO_SDO_BUF_BYTE, 1),
+        BenchRead(&Obj, &AppNode, CO_SDO_BUF_BYTE, 0));
+}
 
 TEST_LIST = {
     { "size_unknown",   test_size_unknown   },
@@ -254,5 +414,10 @@ TEST_LIST = {
     { "write_bad_node", test_write_bad_node },
     { "init_offset",    test_init_offset    },
     { "reset_offset",   test_reset_offset   },
+    { "region_start",   test_region_start   },
+    { "region_offset",  test_region_offset  },
+    { "region_end",     test_region_end     },
+    { "region_none",    test_region_none    },
+    { "bench",          test_bench          },
     { NULL, NULL }
 };
@@ -29,7 +29,7 @@ void test_size_unknown(void)
 {
     CO_NODE    AppNode = { 0 };
     uint8_t    mem[8] = { 'a','b','c','d','e','f','g', 0 };
-    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0] };
+    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0], 0 };
     CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTRING, (CO_DATA)(&data)};
     uint32_t   size;
 
@@ -42,7 +42,7 @@ void test_size_known(void)
 {
     CO_NODE    AppNode = { 0 };
     uint8_t    mem[8] = { 'a','b','c','d','e','f','g', 0 };
-    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0] };
+    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0], 0 };
     CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTRING, (CO_DATA)(&data)};
     uint32_t   size;
 
@@ -55,7 +55,7 @@ void test_bad_size(void)
 {
     CO_NODE    AppNode = { 0 };
     uint8_t    mem[8] = { 'a','b','c','d','e','f','g', 0 };
-    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0] };
+    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0], 0 };
     CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTRING, (CO_DATA)(&data)};
     uint32_t   size;
 
@@ -64,6 +64,27 @@ void test_bad_size(void)
     TEST_CHECK(size == 7);
 }
 
+void test_size_cached(void)
+{
+    CO_NODE    AppNode = { 0 };
+    uint8_t    mem[8] = { 'a','b','c','d','e','f','g', 0 };
+    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0], 0 };
+    CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTRING, (CO_DATA)(&data)};
+    uint32_t   size;
+
+    size = COObjGetSize(&Obj, &AppNode, 0);
+    TEST_CHECK(size == 7);
+    TEST_CHECK(data.Len == 7);
+
+    /* changed string length is used after initialization */
+    mem[3] = 0;
+    size = COObjGetSize(&Obj, &AppNode, 0);
+    TEST_CHECK(size == 7);
+    (void)COObjInit(&Obj, &AppNode);
+    size = COObjGetSize(&Obj, &AppNode, 0);
+    TEST_CHECK(size == 3);
+}
+
 /******************************************************************************
 * TEST CASES - READ
 ******************************************************************************/
@@ -73,7 +94,7 @@ void test_read_ref(void)
     CO_NODE    AppNode = { 0 };
     uint8_t    mem[8] = { 'a','b','c','d','e','f','g', 0 };
     uint8_t    var[8] = { 0 };
-    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0] };
+    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0], 0 };
     CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTRING, (CO_DATA)(&data)};
     CO_ERR     err;
 
@@ -85,11 +106,30 @@ void test_read_ref(void)
     }
 }
 
+void test_read_part(void)
+{
+    CO_NODE    AppNode = { 0 };
+    uint8_t    mem[8] = { 'a','b','c','d','e','f','g', 0 };
+    uint8_t    var[8] = { 0 };
+    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0], 0 };
+    CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTRING, (CO_DATA)(&data)};
+    CO_ERR     err;
+
+    err = COObjRdBufStart(&Obj, &AppNode, &var[0], 4);
+    TEST_CHECK(err == CO_ERR_NONE);
+    err = COObjRdBufCont(&Obj, &AppNode, &var[4], 4);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data.Offset == 7);
+    for (int i=0; i<8; i++) {
+        TEST_CHECK(var[i] == mem[i]);
+    }
+}
+
 void test_read_bad_node(void)
 {
     uint8_t    mem[8] = { 'a','b','c','d','e','f','g', 0 };
     uint8_t    var[8] = { 0 };
-    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0] };
+    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0], 0 };
     CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTRING, (CO_DATA)(&data)};
     CO_ERR     err;
 
@@ -110,7 +150,7 @@ void test_write_ref(void)
     CO_NODE    AppNode = { 0 };
     uint8_t    mem[8] = { 0 };
     uint8_t    var[8] = { 'a','b','c','d','e','f','g', 0 };
-    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0] };
+    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0], 0 };
     CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTRING, (CO_DATA)(&data)};
     CO_ERR     err;
 
@@ -126,7 +166,7 @@ void test_write_bad_node(void)
 {
     uint8_t    mem[8] = { 0 };
     uint8_t    var[8] = { 'a','b','c','d','e','f','g', 0 };
-    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0] };
+    CO_OBJ_STR data = { 0, (uint8_t *)&mem[0], 0 };
     CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTRING, (CO_DATA)(&data)};
     CO_ERR     err;
 
@@ -146,7 +186,7 @@ void test_init_offset(void)
 {
     CO_NODE    AppNode = { 0 };
     uint8_t    mem[8] = { 'a','b','c','d','e','f','g', 0 };
-    CO_OBJ_STR data = { 4, (uint8_t *)&mem[0] };
+    CO_OBJ_STR data = { 4, (uint8_t *)&mem[0], 0 };
     CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTRING, (CO_DATA)(&data)};
     CO_ERR     err;
 
@@ -164,7 +204,7 @@ void test_reset_offset(void)
 {
     CO_NODE    AppNode = { 0 };
     uint8_t    mem[8] = { 'a','b','c','d','e','f','g', 0 };
-    CO_OBJ_STR data = { 4, (uint8_t *)&mem[0] };
+    CO_OBJ_STR data = { 4, (uint8_t *)&mem[0], 0 };
     CO_OBJ     Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTRING, (CO_DATA)(&data)};
     CO_ERR     err;
 
@@ -179,7 +219,9 @@ TEST_LIST = {
     { "size_unknown",   test_size_unknown   },
     { "size_known",     test_size_known     },
     { "bad_size",       test_bad_size       },
+    { "size_cached",    test_size_cached    },
     { "read_ref",       test_read_ref       },
+    { "read_part",      test_read_part      },
     { "read_bad_node",  test_read_bad_node  },
     { "write_ref",      test_write_ref      },
     { "write_bad_node", test_write_bad_node },
@@ -32,6 +32,8 @@ void StubReset(void);
 uint32_t StubPdoTrigObj = 0;
 void COTPdoTrigObj(CO_TPDO *tpdo, CO_OBJ *obj)
 {
+    CO_UNUSED(tpdo);
+    CO_UNUSED(obj);
     StubPdoTrigObj++;
 }
 
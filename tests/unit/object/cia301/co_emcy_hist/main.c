@@ -32,6 +32,7 @@ void StubReset(void);
 uint32_t StubHistReset = 0;
 void COEmcyHistReset(CO_EMCY *emcy)
 {
+    CO_UNUSED(emcy);
     StubHistReset++;
 }
 
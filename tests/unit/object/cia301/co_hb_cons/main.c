@@ -29,6 +29,9 @@ CO_ERR StubReturn = CO_ERR_NONE;
 uint32_t StubActivate = 0;
 CO_ERR CONmtHbConsActivate(CO_HBCONS *hbc, uint16_t time, uint8_t nodeid)
 {
+    CO_UNUSED(hbc);
+    CO_UNUSED(time);
+    CO_UNUSED(nodeid);
     StubActivate++;
     return StubReturn;
 }
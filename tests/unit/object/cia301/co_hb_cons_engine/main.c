@@ -0,0 +1,302 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TEST_TMR_N      256
+#define TEST_HBC_N      127
+#define TEST_HB_TIME    50
+
+#if USE_HBC_TABLE
+#define TEST_ENGINE     "table"
+#else
+#define TEST_ENGINE     "timer"
+#endif
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint32_t   TestCounter;
+static CO_TMR_MEM TestMem[TEST_TMR_N];
+static CO_HBCONS  TestHbc[TEST_HBC_N];
+static CO_NODE    TestNode;
+
+/******************************************************************************
+* TEST TIMER DRIVER
+******************************************************************************/
+
+static void     TestTmrInit   (uint32_t freq) { (void)freq; TestCounter = 0; }
+static void     TestTmrStart  (void)          { }
+static uint32_t TestTmrDelay  (void)          { return (TestCounter); }
+static void     TestTmrReload (uint32_t val)  { TestCounter = val; }
+static void     TestTmrStop   (void)          { TestCounter = 0; }
+
+static uint8_t TestTmrUpdate(void)
+{
+    uint8_t result = 0;
+
+    if (TestCounter > 0) {
+        TestCounter--;
+        if (TestCounter == 0) {
+            result = 1;
+        }
+    }
+    return (result);
+}
+
+static const CO_IF_TIMER_DRV TestTmrDriver = {
+    TestTmrInit,
+    TestTmrReload,
+    TestTmrDelay,
+    TestTmrStop,
+    TestTmrStart,
+    TestTmrUpdate
+};
+
+static CO_IF_DRV TestDriver = { NULL, &TestTmrDriver, NULL };
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TestSetup(void)
+{
+    uint16_t n;
+
+    memset(&TestNode, 0, sizeof(TestNode));
+    memset(&TestHbc, 0, sizeof(TestHbc));
+    TestNode.If.Drv = &TestDriver;
+    TestTmrInit(1000);
+    COTmrInit(&TestNode.Tmr, &TestNode, TestMem, TEST_TMR_N, 1000);
+    CONmtInit(&TestNode.Nmt, &TestNode);
+    for (n = 0; n < TEST_HBC_N; n++) {
+        TestHbc[n].Node = &TestNode;
+    }
+}
+
+static void TestRun(uint32_t ms)
+{
+    while (ms > 0) {
+        if (COTmrService(&TestNode.Tmr) > 0) {
+            COTmrProcess(&TestNode.Tmr);
+        }
+        ms--;
+    }
+}
+
+static int16_t TestHbSend(uint8_t nodeId, uint8_t state)
+{
+    CO_IF_FRM frm = { 0 };
+
+    frm.Identifier = 0x700 + nodeId;
+    frm.DLC        = 1;
+    frm.Data[0]    = state;
+    return (CONmtHbConsCheck(&TestNode.Nmt, &frm));
+}
+
+/******************************************************************************
+* TEST CASES - FUNCTION
+******************************************************************************/
+
+void test_wait(void)
+{
+    TestSetup();
+    TEST_CHECK(CONmtHbConsActivate(&TestHbc[0], TEST_HB_TIME, 10) == CO_ERR_NONE);
+
+    TestRun(10 * TEST_HB_TIME);
+
+    TEST_CHECK(CONmtGetHbEvents(&TestNode.Nmt, 10) == 0);
+}
+
+void test_miss(void)
+{
+    TestSetup();
+    TEST_CHECK(CONmtHbConsActivate(&TestHbc[0], TEST_HB_TIME, 10) == CO_ERR_NONE);
+
+    TEST_CHECK(TestHbSend(10, 5) == 10);
+    TestRun(TEST_HB_TIME - 1);
+    TEST_CHECK(CONmtGetHbEvents(&TestNode.Nmt, 10) == 0);
+    TestRun(1 + CO_HBC_SWEEP);
+    TEST_CHECK(CONmtGetHbEvents(&TestNode.Nmt, 10) == 1);
+}
+
+void test_restart(void)
+{
+    uint16_t n;
+
+    TestSetup();
+    TEST_CHECK(CONmtHbConsActivate(&TestHbc[0], TEST_HB_TIME, 10) == CO_ERR_NONE);
+
+    for (n = 0; n < 10; n++) {
+        TEST_CHECK(TestHbSend(10, 5) == 10);
+        TestRun(TEST_HB_TIME - 10);
+    }
+
+    TEST_CHECK(CONmtGetHbEvents(&TestNode.Nmt, 10) == 0);
+}
+
+void test_repeat(void)
+{
+    int16_t events;
+
+    TestSetup();
+    TEST_CHECK(CONmtHbConsActivate(&TestHbc[0], TEST_HB_TIME, 10) == CO_ERR_NONE);
+
+    TEST_CHECK(TestHbSend(10, 5) == 10);
+    TestRun(20 * TEST_HB_TIME);
+
+    events = CONmtGetHbEvents(&TestNode.Nmt, 10);
+    TEST_CHECK((events >= 19) && (events <= 20));
+    TEST_MSG("events: %d", events);
+}
+
+void test_state(void)
+{
+    TestSetup();
+    TEST_CHECK(CONmtHbConsActivate(&TestHbc[0], TEST_HB_TIME, 10) == CO_ERR_NONE);
+
+    TEST_CHECK(CONmtLastHbState(&TestNode.Nmt, 10) == CO_INVALID);
+    TEST_CHECK(TestHbSend(10, 127) == 10);
+    TEST_CHECK(CONmtLastHbState(&TestNode.Nmt, 10) == CO_PREOP);
+    TEST_CHECK(TestHbSend(10, 5) == 10);
+    TEST_CHECK(CONmtLastHbState(&TestNode.Nmt, 10) == CO_OPERATIONAL);
+
+    TEST_CHECK(TestHbSend(11, 5) < 0);
+    TEST_CHECK(CONmtLastHbState(&TestNode.Nmt, 11) == CO_INVALID);
+}
+
+void test_double(void)
+{
+    TestSetup();
+    TEST_CHECK(CONmtHbConsActivate(&TestHbc[0], TEST_HB_TIME, 10) == CO_ERR_NONE);
+
+    TEST_CHECK(CONmtHbConsActivate(&TestHbc[1], TEST_HB_TIME, 10) == CO_ERR_OBJ_INCOMPATIBLE);
+    TEST_CHECK(CONmtHbConsActivate(&TestHbc[1], TEST_HB_TIME, 11) == CO_ERR_NONE);
+    TEST_CHECK(TestHbSend(10, 5) == 10);
+    TEST_CHECK(TestHbSend(11, 5) == 11);
+}
+
+void test_disable(void)
+{
+    TestSetup();
+    TEST_CHECK(CONmtHbConsActivate(&TestHbc[0], TEST_HB_TIME, 10) == CO_ERR_NONE);
+    TEST_CHECK(TestHbSend(10, 5) == 10);
+
+    TEST_CHECK(CONmtHbConsActivate(&TestHbc[0], 0, 10) == CO_ERR_NONE);
+    TEST_CHECK(TestNode.Nmt.HbCons == NULL);
+    TestRun(4 * TEST_HB_TIME);
+
+    TEST_CHECK(TestHbSend(10, 5) < 0);
+    TEST_CHECK(CONmtGetHbEvents(&TestNode.Nmt, 10) < 0);
+    TEST_CHECK(TestNode.Error == CO_ERR_NONE);
+}
+
+void test_many(void)
+{
+    uint32_t ms;
+    uint8_t  id;
+
+    TestSetup();
+    for (id = 1; id <= TEST_HBC_N; id++) {
+        TEST_CHECK(CONmtHbConsActivate(&TestHbc[id - 1], 150, id) == CO_ERR_NONE);
+    }
+
+    /* all nodes send every 100ms (staggered), node 42 stops after 300ms */
+    for (ms = 0; ms < 1000; ms++) {
+        for (id = 1; id <= TEST_HBC_N; id++) {
+            if (((ms % 100) == (id % 100)) && ((id != 42) || (ms < 300))) {
+                TEST_CHECK(TestHbSend(id, 5) == id);
+            }
+        }
+        TestRun(1);
+    }
+
+    for (id = 1; id <= TEST_HBC_N; id++) {
+        if (id == 42) {
+            TEST_CHECK(CONmtGetHbEvents(&TestNode.Nmt, id) > 0);
+        } else {
+            TEST_CHECK(CONmtGetHbEvents(&TestNode.Nmt, id) == 0);
+            TEST_MSG("node: %d", id);
+        }
+    }
+    TEST_CHECK(TestNode.Error == CO_ERR_NONE);
+}
+
+/******************************************************************************
+* TEST CASES - BENCHMARK
+******************************************************************************/
+
+/*
+* Measures the supervision of 127 nodes, which send heartbeats every 100ms.
+* Build with and without USE_HBC_TABLE to compare the consumer engines.
+*/
+void test_bench(void)
+{
+    uint32_t ms;
+    uint32_t num = 0;
+    uint8_t  id;
+    clock_t  start;
+    double   t;
+
+    TestSetup();
+    for (id = 1; id <= TEST_HBC_N; id++) {
+        TEST_CHECK(CONmtHbConsActivate(&TestHbc[id - 1], 150, id) == CO_ERR_NONE);
+    }
+
+    start = clock();
+    for (ms = 0; ms < 60000; ms++) {
+        for (id = 1; id <= TEST_HBC_N; id++) {
+            if ((ms % 100) == (id % 100)) {
+                (void)TestHbSend(id, 5);
+                num++;
+            }
+        }
+        TestRun(1);
+    }
+    t = (double)(clock() - start) / CLOCKS_PER_SEC;
+    TEST_CHECK(TestNode.Error == CO_ERR_NONE);
+
+    printf("\n  %s: %u heartbeats of %u nodes in 60s: %7.1f ns per heartbeat\n",
+        TEST_ENGINE, (unsigned)num, (unsigned)TEST_HBC_N, t * 1.0e9 / num);
+}
+
+TEST_LIST = {
+    { "wait",    test_wait    },
+    { "miss",    test_miss    },
+    { "restart", test_restart },
+    { "repeat",  test_repeat  },
+    { "state",   test_state   },
+    { "double",  test_double  },
+    { "disable", test_disable },
+    { "many",    test_many    },
+    { "bench",   test_bench   },
+    { NULL, NULL }
+};
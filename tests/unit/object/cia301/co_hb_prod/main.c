@@ -32,6 +32,8 @@ void StubReset(void);
 uint32_t StubTmrDelete = 0;
 int16_t COTmrDelete(CO_TMR *tmr, int16_t actId)
 {
+    CO_UNUSED(tmr);
+    CO_UNUSED(actId);
     StubTmrDelete++;
     return (0);
 }
@@ -39,6 +41,11 @@ int16_t COTmrDelete(CO_TMR *tmr, int16_t actId)
 uint32_t StubTmrCreate = 0;
 int16_t COTmrCreate(CO_TMR *tmr, uint32_t startTicks, uint32_t cycleTicks, CO_TMR_FUNC func, void *para)
 {
+    CO_UNUSED(tmr);
+    CO_UNUSED(startTicks);
+    CO_UNUSED(cycleTicks);
+    CO_UNUSED(func);
+    CO_UNUSED(para);
     StubTmrCreate++;
     return (0);
 }
@@ -238,7 +245,6 @@ void test_reset_unused(void)
 {
     CO_NODE  AppNode = { 0 };
     uint16_t data = 0x2233;
-    uint16_t val  = 0;
     CO_ERR   err;
     CO_OBJ   Obj = { CO_KEY(0x1017, 0, CO_OBJ_____RW), CO_THB_PROD, (CO_DATA)(&data)};
 
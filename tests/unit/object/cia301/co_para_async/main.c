@@ -0,0 +1,417 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TEST_TMR_N      16
+#define TEST_NVM_SIZE   256
+#define TEST_PARA_SIZE  (2 * CO_PARA_CHUNK + 8)
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint32_t   TestCounter;
+static CO_TMR_MEM TestMem[TEST_TMR_N];
+static CO_NODE    TestNode;
+static CO_OBJ     TestDict[5];
+static CO_PARA    TestPara[3];
+static uint8_t    TestData[2][TEST_PARA_SIZE];
+static uint8_t    TestNvm[TEST_NVM_SIZE];
+static uint32_t   TestNvmWrites;
+static uint32_t   TestNvmFail;
+static uint32_t   TestDone;
+static CO_ERR     TestDoneErr;
+
+/******************************************************************************
+* TEST TIMER DRIVER
+******************************************************************************/
+
+static void     TestTmrInit   (uint32_t freq) { (void)freq; TestCounter = 0; }
+static void     TestTmrStart  (void)          { }
+static uint32_t TestTmrDelay  (void)          { return (TestCounter); }
+static void     TestTmrReload (uint32_t val)  { TestCounter = val; }
+static void     TestTmrStop   (void)          { TestCounter = 0; }
+
+static uint8_t TestTmrUpdate(void)
+{
+    uint8_t result = 0;
+
+    if (TestCounter > 0) {
+        TestCounter--;
+        if (TestCounter == 0) {
+            result = 1;
+        }
+    }
+    return (result);
+}
+
+static const CO_IF_TIMER_DRV TestTmrDriver = {
+    TestTmrInit,
+    TestTmrReload,
+    TestTmrDelay,
+    TestTmrStop,
+    TestTmrStart,
+    TestTmrUpdate
+};
+
+/******************************************************************************
+* TEST NVM DRIVER
+******************************************************************************/
+
+static void TestNvmInit(void)
+{
+    memset(TestNvm, 0, sizeof(TestNvm));
+    TestNvmWrites = 0;
+    TestNvmFail   = 0;
+}
+
+static uint32_t TestNvmRead(uint32_t start, uint8_t *buffer, uint32_t size)
+{
+    memcpy(buffer, &TestNvm[start], size);
+    return (size);
+}
+
+static uint32_t TestNvmWrite(uint32_t start, uint8_t *buffer, uint32_t size)
+{
+    TestNvmWrites++;
+    if (TestNvmFail != 0) {
+        return (0);
+    }
+    memcpy(&TestNvm[start], buffer, size);
+    return (size);
+}
+
+static const CO_IF_NVM_DRV TestNvmDriver = {
+    TestNvmInit,
+    TestNvmRead,
+    TestNvmWrite
+};
+
+static CO_IF_DRV TestDriver = { NULL, &TestTmrDriver, &TestNvmDriver };
+
+/******************************************************************************
+* TEST CALLBACK
+******************************************************************************/
+
+void COParaStoreDone(CO_PARA *pg, CO_ERR err)
+{
+    (void)pg;
+    TestDone++;
+    TestDoneErr = err;
+}
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TestSetup(void)
+{
+    uint32_t n;
+
+    memset(&TestNode, 0, sizeof(TestNode));
+    memset(&TestPara, 0, sizeof(TestPara));
+    memset(&TestDict, 0, sizeof(TestDict));
+    for (n = 0; n < TEST_PARA_SIZE; n++) {
+        TestData[0][n] = (uint8_t)(n + 1);
+        TestData[1][n] = (uint8_t)(n + 0x81);
+    }
+    TestPara[1].Offset = 0;
+    TestPara[1].Size   = TEST_PARA_SIZE;
+    TestPara[1].Start  = &TestData[0][0];
+    TestPara[1].Value  = CO_PARA___E;
+    TestPara[2].Offset = TEST_PARA_SIZE;
+    TestPara[2].Size   = TEST_PARA_SIZE;
+    TestPara[2].Start  = &TestData[1][0];
+    TestPara[2].Value  = CO_PARA___E;
+    TestPara[0].Value  = CO_PARA___E;
+
+    TestDict[0].Key  = CO_KEY(0x1010, 0, CO_OBJ_D___R_);
+    TestDict[0].Type = CO_TUNSIGNED8;
+    TestDict[0].Data = (CO_DATA)3;
+    for (n = 1; n < 4; n++) {
+        TestDict[n].Key  = CO_KEY(0x1010, n, CO_OBJ_____RW);
+        TestDict[n].Type = CO_TPARA_STORE;
+        TestDict[n].Data = (CO_DATA)(&TestPara[n - 1]);
+    }
+
+    TestNode.If.Drv = &TestDriver;
+    TestTmrInit(1000);
+    TestNvmInit();
+    TestDone    = 0;
+    TestDoneErr = CO_ERR_NONE;
+    COTmrInit(&TestNode.Tmr, &TestNode, TestMem, TEST_TMR_N, 1000);
+    (void)CODictInit(&TestNode.Dict, &TestNode, &TestDict[0], 5);
+    COParaAsyncInit(&TestNode.ParaAsync, &TestNode);
+}
+
+static void TestRun(uint32_t ms)
+{
+    while (ms > 0) {
+        if (COTmrService(&TestNode.Tmr) > 0) {
+            COTmrProcess(&TestNode.Tmr);
+        }
+        ms--;
+    }
+}
+
+static CO_ERR TestStore(uint8_t sub)
+{
+    uint32_t sig = 0x65766173;      /* store signature is ascii: 'save' */
+
+    return (COObjWrValue(&TestDict[sub], &TestNode, &sig, sizeof(sig)));
+}
+
+static uint32_t TestRead(uint8_t sub)
+{
+    uint32_t val = 0;
+
+    (void)COObjRdValue(&TestDict[sub], &TestNode, &val, sizeof(val));
+    return (val);
+}
+
+/******************************************************************************
+* TEST CASES
+******************************************************************************/
+
+void test_start(void)
+{
+    TestSetup();
+
+    TEST_CHECK(TestStore(2) == CO_ERR_NONE);
+    TEST_CHECK(TestNvmWrites == 0);
+    TEST_CHECK(TestNode.ParaAsync.Obj == &TestDict[2]);
+
+    TestRun(10 * CO_PARA_CYCLE);
+
+    TEST_CHECK(TestNode.ParaAsync.Obj == NULL);
+    TEST_CHECK(TestDone == 1);
+    TEST_CHECK(TestDoneErr == CO_ERR_NONE);
+    TEST_CHECK(memcmp(&TestNvm[0], &TestData[0][0], TEST_PARA_SIZE) == 0);
+    TEST_CHECK(TestRead(2) == CO_PARA___E);
+}
+
+void test_snapshot(void)
+{
+    TestSetup();
+
+    TEST_CHECK(TestStore(2) == CO_ERR_NONE);
+    TestRun(CO_PARA_CYCLE);
+    TestData[0][TEST_PARA_SIZE - 1] = 0xAA;
+    TestRun(10 * CO_PARA_CYCLE);
+
+    TEST_CHECK(TestDone == 1);
+    TEST_CHECK(TestNvm[TEST_PARA_SIZE - 1] == (uint8_t)TEST_PARA_SIZE);
+}
+
+void test_chunks(void)
+{
+    TestSetup();
+
+    TEST_CHECK(TestStore(2) == CO_ERR_NONE);
+    TestRun(CO_PARA_CYCLE);
+    TEST_CHECK(TestNvmWrites == 1);
+    TEST_CHECK(TestDone == 0);
+    TestRun(CO_PARA_CYCLE);
+    TEST_CHECK(TestNvmWrites == 2);
+    TestRun(CO_PARA_CYCLE);
+    TEST_CHECK(TestNvmWrites == 3);
+    TestRun(CO_PARA_CYCLE);
+    TEST_CHECK(TestNvmWrites == 3);
+    TEST_CHECK(TestDone == 1);
+}
+
+void test_busy(void)
+{
+    TestSetup();
+
+    TEST_CHECK(TestStore(2) == CO_ERR_NONE);
+    TEST_CHECK(TestRead(2) == (CO_PARA_BUSY | CO_PARA___E));
+    TEST_CHECK(TestRead(3) == CO_PARA___E);
+    TEST_CHECK(TestStore(3) == CO_ERR_OBJ_ACC);
+
+    TestRun(10 * CO_PARA_CYCLE);
+
+    TEST_CHECK(TestRead(2) == CO_PARA___E);
+    TEST_CHECK(TestStore(3) == CO_ERR_NONE);
+}
+
+void test_nvm_err(void)
+{
+    TestSetup();
+
+    TestNvmFail = 1;
+    TEST_CHECK(TestStore(2) == CO_ERR_NONE);
+    TestRun(10 * CO_PARA_CYCLE);
+
+    TEST_CHECK(TestNvmWrites == 1);
+    TEST_CHECK(TestDone == 1);
+    TEST_CHECK(TestDoneErr == CO_ERR_IF_NVM_WRITE);
+    TEST_CHECK(TestRead(2) == (CO_PARA_FAIL | CO_PARA___E));
+
+    TestNvmFail = 0;
+    TEST_CHECK(TestStore(2) == CO_ERR_NONE);
+    TEST_CHECK(TestRead(2) == (CO_PARA_BUSY | CO_PARA___E));
+    TestRun(10 * CO_PARA_CYCLE);
+    TEST_CHECK(TestRead(2) == CO_PARA___E);
+}
+
+void test_all(void)
+{
+    TestSetup();
+
+    TEST_CHECK(TestStore(1) == CO_ERR_NONE);
+    TEST_CHECK(TestRead(2) == (CO_PARA_BUSY | CO_PARA___E));
+    TEST_CHECK(TestRead(3) == (CO_PARA_BUSY | CO_PARA___E));
+    TestRun(20 * CO_PARA_CYCLE);
+
+    TEST_CHECK(TestDone == 1);
+    TEST_CHECK(TestNvmWrites == 6);
+    TEST_CHECK(memcmp(&TestNvm[0], &TestData[0][0], TEST_PARA_SIZE) == 0);
+    TEST_CHECK(memcmp(&TestNvm[TEST_PARA_SIZE], &TestData[1][0], TEST_PARA_SIZE) == 0);
+}
+
+void test_flush(void)
+{
+    TestSetup();
+
+    TEST_CHECK(TestStore(1) == CO_ERR_NONE);
+    COParaAsyncFlush(&TestNode.ParaAsync);
+
+    TEST_CHECK(TestNode.ParaAsync.Obj == NULL);
+    TEST_CHECK(TestDone == 1);
+    TEST_CHECK(memcmp(&TestNvm[0], &TestData[0][0], TEST_PARA_SIZE) == 0);
+    TEST_CHECK(memcmp(&TestNvm[TEST_PARA_SIZE], &TestData[1][0], TEST_PARA_SIZE) == 0);
+
+    TestRun(10 * CO_PARA_CYCLE);
+    TEST_CHECK(TestDone == 1);
+}
+
+void test_pending(void)
+{
+    TestSetup();
+
+    TestNode.Sdo[0].Obj = &TestDict[2];
+    TEST_CHECK(TestStore(2) == CO_ERR_OBJ_PENDING);
+    TEST_CHECK(TestNode.ParaAsync.Sdo == &TestNode.Sdo[0]);
+
+    TestRun(10 * CO_PARA_CYCLE);
+
+    TEST_CHECK(TestNode.ParaAsync.Sdo == NULL);
+    TEST_CHECK(TestDone == 1);
+}
+
+void test_pending_other(void)
+{
+    TestSetup();
+
+    TestNode.Sdo[0].Obj = &TestDict[2];
+    TEST_CHECK(TestStore(2) == CO_ERR_OBJ_PENDING);
+
+    /* SDO server waits for another object access in the meantime */
+    TestNode.Sdo[0].Obj     = &TestDict[3];
+    TestNode.Sdo[0].Pend    = CO_SDO_WR;
+    TestNode.Sdo[0].PendTmr = -1;
+    TestRun(10 * CO_PARA_CYCLE);
+
+    TEST_CHECK(TestDone == 1);
+    TEST_CHECK(TestNode.Sdo[0].Pend == CO_SDO_WR);
+}
+
+void test_dirty(void)
+{
+    static CO_PARA_DIRTY dirty;
+
+    TestSetup();
+    memset(&dirty, 0, sizeof(dirty));
+    dirty.Valid       = 1;
+    TestPara[1].Dirty = &dirty;
+    memset(&TestNvm[0], 0xFF, TEST_PARA_SIZE);
+
+    COParaDirtyMark(&TestPara[1], 0, CO_PARA_CHUNK + 4);
+    COParaDirtyMark(&TestPara[1], TEST_PARA_SIZE - 2, 2);
+    TEST_CHECK(dirty.Num == 2);
+    TEST_CHECK(TestStore(2) == CO_ERR_NONE);
+    TestRun(10 * CO_PARA_CYCLE);
+
+    TEST_CHECK(TestDone == 1);
+    TEST_CHECK(TestNvmWrites == 3);
+    TEST_CHECK(dirty.Num == 0);
+    TEST_CHECK(memcmp(&TestNvm[0], &TestData[0][0], CO_PARA_CHUNK + 4) == 0);
+    TEST_CHECK(TestNvm[CO_PARA_CHUNK + 4] == 0xFF);
+    TEST_CHECK(TestNvm[TEST_PARA_SIZE - 3] == 0xFF);
+    TEST_CHECK(TestNvm[TEST_PARA_SIZE - 2] == TestData[0][TEST_PARA_SIZE - 2]);
+    TEST_CHECK(TestNvm[TEST_PARA_SIZE - 1] == TestData[0][TEST_PARA_SIZE - 1]);
+
+    /* nothing changed: nothing to write */
+    TEST_CHECK(TestStore(2) == CO_ERR_NONE);
+    TestRun(10 * CO_PARA_CYCLE);
+    TEST_CHECK(TestDone == 2);
+    TEST_CHECK(TestNvmWrites == 3);
+}
+
+void test_dirty_err(void)
+{
+    static CO_PARA_DIRTY dirty;
+
+    TestSetup();
+    memset(&dirty, 0, sizeof(dirty));
+    dirty.Valid       = 1;
+    TestPara[1].Dirty = &dirty;
+
+    COParaDirtyMark(&TestPara[1], 4, 1);
+    TestNvmFail = 1;
+    TEST_CHECK(TestStore(2) == CO_ERR_NONE);
+    TestRun(10 * CO_PARA_CYCLE);
+    TEST_CHECK(TestDoneErr == CO_ERR_IF_NVM_WRITE);
+    TEST_CHECK(dirty.Valid == 0);
+
+    /* unknown NVM content: store the whole parameter group */
+    TestNvmFail = 0;
+    TEST_CHECK(TestStore(2) == CO_ERR_NONE);
+    TestRun(10 * CO_PARA_CYCLE);
+    TEST_CHECK(TestDoneErr == CO_ERR_NONE);
+    TEST_CHECK(TestNvmWrites == 4);
+    TEST_CHECK(dirty.Valid == 1);
+    TEST_CHECK(memcmp(&TestNvm[0], &TestData[0][0], TEST_PARA_SIZE) == 0);
+}
+
+TEST_LIST = {
+    { "start",     test_start    },
+    { "snapshot",  test_snapshot },
+    { "chunks",    test_chunks   },
+    { "busy",      test_busy     },
+    { "nvm_err",   test_nvm_err  },
+    { "all",       test_all      },
+    { "flush",     test_flush    },
+    { "pending",   test_pending  },
+    { "pending_other", test_pending_other },
+    { "dirty",     test_dirty    },
+    { "dirty_err", test_dirty_err },
+    { NULL, NULL }
+};
@@ -0,0 +1,329 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TEST_NVM_SIZE   (CO_PARA_LOG_START + (2 * CO_PARA_LOG_BANK))
+#define TEST_PARA_SIZE  64
+#define TEST_KEY_A      0x0000
+#define TEST_KEY_B      0x0100
+#define TEST_UNLIMITED  0xFFFFFFFFu
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE    TestNode;
+static uint8_t    TestNvm[TEST_NVM_SIZE];
+static uint32_t   TestNvmBudget;
+static uint32_t   TestNvmReads;
+static uint32_t   TestNvmReadBytes;
+static uint8_t    TestBuf[TEST_PARA_SIZE];
+
+/******************************************************************************
+* TEST NVM DRIVER
+******************************************************************************/
+
+static void TestNvmInit(void)
+{
+}
+
+static uint32_t TestNvmRead(uint32_t start, uint8_t *buffer, uint32_t size)
+{
+    TestNvmReads++;
+    TestNvmReadBytes += size;
+    if ((start + size) > TEST_NVM_SIZE) {
+        return (0);
+    }
+    memcpy(buffer, &TestNvm[start], size);
+    return (size);
+}
+
+/* simulates a power loss after the write budget is used up */
+static uint32_t TestNvmWrite(uint32_t start, uint8_t *buffer, uint32_t size)
+{
+    uint32_t num = size;
+
+    if ((start + size) > TEST_NVM_SIZE) {
+        return (0);
+    }
+    if (num > TestNvmBudget) {
+        num = TestNvmBudget;
+    }
+    memcpy(&TestNvm[start], buffer, num);
+    if (TestNvmBudget != TEST_UNLIMITED) {
+        TestNvmBudget -= num;
+    }
+    return (num);
+}
+
+static const CO_IF_NVM_DRV TestNvmDriver = {
+    TestNvmInit,
+    TestNvmRead,
+    TestNvmWrite
+};
+
+static CO_IF_DRV TestDriver = { NULL, NULL, &TestNvmDriver };
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void TestBoot(void)
+{
+    memset(&TestNode, 0, sizeof(TestNode));
+    TestNode.If.Drv  = &TestDriver;
+    TestNvmBudget    = TEST_UNLIMITED;
+    TestNvmReads     = 0;
+    TestNvmReadBytes = 0;
+    COParaLogInit(&TestNode.ParaLog, &TestNode);
+}
+
+static void TestSetup(void)
+{
+    memset(TestNvm, 0xFF, sizeof(TestNvm));
+    TestBoot();
+}
+
+static CO_ERR TestWrite(uint32_t key, uint8_t val)
+{
+    memset(TestBuf, val, sizeof(TestBuf));
+    return (COParaLogWrite(&TestNode.ParaLog, key, TestBuf, sizeof(TestBuf)));
+}
+
+static uint8_t TestRead(uint32_t key, CO_ERR *err)
+{
+    uint32_t n;
+
+    memset(TestBuf, 0xEE, sizeof(TestBuf));
+    *err = COParaLogRead(&TestNode.ParaLog, key, TestBuf, sizeof(TestBuf));
+    for (n = 1; n < sizeof(TestBuf); n++) {
+        if (TestBuf[n] != TestBuf[0]) {
+            return (0);
+        }
+    }
+    return (TestBuf[0]);
+}
+
+/******************************************************************************
+* TEST CASES
+******************************************************************************/
+
+void test_empty(void)
+{
+    CO_ERR err;
+
+    TestSetup();
+
+    TEST_CHECK(TestRead(TEST_KEY_A, &err) == 0xEE);
+    TEST_CHECK(err == CO_ERR_NONE);
+}
+
+void test_reboot(void)
+{
+    CO_ERR err;
+
+    TestSetup();
+    TEST_CHECK(TestWrite(TEST_KEY_A, 0x11) == CO_ERR_NONE);
+    TEST_CHECK(TestWrite(TEST_KEY_B, 0x22) == CO_ERR_NONE);
+
+    TestBoot();
+
+    TEST_CHECK(TestRead(TEST_KEY_A, &err) == 0x11);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(TestRead(TEST_KEY_B, &err) == 0x22);
+    TEST_CHECK(err == CO_ERR_NONE);
+}
+
+void test_latest(void)
+{
+    CO_ERR err;
+
+    TestSetup();
+    TEST_CHECK(TestWrite(TEST_KEY_A, 0x11) == CO_ERR_NONE);
+    TEST_CHECK(TestWrite(TEST_KEY_A, 0x12) == CO_ERR_NONE);
+    TEST_CHECK(TestWrite(TEST_KEY_A, 0x13) == CO_ERR_NONE);
+
+    TestBoot();
+
+    TEST_CHECK(TestRead(TEST_KEY_A, &err) == 0x13);
+    TEST_CHECK(err == CO_ERR_NONE);
+}
+
+void test_torn(void)
+{
+    CO_ERR err;
+    uint32_t budget;
+
+    for (budget = 0; budget < TEST_PARA_SIZE + CO_PARA_LOG_HDR; budget += 8) {
+        TestSetup();
+        TEST_CHECK(TestWrite(TEST_KEY_A, 0x11) == CO_ERR_NONE);
+
+        TestNvmBudget = budget;
+        TEST_CHECK(TestWrite(TEST_KEY_A, 0x12) != CO_ERR_NONE);
+
+        TestBoot();
+        TEST_CHECK(TestRead(TEST_KEY_A, &err) == 0x11);
+        TEST_CHECK(err == CO_ERR_NONE);
+        TEST_MSG("power loss after %u bytes", budget);
+
+        /* the log continues behind the last valid record */
+        TEST_CHECK(TestWrite(TEST_KEY_A, 0x13) == CO_ERR_NONE);
+        TestBoot();
+        TEST_CHECK(TestRead(TEST_KEY_A, &err) == 0x13);
+    }
+}
+
+void test_corrupt(void)
+{
+    CO_ERR err;
+    uint32_t addr;
+
+    TestSetup();
+    TEST_CHECK(TestWrite(TEST_KEY_A, 0x11) == CO_ERR_NONE);
+    TEST_CHECK(TestWrite(TEST_KEY_A, 0x12) == CO_ERR_NONE);
+
+    /* flip a data bit of the latest record */
+    addr = TestNode.ParaLog.Grp[0].Addr + CO_PARA_LOG_HDR + 5;
+    TestNvm[addr] ^= 0x04;
+
+    TestBoot();
+    TEST_CHECK(TestRead(TEST_KEY_A, &err) == 0x11);
+    TEST_CHECK(err == CO_ERR_NONE);
+
+    /* corrupted single record: the buffer is not changed */
+    TestSetup();
+    TEST_CHECK(TestWrite(TEST_KEY_A, 0x11) == CO_ERR_NONE);
+    addr = TestNode.ParaLog.Grp[0].Addr + CO_PARA_LOG_HDR;
+    TestNvm[addr] ^= 0x01;
+    TestBoot();
+    TEST_CHECK(TestRead(TEST_KEY_A, &err) == 0xEE);
+    TEST_CHECK(err == CO_ERR_IF_NVM_READ);
+}
+
+void test_swap(void)
+{
+    CO_ERR   err;
+    uint32_t bank;
+    uint8_t  n;
+
+    TestSetup();
+    TEST_CHECK(TestWrite(TEST_KEY_B, 0x22) == CO_ERR_NONE);
+    bank = TestNode.ParaLog.Bank;
+    for (n = 0; n < 40; n++) {
+        TEST_CHECK(TestWrite(TEST_KEY_A, n) == CO_ERR_NONE);
+    }
+    TEST_CHECK(TestNode.ParaLog.Bank != bank);
+
+    TestBoot();
+    TEST_CHECK(TestRead(TEST_KEY_A, &err) == 39);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(TestRead(TEST_KEY_B, &err) == 0x22);
+    TEST_CHECK(err == CO_ERR_NONE);
+}
+
+void test_torn_swap(void)
+{
+    CO_ERR   err;
+    uint32_t budget;
+    uint32_t bank;
+    uint8_t  n;
+
+    for (budget = 0; budget < 3 * (TEST_PARA_SIZE + CO_PARA_LOG_HDR); budget += 24) {
+        TestSetup();
+        TEST_CHECK(TestWrite(TEST_KEY_B, 0x22) == CO_ERR_NONE);
+        bank = TestNode.ParaLog.Bank;
+        n    = 0;
+        while ((TestNode.ParaLog.Tail + TEST_PARA_SIZE + CO_PARA_LOG_HDR) <=
+               (bank + CO_PARA_LOG_BANK)) {
+            TEST_CHECK(TestWrite(TEST_KEY_A, n) == CO_ERR_NONE);
+            n++;
+        }
+
+        /* the next write compacts the log into the other bank */
+        TestNvmBudget = budget;
+        (void)TestWrite(TEST_KEY_A, 0x77);
+
+        TestBoot();
+        TEST_CHECK(TestRead(TEST_KEY_B, &err) == 0x22);
+        TEST_CHECK(err == CO_ERR_NONE);
+        TEST_CHECK((TestRead(TEST_KEY_A, &err) == (uint8_t)(n - 1)) ||
+                   (TestBuf[0] == 0x77));
+        TEST_CHECK(err == CO_ERR_NONE);
+        TEST_MSG("power loss after %u bytes", budget);
+    }
+}
+
+void test_boot_scan(void)
+{
+    uint8_t n;
+
+    TestSetup();
+    for (n = 0; n < 5; n++) {
+        TEST_CHECK(TestWrite(TEST_KEY_A, n) == CO_ERR_NONE);
+    }
+
+    TestBoot();
+
+    /* two bank headers, five record headers and the end of the log */
+    TEST_CHECK(TestNvmReads == 8);
+    TEST_CHECK(TestNvmReadBytes == (8 * CO_PARA_LOG_HDR));
+}
+
+void test_store(void)
+{
+    CO_PARA pg = { 0 };
+    uint8_t data[TEST_PARA_SIZE];
+    CO_ERR  err;
+
+    TestSetup();
+    memset(data, 0x5A, sizeof(data));
+    pg.Offset = TEST_KEY_B;
+    pg.Size   = sizeof(data);
+    pg.Start  = data;
+    pg.Value  = CO_PARA___E;
+
+    TEST_CHECK(COParaStore(&pg, &TestNode) == CO_ERR_NONE);
+
+    TestBoot();
+    TEST_CHECK(TestRead(TEST_KEY_B, &err) == 0x5A);
+    TEST_CHECK(err == CO_ERR_NONE);
+}
+
+TEST_LIST = {
+    { "empty",      test_empty      },
+    { "reboot",     test_reboot     },
+    { "latest",     test_latest     },
+    { "torn",       test_torn       },
+    { "corrupt",    test_corrupt    },
+    { "swap",       test_swap       },
+    { "torn_swap",  test_torn_swap  },
+    { "boot_scan",  test_boot_scan  },
+    { "store",      test_store      },
+    { NULL, NULL }
+};
@@ -32,6 +32,8 @@ void StubReset(void);
 uint32_t StubRestore = 0;
 CO_ERR COParaRestore(struct CO_PARA_T *pg, struct CO_NODE_T *node)
 {
+    CO_UNUSED(pg);
+    CO_UNUSED(node);
     StubRestore++;
     return (CO_ERR_NONE);
 }
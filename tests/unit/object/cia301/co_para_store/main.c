@@ -32,6 +32,8 @@ void StubReset(void);
 uint32_t StubLoad = 0;
 CO_ERR CONodeParaLoad(struct CO_NODE_T *node, enum CO_NMT_RESET_T type)
 {
+    CO_UNUSED(node);
+    CO_UNUSED(type);
     StubLoad++;
     return (CO_ERR_NONE);
 }
@@ -39,6 +41,8 @@ CO_ERR CONodeParaLoad(struct CO_NODE_T *node, enum CO_NMT_RESET_T type)
 uint32_t StubStore = 0;
 CO_ERR COParaStore(struct CO_PARA_T *pg, struct CO_NODE_T *node)
 {
+    CO_UNUSED(pg);
+    CO_UNUSED(node);
     StubStore++;
     return (CO_ERR_NONE);
 }
@@ -32,6 +32,8 @@ void StubReset(void);
 uint32_t StubTmrDelete = 0;
 int16_t COTmrDelete(CO_TMR *tmr, int16_t actId)
 {
+    CO_UNUSED(tmr);
+    CO_UNUSED(actId);
     StubTmrDelete++;
     return (0);
 }
@@ -39,6 +41,11 @@ int16_t COTmrDelete(CO_TMR *tmr, int16_t actId)
 uint32_t StubTmrCreate = 0;
 int16_t COTmrCreate(CO_TMR *tmr, uint32_t startTicks, uint32_t cycleTicks, CO_TMR_FUNC func, void *para)
 {
+    CO_UNUSED(tmr);
+    CO_UNUSED(startTicks);
+    CO_UNUSED(cycleTicks);
+    CO_UNUSED(func);
+    CO_UNUSED(para);
     StubTmrCreate++;
     return (0);
 }
@@ -46,6 +53,8 @@ int16_t COTmrCreate(CO_TMR *tmr, uint32_t startTicks, uint32_t cycleTicks, CO_TM
 uint32_t StubTmrTicks = 0;
 uint32_t COTmrGetTicks(CO_TMR *tmr, uint16_t time, uint32_t unit)
 {
+    CO_UNUSED(tmr);
+    CO_UNUSED(unit);
     StubTmrTicks++;
     return (time);
 }
@@ -151,7 +160,7 @@ void test_write_start(void)
     uint16_t data = 0;
     uint16_t val  = 0x6655;
     CO_ERR   err;
-    CO_OBJ   Obj[1] = { CO_KEY(0x1800, 5, CO_OBJ_____RW), CO_TPDO_EVENT, (CO_DATA)(&data)};
+    CO_OBJ   Obj[1] = { { CO_KEY(0x1800, 5, CO_OBJ_____RW), CO_TPDO_EVENT, (CO_DATA)(&data)} };
     CODictInit(&AppNode.Dict, &AppNode, &Obj[0], 1);
     AppNode.Nmt.Mode = CO_OPERATIONAL;
     AppNode.TPdo[0].EvTmr = -1;
@@ -171,7 +180,7 @@ void test_write_change(void)
     uint16_t data = 0x8877;
     uint16_t val  = 0x6655;
     CO_ERR   err;
-    CO_OBJ   Obj[1] = { CO_KEY(0x1800, 5, CO_OBJ_____RW), CO_TPDO_EVENT, (CO_DATA)(&data)};
+    CO_OBJ   Obj[1] = { { CO_KEY(0x1800, 5, CO_OBJ_____RW), CO_TPDO_EVENT, (CO_DATA)(&data)} };
     CODictInit(&AppNode.Dict, &AppNode, &Obj[0], 1);
     AppNode.Nmt.Mode = CO_OPERATIONAL;
     AppNode.TPdo[0].EvTmr = 1;
@@ -191,7 +200,7 @@ void test_write_stop(void)
     uint16_t data = 0x8877;
     uint16_t val  = 0;
     CO_ERR   err;
-    CO_OBJ   Obj[1] = { CO_KEY(0x1800, 5, CO_OBJ_____RW), CO_TPDO_EVENT, (CO_DATA)(&data)};
+    CO_OBJ   Obj[1] = { { CO_KEY(0x1800, 5, CO_OBJ_____RW), CO_TPDO_EVENT, (CO_DATA)(&data)} };
     CODictInit(&AppNode.Dict, &AppNode, &Obj[0], 1);
     AppNode.Nmt.Mode = CO_OPERATIONAL;
     AppNode.TPdo[0].EvTmr = 1;
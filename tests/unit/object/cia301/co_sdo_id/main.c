@@ -32,12 +32,17 @@ void StubReset(void);
 uint32_t StubSdoReset = 0;
 void COSdoReset(CO_SDO *srv, uint8_t num, CO_NODE *node)
 {
+    CO_UNUSED(srv);
+    CO_UNUSED(num);
+    CO_UNUSED(node);
     StubSdoReset++;
 }
 
 uint32_t StubSdoEnable = 0;
 void COSdoEnable(CO_SDO *srv, uint8_t num)
 {
+    CO_UNUSED(srv);
+    CO_UNUSED(num);
     StubSdoEnable++;
 }
 
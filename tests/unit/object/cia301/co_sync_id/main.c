@@ -32,12 +32,14 @@ void StubReset(void);
 uint32_t StubDeaktivate = 0;
 void COSyncProdDeactivate(CO_SYNC *sync)
 {
+    CO_UNUSED(sync);
     StubDeaktivate++;
 }
 
 uint32_t StubAktivate = 0;
 void COSyncProdActivate(CO_SYNC *sync)
 {
+    CO_UNUSED(sync);
     StubAktivate++;
 }
 